@@ -1,24 +0,0 @@
-/**
- * @file game_sound_0005_22050_8bit.h
- * @brief Embedded sound: game_alert_land (ID 0005)
- * 
- * Auto-generated from /home/drzoid/dev/openfront/ots/ots-fw-audiomodule/sounds/0005.wav
- * Format: 8-bit PCM, 22050 Hz, Mono
- * Size: 44178 bytes
- */
-
-#pragma once
-
-#include <stdint.h>
-#include <stddef.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-extern const uint8_t game_sound_0005_22050_8bit_wav[];
-extern const size_t game_sound_0005_22050_8bit_wav_len;
-
-#ifdef __cplusplus
-}
-#endif
@@ -1,24 +0,0 @@
-/**
- * @file game_sound_10002_22050_8bit.h
- * @brief Embedded sound: test_tone_5s_220hz (ID 10002)
- * 
- * Auto-generated from /home/drzoid/dev/openfront/ots/ots-fw-audiomodule/sounds/10002.wav
- * Format: 8-bit PCM, 22050 Hz, Mono
- * Size: 110328 bytes
- */
-
-#pragma once
-
-#include <stdint.h>
-#include <stddef.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-extern const uint8_t game_sound_10002_22050_8bit_wav[];
-extern const size_t game_sound_10002_22050_8bit_wav_len;
-
-#ifdef __cplusplus
-}
-#endif
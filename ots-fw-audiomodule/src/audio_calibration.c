@@ -0,0 +1,294 @@
+/**
+ * @file audio_calibration.c
+ * @brief I2S DMA depth calibration implementation
+ */
+
+#include "audio_calibration.h"
+#include "audio_mixer.h"
+#include "embedded_sounds.h"
+#include "sound_library.h"
+#include "hardware/i2s.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char *TAG = "AUDIO_CAL";
+
+#define NVS_KEY_DESC_NUM   "dma_desc"
+#define NVS_KEY_FRAME_NUM  "dma_frames"
+#define NVS_KEY_LATENCY    "dma_lat_us"
+
+// A depth passes only if every run is clean
+#define CAL_RUNS_PER_STEP  2
+
+// Voice volume during calibration: quiet, and below 100% so the per-sample
+// volume scaling (the costlier mixer path) runs for every voice
+#define CAL_VOICE_VOLUME   5
+
+// Candidate depths, smallest total first (desc_num, frame_num)
+static const uint16_t s_candidates[][2] = {
+    { 2, 128 }, { 3, 128 }, { 4, 128 }, { 3, 256 },
+    { 4, 256 }, { 6, 256 }, { I2S_DEFAULT_DMA_DESC_NUM, I2S_DEFAULT_DMA_FRAME_NUM },
+};
+#define NUM_CANDIDATES (sizeof(s_candidates) / sizeof(s_candidates[0]))
+
+esp_err_t audio_calibration_load(void)
+{
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(AUDIO_CAL_NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (ret != ESP_OK) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    uint16_t desc_num = 0;
+    uint16_t frame_num = 0;
+    uint32_t latency_us = 0;
+    ret = nvs_get_u16(nvs, NVS_KEY_DESC_NUM, &desc_num);
+    if (ret == ESP_OK) {
+        ret = nvs_get_u16(nvs, NVS_KEY_FRAME_NUM, &frame_num);
+    }
+    if (ret == ESP_OK && nvs_get_u32(nvs, NVS_KEY_LATENCY, &latency_us) != ESP_OK) {
+        latency_us = 0;     // Stored before the latency was: frames only
+    }
+    nvs_close(nvs);
+
+    if (ret != ESP_OK) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    if (latency_us) {
+        // The frame count follows the output rate (see i2s_set_dma_latency)
+        ret = i2s_set_dma_latency(desc_num, latency_us);
+    } else {
+        ESP_LOGW(TAG, "Stored DMA depth has no latency, run 'i2s calibrate' again");
+        ret = i2s_set_dma_config(desc_num, frame_num);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Stored DMA depth %u x %u rejected, using default", desc_num, frame_num);
+        return ret;
+    }
+    ESP_LOGI(TAG, "Using calibrated DMA depth %u x %u frames (%lu us)", desc_num, frame_num,
+             (unsigned long)latency_us);
+    return ESP_OK;
+}
+
+static esp_err_t store_config(uint32_t desc_num, uint32_t frame_num, uint32_t latency_us)
+{
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(AUDIO_CAL_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_set_u16(nvs, NVS_KEY_DESC_NUM, (uint16_t)desc_num);
+    if (ret == ESP_OK) {
+        ret = nvs_set_u16(nvs, NVS_KEY_FRAME_NUM, (uint16_t)frame_num);
+    }
+    if (ret == ESP_OK) {
+        ret = nvs_set_u32(nvs, NVS_KEY_LATENCY, latency_us);
+    }
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+    return ret;
+}
+
+/**
+ * @brief Wait until stopped voices have drained and released their slots
+ */
+static void wait_idle(void)
+{
+    for (int i = 0; i < 200; i++) {
+        bool busy = false;
+        for (audio_source_handle_t h = 0; h < MAX_AUDIO_SOURCES; h++) {
+            if (audio_mixer_get_source_info(h, NULL, 0, NULL, NULL) == ESP_OK) {
+                busy = true;
+            }
+        }
+        if (!busy) {
+            return;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+/**
+ * @brief Set the DMA depth (in frames, or as latency_us if non-zero) once
+ *        stopped voices have drained
+ */
+static esp_err_t set_dma_when_idle(uint32_t desc_num, uint32_t frame_num, uint32_t latency_us)
+{
+    for (int i = 0; i < 200; i++) {
+        esp_err_t ret = latency_us ? audio_mixer_set_dma_latency(desc_num, latency_us)
+                                   : audio_mixer_set_dma_config(desc_num, frame_num);
+        if (ret != ESP_ERR_INVALID_STATE) {
+            return ret;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return ESP_ERR_TIMEOUT;
+}
+
+/**
+ * @brief Fill every source slot with a looping voice
+ *
+ * One SD voice when the library has a sound (file decoding competes for
+ * the CPU and the SPI bus), embedded voices for the rest.
+ */
+static int start_worst_case_mix(void)
+{
+    int voices = 0;
+    audio_source_handle_t handle;
+
+    sound_library_entry_t entry;
+    if (sound_library_get_entry(0, &entry) == ESP_OK) {
+        char path[64];
+        sound_library_entry_path(&entry, path, sizeof(path));
+        if (audio_mixer_create_source_preparsed(path, &entry.wav, CAL_VOICE_VOLUME,
+                                                true, false, &handle) == ESP_OK) {
+            voices++;
+        }
+    }
+
+    for (size_t i = 0; i < g_embedded_sound_count && voices < MAX_AUDIO_SOURCES; i++) {
+        const embedded_sound_t *sound = &g_embedded_sounds[i];
+        if (audio_mixer_create_source_from_memory(embedded_sounds_pcm(sound), sound->wav.data_size,
+                                                  &sound->wav, CAL_VOICE_VOLUME,
+                                                  true, false, &handle) == ESP_OK) {
+            voices++;
+        }
+    }
+    return voices;
+}
+
+/**
+ * @brief Play the worst-case mix for duration_ms at the current DMA depth
+ */
+static void run_step(uint32_t duration_ms, audio_calibration_step_t *step)
+{
+    // Let the voices fill their buffers before measuring
+    wait_idle();
+    step->voices = start_worst_case_mix();
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    // At the rate the voices play at (an idle mixer follows the first one)
+    uint32_t latency_us = i2s_get_output_latency_us();
+    if (step->latency_us == 0 || latency_us < step->latency_us) {
+        step->latency_us = latency_us;
+        step->sample_rate = i2s_get_sample_rate();
+    }
+
+    i2s_stats_t before;
+    i2s_get_stats(&before);
+    uint32_t underruns_before = audio_mixer_get_playback_underruns();
+
+    vTaskDelay(pdMS_TO_TICKS(duration_ms));
+
+    i2s_stats_t after;
+    i2s_get_stats(&after);
+    step->underruns += audio_mixer_get_playback_underruns() - underruns_before;
+    step->late_writes += after.late_writes - before.late_writes;
+
+    audio_mixer_stop_all();
+}
+
+esp_err_t audio_calibration_run(uint32_t step_ms, audio_calibration_result_t *out)
+{
+    if (out == NULL || step_ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!audio_mixer_is_hardware_ready()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->chosen = -1;
+
+    uint32_t old_desc, old_frames;
+    i2s_get_dma_config(&old_desc, &old_frames);
+    audio_mixer_stop_all();
+
+    ESP_LOGI(TAG, "Calibrating I2S DMA depth (%d run(s) of %lu ms per depth)",
+             CAL_RUNS_PER_STEP, (unsigned long)step_ms);
+
+    for (size_t c = 0; c < NUM_CANDIDATES && out->steps < AUDIO_CAL_MAX_STEPS; c++) {
+        audio_calibration_step_t *step = &out->step[out->steps];
+        step->desc_num = s_candidates[c][0];
+        step->frame_num = s_candidates[c][1];
+
+        esp_err_t ret = set_dma_when_idle(step->desc_num, step->frame_num, 0);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "DMA %lu x %lu not applied: %s", (unsigned long)step->desc_num,
+                     (unsigned long)step->frame_num, esp_err_to_name(ret));
+            continue;
+        }
+        out->steps++;
+
+        for (int run = 0; run < CAL_RUNS_PER_STEP; run++) {
+            run_step(step_ms, step);
+            if (step->underruns || step->late_writes) {
+                break;
+            }
+        }
+
+        ESP_LOGI(TAG, "DMA %lu x %lu (%lu us): %d voice(s), %lu underrun(s), %lu late write(s)",
+                 (unsigned long)step->desc_num, (unsigned long)step->frame_num,
+                 (unsigned long)step->latency_us, step->voices,
+                 (unsigned long)step->underruns, (unsigned long)step->late_writes);
+
+        if (step->underruns == 0 && step->late_writes == 0) {
+            out->chosen = out->steps - 1;
+            // One candidate of headroom: a clean run is not a guarantee
+            size_t stored = (c + 1 < NUM_CANDIDATES) ? c + 1 : c;
+            out->desc_num = s_candidates[stored][0];
+            out->latency_us = (uint32_t)((uint64_t)step->latency_us * s_candidates[stored][0] *
+                                         s_candidates[stored][1] / (step->desc_num * step->frame_num));
+            break;
+        }
+    }
+
+    if (out->chosen < 0) {
+        set_dma_when_idle(old_desc, old_frames, 0);
+        ESP_LOGW(TAG, "No DMA depth ran without underruns, keeping %lu x %lu",
+                 (unsigned long)old_desc, (unsigned long)old_frames);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // Held as a latency, so a later rate switch keeps it (more frames at higher rates)
+    esp_err_t ret = set_dma_when_idle(out->desc_num, 0, out->latency_us);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "DMA latency %lu us not applied: %s", (unsigned long)out->latency_us,
+                 esp_err_to_name(ret));
+        return ret;
+    }
+    i2s_get_dma_config(NULL, &out->frame_num);
+    ret = store_config(out->desc_num, out->frame_num, out->latency_us);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "DMA depth not stored: %s", esp_err_to_name(ret));
+    }
+    ESP_LOGI(TAG, "Calibrated DMA depth %lu x %lu frames, output latency %lu.%lu ms",
+             (unsigned long)out->desc_num, (unsigned long)out->frame_num,
+             (unsigned long)(out->latency_us / 1000), (unsigned long)(out->latency_us / 100 % 10));
+    return ESP_OK;
+}
+
+esp_err_t audio_calibration_clear(void)
+{
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(AUDIO_CAL_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret == ESP_OK) {
+        nvs_erase_key(nvs, NVS_KEY_DESC_NUM);
+        nvs_erase_key(nvs, NVS_KEY_FRAME_NUM);
+        nvs_erase_key(nvs, NVS_KEY_LATENCY);
+        ret = nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    audio_mixer_stop_all();
+    return set_dma_when_idle(I2S_DEFAULT_DMA_DESC_NUM, I2S_DEFAULT_DMA_FRAME_NUM, 0);
+}
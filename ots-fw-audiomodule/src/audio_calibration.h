@@ -0,0 +1,82 @@
+/**
+ * @file audio_calibration.h
+ * @brief I2S DMA depth calibration
+ *
+ * The DMA depth (buffers x frames) is the output latency and also how long
+ * the mixer may stall before the codec plays silence. The calibration plays
+ * a worst-case mix (every source slot busy, looping, volume scaling active)
+ * at increasing DMA depths and finds the smallest one without underruns or
+ * late writes. The next larger depth (one step of headroom) is stored in NVS
+ * as a latency and applied at boot before I2S is initialized; the frame
+ * count follows the output rate, so a switch to a higher rate does not
+ * shorten it.
+ */
+
+#ifndef AUDIO_CALIBRATION_H
+#define AUDIO_CALIBRATION_H
+
+#include "esp_err.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_CAL_NVS_NAMESPACE  "audio"
+#define AUDIO_CAL_MAX_STEPS      8
+#define AUDIO_CAL_DEFAULT_STEP_MS 2000
+
+/**
+ * @brief Result of one DMA depth under the worst-case mix
+ */
+typedef struct {
+    uint32_t desc_num;
+    uint32_t frame_num;
+    uint32_t latency_us;     ///< Output latency at sample_rate
+    uint32_t sample_rate;    ///< Output rate while the voices played
+    uint32_t underruns;      ///< I2S underruns while the voices were mixed
+    uint32_t late_writes;    ///< Mixer writes later than the DMA depth
+    int voices;              ///< Voices that were playing
+} audio_calibration_step_t;
+
+/**
+ * @brief Calibration result
+ */
+typedef struct {
+    int steps;                                    ///< Depths tried (smallest first)
+    audio_calibration_step_t step[AUDIO_CAL_MAX_STEPS];
+    int chosen;                                   ///< Smallest clean depth (index into step), -1 if none
+    uint32_t desc_num;                            ///< Stored depth (chosen + one step of headroom)
+    uint32_t frame_num;                           ///< ... at the current rate
+    uint32_t latency_us;                          ///< Stored latency
+} audio_calibration_result_t;
+
+/**
+ * @brief Apply the stored DMA depth (call before i2s_init)
+ * @return ESP_OK if a stored depth was applied, ESP_ERR_NOT_FOUND if none is stored
+ */
+esp_err_t audio_calibration_load(void);
+
+/**
+ * @brief Find the smallest DMA depth without underruns, store one step above it
+ *
+ * Stops all playback. Takes up to two runs of step_ms per depth tried. On
+ * failure the previous depth is restored.
+ *
+ * @param step_ms Duration of each run (ms)
+ * @param out Per-depth results
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if audio output is not running,
+ *         ESP_ERR_NOT_FOUND if no depth passed
+ */
+esp_err_t audio_calibration_run(uint32_t step_ms, audio_calibration_result_t *out);
+
+/**
+ * @brief Forget the stored depth and return to the default
+ */
+esp_err_t audio_calibration_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AUDIO_CALIBRATION_H
@@ -8,13 +8,21 @@
 #include "audio_console.h"
 #include "audio_mixer.h"
 #include "audio_player.h"
+#include "audio_calibration.h"
+#include "audio_dsp.h"
+#include "boot_timeline.h"
+#include "sound_library.h"
+#include "sound_bank.h"
 #include "hardware/sdcard.h"
+#include "hardware/i2s.h"
 
 #include "esp_log.h"
 #include "esp_console.h"
 #include "esp_heap_caps.h"
 #include "esp_psram.h"
 #include "esp_system.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
 #include "linenoise/linenoise.h"
 #include "argtable3/argtable3.h"
 #include <string.h>
@@ -62,6 +70,11 @@ static void print_mixer_status(void)
     ESP_LOGI(TAG, "═══ Mixer Status ═══");
     ESP_LOGI(TAG, "Active sources: %d / %d", active, MAX_AUDIO_SOURCES);
     ESP_LOGI(TAG, "Master volume:  %d%%", volume);
+    
+    audio_mixer_rate_stats_t st;
+    audio_mixer_get_rate_stats(&st);
+    ESP_LOGI(TAG, "Output rate:    %lu Hz (%s)", (unsigned long)st.output_rate,
+             st.auto_rate ? "auto" : "fixed");
 }
 
 static void print_playing_sources(void)
@@ -382,6 +395,500 @@ static int cmd_ls(int argc, char **argv)
     return 0;
 }
 
+// Play a sound by ID (SD index first, then embedded)
+static int cmd_playid(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("Usage: playid <sound_id>\n");
+        return 1;
+    }
+    
+    int id = atoi(argv[1]);
+    if (id < 0 || id > 0xFFFF) {
+        printf("Error: Sound ID must be 0-65535\n");
+        return 1;
+    }
+    
+    audio_source_handle_t handle;
+    esp_err_t ret = audio_player_play_sound((uint16_t)id, 100, false, false, &handle);
+    if (ret == ESP_ERR_NOT_FINISHED) {
+        printf("SD card still mounting, try again shortly\n");
+    }
+    return (ret == ESP_OK) ? 0 : 1;
+}
+
+// SD sound library index
+static int cmd_sounds(int argc, char **argv)
+{
+    if (argc >= 2) {
+        if (strcmp(argv[1], "rescan") == 0) {
+            esp_err_t ret = sound_library_scan();
+            if (ret != ESP_OK) {
+                printf("Error: Scan failed: %s\n", esp_err_to_name(ret));
+                return 1;
+            }
+        } else if (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0) {
+            sound_library_set_enabled(strcmp(argv[1], "on") == 0);
+            return 0;
+        } else {
+            printf("Usage: sounds [rescan|on|off]\n");
+            return 1;
+        }
+    }
+    
+    sound_library_stats_t stats;
+    sound_library_get_stats(&stats);
+    
+    ESP_LOGI(TAG, "═══ SD Sound Library (%s) ═══", SOUND_LIBRARY_DIR);
+    sound_library_entry_t entry;
+    for (size_t i = 0; sound_library_get_entry(i, &entry) == ESP_OK; i++) {
+        printf("  ID %5u: %-12s %5luHz %dch %2dbit %7lu bytes\n",
+               entry.sound_id, entry.name,
+               (unsigned long)entry.wav.sample_rate, entry.wav.num_channels,
+               entry.wav.bits_per_sample, (unsigned long)entry.wav.data_size);
+    }
+    printf("Index: %s, %zu sound(s), %zu skipped, scan %lu ms\n",
+           sound_library_is_enabled() ? "enabled" : "bypassed",
+           stats.entries, stats.skipped, (unsigned long)stats.scan_ms);
+    printf("Lookups: %lu hit(s), %lu miss(es)\n",
+           (unsigned long)stats.hits, (unsigned long)stats.misses);
+    return 0;
+}
+
+// Packed sound bank
+static int cmd_bank(int argc, char **argv)
+{
+    if (argc >= 2) {
+        if (strcmp(argv[1], "reload") != 0) {
+            printf("Usage: bank [reload]\n");
+            return 1;
+        }
+        esp_err_t ret = sound_bank_open(SOUND_BANK_PATH);
+        if (ret != ESP_OK) {
+            printf("Error: Cannot open %s: %s\n", SOUND_BANK_PATH, esp_err_to_name(ret));
+            return 1;
+        }
+    }
+    
+    sound_bank_stats_t stats;
+    sound_bank_get_stats(&stats);
+    if (!stats.open) {
+        printf("No sound bank (%s)\n", SOUND_BANK_PATH);
+        return 0;
+    }
+    
+    ESP_LOGI(TAG, "═══ Sound Bank (%s) ═══", SOUND_BANK_PATH);
+    uint16_t id;
+    wav_info_t wav;
+    for (size_t i = 0; sound_bank_get_entry(i, &id, &wav) == ESP_OK; i++) {
+        printf("  ID %5u: @%-8lu %5luHz %dch %2dbit %7lu bytes\n", id,
+               (unsigned long)wav.data_offset, (unsigned long)wav.sample_rate,
+               wav.num_channels, wav.bits_per_sample, (unsigned long)wav.data_size);
+    }
+    printf("%zu sound(s), %lu bytes, %lu read(s), %llu bytes served\n",
+           stats.entries, (unsigned long)stats.file_size, (unsigned long)stats.reads,
+           (unsigned long long)stats.bytes_read);
+    return 0;
+}
+
+// Concurrent-voice SD throughput: bank vs one file per voice
+static int cmd_bankbench(int argc, char **argv)
+{
+    int voices = (argc >= 2) ? atoi(argv[1]) : 4;
+    uint32_t duration_ms = (argc >= 3) ? (uint32_t)atoi(argv[2]) : 3000;
+    
+    if (audio_mixer_get_active_count() > 0) {
+        printf("Error: Stop playback first (the benchmark saturates the SD bus)\n");
+        return 1;
+    }
+    
+    ESP_LOGI(TAG, "═══ SD Throughput: %d voice(s), %lu ms ═══", voices, (unsigned long)duration_ms);
+    for (int mode = 0; mode < 2; mode++) {
+        bool use_bank = (mode == 1);
+        sound_bank_bench_t r;
+        esp_err_t ret = sound_bank_benchmark(voices, duration_ms, use_bank, &r);
+        if (ret != ESP_OK) {
+            printf("  %-6s: %s\n", use_bank ? "bank" : "files", esp_err_to_name(ret));
+            continue;
+        }
+        printf("  %-6s: %d voice(s) ran, %d could not open, %lu KiB/s total, "
+               "%lu KiB/s per voice, worst chunk %lu us\n",
+               use_bank ? "bank" : "files", r.voices, r.open_failures,
+               (unsigned long)r.kbps, (unsigned long)(r.voices ? r.kbps / r.voices : 0),
+               (unsigned long)r.worst_chunk_us);
+    }
+    printf("A 22050 Hz 8-bit mono voice needs 22 KiB/s, 44100 Hz 16-bit mono 86 KiB/s\n");
+    return 0;
+}
+
+// Play request -> first sample latency
+static int cmd_latency(int argc, char **argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "reset") == 0) {
+        audio_mixer_reset_latency_stats();
+        ESP_LOGI(TAG, "✓ Latency statistics reset");
+        return 0;
+    }
+    
+    static const char *const kind_names[AUDIO_LATENCY_KINDS] = { "SD", "Embedded" };
+    
+    ESP_LOGI(TAG, "═══ Play -> First Sample Latency ═══");
+    for (int k = 0; k < AUDIO_LATENCY_KINDS; k++) {
+        audio_latency_stats_t st;
+        audio_mixer_get_latency_stats((audio_latency_kind_t)k, &st);
+        if (st.count == 0) {
+            printf("  %-8s: no samples\n", kind_names[k]);
+            continue;
+        }
+        printf("  %-8s: n=%lu last=%lu us avg=%lu us min=%lu us max=%lu us\n",
+               kind_names[k], (unsigned long)st.count, (unsigned long)st.last_us,
+               (unsigned long)(st.total_us / st.count),
+               (unsigned long)st.min_us, (unsigned long)st.max_us);
+    }
+    printf("SD index: %s\n", sound_library_is_enabled() ? "enabled" : "bypassed");
+    return 0;
+}
+
+// Mixer output rate and per-voice mixing cost
+static int cmd_rate(int argc, char **argv)
+{
+    if (argc >= 2) {
+        if (strcmp(argv[1], "reset") == 0) {
+            audio_mixer_reset_rate_stats();
+            ESP_LOGI(TAG, "✓ Rate statistics reset");
+            return 0;
+        }
+        uint32_t rate = (strcmp(argv[1], "auto") == 0) ? 0 : (uint32_t)atoi(argv[1]);
+        esp_err_t ret = audio_mixer_set_output_rate(rate);
+        if (ret == ESP_ERR_INVALID_STATE) {
+            printf("Error: Stop playback first (the rate only changes while idle)\n");
+            return 1;
+        }
+        if (ret != ESP_OK) {
+            printf("Error: Rate must be auto or %d-%d Hz\n", MIXER_MIN_SAMPLE_RATE, MIXER_MAX_SAMPLE_RATE);
+            return 1;
+        }
+    }
+    
+    audio_mixer_rate_stats_t st;
+    audio_mixer_get_rate_stats(&st);
+    
+    ESP_LOGI(TAG, "═══ Mixer Output Rate ═══");
+    printf("  Output:   %lu Hz (%s), %lu switch(es)\n", (unsigned long)st.output_rate,
+           st.auto_rate ? "auto" : "fixed", (unsigned long)st.rate_switches);
+    printf("  Voices:   %lu native, %lu resampled\n",
+           (unsigned long)st.native_voices, (unsigned long)st.resampled_voices);
+    
+    // Per voice, each output frame costs the same to mix at any rate, so the
+    // per-second cost scales with the output rate
+    size_t buf_44k = (size_t)SOURCE_BUFFER_SAMPLES * 4;
+    printf("  Memory:   %zu bytes stream buffer per voice (%zu at 44100 Hz)\n",
+           st.voice_buffer_bytes, buf_44k);
+    if (st.voice_frames > 0) {
+        uint64_t ns_per_frame = st.mix_us * 1000 / st.voice_frames;
+        uint64_t us_per_s = ns_per_frame * st.output_rate / 1000;
+        uint64_t us_per_s_44k = ns_per_frame * 44100 / 1000;
+        printf("  Mix CPU:  %llu ns/frame, %llu us/s per voice (%llu.%llu%% of a core), "
+               "%llu us/s at 44100 Hz\n",
+               (unsigned long long)ns_per_frame, (unsigned long long)us_per_s,
+               (unsigned long long)(us_per_s / 10000), (unsigned long long)(us_per_s / 1000 % 10),
+               (unsigned long long)us_per_s_44k);
+        printf("  Mixed:    %llu voice frames in %llu ms\n",
+               (unsigned long long)st.voice_frames, (unsigned long long)(st.window_us / 1000));
+    } else {
+        printf("  Mix CPU:  no voices mixed yet\n");
+    }
+    return 0;
+}
+
+static void print_i2s_status(void)
+{
+    uint32_t desc_num, frame_num;
+    i2s_get_dma_config(&desc_num, &frame_num);
+    uint32_t latency_us = i2s_get_output_latency_us();
+    i2s_stats_t st;
+    i2s_get_stats(&st);
+    
+    ESP_LOGI(TAG, "═══ I2S Output ═══");
+    printf("  DMA:        %lu x %lu frames @ %lu Hz\n", (unsigned long)desc_num,
+           (unsigned long)frame_num, (unsigned long)i2s_get_sample_rate());
+    printf("  Latency:    %lu.%lu ms\n", (unsigned long)(latency_us / 1000),
+           (unsigned long)(latency_us / 100 % 10));
+    printf("  Underruns:  %lu while playing, %lu total (idle ones are silence)\n",
+           (unsigned long)audio_mixer_get_playback_underruns(), (unsigned long)st.underruns);
+    printf("  Writes:     %lu, %lu late, longest gap %lu us\n", (unsigned long)st.writes,
+           (unsigned long)st.late_writes, (unsigned long)st.max_write_gap_us);
+}
+
+// I2S output health and DMA depth calibration
+static int cmd_i2s(int argc, char **argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "reset") == 0) {
+        i2s_reset_stats();
+        ESP_LOGI(TAG, "✓ I2S statistics reset");
+        return 0;
+    }
+    
+    if (argc >= 2 && strcmp(argv[1], "default") == 0) {
+        esp_err_t ret = audio_calibration_clear();
+        if (ret != ESP_OK) {
+            printf("Error: %s\n", esp_err_to_name(ret));
+            return 1;
+        }
+        ESP_LOGI(TAG, "✓ Calibration cleared, default DMA depth restored");
+        print_i2s_status();
+        return 0;
+    }
+    
+    if (argc >= 2 && strcmp(argv[1], "calibrate") == 0) {
+        uint32_t step_ms = (argc >= 3) ? (uint32_t)atoi(argv[2]) : AUDIO_CAL_DEFAULT_STEP_MS;
+        
+        // Static: the result is too large for the console task stack
+        static audio_calibration_result_t result;
+        printf("Calibrating (stops playback, plays a quiet %d-voice mix)...\n", MAX_AUDIO_SOURCES);
+        esp_err_t ret = audio_calibration_run(step_ms, &result);
+        if (ret == ESP_ERR_INVALID_STATE) {
+            printf("Error: Audio output is not running\n");
+            return 1;
+        }
+        for (int i = 0; i < result.steps; i++) {
+            const audio_calibration_step_t *st = &result.step[i];
+            printf("  %c %2lu x %4lu  %3lu.%lu ms @ %5lu Hz  %d voice(s)  %lu underrun(s)  %lu late write(s)\n",
+                   (i == result.chosen) ? '*' : ' ',
+                   (unsigned long)st->desc_num, (unsigned long)st->frame_num,
+                   (unsigned long)(st->latency_us / 1000), (unsigned long)(st->latency_us / 100 % 10),
+                   (unsigned long)st->sample_rate,
+                   st->voices, (unsigned long)st->underruns, (unsigned long)st->late_writes);
+        }
+        if (ret != ESP_OK) {
+            printf("Error: %s\n", esp_err_to_name(ret));
+            return 1;
+        }
+        printf("Stored: %lu.%lu ms (one step above *), %lu x %lu frames now, held at every rate\n",
+               (unsigned long)(result.latency_us / 1000), (unsigned long)(result.latency_us / 100 % 10),
+               (unsigned long)result.desc_num, (unsigned long)result.frame_num);
+        ESP_LOGI(TAG, "✓ DMA depth stored, used from now on and at boot");
+    }
+    
+    print_i2s_status();
+    return 0;
+}
+
+// Cost of the master bus stages as a share of the real-time budget of a block
+static void print_dsp_budget(const char *label, uint64_t cycles, uint32_t blocks, uint32_t max_cycles)
+{
+    uint32_t mhz = esp_rom_get_cpu_ticks_per_us();
+    uint32_t rate = i2s_get_sample_rate();
+    uint64_t budget = (uint64_t)MIXER_BLOCK_FRAMES * mhz * 1000000ULL / rate;  // Cycles per block
+    uint64_t avg = cycles / blocks;
+    printf("  %-9s %llu cycles/block avg (%llu.%02llu/sample), %lu max, "
+           "%llu.%02llu%% of the %llu us block\n",
+           label, (unsigned long long)avg,
+           (unsigned long long)(avg / MIXER_BLOCK_FRAMES),
+           (unsigned long long)(avg * 100 / MIXER_BLOCK_FRAMES % 100),
+           (unsigned long)max_cycles,
+           (unsigned long long)(avg * 100 / budget), (unsigned long long)(avg * 10000 / budget % 100),
+           (unsigned long long)(budget / mhz));
+}
+
+// Synthetic worst case: every sample above the threshold, ducking ramping
+static void run_dsp_bench(uint32_t blocks)
+{
+    // Static: too large for the console task stack
+    static int32_t main_bus[MIXER_BLOCK_FRAMES];
+    static int32_t duck_bus[MIXER_BLOCK_FRAMES];
+    static int16_t out[MIXER_BLOCK_FRAMES];
+    static audio_limiter_t lim;
+    audio_duck_t duck;
+    
+    audio_limiter_init(&lim);
+    audio_duck_init(&duck, AUDIO_DUCK_DEFAULT_PERCENT);
+    
+    uint64_t total = 0;
+    uint32_t worst = 0;
+    for (uint32_t b = 0; b < blocks; b++) {
+        // Four full-scale voices summed: peaks up to 4x full scale
+        for (int j = 0; j < MIXER_BLOCK_FRAMES; j++) {
+            int32_t tri = ((j * 512 + (int32_t)b * 4096) & 0xFFFF) - 32768;
+            main_bus[j] = tri * 3;
+            duck_bus[j] = -tri;
+        }
+        uint32_t start = esp_cpu_get_cycle_count();
+        audio_duck_process(&duck, duck_bus, main_bus, MIXER_BLOCK_FRAMES, (b & 16) != 0);
+        audio_limiter_process(&lim, main_bus, out, MIXER_BLOCK_FRAMES, AUDIO_DSP_UNITY * 8 / 10);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        total += cycles;
+        if (cycles > worst) {
+            worst = cycles;
+        }
+    }
+    
+    ESP_LOGI(TAG, "═══ Master Bus Benchmark (%lu blocks of %d frames) ═══",
+             (unsigned long)blocks, MIXER_BLOCK_FRAMES);
+    print_dsp_budget("Worst:", total, blocks, worst);
+    printf("  Limited %lu of %lu samples, %lu clipped, deepest gain %ld%%\n",
+           (unsigned long)lim.limited_samples, (unsigned long)(blocks * MIXER_BLOCK_FRAMES),
+           (unsigned long)lim.clipped_samples, (long)((int64_t)lim.min_gain * 100 / AUDIO_DSP_UNITY));
+}
+
+// Master bus: ducking, limiter and their CPU cost
+static int cmd_dsp(int argc, char **argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "reset") == 0) {
+        audio_mixer_reset_dsp_stats();
+        ESP_LOGI(TAG, "✓ Master bus statistics reset");
+        return 0;
+    }
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        run_dsp_bench((argc >= 3) ? (uint32_t)atoi(argv[2]) : 1000);
+        return 0;
+    }
+    
+    audio_mixer_dsp_stats_t st;
+    audio_mixer_get_dsp_stats(&st);
+    
+    if (argc >= 3 && strcmp(argv[1], "duck") == 0) {
+        if (strcmp(argv[2], "on") == 0 || strcmp(argv[2], "off") == 0) {
+            audio_mixer_set_ducking(strcmp(argv[2], "on") == 0, st.duck_percent);
+        } else {
+            int percent = atoi(argv[2]);
+            if (percent < 0 || percent > 100) {
+                printf("Error: Duck level must be 0-100\n");
+                return 1;
+            }
+            audio_mixer_set_ducking(true, (uint8_t)percent);
+        }
+        audio_mixer_get_dsp_stats(&st);
+    }
+    
+    ESP_LOGI(TAG, "═══ Master Bus ═══");
+    printf("  Ducking:  %s, loops to %u%% under alerts (now %u%%)\n",
+           st.ducking_enabled ? "on" : "off", st.duck_percent, st.duck_gain_percent);
+    printf("  Limiter:  -1 dBFS, %d sample look-ahead, gain now %u%%, deepest %u%%\n",
+           AUDIO_LIMITER_LOOKAHEAD, st.limiter_gain_percent, st.min_gain_percent);
+    printf("  Limited:  %lu sample(s), %lu clipped\n",
+           (unsigned long)st.limited_samples, (unsigned long)st.clipped_samples);
+    if (st.blocks > 0) {
+        print_dsp_budget("CPU:", st.cycles, st.blocks, st.max_cycles);
+    } else {
+        printf("  CPU:      no blocks mixed yet\n");
+    }
+    return 0;
+}
+
+// Share of a window in tenths of a percent, printed as "x.y%"
+static void print_pct_of(const char *label, uint64_t part_us, uint64_t window_us)
+{
+    uint64_t permille = window_us ? part_us * 1000 / window_us : 0;
+    printf("%s%llu.%llu%%", label, (unsigned long long)(permille / 10), (unsigned long long)(permille % 10));
+}
+
+// Real-time health: mixer pass times, underruns, decoder CPU, memory
+static int cmd_perf(int argc, char **argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "reset") == 0) {
+        audio_mixer_reset_perf();
+        ESP_LOGI(TAG, "✓ Real-time metrics reset");
+        return 0;
+    }
+    
+    audio_mixer_perf_t st;
+    audio_mixer_get_perf(&st);
+    
+    ESP_LOGI(TAG, "═══ Real-Time Metrics (%llu s) ═══", (unsigned long long)(st.window_us / 1000000));
+    if (st.loops > 0) {
+        printf("  Mixer pass: p50 %lu us, p95 %lu us, p99 %lu us, max %lu us (%lu passes, budget %lu us)\n",
+               (unsigned long)st.p50_us, (unsigned long)st.p95_us, (unsigned long)st.p99_us,
+               (unsigned long)st.max_us, (unsigned long)st.loops, (unsigned long)st.budget_us);
+    } else {
+        printf("  Mixer pass: no voices mixed yet (budget %lu us)\n", (unsigned long)st.budget_us);
+    }
+    printf("  Underruns:  %lu I2S while playing, %lu voice starvation(s)\n",
+           (unsigned long)st.playback_underruns, (unsigned long)st.voice_starved);
+    print_pct_of("  Decoders:   convert ", st.decode_convert_us, st.window_us);
+    print_pct_of(" of a core, read ", st.decode_read_us, st.window_us);
+    printf(" (%llu / %llu ms)\n", (unsigned long long)(st.decode_convert_us / 1000),
+           (unsigned long long)(st.decode_read_us / 1000));
+    printf("  Heap:       %u free, %u min, %u largest block\n",
+           (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+           (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+           (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    if (esp_psram_get_size() > 0) {
+        printf("  PSRAM:      %u free, %u min of %u\n",
+               (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+               (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM),
+               (unsigned)heap_caps_get_total_size(MALLOC_CAP_SPIRAM));
+    }
+    return 0;
+}
+
+// Per-voice buffer fill, starvation and decoder time
+static int cmd_voices(int argc, char **argv)
+{
+    static const char *const state_names[] = {
+        "idle", "playing", "paused", "stopping", "draining", "stopped"
+    };
+    
+    ESP_LOGI(TAG, "═══ Voices ═══");
+    int found = 0;
+    for (int i = 0; i < MAX_AUDIO_SOURCES; i++) {
+        audio_voice_perf_t v;
+        if (audio_mixer_get_voice_perf(i, &v) != ESP_OK) {
+            continue;
+        }
+        printf("  [%d] %-20s %-8s vol %3u%%  fill %3u%% (min %3u%%)  starved %lu  ",
+               i, v.name, state_names[v.state], v.volume, v.fill_pct, v.min_fill_pct,
+               (unsigned long)v.starved);
+        print_pct_of("decode ", v.convert_us, (uint64_t)v.age_ms * 1000);
+        print_pct_of(" read ", v.read_us, (uint64_t)v.age_ms * 1000);
+        printf("\n");
+        found++;
+    }
+    if (found == 0) {
+        printf("  No active voices\n");
+    }
+    return 0;
+}
+
+// Time to first sample of the most recent plays
+static int cmd_plays(int argc, char **argv)
+{
+    static const char *const kind_names[AUDIO_LATENCY_KINDS] = { "SD", "embedded" };
+    audio_recent_play_t plays[MIXER_RECENT_PLAYS];
+    int count = audio_mixer_get_recent_plays(plays, MIXER_RECENT_PLAYS);
+    
+    ESP_LOGI(TAG, "═══ Recent Plays (newest first) ═══");
+    for (int i = 0; i < count; i++) {
+        printf("  %-24s %-8s first sample after %6lu us (%lu s ago)\n",
+               plays[i].name, kind_names[plays[i].kind], (unsigned long)plays[i].latency_us,
+               (unsigned long)(plays[i].age_ms / 1000));
+    }
+    if (count == 0) {
+        printf("  No plays tracked yet\n");
+    }
+    return 0;
+}
+
+// Boot stage timestamps
+static int cmd_boot(int argc, char **argv)
+{
+    static const char *const sd_names[] = { "mounting", "ready", "unavailable" };
+    
+    ESP_LOGI(TAG, "═══ Boot Timeline (ms since app start) ═══");
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        int64_t us = boot_timeline_get_us((boot_stage_t)i);
+        if (us > 0) {
+            printf("  %-16s %6lu.%lu ms\n", boot_timeline_stage_name((boot_stage_t)i),
+                   (unsigned long)(us / 1000), (unsigned long)(us / 100 % 10));
+        } else {
+            printf("  %-16s      -\n", boot_timeline_stage_name((boot_stage_t)i));
+        }
+    }
+    printf("  SD card: %s\n", sd_names[audio_player_get_sd_state()]);
+    printf("  (ROM and 2nd-stage bootloader time not included)\n");
+    return 0;
+}
+
 // System status information
 static int cmd_sysinfo(int argc, char **argv)
 {
@@ -507,6 +1014,78 @@ static void register_commands(void)
             .hint = NULL,
             .func = &cmd_ls,
         },
+        {
+            .command = "playid",
+            .help = "Play a sound by ID (SD card first, then embedded)",
+            .hint = "<sound_id>",
+            .func = &cmd_playid,
+        },
+        {
+            .command = "sounds",
+            .help = "List the SD sound index, rescan it, or bypass it (on/off)",
+            .hint = "[rescan|on|off]",
+            .func = &cmd_sounds,
+        },
+        {
+            .command = "bank",
+            .help = "List the packed sound bank (/sdcard/sounds.bank) or reload it",
+            .hint = "[reload]",
+            .func = &cmd_bank,
+        },
+        {
+            .command = "bankbench",
+            .help = "SD throughput with concurrent voices: one file per voice vs sound bank",
+            .hint = "[voices] [ms]",
+            .func = &cmd_bankbench,
+        },
+        {
+            .command = "latency",
+            .help = "Show play request -> first sample latency (SD vs embedded)",
+            .hint = "[reset]",
+            .func = &cmd_latency,
+        },
+        {
+            .command = "rate",
+            .help = "Show or set mixer output rate and per-voice mixing cost",
+            .hint = "[auto|<hz>|reset]",
+            .func = &cmd_rate,
+        },
+        {
+            .command = "i2s",
+            .help = "Show I2S output latency and underruns, or calibrate the DMA depth",
+            .hint = "[calibrate [ms]|default|reset]",
+            .func = &cmd_i2s,
+        },
+        {
+            .command = "perf",
+            .help = "Show real-time metrics: mixer pass percentiles, underruns, decoder CPU, memory",
+            .hint = "[reset]",
+            .func = &cmd_perf,
+        },
+        {
+            .command = "voices",
+            .help = "Show per-voice buffer fill, starvation and decoder time",
+            .hint = NULL,
+            .func = &cmd_voices,
+        },
+        {
+            .command = "plays",
+            .help = "Show time to first sample of the most recent plays",
+            .hint = NULL,
+            .func = &cmd_plays,
+        },
+        {
+            .command = "boot",
+            .help = "Show when each boot stage was reached (CAN, audio, SD, first ACK)",
+            .hint = NULL,
+            .func = &cmd_boot,
+        },
+        {
+            .command = "dsp",
+            .help = "Show master bus ducking/limiter, set ducking, or benchmark the stages",
+            .hint = "[duck on|off|<0-100>|bench [blocks]|reset]",
+            .func = &cmd_dsp,
+        },
         {
             .command = "sysinfo",
             .help = "Show system information",
@@ -3,12 +3,15 @@
  * @brief WAV file decoder task implementation
  * 
  * Handles decoding of WAV audio from both file and memory sources.
- * Converts 8-bit to 16-bit and resamples to 44.1kHz as needed.
+ * Converts 8-bit to 16-bit and resamples to the mixer output rate as needed.
  */
 
 #include "audio_decoder.h"
 #include "wav_utils.h"
+#include "sound_bank.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -19,14 +22,27 @@ static const char *TAG = "DECODER";
 #define CONVERT_BUF_SIZE    1024  // Large enough for resampling expansion
 #define RESAMPLE_BUF_SIZE   1536  // ~3x for max expansion ratio
 
+/**
+ * @brief Add the time since *since to a statistics counter and restart it
+ * 
+ * Only reading and converting are timed, not the wait on a full stream buffer.
+ */
+static inline void account_us(volatile uint32_t *counter, int64_t *since) {
+    int64_t now = esp_timer_get_time();
+    *counter += (uint32_t)(now - *since);
+    *since = now;
+}
+
 /**
  * @brief Convert and resample a chunk of audio data
  * 
- * Takes raw input data (8-bit or 16-bit) and outputs 16-bit 44.1kHz data.
+ * Takes raw input data (8-bit or 16-bit) and outputs 16-bit data at the
+ * mixer output rate.
  * 
  * @param input Raw input data
  * @param input_bytes Number of input bytes
  * @param wav_info Format information (sample rate, bit depth, channels)
+ * @param output_rate Mixer output rate (Hz)
  * @param convert_buf Working buffer for 8→16 bit conversion
  * @param resample_buf Working buffer for resampling
  * @param output Pointer to output buffer (set by function)
@@ -36,6 +52,7 @@ static void convert_audio_chunk(
     const void *input,
     size_t input_bytes,
     const wav_info_t *wav_info,
+    uint32_t output_rate,
     int16_t *convert_buf,
     int16_t *resample_buf,
     int16_t **output,
@@ -59,10 +76,10 @@ static void convert_audio_chunk(
         current_samples = num_samples;
     }
     
-    // Step 2: Resample if needed (any rate → 44.1kHz)
-    if (wav_info->sample_rate != 44100) {
+    // Step 2: Resample if needed (only sources not at the output rate)
+    if (wav_info->sample_rate != output_rate) {
         size_t in_frames = current_samples / wav_info->num_channels;
-        size_t out_frames = (in_frames * 44100) / wav_info->sample_rate;
+        size_t out_frames = (in_frames * output_rate) / wav_info->sample_rate;
         
         // Limit output to buffer size
         size_t max_out_frames = RESAMPLE_BUF_SIZE / wav_info->num_channels;
@@ -72,7 +89,7 @@ static void convert_audio_chunk(
         
         size_t frames_written = wav_resample_linear(
             current_buf, in_frames, wav_info->sample_rate,
-            resample_buf, out_frames, 44100, wav_info->num_channels);
+            resample_buf, out_frames, output_rate, wav_info->num_channels);
         
         *output = resample_buf;
         *output_bytes = frames_written * wav_info->num_channels * sizeof(int16_t);
@@ -110,8 +127,10 @@ static void decode_memory_source(decoder_params_t *params) {
         // Convert and resample
         int16_t *output;
         size_t output_bytes;
-        convert_audio_chunk(data + offset, chunk_bytes, wav,
+        int64_t t = esp_timer_get_time();
+        convert_audio_chunk(data + offset, chunk_bytes, wav, params->output_rate,
                            convert_buf, resample_buf, &output, &output_bytes);
+        account_us(&params->convert_us, &t);
         
         // Send to stream buffer
         if (output_bytes > 0) {
@@ -137,19 +156,26 @@ static void decode_file_source(decoder_params_t *params) {
         return;
     }
     
-    // Parse WAV header
-    if (wav_parse_header(fp, params->wav_info) != ESP_OK) {
+    if (params->wav_preparsed) {
+        // Header known from the sound library index: go straight to the PCM
+        if (fseek(fp, params->wav_info->data_offset, SEEK_SET) != 0) {
+            ESP_LOGE(TAG, "Seek failed: %s", params->filepath);
+            fclose(fp);
+            return;
+        }
+    } else if (wav_parse_header(fp, params->wav_info) != ESP_OK) {
         ESP_LOGE(TAG, "Invalid WAV file: %s", params->filepath);
         fclose(fp);
         return;
     }
     
     wav_info_t *wav = params->wav_info;
-    ESP_LOGI(TAG, "Source %d: %luHz %dch %dbit", 
+    ESP_LOGI(TAG, "Source %d: %luHz %dch %dbit%s", 
              params->slot, 
              (unsigned long)wav->sample_rate, 
              wav->num_channels, 
-             wav->bits_per_sample);
+             wav->bits_per_sample,
+             (wav->sample_rate != params->output_rate) ? " (resampled)" : "");
     
     // Working buffers
     uint8_t read_buf[CHUNK_SAMPLES * 2];  // Max 2 bytes per sample
@@ -158,24 +184,39 @@ static void decode_file_source(decoder_params_t *params) {
     
     size_t bytes_per_sample = wav->bits_per_sample / 8;
     size_t chunk_bytes = CHUNK_SAMPLES * wav->num_channels * bytes_per_sample;
+    if (chunk_bytes > sizeof(read_buf)) {
+        chunk_bytes = sizeof(read_buf);  // 16-bit stereo: 256 frames per read
+    }
+    
+    // Stop at the end of the data chunk (trailing LIST/cue chunks are not audio);
+    // data_size 0 means the writer did not fill it in, read to EOF then
+    size_t remaining = wav->data_size ? wav->data_size : SIZE_MAX;
     
     while (!(*params->stopping)) {
-        size_t bytes_read = fread(read_buf, 1, chunk_bytes, fp);
+        size_t want = (remaining < chunk_bytes) ? remaining : chunk_bytes;
+        int64_t t = esp_timer_get_time();
+        size_t bytes_read = want ? fread(read_buf, 1, want, fp) : 0;
+        account_us(&params->read_us, &t);
         
         if (bytes_read == 0) {
             if (params->loop) {
                 fseek(fp, wav->data_offset, SEEK_SET);
+                remaining = wav->data_size ? wav->data_size : SIZE_MAX;
                 continue;
             }
             *params->eof_reached = true;
             break;
         }
+        if (remaining != SIZE_MAX) {
+            remaining -= bytes_read;
+        }
         
         // Convert and resample
         int16_t *output;
         size_t output_bytes;
-        convert_audio_chunk(read_buf, bytes_read, wav,
+        convert_audio_chunk(read_buf, bytes_read, wav, params->output_rate,
                            convert_buf, resample_buf, &output, &output_bytes);
+        account_us(&params->convert_us, &t);
         
         // Send to stream buffer
         if (output_bytes > 0) {
@@ -186,6 +227,61 @@ static void decode_file_source(decoder_params_t *params) {
     fclose(fp);
 }
 
+/**
+ * @brief Decode audio from the sound bank (offset reads on the shared descriptor)
+ */
+static void decode_bank_source(decoder_params_t *params) {
+    wav_info_t *wav = params->wav_info;
+    
+    // Working buffers
+    uint8_t read_buf[CHUNK_SAMPLES * 2];  // Max 2 bytes per sample
+    int16_t convert_buf[CONVERT_BUF_SIZE];
+    int16_t resample_buf[RESAMPLE_BUF_SIZE];
+    
+    size_t bytes_per_sample = wav->bits_per_sample / 8;
+    size_t chunk_bytes = CHUNK_SAMPLES * wav->num_channels * bytes_per_sample;
+    if (chunk_bytes > sizeof(read_buf)) {
+        chunk_bytes = sizeof(read_buf);  // 16-bit stereo: 256 frames per read
+    }
+    uint32_t pos = 0;
+    
+    while (!(*params->stopping)) {
+        uint32_t left = wav->data_size - pos;
+        if (left == 0) {
+            if (params->loop) {
+                pos = 0;
+                continue;
+            }
+            *params->eof_reached = true;
+            break;
+        }
+        
+        int64_t t = esp_timer_get_time();
+        size_t bytes_read = sound_bank_read(wav->data_offset + pos, read_buf,
+                                            (left < chunk_bytes) ? left : chunk_bytes);
+        account_us(&params->read_us, &t);
+        if (bytes_read == 0) {
+            ESP_LOGE(TAG, "Source %d: bank read failed at %lu", 
+                     params->slot, (unsigned long)(wav->data_offset + pos));
+            *params->eof_reached = true;
+            break;
+        }
+        pos += bytes_read;
+        
+        // Convert and resample
+        int16_t *output;
+        size_t output_bytes;
+        convert_audio_chunk(read_buf, bytes_read, wav, params->output_rate,
+                           convert_buf, resample_buf, &output, &output_bytes);
+        account_us(&params->convert_us, &t);
+        
+        // Send to stream buffer
+        if (output_bytes > 0) {
+            xStreamBufferSend(params->buffer, output, output_bytes, portMAX_DELAY);
+        }
+    }
+}
+
 /**
  * @brief Decoder task entry point
  */
@@ -197,10 +293,16 @@ void audio_decoder_task(void *arg) {
     
     if (params->memory_data != NULL) {
         decode_memory_source(params);
+    } else if (params->from_bank) {
+        decode_bank_source(params);
     } else {
         decode_file_source(params);
     }
     
+    // Also on errors and stop requests: the mixer frees the slot once the
+    // decoder is gone and the buffer is empty
+    *params->eof_reached = true;
+    
     ESP_LOGI(TAG, "Decoder task stopped for source %d", params->slot);
     vTaskDelete(NULL);
 }
@@ -28,12 +28,19 @@ typedef struct {
     bool loop;                         ///< Loop playback
     StreamBufferHandle_t buffer;       ///< Output stream buffer
     volatile bool *stopping;           ///< Stopping flag (set by mixer)
-    volatile bool *eof_reached;        ///< EOF flag (set by decoder)
-    wav_info_t *wav_info;              ///< WAV file info (output)
+    volatile bool *eof_reached;        ///< EOF flag (set by decoder at end of data and on exit)
+    wav_info_t *wav_info;              ///< WAV file info (output, or input if wav_preparsed)
+    bool wav_preparsed;                ///< wav_info already filled: seek to data_offset, skip parsing
+    bool from_bank;                    ///< Read PCM from the sound bank (wav_info offsets are bank offsets)
+    uint32_t output_rate;              ///< Mixer output rate; other source rates are resampled
     
     // Memory source fields
     const uint8_t *memory_data;        ///< Pointer to memory buffer (NULL for file source)
     size_t memory_size;                ///< Size of memory buffer
+    
+    // Statistics (written by the decoder, read by the mixer)
+    volatile uint32_t convert_us;      ///< Time converting/resampling (CPU)
+    volatile uint32_t read_us;         ///< Time reading the source (SD or bank)
 } decoder_params_t;
 
 /**
@@ -0,0 +1,153 @@
+/**
+ * @file audio_dsp.c
+ * @brief Fixed-point master bus processing implementation
+ */
+
+#include "audio_dsp.h"
+#include <string.h>
+
+#define LOOKAHEAD_MASK (AUDIO_LIMITER_LOOKAHEAD - 1)
+
+_Static_assert((AUDIO_LIMITER_LOOKAHEAD & LOOKAHEAD_MASK) == 0,
+               "AUDIO_LIMITER_LOOKAHEAD must be a power of two");
+// Gain is computed with a 32-bit divide
+_Static_assert((uint64_t)AUDIO_LIMITER_THRESHOLD << 16 <= UINT32_MAX,
+               "AUDIO_LIMITER_THRESHOLD too large");
+
+void audio_limiter_init(audio_limiter_t *lim)
+{
+    memset(lim, 0, sizeof(*lim));
+    lim->gain = AUDIO_DSP_UNITY;
+    lim->target = AUDIO_DSP_UNITY;
+    lim->min_gain = AUDIO_DSP_UNITY;
+    lim->peak = AUDIO_LIMITER_THRESHOLD;
+}
+
+void audio_limiter_reset_stats(audio_limiter_t *lim)
+{
+    lim->limited_samples = 0;
+    lim->min_gain = AUDIO_DSP_UNITY;
+    lim->clipped_samples = 0;
+}
+
+void audio_limiter_process(audio_limiter_t *lim, const int32_t *in, int16_t *out,
+                           size_t count, int32_t input_gain)
+{
+    int32_t gain = lim->gain;
+    int32_t target = lim->target;
+    int32_t step = lim->step;
+    uint32_t hold = lim->hold;
+    int32_t peak = lim->peak;
+    uint32_t pos = lim->pos;
+    uint32_t limited = 0;
+    uint32_t clipped = 0;
+    int32_t min_gain = lim->min_gain;
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t x = in[i];
+        if (input_gain != AUDIO_DSP_UNITY) {
+            x = (int32_t)(((int64_t)x * input_gain) >> 16);
+        }
+
+        // Look ahead: the sample entering the delay sets the gain needed
+        // when it leaves, AUDIO_LIMITER_LOOKAHEAD samples from now. Only a
+        // new peak costs a divide
+        int32_t ax = (x < 0) ? -x : x;
+        if (ax > AUDIO_LIMITER_THRESHOLD) {
+            if (ax > peak) {
+                int32_t needed = (int32_t)(((uint32_t)AUDIO_LIMITER_THRESHOLD << 16) / (uint32_t)ax);
+                // Reach it exactly when the peak leaves the delay
+                int32_t new_step = (gain > needed) ? (gain - needed + LOOKAHEAD_MASK) / AUDIO_LIMITER_LOOKAHEAD : 0;
+                // An attack still under way has an earlier deadline: never
+                // slow it down, or the earlier peak leaves above the threshold
+                if (gain <= target || new_step > step) {
+                    step = new_step;
+                }
+                peak = ax;
+                target = needed;
+            }
+            hold = AUDIO_LIMITER_HOLD;
+        }
+
+        int32_t delayed = lim->delay[pos];
+        lim->delay[pos] = x;
+        pos = (pos + 1) & LOOKAHEAD_MASK;
+
+        if (gain > target) {
+            gain -= step;
+            if (gain < target) {
+                gain = target;
+            }
+        } else if (hold > 0) {
+            hold--;
+        } else {
+            target = AUDIO_DSP_UNITY;
+            peak = AUDIO_LIMITER_THRESHOLD;
+            gain += (AUDIO_DSP_UNITY - gain) >> AUDIO_LIMITER_RELEASE_SHIFT;
+            if (gain > AUDIO_DSP_UNITY - (1 << AUDIO_LIMITER_RELEASE_SHIFT)) {
+                gain = AUDIO_DSP_UNITY;  // Shift never closes the last step
+            }
+        }
+
+        int32_t y = delayed;
+        if (gain < AUDIO_DSP_UNITY) {
+            y = (int32_t)(((int64_t)delayed * gain) >> 16);
+            limited++;
+            if (gain < min_gain) {
+                min_gain = gain;
+            }
+        }
+        if (y > 32767) {
+            y = 32767;
+            clipped++;
+        } else if (y < -32768) {
+            y = -32768;
+            clipped++;
+        }
+        out[i] = (int16_t)y;
+    }
+
+    lim->gain = gain;
+    lim->target = target;
+    lim->step = step;
+    lim->hold = hold;
+    lim->peak = peak;
+    lim->pos = pos;
+    lim->limited_samples += limited;
+    lim->clipped_samples += clipped;
+    lim->min_gain = min_gain;
+}
+
+void audio_duck_init(audio_duck_t *duck, uint8_t percent)
+{
+    duck->gain = AUDIO_DSP_UNITY;
+    duck->duck_gain = audio_dsp_percent_to_gain(percent);
+}
+
+void audio_duck_set_level(audio_duck_t *duck, uint8_t percent)
+{
+    duck->duck_gain = audio_dsp_percent_to_gain(percent);
+}
+
+void audio_duck_process(audio_duck_t *duck, const int32_t *duck_bus, int32_t *main_bus,
+                        size_t count, bool ducking)
+{
+    int32_t target = ducking ? duck->duck_gain : AUDIO_DSP_UNITY;
+    int32_t gain = duck->gain;
+
+    // Linear ramps: fast down when an alert starts, slow back up after it
+    const int32_t down = AUDIO_DSP_UNITY / AUDIO_DUCK_ATTACK_SAMPLES;
+    const int32_t up = AUDIO_DSP_UNITY / AUDIO_DUCK_RELEASE_SAMPLES;
+
+    for (size_t i = 0; i < count; i++) {
+        if (gain > target) {
+            gain = (gain - down > target) ? gain - down : target;
+        } else if (gain < target) {
+            gain = (gain + up < target) ? gain + up : target;
+        }
+        int32_t x = duck_bus[i];
+        main_bus[i] += (gain == AUDIO_DSP_UNITY) ? x : (int32_t)(((int64_t)x * gain) >> 16);
+    }
+
+    duck->gain = gain;
+}
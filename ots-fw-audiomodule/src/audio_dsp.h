@@ -0,0 +1,128 @@
+/**
+ * @file audio_dsp.h
+ * @brief Fixed-point master bus processing: look-ahead limiter and ducking
+ *
+ * The mixer sums voices into 32-bit buses instead of saturating 16-bit adds,
+ * then runs them through these block stages:
+ *
+ *   duck bus (looping voices) --[audio_duck_process]--+
+ *                                                     +--> main bus
+ *   alert voices ----------------------------------- -+
+ *   main bus --[audio_limiter_process, master gain]--> int16 output
+ *
+ * The limiter delays the signal by AUDIO_LIMITER_LOOKAHEAD samples and ramps
+ * its gain down over that window before a peak leaves the delay, so peaks
+ * are held under the threshold without the distortion of hard clipping.
+ * Gains are Q16 (65536 = 1.0). No floating point, no allocation; plain C so
+ * the stages can be built and timed on the host.
+ */
+
+#ifndef AUDIO_DSP_H
+#define AUDIO_DSP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUDIO_DSP_UNITY               65536      // Q16 gain 1.0
+
+#define AUDIO_LIMITER_LOOKAHEAD       64         // Samples (2.9 ms at 22050 Hz), power of two
+#define AUDIO_LIMITER_THRESHOLD       29204      // -1 dBFS
+#define AUDIO_LIMITER_HOLD            AUDIO_LIMITER_LOOKAHEAD
+#define AUDIO_LIMITER_RELEASE_SHIFT   11         // Release time constant 2^11 samples (~93 ms at 22050 Hz)
+
+#define AUDIO_DUCK_DEFAULT_PERCENT    30         // Ducked voices at 30% (about -10 dB)
+#define AUDIO_DUCK_ATTACK_SAMPLES     256        // ~12 ms at 22050 Hz
+#define AUDIO_DUCK_RELEASE_SAMPLES    8192       // ~370 ms at 22050 Hz
+
+/**
+ * @brief Look-ahead peak limiter state (mono)
+ */
+typedef struct {
+    int32_t delay[AUDIO_LIMITER_LOOKAHEAD];
+    uint32_t pos;
+    int32_t gain;               // Current gain (Q16)
+    int32_t target;             // Gain the attack ramp heads for (Q16)
+    int32_t step;               // Attack decrement per sample (Q16)
+    int32_t peak;               // Input level target was computed for
+    uint32_t hold;              // Samples before release may start
+    // Statistics (since audio_limiter_reset_stats)
+    uint32_t limited_samples;   // Output samples with gain < 1
+    int32_t min_gain;           // Deepest gain reduction (Q16)
+    uint32_t clipped_samples;   // Output samples still clamped (should stay 0)
+} audio_limiter_t;
+
+/**
+ * @brief Ducking gain for the duck bus
+ */
+typedef struct {
+    int32_t gain;               // Current gain (Q16)
+    int32_t duck_gain;          // Gain while an alert plays (Q16)
+} audio_duck_t;
+
+/**
+ * @brief Reset limiter state and statistics (unity gain, empty delay)
+ */
+void audio_limiter_init(audio_limiter_t *lim);
+
+/**
+ * @brief Reset limiter statistics only
+ */
+void audio_limiter_reset_stats(audio_limiter_t *lim);
+
+/**
+ * @brief Limit one block
+ *
+ * @param lim Limiter state
+ * @param in Mixed bus (any 32-bit level; read only)
+ * @param out Output samples, delayed by AUDIO_LIMITER_LOOKAHEAD
+ * @param count Samples in the block
+ * @param input_gain Gain applied before limiting (Q16, master volume)
+ */
+void audio_limiter_process(audio_limiter_t *lim, const int32_t *in, int16_t *out,
+                           size_t count, int32_t input_gain);
+
+/**
+ * @brief Initialize ducking
+ * @param duck State
+ * @param percent Duck bus level while an alert plays (0-100)
+ */
+void audio_duck_init(audio_duck_t *duck, uint8_t percent);
+
+/**
+ * @brief Change the ducked level (takes effect through the normal ramp)
+ */
+void audio_duck_set_level(audio_duck_t *duck, uint8_t percent);
+
+/**
+ * @brief Ramp the duck bus gain and add the bus into the main bus
+ *
+ * @param duck State
+ * @param duck_bus Ducked voices (read only)
+ * @param main_bus Destination, duck_bus * gain is added
+ * @param count Samples in the block
+ * @param ducking true while a ducking (alert) voice plays
+ */
+void audio_duck_process(audio_duck_t *duck, const int32_t *duck_bus, int32_t *main_bus,
+                        size_t count, bool ducking);
+
+/**
+ * @brief Convert 0-100 to a Q16 gain
+ */
+static inline int32_t audio_dsp_percent_to_gain(uint8_t percent)
+{
+    if (percent > 100) {
+        percent = 100;
+    }
+    return (int32_t)(((uint32_t)percent * AUDIO_DSP_UNITY + 50) / 100);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AUDIO_DSP_H
@@ -1,11 +1,13 @@
 #include "audio_mixer.h"
-#include "audio_volume.h"
+#include "audio_dsp.h"
 #include "audio_decoder.h"
 #include "wav_utils.h"
 #include "hardware/i2s.h"
 #include "can_audio_handler.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/stream_buffer.h"
@@ -15,6 +17,9 @@
 
 static const char *TAG = "MIXER";
 
+// Margin on top of the I2S DMA latency before a drained source is reported
+#define I2S_DRAIN_MARGIN_MS 5
+
 // Audio source structure
 typedef struct {
     bool active;
@@ -22,6 +27,15 @@ typedef struct {
     char filepath[128];
     uint8_t volume;              // 0-100
     bool loop;
+    bool duckable;               // Lowered while an alert plays
+    
+    // Real-time metrics
+    size_t buffer_bytes;         // Stream buffer size
+    uint8_t fill_pct;            // Stream buffer fill after the last pass
+    uint8_t min_fill_pct;        // Lowest fill before EOF, once primed
+    bool fill_primed;            // Buffer was at least half full once
+    uint32_t starved;            // Passes with an empty buffer before EOF
+    int64_t created_us;
     
     // CAN protocol integration
     uint8_t queue_id;            // CAN queue ID (1-255, 0=not set)
@@ -45,6 +59,11 @@ typedef struct {
     bool stopping;
     bool eof_reached;
     TickType_t drain_start_tick; // When draining started (for I2S buffer flush)
+    
+    // Request -> first sample latency (0 = not tracked / not yet reached)
+    int64_t request_us;
+    int64_t first_sample_us;
+    audio_latency_kind_t latency_kind;
 } audio_source_t;
 
 // Global mixer state
@@ -56,8 +75,52 @@ static struct {
     TaskHandle_t mixer_task;
     int16_t *mix_buffer;  // Dynamically allocated stereo mix buffer
     uint8_t master_volume;  // Master volume 0-100
+    audio_latency_stats_t latency[AUDIO_LATENCY_KINDS];
+    
+    // Output rate (changes only while no source is active)
+    uint32_t output_rate;
+    bool auto_rate;
+    bool rate_pending;      // output_rate not yet applied to I2S (mixer task does it)
+    audio_mixer_rate_stats_t rate_stats;
+    int64_t rate_stats_start_us;
+    
+    // I2S DMA depth change (applied by the mixer task while idle)
+    bool dma_pending;
+    uint32_t dma_desc_num;
+    uint32_t dma_frame_num;
+    uint32_t dma_latency_us;        // Non-zero: dma_frame_num follows the rate
+    esp_err_t dma_result;
+    uint32_t drain_ms;              // DMA latency + margin at the output rate
+    uint32_t playback_underruns;    // I2S underruns while sources were mixed
+    
+    // Master bus: ducking of duckable voices, then master volume + limiter
+    bool ducking_enabled;
+    uint8_t duck_percent;
+    audio_duck_t duck;
+    audio_limiter_t limiter;
+    uint32_t dsp_blocks;
+    uint64_t dsp_cycles;
+    uint32_t dsp_max_cycles;
+    
+    // Real-time metrics (mixer pass time histogram, decoder time, recent plays)
+    uint32_t loop_hist[MIXER_LOOP_HIST_BUCKETS];
+    uint32_t loop_max_us;
+    uint32_t voice_starved;
+    uint64_t decode_convert_retired_us;  // Decoder time of slots already reused
+    uint64_t decode_read_retired_us;
+    uint64_t decode_convert_base_us;     // Totals at the last reset
+    uint64_t decode_read_base_us;
+    uint32_t underruns_base;
+    int64_t perf_start_us;
+    audio_recent_play_t recent[MIXER_RECENT_PLAYS];
+    int64_t recent_us[MIXER_RECENT_PLAYS];
+    uint32_t recent_next;
 } g_mixer = {0};
 
+// Mono mix buses (32-bit, so voices sum without clipping before the limiter)
+static int32_t s_main_bus[MIXER_BLOCK_FRAMES];
+static int32_t s_duck_bus[MIXER_BLOCK_FRAMES];
+
 // Forward declarations
 static void mixer_task(void *arg);
 
@@ -75,6 +138,18 @@ esp_err_t audio_mixer_init(void) {
     // Assume hardware is NOT ready (main.c will set this after successful I2S/codec init)
     g_mixer.hardware_ready = false;
     
+    // I2S is initialized before the mixer; start at its rate
+    g_mixer.output_rate = i2s_get_sample_rate();
+    g_mixer.auto_rate = MIXER_DEFAULT_AUTO_RATE;
+    g_mixer.rate_stats_start_us = esp_timer_get_time();
+    g_mixer.perf_start_us = g_mixer.rate_stats_start_us;
+    g_mixer.drain_ms = i2s_get_output_latency_us() / 1000 + I2S_DRAIN_MARGIN_MS;
+    
+    g_mixer.ducking_enabled = MIXER_DEFAULT_DUCKING;
+    g_mixer.duck_percent = AUDIO_DUCK_DEFAULT_PERCENT;
+    audio_duck_init(&g_mixer.duck, g_mixer.duck_percent);
+    audio_limiter_init(&g_mixer.limiter);
+    
     // Allocate mix buffer from heap (use PSRAM if available, fallback to internal RAM)
     g_mixer.mix_buffer = (int16_t *)heap_caps_malloc(SOURCE_BUFFER_SAMPLES * 2 * sizeof(int16_t), 
                                                       MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
@@ -119,7 +194,8 @@ esp_err_t audio_mixer_init(void) {
     
     g_mixer.initialized = true;
     g_mixer.master_volume = 100;  // Default to full volume
-    ESP_LOGI(TAG, "Audio mixer initialized");
+    ESP_LOGI(TAG, "Audio mixer initialized (%lu Hz, %s rate)",
+             (unsigned long)g_mixer.output_rate, g_mixer.auto_rate ? "auto" : "fixed");
     
     return ESP_OK;
 }
@@ -143,6 +219,13 @@ void audio_mixer_set_hardware_ready(bool ready) {
     }
 }
 
+/**
+ * @brief Check whether the mixer is writing to I2S
+ */
+bool audio_mixer_is_hardware_ready(void) {
+    return g_mixer.hardware_ready;
+}
+
 /**
  * @brief Set master volume
  */
@@ -283,6 +366,12 @@ static int find_free_slot(void) {
  */
 static void cleanup_source_slot(audio_source_t *src, int slot) {
     if (!src->active) {
+        // The decoder has exited: keep its time in the totals
+        g_mixer.decode_convert_retired_us += src->decoder_params.convert_us;
+        g_mixer.decode_read_retired_us += src->decoder_params.read_us;
+        src->decoder_params.convert_us = 0;
+        src->decoder_params.read_us = 0;
+        
         // Normal case: source is not active, safe to cleanup
         if (src->buffer) {
             vStreamBufferDelete(src->buffer);
@@ -295,12 +384,61 @@ static void cleanup_source_slot(audio_source_t *src, int slot) {
     }
 }
 
+static bool rate_supported(uint32_t rate) {
+    return rate >= MIXER_MIN_SAMPLE_RATE && rate <= MIXER_MAX_SAMPLE_RATE;
+}
+
+/**
+ * @brief Check whether any slot is in use (playing, stopping or draining)
+ * @note Caller holds the mixer mutex
+ */
+static bool any_source_active(void) {
+    for (int i = 0; i < MAX_AUDIO_SOURCES; i++) {
+        if (g_mixer.sources[i].active) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Pick the output rate for a new source
+ * 
+ * In auto mode an idle mixer switches to the source's own rate so it plays
+ * without resampling; the mixer task reconfigures I2S before mixing it.
+ * 
+ * @param source_rate Source rate, or 0 if not known yet (header not parsed)
+ * @return Output rate the source's decoder must produce
+ * @note Caller holds the mixer mutex; the new slot is not active yet
+ */
+static uint32_t select_output_rate(uint32_t source_rate) {
+    if (g_mixer.auto_rate && source_rate != g_mixer.output_rate &&
+        rate_supported(source_rate) && !any_source_active()) {
+        ESP_LOGI(TAG, "Output rate %lu -> %lu Hz",
+                 (unsigned long)g_mixer.output_rate, (unsigned long)source_rate);
+        g_mixer.output_rate = source_rate;
+        g_mixer.rate_pending = true;
+    }
+    return g_mixer.output_rate;
+}
+
+/**
+ * @brief Stream buffer size per source at the current output rate
+ */
+static size_t source_buffer_bytes(void) {
+    // 16KB at 44.1kHz; same buffered time at other rates
+    size_t bytes = (size_t)SOURCE_BUFFER_SAMPLES * 4 * g_mixer.output_rate / SOURCE_BUFFER_REF_RATE;
+    bytes &= ~(size_t)3;  // Whole stereo frames
+    return (bytes < 4096) ? 4096 : bytes;
+}
+
 /**
  * @brief Create stream buffer for source (tries PSRAM first)
  * @return true on success
  */
 static bool create_source_buffer(audio_source_t *src, int slot) {
-    size_t buffer_size = SOURCE_BUFFER_SAMPLES * 4;  // 16KB buffer
+    size_t buffer_size = source_buffer_bytes();
+    src->buffer_bytes = buffer_size;
     
     src->buffer_storage = (uint8_t *)heap_caps_malloc(
         buffer_size + sizeof(StaticStreamBuffer_t),
@@ -333,9 +471,17 @@ static void init_source_common(audio_source_t *src, int slot,
     strncpy(src->filepath, name, sizeof(src->filepath) - 1);
     src->volume = volume;
     src->loop = loop;
+    src->duckable = loop;
     src->samples_played = 0;
     src->stopping = false;
     src->eof_reached = false;
+    src->request_us = 0;
+    src->first_sample_us = 0;
+    src->fill_pct = 0;
+    src->min_fill_pct = 100;
+    src->fill_primed = false;
+    src->starved = 0;
+    src->created_us = esp_timer_get_time();
     
     // Setup decoder params (common fields)
     src->decoder_params.slot = slot;
@@ -348,11 +494,11 @@ static void init_source_common(audio_source_t *src, int slot,
 }
 
 /**
- * @brief Create a new audio source
+ * @brief Create a file or bank source (wav_info NULL = decoder parses the header)
  */
-esp_err_t audio_mixer_create_source(const char *filepath, uint8_t volume,
-                                     bool loop, bool interrupt,
-                                     audio_source_handle_t *handle) {
+static esp_err_t create_file_source(const char *filepath, const wav_info_t *wav_info,
+                                    bool from_bank, uint8_t volume, bool loop, bool interrupt,
+                                    audio_source_handle_t *handle) {
     if (!g_mixer.initialized) {
         ESP_LOGE(TAG, "Mixer not initialized");
         return ESP_FAIL;
@@ -376,6 +522,9 @@ esp_err_t audio_mixer_create_source(const char *filepath, uint8_t volume,
     audio_source_t *src = &g_mixer.sources[slot];
     cleanup_source_slot(src, slot);
     
+    // Unparsed files (wav_info NULL) play at the current rate
+    uint32_t output_rate = select_output_rate(wav_info ? wav_info->sample_rate : 0);
+    
     if (!create_source_buffer(src, slot)) {
         ESP_LOGE(TAG, "Failed to create stream buffer for source %d", slot);
         xSemaphoreGive(g_mixer.mutex);
@@ -383,17 +532,24 @@ esp_err_t audio_mixer_create_source(const char *filepath, uint8_t volume,
     }
     
     init_source_common(src, slot, filepath, volume, loop);
+    src->decoder_params.output_rate = output_rate;
     
-    // File source specific: decoder will parse wav_info
+    // File source specific: decoder parses wav_info unless the caller has it
     src->decoder_params.memory_data = NULL;
     src->decoder_params.memory_size = 0;
+    src->decoder_params.wav_preparsed = (wav_info != NULL);
+    src->decoder_params.from_bank = from_bank;
+    if (wav_info != NULL) {
+        memcpy(&src->wav_info, wav_info, sizeof(wav_info_t));
+    }
     
-    // Create decoder task
+    // Create decoder task (same stack as memory sources: ~6 KB of
+    // read/convert/resample buffers live on it)
     char task_name[16];
-    snprintf(task_name, sizeof(task_name), "dec_%d", slot);
+    snprintf(task_name, sizeof(task_name), from_bank ? "bankdec_%d" : "dec_%d", slot);
     
     BaseType_t ret = xTaskCreatePinnedToCore(
-        audio_decoder_task, task_name, 4096,
+        audio_decoder_task, task_name, 8192,
         &src->decoder_params, 8, &src->decoder_task, tskNO_AFFINITY);
     
     if (ret != pdPASS) {
@@ -412,6 +568,39 @@ esp_err_t audio_mixer_create_source(const char *filepath, uint8_t volume,
     return ESP_OK;
 }
 
+/**
+ * @brief Create a new audio source
+ */
+esp_err_t audio_mixer_create_source(const char *filepath, uint8_t volume,
+                                     bool loop, bool interrupt,
+                                     audio_source_handle_t *handle) {
+    return create_file_source(filepath, NULL, false, volume, loop, interrupt, handle);
+}
+
+/**
+ * @brief Create an audio source from a file with a known WAV header
+ */
+esp_err_t audio_mixer_create_source_preparsed(const char *filepath, const wav_info_t *wav_info,
+                                               uint8_t volume, bool loop, bool interrupt,
+                                               audio_source_handle_t *handle) {
+    if (wav_info == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return create_file_source(filepath, wav_info, false, volume, loop, interrupt, handle);
+}
+
+/**
+ * @brief Create an audio source from a sound bank entry
+ */
+esp_err_t audio_mixer_create_source_from_bank(const char *name, const wav_info_t *wav_info,
+                                               uint8_t volume, bool loop, bool interrupt,
+                                               audio_source_handle_t *handle) {
+    if (wav_info == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return create_file_source(name, wav_info, true, volume, loop, interrupt, handle);
+}
+
 /**
  * @brief Create an audio source from memory buffer
  */
@@ -447,6 +636,8 @@ esp_err_t audio_mixer_create_source_from_memory(const uint8_t *pcm_data, size_t
     audio_source_t *src = &g_mixer.sources[slot];
     cleanup_source_slot(src, slot);
     
+    uint32_t output_rate = select_output_rate(wav_info ? wav_info->sample_rate : 44100);
+    
     if (!create_source_buffer(src, slot)) {
         ESP_LOGE(TAG, "Failed to create stream buffer for source %d", slot);
         xSemaphoreGive(g_mixer.mutex);
@@ -470,6 +661,9 @@ esp_err_t audio_mixer_create_source_from_memory(const uint8_t *pcm_data, size_t
     
     src->decoder_params.memory_data = pcm_data;
     src->decoder_params.memory_size = pcm_size;
+    src->decoder_params.wav_preparsed = true;
+    src->decoder_params.from_bank = false;
+    src->decoder_params.output_rate = output_rate;
     
     // Create decoder task (larger stack for format conversion)
     char task_name[16];
@@ -607,12 +801,466 @@ bool audio_mixer_is_playing(audio_source_handle_t handle) {
     return playing;
 }
 
+/**
+ * @brief Fold a source's request -> first sample time into the stats
+ * @note Caller holds the mixer mutex
+ */
+static void record_latency(audio_source_t *src) {
+    if (src->request_us == 0 || src->first_sample_us == 0) {
+        return;
+    }
+    
+    int64_t delta = src->first_sample_us - src->request_us;
+    uint32_t us = (delta < 0) ? 0 : (uint32_t)delta;
+    audio_latency_stats_t *st = &g_mixer.latency[src->latency_kind];
+    
+    st->last_us = us;
+    if (st->count == 0 || us < st->min_us) st->min_us = us;
+    if (us > st->max_us) st->max_us = us;
+    st->total_us += us;
+    st->count++;
+    src->request_us = 0;  // Count once
+    
+    audio_recent_play_t *recent = &g_mixer.recent[g_mixer.recent_next % MIXER_RECENT_PLAYS];
+    const char *slash = strrchr(src->filepath, '/');
+    strlcpy(recent->name, slash ? slash + 1 : src->filepath, sizeof(recent->name));
+    recent->kind = src->latency_kind;
+    recent->latency_us = us;
+    g_mixer.recent_us[g_mixer.recent_next % MIXER_RECENT_PLAYS] = src->first_sample_us;
+    g_mixer.recent_next++;
+    
+    ESP_LOGD(TAG, "Source %d: first sample %lu us after request", 
+             (int)(src - g_mixer.sources), (unsigned long)us);
+}
+
+/**
+ * @brief Track request -> first sample latency of a source
+ */
+void audio_mixer_track_latency(audio_source_handle_t handle, int64_t request_us,
+                               audio_latency_kind_t kind) {
+    if (handle < 0 || handle >= MAX_AUDIO_SOURCES || kind >= AUDIO_LATENCY_KINDS) {
+        return;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    audio_source_t *src = &g_mixer.sources[handle];
+    if (src->active) {
+        src->request_us = request_us;
+        src->latency_kind = kind;
+        // The mixer may already have pulled the first chunk
+        record_latency(src);
+    }
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Get request -> first sample latency statistics
+ */
+void audio_mixer_get_latency_stats(audio_latency_kind_t kind, audio_latency_stats_t *out) {
+    if (out == NULL || kind >= AUDIO_LATENCY_KINDS) {
+        return;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    *out = g_mixer.latency[kind];
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Reset latency statistics
+ */
+void audio_mixer_reset_latency_stats(void) {
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    memset(g_mixer.latency, 0, sizeof(g_mixer.latency));
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Decoder time of all voices since boot
+ * @note Caller holds the mixer mutex
+ */
+static void decode_totals(uint64_t *convert_us, uint64_t *read_us) {
+    *convert_us = g_mixer.decode_convert_retired_us;
+    *read_us = g_mixer.decode_read_retired_us;
+    for (int i = 0; i < MAX_AUDIO_SOURCES; i++) {
+        *convert_us += g_mixer.sources[i].decoder_params.convert_us;
+        *read_us += g_mixer.sources[i].decoder_params.read_us;
+    }
+}
+
+/**
+ * @brief Pass time below which pct percent of the passes fall (bucket upper bound)
+ * @note Caller holds the mixer mutex
+ */
+static uint32_t loop_percentile(uint32_t loops, uint32_t pct) {
+    uint64_t rank = ((uint64_t)loops * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (int b = 0; b < MIXER_LOOP_HIST_BUCKETS - 1; b++) {
+        seen += g_mixer.loop_hist[b];
+        if (seen >= rank) {
+            uint32_t upper = (uint32_t)(b + 1) * MIXER_LOOP_HIST_STEP_US;
+            return (upper < g_mixer.loop_max_us) ? upper : g_mixer.loop_max_us;
+        }
+    }
+    return g_mixer.loop_max_us;
+}
+
+/**
+ * @brief Get mixer real-time metrics
+ */
+void audio_mixer_get_perf(audio_mixer_perf_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    
+    memset(out, 0, sizeof(*out));
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    for (int b = 0; b < MIXER_LOOP_HIST_BUCKETS; b++) {
+        out->loops += g_mixer.loop_hist[b];
+    }
+    if (out->loops > 0) {
+        out->p50_us = loop_percentile(out->loops, 50);
+        out->p95_us = loop_percentile(out->loops, 95);
+        out->p99_us = loop_percentile(out->loops, 99);
+        out->max_us = g_mixer.loop_max_us;
+    }
+    out->budget_us = (uint32_t)((uint64_t)MIXER_BLOCK_FRAMES * 1000000 / g_mixer.output_rate);
+    out->playback_underruns = g_mixer.playback_underruns - g_mixer.underruns_base;
+    out->voice_starved = g_mixer.voice_starved;
+    uint64_t convert_us, read_us;
+    decode_totals(&convert_us, &read_us);
+    out->decode_convert_us = convert_us - g_mixer.decode_convert_base_us;
+    out->decode_read_us = read_us - g_mixer.decode_read_base_us;
+    out->window_us = (uint64_t)(esp_timer_get_time() - g_mixer.perf_start_us);
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Get real-time metrics of one voice
+ */
+esp_err_t audio_mixer_get_voice_perf(audio_source_handle_t handle, audio_voice_perf_t *out) {
+    if (handle < 0 || handle >= MAX_AUDIO_SOURCES || out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    audio_source_t *src = &g_mixer.sources[handle];
+    if (!src->active) {
+        xSemaphoreGive(g_mixer.mutex);
+        return ESP_ERR_NOT_FOUND;
+    }
+    const char *slash = strrchr(src->filepath, '/');
+    strlcpy(out->name, slash ? slash + 1 : src->filepath, sizeof(out->name));
+    out->state = src->state;
+    out->volume = src->volume;
+    out->fill_pct = src->fill_pct;
+    out->min_fill_pct = src->min_fill_pct;
+    out->starved = src->starved;
+    out->convert_us = src->decoder_params.convert_us;
+    out->read_us = src->decoder_params.read_us;
+    out->age_ms = (uint32_t)((esp_timer_get_time() - src->created_us) / 1000);
+    xSemaphoreGive(g_mixer.mutex);
+    return ESP_OK;
+}
+
+/**
+ * @brief Get the lowest buffer fill of the voices playing now
+ */
+int audio_mixer_get_min_voice_fill(void) {
+    int min_fill = -1;
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    for (int i = 0; i < MAX_AUDIO_SOURCES; i++) {
+        const audio_source_t *src = &g_mixer.sources[i];
+        if (src->active && src->state == SOURCE_STATE_PLAYING && src->first_sample_us != 0 &&
+            (min_fill < 0 || src->min_fill_pct < min_fill)) {
+            min_fill = src->min_fill_pct;
+        }
+    }
+    xSemaphoreGive(g_mixer.mutex);
+    return min_fill;
+}
+
+/**
+ * @brief Get the most recent plays, newest first
+ */
+int audio_mixer_get_recent_plays(audio_recent_play_t *out, int max) {
+    if (out == NULL || max <= 0) {
+        return 0;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    int count = (g_mixer.recent_next < MIXER_RECENT_PLAYS) ? (int)g_mixer.recent_next : MIXER_RECENT_PLAYS;
+    if (count > max) {
+        count = max;
+    }
+    int64_t now = esp_timer_get_time();
+    for (int i = 0; i < count; i++) {
+        uint32_t idx = (g_mixer.recent_next - 1 - i) % MIXER_RECENT_PLAYS;
+        out[i] = g_mixer.recent[idx];
+        out[i].age_ms = (uint32_t)((now - g_mixer.recent_us[idx]) / 1000);
+    }
+    xSemaphoreGive(g_mixer.mutex);
+    return count;
+}
+
+/**
+ * @brief Reset real-time metrics
+ */
+void audio_mixer_reset_perf(void) {
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    memset(g_mixer.loop_hist, 0, sizeof(g_mixer.loop_hist));
+    g_mixer.loop_max_us = 0;
+    g_mixer.voice_starved = 0;
+    g_mixer.underruns_base = g_mixer.playback_underruns;
+    decode_totals(&g_mixer.decode_convert_base_us, &g_mixer.decode_read_base_us);
+    g_mixer.perf_start_us = esp_timer_get_time();
+    for (int i = 0; i < MAX_AUDIO_SOURCES; i++) {
+        g_mixer.sources[i].starved = 0;
+        g_mixer.sources[i].min_fill_pct = 100;
+    }
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Set the mixer output rate (0 = auto)
+ */
+esp_err_t audio_mixer_set_output_rate(uint32_t rate) {
+    if (rate != 0 && !rate_supported(rate)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!g_mixer.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    if (rate == 0) {
+        g_mixer.auto_rate = true;
+    } else if (any_source_active()) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else {
+        g_mixer.auto_rate = false;
+        if (rate != g_mixer.output_rate) {
+            g_mixer.output_rate = rate;
+            g_mixer.rate_pending = true;
+        }
+    }
+    xSemaphoreGive(g_mixer.mutex);
+    
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Output rate: %s", rate ? "fixed" : "auto");
+    }
+    return ret;
+}
+
+/**
+ * @brief Get output rate and mixing cost statistics
+ */
+void audio_mixer_get_rate_stats(audio_mixer_rate_stats_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    *out = g_mixer.rate_stats;
+    out->output_rate = g_mixer.output_rate;
+    out->auto_rate = g_mixer.auto_rate;
+    out->window_us = (uint64_t)(esp_timer_get_time() - g_mixer.rate_stats_start_us);
+    out->voice_buffer_bytes = source_buffer_bytes();
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Reset mixing cost statistics
+ */
+void audio_mixer_reset_rate_stats(void) {
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    memset(&g_mixer.rate_stats, 0, sizeof(g_mixer.rate_stats));
+    g_mixer.rate_stats_start_us = esp_timer_get_time();
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Apply a pending output rate to I2S
+ * 
+ * Runs in the mixer task between two I2S writes while the DMA holds only
+ * silence (the switch is requested while no source is active).
+ * @note Caller holds the mixer mutex
+ */
+static void apply_output_rate(void) {
+    g_mixer.rate_pending = false;
+    
+    esp_err_t ret = i2s_set_sample_rate(g_mixer.output_rate);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "I2S rate switch to %lu Hz failed: %s",
+                 (unsigned long)g_mixer.output_rate, esp_err_to_name(ret));
+        g_mixer.output_rate = i2s_get_sample_rate();
+    } else {
+        g_mixer.rate_stats.rate_switches++;
+    }
+    g_mixer.drain_ms = i2s_get_output_latency_us() / 1000 + I2S_DRAIN_MARGIN_MS;
+}
+
+/**
+ * @brief Apply a pending DMA depth to I2S (same rules as apply_output_rate)
+ * @note Caller holds the mixer mutex
+ */
+static void apply_dma_config(void) {
+    g_mixer.dma_result = g_mixer.dma_latency_us
+        ? i2s_set_dma_latency(g_mixer.dma_desc_num, g_mixer.dma_latency_us)
+        : i2s_set_dma_config(g_mixer.dma_desc_num, g_mixer.dma_frame_num);
+    g_mixer.drain_ms = i2s_get_output_latency_us() / 1000 + I2S_DRAIN_MARGIN_MS;
+    g_mixer.dma_pending = false;
+}
+
+/**
+ * @brief Set the I2S DMA depth in frames or, with latency_us, as a latency (idle only)
+ */
+static esp_err_t set_dma(uint32_t desc_num, uint32_t frame_num, uint32_t latency_us) {
+    if (!g_mixer.initialized) {
+        return latency_us ? i2s_set_dma_latency(desc_num, latency_us)
+                          : i2s_set_dma_config(desc_num, frame_num);
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    if (any_source_active()) {
+        xSemaphoreGive(g_mixer.mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_mixer.dma_desc_num = desc_num;
+    g_mixer.dma_frame_num = frame_num;
+    g_mixer.dma_latency_us = latency_us;
+    if (!g_mixer.hardware_ready) {
+        // Mixer task is not writing to I2S yet
+        apply_dma_config();
+        esp_err_t ret = g_mixer.dma_result;
+        xSemaphoreGive(g_mixer.mutex);
+        return ret;
+    }
+    g_mixer.dma_pending = true;
+    xSemaphoreGive(g_mixer.mutex);
+    
+    // The mixer task applies it between two writes (within one idle loop)
+    for (int i = 0; i < 100; i++) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+        bool pending = g_mixer.dma_pending;
+        esp_err_t ret = g_mixer.dma_result;
+        xSemaphoreGive(g_mixer.mutex);
+        if (!pending) {
+            return ret;
+        }
+    }
+    return ESP_ERR_TIMEOUT;
+}
+
+/**
+ * @brief Set the I2S DMA depth (idle only)
+ */
+esp_err_t audio_mixer_set_dma_config(uint32_t desc_num, uint32_t frame_num) {
+    return set_dma(desc_num, frame_num, 0);
+}
+
+/**
+ * @brief Set the I2S DMA depth as an output latency (idle only)
+ */
+esp_err_t audio_mixer_set_dma_latency(uint32_t desc_num, uint32_t latency_us) {
+    if (latency_us == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return set_dma(desc_num, 0, latency_us);
+}
+
+/**
+ * @brief Get I2S underruns that happened while sources were mixed
+ */
+uint32_t audio_mixer_get_playback_underruns(void) {
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    uint32_t count = g_mixer.playback_underruns;
+    xSemaphoreGive(g_mixer.mutex);
+    return count;
+}
+
+/**
+ * @brief Enable ducking and set the ducked level
+ */
+void audio_mixer_set_ducking(bool enabled, uint8_t percent) {
+    if (percent > 100) {
+        percent = 100;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    g_mixer.ducking_enabled = enabled;
+    g_mixer.duck_percent = percent;
+    audio_duck_set_level(&g_mixer.duck, percent);
+    xSemaphoreGive(g_mixer.mutex);
+    
+    ESP_LOGI(TAG, "Ducking %s (%d%%)", enabled ? "on" : "off", percent);
+}
+
+/**
+ * @brief Override whether a voice is ducked under alerts
+ */
+esp_err_t audio_mixer_set_source_duckable(audio_source_handle_t handle, bool duckable) {
+    if (handle < 0 || handle >= MAX_AUDIO_SOURCES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    if (g_mixer.sources[handle].active) {
+        g_mixer.sources[handle].duckable = duckable;
+        ret = ESP_OK;
+    }
+    xSemaphoreGive(g_mixer.mutex);
+    return ret;
+}
+
+static uint8_t gain_to_percent(int32_t gain) {
+    return (uint8_t)(((int64_t)gain * 100 + AUDIO_DSP_UNITY / 2) / AUDIO_DSP_UNITY);
+}
+
+/**
+ * @brief Get master bus statistics
+ */
+void audio_mixer_get_dsp_stats(audio_mixer_dsp_stats_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    out->ducking_enabled = g_mixer.ducking_enabled;
+    out->duck_percent = g_mixer.duck_percent;
+    out->duck_gain_percent = gain_to_percent(g_mixer.duck.gain);
+    out->limiter_gain_percent = gain_to_percent(g_mixer.limiter.gain);
+    out->min_gain_percent = gain_to_percent(g_mixer.limiter.min_gain);
+    out->limited_samples = g_mixer.limiter.limited_samples;
+    out->clipped_samples = g_mixer.limiter.clipped_samples;
+    out->blocks = g_mixer.dsp_blocks;
+    out->cycles = g_mixer.dsp_cycles;
+    out->max_cycles = g_mixer.dsp_max_cycles;
+    xSemaphoreGive(g_mixer.mutex);
+}
+
+/**
+ * @brief Reset master bus statistics
+ */
+void audio_mixer_reset_dsp_stats(void) {
+    xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+    audio_limiter_reset_stats(&g_mixer.limiter);
+    g_mixer.dsp_blocks = 0;
+    g_mixer.dsp_cycles = 0;
+    g_mixer.dsp_max_cycles = 0;
+    xSemaphoreGive(g_mixer.mutex);
+}
+
 /**
  * @brief Mixer task - combines all sources and outputs to I2S
  */
 static void mixer_task(void *arg) {
-    int16_t i2s_buffer[512 * 2];  // Stereo
-    int16_t source_samples[512 * 2];
+    int16_t i2s_buffer[MIXER_BLOCK_FRAMES * 2];  // Stereo
+    int16_t source_samples[MIXER_BLOCK_FRAMES * 2];
     size_t bytes_written;
     
     ESP_LOGI(TAG, "Mixer task started");
@@ -624,15 +1272,30 @@ static void mixer_task(void *arg) {
     ESP_LOGI(TAG, "Hardware ready, starting mixer loop");
     
     while (true) {
-        // Clear mix buffer
-        memset(i2s_buffer, 0, sizeof(i2s_buffer));
+        // Underruns during the idle delay below are silence, not dropouts
+        uint32_t underruns_before = i2s_get_underruns();
+        
+        // Clear mix buses
+        memset(s_main_bus, 0, sizeof(s_main_bus));
+        memset(s_duck_bus, 0, sizeof(s_duck_bus));
         
         int active_sources = 0;
-        size_t max_samples = 0;  // Track maximum samples mixed
+        bool alert_playing = false;  // A voice that ducks the duckable ones
+        uint32_t voice_frames = 0;  // Output frames mixed, summed over sources
         
         // Mix all active sources
         xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
         
+        // Switch rate / DMA depth before the new source's first samples are mixed
+        if (g_mixer.rate_pending) {
+            apply_output_rate();
+        }
+        if (g_mixer.dma_pending) {
+            apply_dma_config();
+            underruns_before = i2s_get_underruns();
+        }
+        int64_t mix_start_us = esp_timer_get_time();
+        
         for (int i = 0; i < MAX_AUDIO_SOURCES; i++) {
             audio_source_t *src = &g_mixer.sources[i];
             
@@ -650,26 +1313,38 @@ static void mixer_task(void *arg) {
                 continue;
             }
             
+            // Stopped by request: discard queued PCM so a decoder blocked on a
+            // full buffer sees the stop flag, then drain like a finished source
+            if (src->active && src->state == SOURCE_STATE_STOPPING) {
+                xStreamBufferReceive(src->buffer, source_samples, sizeof(source_samples), 0);
+                if (src->eof_reached) {
+                    src->state = SOURCE_STATE_DRAINING;
+                    src->drain_start_tick = xTaskGetTickCount();
+                }
+                continue;
+            }
+            
             // Skip inactive or non-playing sources
             if (!src->active || src->state != SOURCE_STATE_PLAYING) {
                 // Check if draining state - wait for I2S DMA buffer to flush
-                // I2S DMA: 8 descriptors x 256 frames @ 44100Hz = ~23ms
-                // Use 30ms to be safe
-                #define I2S_DRAIN_TIME_MS 30
                 if (src->state == SOURCE_STATE_DRAINING) {
                     TickType_t elapsed = xTaskGetTickCount() - src->drain_start_tick;
-                    if (elapsed >= pdMS_TO_TICKS(I2S_DRAIN_TIME_MS)) {
+                    if (elapsed >= pdMS_TO_TICKS(g_mixer.drain_ms)) {
                         src->state = SOURCE_STATE_STOPPED;
                     }
                 }
                 continue;
             }
             
+            if (!src->loop && !src->duckable) {
+                alert_playing = true;
+            }
+            
             // Read from source buffer
             // Limit read size to what we can process in one iteration:
-            // - Mono source: 512 samples (1024 bytes) -> 512 stereo frames output
-            // - Stereo source: 512 stereo pairs (2048 bytes) -> 512 stereo frames output
-            size_t max_bytes = (src->wav_info.num_channels == 1) ? 1024 : 2048;
+            // - Mono source: 512 samples (1024 bytes) -> 512 output frames
+            // - Stereo source: 512 stereo pairs (2048 bytes) -> 512 output frames
+            size_t max_bytes = MIXER_BLOCK_FRAMES * 2 * ((src->wav_info.num_channels == 1) ? 1 : 2);
             size_t bytes_available = xStreamBufferReceive(
                 src->buffer, 
                 source_samples, 
@@ -677,7 +1352,23 @@ static void mixer_task(void *arg) {
                 0  // Non-blocking
             );
             
+            if (bytes_available > 0 && src->first_sample_us == 0) {
+                src->first_sample_us = esp_timer_get_time();
+                record_latency(src);
+                // Header is parsed by now, also for unparsed file sources
+                if (src->wav_info.sample_rate == g_mixer.output_rate) {
+                    g_mixer.rate_stats.native_voices++;
+                } else {
+                    g_mixer.rate_stats.resampled_voices++;
+                }
+            }
+            
             if (bytes_available == 0) {
+                if (!src->eof_reached && src->first_sample_us != 0) {
+                    // Decoder fell behind: this voice is silent for a block
+                    src->starved++;
+                    g_mixer.voice_starved++;
+                }
                 // No data available - check if EOF
                 if (src->eof_reached) {
                     // Start draining - wait for I2S DMA buffer to flush (~23ms)
@@ -687,96 +1378,99 @@ static void mixer_task(void *arg) {
                 continue;
             }
             
-            // Mix into output buffer with volume control
-            // MONO OUTPUT MODE: Always output mono duplicated on both I2S channels
-            // This ensures single-speaker setup (LOUT or ROUT) gets full audio
+            // Buffer fill after this read. The minimum counts once the decoder
+            // has filled the buffer (not while it starts) and before the tail
+            // of a finished file empties it
+            src->fill_pct = (uint8_t)(xStreamBufferBytesAvailable(src->buffer) * 100 / src->buffer_bytes);
+            if (src->fill_pct >= 50) {
+                src->fill_primed = true;
+            }
+            if (src->fill_primed && !src->eof_reached && src->fill_pct < src->min_fill_pct) {
+                src->min_fill_pct = src->fill_pct;
+            }
+            
+            // Mix into the voice's bus with volume control (Q16 gain)
+            // MONO OUTPUT MODE: the mono mix is duplicated on both I2S channels
+            // so a single-speaker setup (LOUT or ROUT) gets full audio
+            int32_t *bus = (g_mixer.ducking_enabled && src->duckable) ? s_duck_bus : s_main_bus;
+            int32_t gain = audio_dsp_percent_to_gain(src->volume);
             int samples = bytes_available / 2;  // 16-bit samples
+            int frames;
             
             if (src->wav_info.num_channels == 1) {
-                // MONO SOURCE: Duplicate each sample to both L and R channels
-                for (int j = 0; j < samples && (j * 2 + 1) < (512 * 2); j++) {
-                    // Apply source volume
-                    int32_t sample = source_samples[j];
-                    if (src->volume < 100) {
-                        sample = (sample * src->volume) / 100;
+                frames = (samples < MIXER_BLOCK_FRAMES) ? samples : MIXER_BLOCK_FRAMES;
+                if (gain == AUDIO_DSP_UNITY) {
+                    for (int j = 0; j < frames; j++) {
+                        bus[j] += source_samples[j];
+                    }
+                } else {
+                    for (int j = 0; j < frames; j++) {
+                        bus[j] += ((int32_t)source_samples[j] * gain) >> 16;
                     }
-                    
-                    // Mix to both LEFT and RIGHT channels (saturating add)
-                    // Left channel
-                    int32_t mixed_l = i2s_buffer[j * 2] + sample;
-                    if (mixed_l > 32767) mixed_l = 32767;
-                    if (mixed_l < -32768) mixed_l = -32768;
-                    i2s_buffer[j * 2] = (int16_t)mixed_l;
-                    
-                    // Right channel (same sample)
-                    int32_t mixed_r = i2s_buffer[j * 2 + 1] + sample;
-                    if (mixed_r > 32767) mixed_r = 32767;
-                    if (mixed_r < -32768) mixed_r = -32768;
-                    i2s_buffer[j * 2 + 1] = (int16_t)mixed_r;
-                }
-                
-                // Track stereo samples mixed (mono samples * 2)
-                int stereo_samples = samples * 2;
-                if (stereo_samples > max_samples) {
-                    max_samples = stereo_samples;
                 }
             } else {
-                // STEREO SOURCE: Downmix to mono, then duplicate to both channels
-                // This ensures full audio on single speaker (LOUT or ROUT)
-                int stereo_samples = samples / 2;  // Stereo pairs (L+R)
-                
-                for (int j = 0; j < stereo_samples && (j * 2 + 1) < (512 * 2); j++) {
-                    // Read stereo pair from source
-                    int16_t left_in = source_samples[j * 2];
-                    int16_t right_in = source_samples[j * 2 + 1];
-                    
-                    // Downmix to mono: average L and R channels
-                    int32_t mono_sample = ((int32_t)left_in + (int32_t)right_in) / 2;
-                    
-                    // Apply source volume
-                    if (src->volume < 100) {
-                        mono_sample = (mono_sample * src->volume) / 100;
-                    }
-                    
-                    // Mix to both LEFT and RIGHT output channels (saturating add)
-                    // Left channel
-                    int32_t mixed_l = i2s_buffer[j * 2] + mono_sample;
-                    if (mixed_l > 32767) mixed_l = 32767;
-                    if (mixed_l < -32768) mixed_l = -32768;
-                    i2s_buffer[j * 2] = (int16_t)mixed_l;
-                    
-                    // Right channel (same mono sample)
-                    int32_t mixed_r = i2s_buffer[j * 2 + 1] + mono_sample;
-                    if (mixed_r > 32767) mixed_r = 32767;
-                    if (mixed_r < -32768) mixed_r = -32768;
-                    i2s_buffer[j * 2 + 1] = (int16_t)mixed_r;
+                // STEREO SOURCE: Downmix to mono (average L and R)
+                frames = samples / 2;
+                if (frames > MIXER_BLOCK_FRAMES) {
+                    frames = MIXER_BLOCK_FRAMES;
                 }
-                
-                // Track output samples (stereo pairs * 2 for L+R)
-                int output_samples = stereo_samples * 2;
-                if (output_samples > max_samples) {
-                    max_samples = output_samples;
+                for (int j = 0; j < frames; j++) {
+                    int32_t mono_sample = ((int32_t)source_samples[j * 2] + source_samples[j * 2 + 1]) / 2;
+                    bus[j] += (mono_sample * gain) >> 16;
                 }
             }
             
+            voice_frames += frames;
             active_sources++;
         }
         
+        if (voice_frames > 0) {
+            g_mixer.rate_stats.voice_frames += voice_frames;
+            g_mixer.rate_stats.mix_us += (uint64_t)(esp_timer_get_time() - mix_start_us);
+        }
+        
+        // Master bus: duckable voices under alerts, then master volume and the
+        // look-ahead limiter instead of clipping. Always the full block, so the
+        // limiter delay drains into the silence after the last voice
+        uint32_t dsp_start = esp_cpu_get_cycle_count();
+        audio_duck_process(&g_mixer.duck, s_duck_bus, s_main_bus, MIXER_BLOCK_FRAMES, alert_playing);
+        audio_limiter_process(&g_mixer.limiter, s_main_bus, source_samples, MIXER_BLOCK_FRAMES,
+                              audio_dsp_percent_to_gain(g_mixer.master_volume));
+        uint32_t dsp_cycles = esp_cpu_get_cycle_count() - dsp_start;
+        if (active_sources > 0) {
+            g_mixer.dsp_blocks++;
+            g_mixer.dsp_cycles += dsp_cycles;
+            if (dsp_cycles > g_mixer.dsp_max_cycles) {
+                g_mixer.dsp_max_cycles = dsp_cycles;
+            }
+            
+            uint32_t loop_us = (uint32_t)(esp_timer_get_time() - mix_start_us);
+            uint32_t bucket = loop_us / MIXER_LOOP_HIST_STEP_US;
+            g_mixer.loop_hist[(bucket < MIXER_LOOP_HIST_BUCKETS) ? bucket : MIXER_LOOP_HIST_BUCKETS - 1]++;
+            if (loop_us > g_mixer.loop_max_us) {
+                g_mixer.loop_max_us = loop_us;
+            }
+        }
+        
         xSemaphoreGive(g_mixer.mutex);
         
-        // Apply master volume scaling using audio_volume module
-        uint8_t master_vol = audio_mixer_get_master_volume();
-        if (master_vol < 100 && max_samples > 0) {
-            // Only scale the samples we actually mixed (not beyond buffer!)
-            audio_volume_apply_fast(i2s_buffer, 
-                                   (max_samples < (512 * 2)) ? max_samples : (512 * 2),
-                                   master_vol);
+        // Mono -> both I2S channels
+        for (int j = 0; j < MIXER_BLOCK_FRAMES; j++) {
+            i2s_buffer[j * 2] = source_samples[j];
+            i2s_buffer[j * 2 + 1] = source_samples[j];
         }
         
         // Write to I2S only if hardware is ready
         if (g_mixer.hardware_ready) {
             // Always write full buffer to maintain continuous I2S stream
             i2s_write_audio(i2s_buffer, sizeof(i2s_buffer), &bytes_written);
+            
+            uint32_t underruns = i2s_get_underruns() - underruns_before;
+            if (underruns > 0 && active_sources > 0) {
+                xSemaphoreTake(g_mixer.mutex, portMAX_DELAY);
+                g_mixer.playback_underruns += underruns;
+                xSemaphoreGive(g_mixer.mutex);
+            }
         }
         
         // Small yield to prevent watchdog
@@ -10,12 +10,30 @@
 #define MAX_AUDIO_SOURCES 4
 
 // Audio format
-#define MIXER_SAMPLE_RATE 44100
 #define MIXER_CHANNELS 2
 #define MIXER_BITS_PER_SAMPLE 16
 
+// Output rate range (the output rate follows the I2S rate set in main.c)
+#define MIXER_MIN_SAMPLE_RATE 8000
+#define MIXER_MAX_SAMPLE_RATE 48000
+
+// Auto rate: while idle, switch the output to the rate of the next voice
+#ifndef MIXER_DEFAULT_AUTO_RATE
+#define MIXER_DEFAULT_AUTO_RATE true
+#endif
+
 // Ring buffer size per source (in samples, stereo = 2 values per sample)
+// at 44.1kHz; scaled with the output rate so every rate buffers the same time
 #define SOURCE_BUFFER_SAMPLES 4096  // ~46ms at 44.1kHz stereo
+#define SOURCE_BUFFER_REF_RATE 44100
+
+// Output frames mixed per iteration (one I2S write)
+#define MIXER_BLOCK_FRAMES 512
+
+// Ducking: alerts lower looping voices (music, ambience) while they play
+#ifndef MIXER_DEFAULT_DUCKING
+#define MIXER_DEFAULT_DUCKING true
+#endif
 
 /**
  * @brief Audio source handle
@@ -35,6 +53,104 @@ typedef enum {
     SOURCE_STATE_STOPPED
 } audio_source_state_t;
 
+/**
+ * @brief Where a tracked source was loaded from (latency statistics)
+ */
+typedef enum {
+    AUDIO_LATENCY_SD = 0,
+    AUDIO_LATENCY_EMBEDDED,
+    AUDIO_LATENCY_KINDS
+} audio_latency_kind_t;
+
+/**
+ * @brief Play request -> first mixed sample latency
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;          // Sum over count (average = total_us / count)
+} audio_latency_stats_t;
+
+// Real-time metrics (always collected)
+#define MIXER_LOOP_HIST_BUCKETS 64   // Mixer pass time histogram...
+#define MIXER_LOOP_HIST_STEP_US 50   // ...in 50 us steps (last bucket: 3150 us and more)
+#define MIXER_RECENT_PLAYS      8    // Time-to-first-sample of the last plays
+
+/**
+ * @brief Mixer real-time metrics since the last reset
+ */
+typedef struct {
+    uint32_t loops;              // Mixer passes with voices
+    uint32_t p50_us;             // Pass time percentiles (mix + master bus,
+    uint32_t p95_us;             //   bucket upper bounds)
+    uint32_t p99_us;
+    uint32_t max_us;
+    uint32_t budget_us;          // Duration of one block at the output rate
+    uint32_t playback_underruns; // I2S underruns while voices were mixed
+    uint32_t voice_starved;      // Passes where a voice had no data before its end
+    uint64_t decode_convert_us;  // All decoders: converting/resampling (CPU)
+    uint64_t decode_read_us;     // All decoders: reading SD / bank
+    uint64_t window_us;          // Time since the metrics were reset
+} audio_mixer_perf_t;
+
+/**
+ * @brief Per-voice real-time metrics
+ */
+typedef struct {
+    char name[32];               // File name (without directory)
+    audio_source_state_t state;
+    uint8_t volume;
+    uint8_t fill_pct;            // Stream buffer fill after the last pass
+    uint8_t min_fill_pct;        // Lowest fill once primed, before EOF (100 = not measured yet)
+    uint32_t starved;            // Passes with an empty buffer before EOF
+    uint32_t convert_us;         // Decoder time converting/resampling
+    uint32_t read_us;            // Decoder time reading
+    uint32_t age_ms;             // Since the voice was created
+} audio_voice_perf_t;
+
+/**
+ * @brief One recent play: request -> first sample
+ */
+typedef struct {
+    char name[32];
+    audio_latency_kind_t kind;
+    uint32_t latency_us;
+    uint32_t age_ms;             // Since the first sample
+} audio_recent_play_t;
+
+/**
+ * @brief Output rate and mixing cost statistics
+ */
+typedef struct {
+    uint32_t output_rate;       // Current mixer/I2S rate (Hz)
+    bool auto_rate;             // Output rate follows the voices while idle
+    uint32_t rate_switches;     // I2S reconfigurations
+    uint32_t native_voices;     // Voices played at their own rate (no resampling)
+    uint32_t resampled_voices;  // Voices resampled to the output rate
+    uint64_t voice_frames;      // Output frames mixed, summed over voices
+    uint64_t mix_us;            // Time spent mixing those frames
+    uint64_t window_us;         // Time since the statistics were reset
+    size_t voice_buffer_bytes;  // Stream buffer per voice at the output rate
+} audio_mixer_rate_stats_t;
+
+/**
+ * @brief Master bus statistics (ducking + limiter)
+ */
+typedef struct {
+    bool ducking_enabled;
+    uint8_t duck_percent;        // Duck bus level while an alert plays
+    uint8_t duck_gain_percent;   // Current duck bus level
+    uint8_t limiter_gain_percent;// Current limiter gain
+    uint8_t min_gain_percent;    // Deepest limiting since the statistics were reset
+    uint32_t limited_samples;    // Output samples with gain reduction
+    uint32_t clipped_samples;    // Output samples clamped after limiting (should stay 0)
+    uint32_t blocks;             // Blocks processed while sources were mixed
+    uint64_t cycles;             // CPU cycles of the master bus stages in those blocks
+    uint32_t max_cycles;         // Worst block
+} audio_mixer_dsp_stats_t;
+
 /**
  * @brief Initialize audio mixer
  * 
@@ -56,6 +172,13 @@ esp_err_t audio_mixer_init(void);
  */
 void audio_mixer_set_hardware_ready(bool ready);
 
+/**
+ * @brief Check whether the mixer is writing to I2S
+ * 
+ * @return true after audio_mixer_set_hardware_ready(true)
+ */
+bool audio_mixer_is_hardware_ready(void);
+
 /**
  * @brief Create a new audio source
  * 
@@ -70,6 +193,42 @@ esp_err_t audio_mixer_create_source(const char *filepath, uint8_t volume,
                                      bool loop, bool interrupt,
                                      audio_source_handle_t *handle);
 
+/**
+ * @brief Create a new audio source from a file whose header is already known
+ * 
+ * The decoder seeks straight to wav_info->data_offset instead of parsing
+ * the header again (used with the SD sound library index).
+ * 
+ * @param filepath Path to WAV file on SD card
+ * @param wav_info Parsed WAV header (data_offset/data_size locate the PCM)
+ * @param volume Volume 0-100 (100 = full volume)
+ * @param loop true to loop playback, false for one-shot
+ * @param interrupt true to stop all other sources
+ * @param handle Output: source handle for control
+ * @return ESP_OK on success, error otherwise
+ */
+esp_err_t audio_mixer_create_source_preparsed(const char *filepath, const wav_info_t *wav_info,
+                                               uint8_t volume, bool loop, bool interrupt,
+                                               audio_source_handle_t *handle);
+
+/**
+ * @brief Create an audio source from a sound bank entry
+ * 
+ * PCM is read with offset reads on the bank's shared file descriptor, so
+ * bank sources do not use a FATFS file slot.
+ * 
+ * @param name Display name (e.g. "bank:4")
+ * @param wav_info Entry format; data_offset/data_size are bank offsets
+ * @param volume Volume 0-100 (100 = full volume)
+ * @param loop true to loop playback, false for one-shot
+ * @param interrupt true to stop all other sources
+ * @param handle Output: source handle for control
+ * @return ESP_OK on success, error otherwise
+ */
+esp_err_t audio_mixer_create_source_from_bank(const char *name, const wav_info_t *wav_info,
+                                               uint8_t volume, bool loop, bool interrupt,
+                                               audio_source_handle_t *handle);
+
 /**
  * @brief Create an audio source from memory buffer
  * 
@@ -211,4 +370,156 @@ esp_err_t audio_mixer_stop_by_queue_id(uint8_t queue_id);
  */
 audio_source_handle_t audio_mixer_get_handle_by_queue_id(uint8_t queue_id);
 
+/**
+ * @brief Set the mixer output rate
+ * 
+ * With a fixed rate every voice at another rate is resampled. With auto
+ * (rate 0), a voice that starts while nothing is playing switches the
+ * output to its own rate, so only voices mixed with it at a different rate
+ * are resampled. I2S is only reconfigured while no source is active, by the
+ * mixer task between two buffers, so a switch never cuts audio.
+ * 
+ * @param rate Output rate in Hz (MIXER_MIN_SAMPLE_RATE-MIXER_MAX_SAMPLE_RATE), or 0 for auto
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for an unsupported rate,
+ *         ESP_ERR_INVALID_STATE if a fixed rate is requested while sources are active
+ */
+esp_err_t audio_mixer_set_output_rate(uint32_t rate);
+
+/**
+ * @brief Get output rate and mixing cost statistics
+ */
+void audio_mixer_get_rate_stats(audio_mixer_rate_stats_t *out);
+
+/**
+ * @brief Reset mixing cost statistics (rate settings are kept)
+ */
+void audio_mixer_reset_rate_stats(void);
+
+/**
+ * @brief Set the I2S DMA depth
+ * 
+ * Applied by the mixer task between two buffers while no source is active
+ * (the I2S channel is recreated). Blocks until applied. The drain wait of
+ * finished sources follows the new DMA latency.
+ * 
+ * @param desc_num Number of DMA buffers
+ * @param frame_num Frames per DMA buffer
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if sources are active,
+ *         ESP_ERR_INVALID_ARG / I2S error from i2s_set_dma_config()
+ */
+esp_err_t audio_mixer_set_dma_config(uint32_t desc_num, uint32_t frame_num);
+
+/**
+ * @brief Set the I2S DMA depth as an output latency
+ * 
+ * Same rules as audio_mixer_set_dma_config(); the frame count follows the
+ * output rate so the latency holds when the rate switches (see
+ * i2s_set_dma_latency()).
+ * 
+ * @param desc_num Number of DMA buffers (minimum)
+ * @param latency_us Output latency to hold
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if sources are active,
+ *         ESP_ERR_INVALID_ARG / I2S error from i2s_set_dma_latency()
+ */
+esp_err_t audio_mixer_set_dma_latency(uint32_t desc_num, uint32_t latency_us);
+
+/**
+ * @brief Get I2S underruns that happened while sources were being mixed
+ * 
+ * Underruns while idle only replay silence and are not counted.
+ */
+uint32_t audio_mixer_get_playback_underruns(void);
+
+/**
+ * @brief Enable ducking and set the ducked level
+ * 
+ * While an alert (a non-looping voice that is not duckable) plays, duckable
+ * voices are ramped down to percent and back up after it ends. New looping
+ * voices are duckable, others are not.
+ * 
+ * @param enabled false mixes every voice at its own volume
+ * @param percent Level of duckable voices under an alert (0-100)
+ */
+void audio_mixer_set_ducking(bool enabled, uint8_t percent);
+
+/**
+ * @brief Override whether a voice is ducked under alerts
+ * 
+ * @param handle Source handle
+ * @param duckable true to duck the voice, false to play it at full level
+ *                 (a non-looping voice that is not duckable ducks the others)
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NOT_FOUND if the slot is idle
+ */
+esp_err_t audio_mixer_set_source_duckable(audio_source_handle_t handle, bool duckable);
+
+/**
+ * @brief Get master bus (ducking + limiter) statistics
+ */
+void audio_mixer_get_dsp_stats(audio_mixer_dsp_stats_t *out);
+
+/**
+ * @brief Reset master bus statistics (settings are kept)
+ */
+void audio_mixer_reset_dsp_stats(void);
+
+/**
+ * @brief Track request -> first sample latency of a source
+ * 
+ * The first sample is the moment the mixer pulls the source's first PCM
+ * chunk for I2S output.
+ * 
+ * @param handle Source handle returned by a create call
+ * @param request_us esp_timer_get_time() when the play request arrived
+ * @param kind Statistics bucket
+ */
+void audio_mixer_track_latency(audio_source_handle_t handle, int64_t request_us,
+                               audio_latency_kind_t kind);
+
+/**
+ * @brief Get request -> first sample latency statistics
+ * 
+ * @param kind Statistics bucket
+ * @param out Output statistics
+ */
+void audio_mixer_get_latency_stats(audio_latency_kind_t kind, audio_latency_stats_t *out);
+
+/**
+ * @brief Reset latency statistics
+ */
+void audio_mixer_reset_latency_stats(void);
+
+/**
+ * @brief Get mixer real-time metrics (pass time percentiles, underruns, decoder time)
+ */
+void audio_mixer_get_perf(audio_mixer_perf_t *out);
+
+/**
+ * @brief Get real-time metrics of one voice
+ * 
+ * @param handle Source handle
+ * @param out Output metrics
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NOT_FOUND if the slot is idle
+ */
+esp_err_t audio_mixer_get_voice_perf(audio_source_handle_t handle, audio_voice_perf_t *out);
+
+/**
+ * @brief Get the lowest buffer fill of the voices playing now
+ * @return Percent, or -1 if no voice has played a sample yet
+ */
+int audio_mixer_get_min_voice_fill(void);
+
+/**
+ * @brief Get the most recent plays with their time to first sample
+ * 
+ * @param out Output array, newest first
+ * @param max Capacity of out
+ * @return Number of entries written (at most MIXER_RECENT_PLAYS)
+ */
+int audio_mixer_get_recent_plays(audio_recent_play_t *out, int max);
+
+/**
+ * @brief Reset real-time metrics (pass times, starvation, decoder time)
+ */
+void audio_mixer_reset_perf(void);
+
 #endif // AUDIO_MIXER_H
@@ -17,6 +17,25 @@
 extern "C" {
 #endif
 
+/**
+ * @brief SD card availability (the card is mounted in the background at boot)
+ */
+typedef enum {
+    AUDIO_SD_PENDING = 0,      ///< Mount / indexing still running
+    AUDIO_SD_READY,            ///< Mounted and indexed
+    AUDIO_SD_UNAVAILABLE,      ///< No card or mount failed
+} audio_sd_state_t;
+
+/**
+ * @brief Set the SD card state (boot task)
+ */
+void audio_player_set_sd_state(audio_sd_state_t state);
+
+/**
+ * @brief Get the SD card state
+ */
+audio_sd_state_t audio_player_get_sd_state(void);
+
 /**
  * @brief Play a sound by ID (unified entry point)
  * 
@@ -35,8 +54,13 @@ extern "C" {
  * @param loop Enable looping playback
  * @param interrupt Interrupt currently playing sounds
  * @param handle Output parameter for mixer source handle
+ * While the SD card is still being mounted (AUDIO_SD_PENDING) only
+ * embedded sounds play; other IDs return ESP_ERR_NOT_FINISHED so the caller
+ * can retry once the card is ready.
+ * 
  * @return ESP_OK on success
  * @return ESP_ERR_NOT_FOUND if sound not found (SD or embedded)
+ * @return ESP_ERR_NOT_FINISHED if the sound is not embedded and the SD card is not ready yet
  * @return ESP_FAIL on playback error
  */
 esp_err_t audio_player_play_sound(uint16_t sound_id, 
@@ -76,7 +100,7 @@ size_t audio_player_get_embedded_count(void);
  * @param index Index in embedded sounds array (0 to count-1)
  * @param sound_id Output: sound ID
  * @param name Output: sound name
- * @param size Output: sound size in bytes
+ * @param size Output: PCM size in bytes
  * @return ESP_OK on success, ESP_ERR_INVALID_ARG if index out of range
  */
 esp_err_t audio_player_get_embedded_info(size_t index, uint16_t *sound_id, 
@@ -84,7 +108,7 @@ esp_err_t audio_player_get_embedded_info(size_t index, uint16_t *sound_id,
 
 /**
  * @brief Get total size of all embedded sounds
- * @return Total bytes used by embedded sounds
+ * @return Bytes of flash used by the embedded sound blob
  */
 size_t audio_player_get_total_embedded_size(void);
 
@@ -77,7 +77,7 @@ extern "C" {
 /*------------------------------------------------------------------------
  *  Audio Configuration
  *-----------------------------------------------------------------------*/
-#define DEFAULT_SAMPLE_RATE  44100  // Default sample rate (Hz)
+#define DEFAULT_SAMPLE_RATE  22050  // Boot output rate (Hz), native rate of all shipped sounds
 
 #ifdef __cplusplus
 }
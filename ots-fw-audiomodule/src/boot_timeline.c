@@ -0,0 +1,41 @@
+/**
+ * @file boot_timeline.c
+ * @brief Boot stage timestamps implementation
+ */
+
+#include "boot_timeline.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "BOOT";
+
+static int64_t s_stage_us[BOOT_STAGE_COUNT];
+
+static const char *const s_stage_names[BOOT_STAGE_COUNT] = {
+    [BOOT_STAGE_CAN_READY]      = "CAN ready",
+    [BOOT_STAGE_AUDIO_READY]    = "Audio ready",
+    [BOOT_STAGE_READY_SOUND]    = "Ready sound",
+    [BOOT_STAGE_SD_READY]       = "SD ready",
+    [BOOT_STAGE_FIRST_ANNOUNCE] = "First announce",
+    [BOOT_STAGE_FIRST_ACK]      = "First ACK",
+};
+
+void boot_timeline_mark(boot_stage_t stage)
+{
+    if (stage >= BOOT_STAGE_COUNT || s_stage_us[stage] != 0) {
+        return;
+    }
+    // Stages are marked from different tasks, each stage by one task only
+    s_stage_us[stage] = esp_timer_get_time();
+    ESP_LOGI(TAG, "%s at %lu ms", s_stage_names[stage], (unsigned long)(s_stage_us[stage] / 1000));
+}
+
+int64_t boot_timeline_get_us(boot_stage_t stage)
+{
+    return (stage < BOOT_STAGE_COUNT) ? s_stage_us[stage] : 0;
+}
+
+const char *boot_timeline_stage_name(boot_stage_t stage)
+{
+    return (stage < BOOT_STAGE_COUNT) ? s_stage_names[stage] : "?";
+}
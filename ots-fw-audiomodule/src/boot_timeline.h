@@ -0,0 +1,50 @@
+/**
+ * @file boot_timeline.h
+ * @brief Boot stage timestamps
+ *
+ * The audio module boots in stages: CAN and embedded playback first, the SD
+ * card (mount, sound index, bank) in a background task. Each stage records
+ * when it was reached (esp_timer time, i.e. since the application started;
+ * the ROM and second-stage bootloader run before that).
+ */
+
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    BOOT_STAGE_CAN_READY = 0,   ///< CAN handler answers discovery and PLAY requests
+    BOOT_STAGE_AUDIO_READY,     ///< Codec and mixer initialized (CAN PLAY requests wait for it); not reached if either failed
+    BOOT_STAGE_READY_SOUND,     ///< Boot-ready sound started
+    BOOT_STAGE_SD_READY,        ///< SD mounted and indexed (or found missing)
+    BOOT_STAGE_FIRST_ANNOUNCE,  ///< First MODULE_ANNOUNCE sent
+    BOOT_STAGE_FIRST_ACK,       ///< First SOUND_ACK sent
+    BOOT_STAGE_COUNT
+} boot_stage_t;
+
+/**
+ * @brief Record that a stage was reached (only the first call counts)
+ */
+void boot_timeline_mark(boot_stage_t stage);
+
+/**
+ * @brief Time a stage was reached
+ * @return Microseconds since application start, 0 if not reached yet
+ */
+int64_t boot_timeline_get_us(boot_stage_t stage);
+
+/**
+ * @brief Printable stage name
+ */
+const char *boot_timeline_stage_name(boot_stage_t stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BOOT_TIMELINE_H
@@ -10,10 +10,13 @@
 #include "sound_config.h"
 #include "audio_mixer.h"
 #include "audio_player.h"
+#include "boot_timeline.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 
 static const char *TAG = "CAN_AUDIO";
 
@@ -25,6 +28,161 @@ static uint8_t g_last_error = CAN_AUDIO_ERR_OK;
 // Queue ID allocator state (using shared utility function)
 static uint8_t g_next_queue_id = 1;
 
+// PLAY requests received while the codec/mixer or the SD card are still
+// starting: ACKed with a queue ID right away, played once they are ready
+#define MAX_PENDING_PLAYS 8
+
+typedef struct {
+    uint16_t sound_index;
+    uint8_t flags;
+    uint8_t volume;
+    uint8_t queue_id;
+} pending_play_t;
+
+static pending_play_t g_pending[MAX_PENDING_PLAYS];
+static int g_pending_count = 0;
+
+// Codec or mixer failed at boot: audio never becomes ready
+static volatile bool g_audio_failed = false;
+
+// Decoder time at the previous SOUND_PERF (CPU share per interval)
+static uint64_t g_perf_convert_us = 0;
+static int64_t g_perf_time_us = 0;
+
+static uint8_t perf_u8(uint64_t value)
+{
+    return (value < CAN_AUDIO_PERF_NONE) ? (uint8_t)value : CAN_AUDIO_PERF_NONE - 1;
+}
+
+/**
+ * @brief Send the SOUND_PERF metrics frame (after each STATUS)
+ */
+static void send_perf_frame(void)
+{
+    audio_mixer_perf_t perf;
+    audio_mixer_get_perf(&perf);
+    
+    can_audio_perf_t msg;
+    int min_fill = audio_mixer_get_min_voice_fill();
+    msg.min_voice_fill = (min_fill < 0) ? CAN_AUDIO_PERF_NONE : (uint8_t)min_fill;
+    msg.loop_p99 = perf_u8(perf.budget_us ? (uint64_t)perf.p99_us * 100 / perf.budget_us : 0);
+    msg.underruns = perf_u8(perf.playback_underruns);
+    msg.voice_starved = perf_u8(perf.voice_starved);
+    
+    // Decoder CPU since the last frame; the console may have reset the totals
+    int64_t now = esp_timer_get_time();
+    uint64_t convert_us = (perf.decode_convert_us >= g_perf_convert_us) ?
+                          perf.decode_convert_us - g_perf_convert_us : perf.decode_convert_us;
+    msg.decoder_cpu = (g_perf_time_us && now > g_perf_time_us) ?
+                      perf_u8(convert_us * 100 / (uint64_t)(now - g_perf_time_us)) : 0;
+    g_perf_convert_us = perf.decode_convert_us;
+    g_perf_time_us = now;
+    
+    // 4 KiB units: KiB would saturate at 254 with more than that free
+    msg.heap_free_4k = perf_u8(heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / CAN_AUDIO_PERF_HEAP_UNIT);
+    size_t psram_total = heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
+    msg.psram_free = psram_total ?
+                     perf_u8((uint64_t)heap_caps_get_free_size(MALLOC_CAP_SPIRAM) * 100 / psram_total) :
+                     CAN_AUDIO_PERF_NONE;
+    
+    audio_recent_play_t last;
+    msg.last_ttfs_ms = (audio_mixer_get_recent_plays(&last, 1) == 1) ?
+                       perf_u8(last.latency_us / 1000) : CAN_AUDIO_PERF_NONE;
+    
+    can_frame_t frame;
+    can_audio_build_sound_perf(&msg, &frame);
+    can_driver_send(&frame);
+}
+
+/**
+ * @brief Whether boot has finished bringing up the codec and mixer
+ * 
+ * The CAN handler starts before them; mixer calls wait until then.
+ */
+static bool audio_ready(void)
+{
+    if (g_audio_failed) {
+        return false;
+    }
+    return boot_timeline_get_us(BOOT_STAGE_AUDIO_READY) != 0;
+}
+
+static int active_source_count(void)
+{
+    return audio_ready() ? audio_mixer_get_active_count() : 0;
+}
+
+static void send_sound_ack(bool ok, uint16_t sound_index, uint8_t queue_id,
+                           uint8_t error_code, uint16_t request_id)
+{
+    can_frame_t ack_frame;
+    can_audio_build_sound_ack(ok ? 1 : 0, sound_index, queue_id, error_code, request_id, &ack_frame);
+    can_driver_send(&ack_frame);
+    boot_timeline_mark(BOOT_STAGE_FIRST_ACK);
+}
+
+/**
+ * @brief Retry the queued requests
+ * 
+ * Requests still waiting for the SD card stay queued. One that fails
+ * ends with SOUND_FINISHED (error), as its ACK was positive.
+ */
+static void play_pending_requests(void)
+{
+    int kept = 0;
+    for (int i = 0; i < g_pending_count; i++) {
+        const pending_play_t *p = &g_pending[i];
+        bool loop = (p->flags & CAN_AUDIO_FLAG_LOOP) != 0;
+        bool interrupt = (p->flags & CAN_AUDIO_FLAG_INTERRUPT) != 0;
+        audio_source_handle_t handle;
+        
+        esp_err_t ret = audio_player_play_sound(p->sound_index, p->volume, loop, interrupt, &handle);
+        if (ret == ESP_ERR_NOT_FINISHED) {
+            g_pending[kept++] = *p;
+        } else if (ret == ESP_OK) {
+            audio_mixer_set_queue_id(handle, p->queue_id, p->sound_index);
+            g_last_sound_index = p->sound_index;
+            ESP_LOGI(TAG, "Queued sound %d started (queue_id=%d)", p->sound_index, p->queue_id);
+        } else {
+            ESP_LOGW(TAG, "Queued sound %d failed: %s", p->sound_index, esp_err_to_name(ret));
+            g_last_error = (ret == ESP_ERR_NOT_FOUND) ? CAN_AUDIO_ERR_FILE_NOT_FOUND : CAN_AUDIO_ERR_SD_ERROR;
+            can_audio_handler_sound_finished(p->queue_id, p->sound_index, CAN_AUDIO_FINISHED_ERROR);
+        }
+    }
+    g_pending_count = kept;
+}
+
+/**
+ * @brief End the queued requests when audio failed at boot
+ * 
+ * Their ACK was positive, so each ends with SOUND_FINISHED (error).
+ */
+static void fail_pending_requests(void)
+{
+    for (int i = 0; i < g_pending_count; i++) {
+        ESP_LOGW(TAG, "Queued sound %d dropped: audio output failed", g_pending[i].sound_index);
+        can_audio_handler_sound_finished(g_pending[i].queue_id, g_pending[i].sound_index,
+                                         CAN_AUDIO_FINISHED_ERROR);
+    }
+    g_pending_count = 0;
+    g_last_error = CAN_AUDIO_ERR_SD_ERROR;
+}
+
+/**
+ * @brief Drop a queued request (STOP_SOUND before it started)
+ * @return true if queue_id was queued
+ */
+static bool cancel_pending_request(uint8_t queue_id)
+{
+    for (int i = 0; i < g_pending_count; i++) {
+        if (g_pending[i].queue_id == queue_id) {
+            g_pending[i] = g_pending[--g_pending_count];
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * @brief CAN RX task - receives and processes CAN messages
  */
@@ -51,6 +209,7 @@ static void can_rx_task(void *arg)
                     0x42,                    // CAN block: 0x420-0x42F
                     0                        // Node ID (single module)
                 );
+                boot_timeline_mark(BOOT_STAGE_FIRST_ANNOUNCE);
             }
             // Handle PLAY_SOUND command (0x420)
             else if (frame.id == CAN_ID_PLAY_SOUND) {
@@ -62,7 +221,7 @@ static void can_rx_task(void *arg)
                     ESP_LOGI(TAG, "PLAY_SOUND: index=%d flags=0x%02X vol=%d req_id=%d",
                              sound_index, flags, volume, request_id);
                     
-                    int active_count = audio_mixer_get_active_count();
+                    int active_count = active_source_count();
                     bool should_play = (active_count < MAX_AUDIO_SOURCES) || (flags & CAN_AUDIO_FLAG_INTERRUPT);
                     
                     if (should_play) {
@@ -71,11 +230,28 @@ static void can_rx_task(void *arg)
                         
                         g_last_sound_index = sound_index;
                         audio_source_handle_t handle;
-                        esp_err_t ret = audio_player_play_sound(sound_index, volume, loop, interrupt, &handle);
+                        esp_err_t ret = g_audio_failed ? ESP_ERR_INVALID_STATE :
+                            audio_ready() ?
+                            audio_player_play_sound(sound_index, volume, loop, interrupt, &handle) :
+                            ESP_ERR_NOT_FINISHED;
                         
                         uint8_t queue_id = 0;
                         uint8_t error_code = CAN_AUDIO_ERR_OK;
                         
+                        if (ret == ESP_ERR_NOT_FINISHED && g_pending_count < MAX_PENDING_PLAYS) {
+                            // Audio or SD card still starting: play it once ready
+                            queue_id = can_audio_allocate_queue_id(&g_next_queue_id);
+                            g_pending[g_pending_count++] = (pending_play_t){
+                                .sound_index = sound_index,
+                                .flags = flags,
+                                .volume = volume,
+                                .queue_id = queue_id,
+                            };
+                            send_sound_ack(true, sound_index, queue_id, CAN_AUDIO_ERR_OK, request_id);
+                            ESP_LOGI(TAG, "Sound %d queued until ready (queue_id=%d)", sound_index, queue_id);
+                            continue;
+                        }
+                        
                         if (ret == ESP_OK) {
                             // Allocate queue ID and associate with source
                             queue_id = can_audio_allocate_queue_id(&g_next_queue_id);
@@ -84,12 +260,19 @@ static void can_rx_task(void *arg)
                             error_code = CAN_AUDIO_ERR_OK;
                         } else {
                             // Map ESP error codes to CAN audio error codes
-                            if (ret == ESP_ERR_NOT_FOUND) {
+                            if (ret == ESP_ERR_NOT_FINISHED) {
+                                error_code = CAN_AUDIO_ERR_BUSY;  // Queue of boot requests full
+                                ESP_LOGE(TAG, "Sound %d: not ready and %d requests already queued",
+                                         sound_index, MAX_PENDING_PLAYS);
+                            } else if (ret == ESP_ERR_NOT_FOUND) {
                                 error_code = CAN_AUDIO_ERR_FILE_NOT_FOUND;
                                 ESP_LOGE(TAG, "Sound %d: File not found or SD card not mounted", sound_index);
                             } else if (ret == ESP_ERR_INVALID_ARG) {
                                 error_code = CAN_AUDIO_ERR_SD_ERROR;  // Invalid WAV file
                                 ESP_LOGE(TAG, "Sound %d: Invalid WAV file format", sound_index);
+                            } else if (ret == ESP_ERR_INVALID_STATE && g_audio_failed) {
+                                error_code = CAN_AUDIO_ERR_SD_ERROR;  // Generic error
+                                ESP_LOGE(TAG, "Sound %d: Audio output failed at boot", sound_index);
                             } else if (ret == ESP_FAIL) {
                                 error_code = CAN_AUDIO_ERR_MIXER_FULL;  // Could be mixer full
                                 ESP_LOGE(TAG, "Sound %d: Mixer error (possibly full)", sound_index);
@@ -101,31 +284,13 @@ static void can_rx_task(void *arg)
                         
                         g_last_error = error_code;
                         
-                        // Send ACK with queue_id (new 5-parameter signature)
-                        can_frame_t ack_frame;
-                        can_audio_build_sound_ack(
-                            ret == ESP_OK ? 1 : 0,  // ok
-                            sound_index,            // sound_index
-                            queue_id,               // queue_id (0 if error)
-                            error_code,             // error_code
-                            request_id,             // request_id
-                            &ack_frame
-                        );
-                        can_driver_send(&ack_frame);
+                        // Send ACK with queue_id (0 if error)
+                        send_sound_ack(ret == ESP_OK, sound_index, queue_id, error_code, request_id);
                         ESP_LOGI(TAG, "Sent ACK: ok=%d queue_id=%d error=0x%02X active=%d", 
-                                ret == ESP_OK, queue_id, error_code, audio_mixer_get_active_count());
+                                ret == ESP_OK, queue_id, error_code, active_source_count());
                     } else {
                         // Mixer full - send error ACK
-                        can_frame_t ack_frame;
-                        can_audio_build_sound_ack(
-                            0,                      // ok=false
-                            sound_index,
-                            0,                      // queue_id=0 (error)
-                            CAN_AUDIO_ERR_MIXER_FULL,     // error_code
-                            request_id,
-                            &ack_frame
-                        );
-                        can_driver_send(&ack_frame);
+                        send_sound_ack(false, sound_index, 0, CAN_AUDIO_ERR_MIXER_FULL, request_id);
                         ESP_LOGW(TAG, "Sent NACK: mixer full (max sources=%d)", MAX_AUDIO_SOURCES);
                     }
                 }
@@ -139,7 +304,9 @@ static void can_rx_task(void *arg)
                 if (can_audio_parse_stop_sound(&frame, &queue_id, &flags, &request_id)) {
                     ESP_LOGI(TAG, "STOP_SOUND: queue_id=%d flags=0x%02X", queue_id, flags);
                     
-                    esp_err_t ret = audio_mixer_stop_by_queue_id(queue_id);
+                    esp_err_t ret = cancel_pending_request(queue_id) ? ESP_OK :
+                                    audio_ready() ? audio_mixer_stop_by_queue_id(queue_id) :
+                                    ESP_ERR_NOT_FOUND;
                     
                     // Send ACK (reusing SOUND_ACK format)
                     can_frame_t ack_frame;
@@ -163,20 +330,29 @@ static void can_rx_task(void *arg)
             // Handle STOP_ALL command (0x424)
             else if (frame.id == CAN_ID_STOP_ALL) {
                 ESP_LOGI(TAG, "STOP_ALL received");
-                audio_mixer_stop_all();
+                g_pending_count = 0;
+                if (audio_ready()) {
+                    audio_mixer_stop_all();
+                }
                 ESP_LOGI(TAG, "Stopped all sources");
             }
         }
         
+        if (g_pending_count > 0 && g_audio_failed) {
+            fail_pending_requests();
+        } else if (g_pending_count > 0 && audio_ready()) {
+            play_pending_requests();
+        }
+        
         // Send periodic STATUS message every 5 seconds
         uptime_sec = esp_log_timestamp() / 1000;
         if (uptime_sec % (CAN_AUDIO_STATUS_INTERVAL_MS / 1000) == 0) {
-            int active_sources = audio_mixer_get_active_count();
+            int active_sources = active_source_count();
             
             uint8_t state_bits = 0;
             if (g_sd_mounted && *g_sd_mounted) state_bits |= CAN_AUDIO_STATUS_SD_MOUNTED;
             if (active_sources > 0) state_bits |= CAN_AUDIO_STATUS_PLAYING;
-            if (g_last_error == 0) state_bits |= CAN_AUDIO_STATUS_READY;
+            if (g_last_error == 0 && audio_ready()) state_bits |= CAN_AUDIO_STATUS_READY;
             if (g_last_error != 0) state_bits |= CAN_AUDIO_STATUS_ERROR;
             
             can_frame_t status_frame;
@@ -186,9 +362,13 @@ static void can_rx_task(void *arg)
                 g_last_error,
                 CAN_AUDIO_VOLUME_USE_POT,  // Volume from pot
                 uptime_sec,
+                (uint8_t)active_sources,
                 &status_frame
             );
             can_driver_send(&status_frame);
+            if (audio_ready()) {
+                send_perf_frame();
+            }
             
             ESP_LOGI(TAG, "STATUS: bits=0x%02X active=%d uptime=%lus",
                      state_bits, active_sources, (unsigned long)uptime_sec);
@@ -226,6 +406,11 @@ esp_err_t can_audio_handler_start_task(void)
     return (ret == pdPASS) ? ESP_OK : ESP_FAIL;
 }
 
+void can_audio_handler_set_audio_failed(void)
+{
+    g_audio_failed = true;
+}
+
 void can_audio_handler_sound_finished(uint8_t queue_id, uint16_t sound_index, uint8_t reason)
 {
     if (!can_audio_queue_id_is_valid(queue_id)) {
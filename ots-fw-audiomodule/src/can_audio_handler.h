@@ -31,6 +31,15 @@ esp_err_t can_audio_handler_init(bool *sd_mounted);
  */
 esp_err_t can_audio_handler_start_task(void);
 
+/**
+ * @brief Report that the codec or mixer failed to start
+ * 
+ * PLAY requests are then answered with an error ACK, and those queued while
+ * audio was starting end with SOUND_FINISHED (error). Without this call
+ * they wait for BOOT_STAGE_AUDIO_READY.
+ */
+void can_audio_handler_set_audio_failed(void);
+
 /**
  * @brief Notify CAN handler that a sound has finished playback
  * 
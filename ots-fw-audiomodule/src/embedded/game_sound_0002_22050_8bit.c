@@ -1,3697 +0,0 @@
-/**
- * @file game_sound_0002_22050_8bit.c
- * @brief Embedded sound data: game_defeat (ID 0002)
- * 
- * Auto-generated from /home/drzoid/dev/openfront/ots/ots-fw-audiomodule/sounds/0002.wav
- * Format: 8-bit PCM, 22050 Hz, Mono
- * Size: 44178 bytes
- */
-
-#include "embedded/game_sound_0002_22050_8bit.h"
-
-const uint8_t game_sound_0002_22050_8bit_wav[] = {
-0x52, 0x49, 0x46, 0x46, 0x8a, 0xac, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-0x22, 0x56, 0x00, 0x00, 0x22, 0x56, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-0x4c, 0x49, 0x53, 0x54, 0x1a, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x46, 0x4f,
-0x49, 0x53, 0x46, 0x54, 0x0e, 0x00, 0x00, 0x00, 0x4c, 0x61, 0x76, 0x66,
-0x36, 0x30, 0x2e, 0x31, 0x36, 0x2e, 0x31, 0x30, 0x30, 0x00, 0x64, 0x61,
-0x74, 0x61, 0x44, 0xac, 0x00, 0x00, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83,
-0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86,
-0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78,
-0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86,
-0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81,
-0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b,
-0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79,
-0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82,
-0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81,
-0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77,
-0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78,
-0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77,
-0x78, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87,
-0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a,
-0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74,
-0x75, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80,
-0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80,
-0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7e,
-0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83,
-0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b,
-0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86,
-0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78,
-0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88,
-0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88,
-0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79,
-0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85,
-0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b,
-0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x81, 0x82,
-0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e,
-0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80,
-0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81,
-0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74,
-0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
-0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89,
-0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-0x85, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x77,
-0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87,
-0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89,
-0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x79,
-0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84,
-0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a,
-0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7c,
-0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75,
-0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x82,
-0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b,
-0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x80, 0x7f,
-0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-0x74, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7f,
-0x80, 0x81, 0x83, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b,
-0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82,
-0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x76, 0x75, 0x75,
-0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7c,
-0x7d, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
-0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76,
-0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79,
-0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88,
-0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-0x86, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-0x77, 0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x77,
-0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e
-};
-
-const size_t game_sound_0002_22050_8bit_wav_len = sizeof(game_sound_0002_22050_8bit_wav);
@@ -1,886 +0,0 @@
-/**
- * @file game_sound_10100_22050_8bit.c
- * @brief Embedded sound data: quack_sound (ID 10100)
- * 
- * Auto-generated from /home/drzoid/dev/openfront/ots/ots-fw-audiomodule/sounds/10100.wav
- * Format: 8-bit PCM, 22050 Hz, Mono
- * Size: 10448 bytes
- */
-
-#include "embedded/game_sound_10100_22050_8bit.h"
-
-const uint8_t game_sound_10100_22050_8bit_wav[] = {
-0x52, 0x49, 0x46, 0x46, 0xc8, 0x28, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-0x22, 0x56, 0x00, 0x00, 0x22, 0x56, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-0x4c, 0x49, 0x53, 0x54, 0x1a, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x46, 0x4f,
-0x49, 0x53, 0x46, 0x54, 0x0e, 0x00, 0x00, 0x00, 0x4c, 0x61, 0x76, 0x66,
-0x36, 0x30, 0x2e, 0x31, 0x36, 0x2e, 0x31, 0x30, 0x30, 0x00, 0x64, 0x61,
-0x74, 0x61, 0x82, 0x28, 0x00, 0x00, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80,
-0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
-0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80,
-0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f,
-0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d,
-0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80,
-0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80,
-0x7f, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f,
-0x80, 0x82, 0x82, 0x83, 0x85, 0x86, 0x87, 0x87, 0x86, 0x85, 0x83, 0x81,
-0x80, 0x7f, 0x7d, 0x7a, 0x78, 0x76, 0x74, 0x73, 0x73, 0x72, 0x73, 0x74,
-0x75, 0x78, 0x7a, 0x7d, 0x80, 0x83, 0x86, 0x88, 0x89, 0x8a, 0x8a, 0x89,
-0x86, 0x83, 0x80, 0x7c, 0x79, 0x75, 0x72, 0x6f, 0x6e, 0x6e, 0x6e, 0x70,
-0x71, 0x73, 0x75, 0x78, 0x7b, 0x7d, 0x80, 0x82, 0x84, 0x85, 0x86, 0x86,
-0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f,
-0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x86,
-0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8d, 0x8d, 0x8e, 0x8d, 0x8c, 0x8c, 0x8b,
-0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x88, 0x87, 0x86, 0x86, 0x86, 0x87,
-0x87, 0x86, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8b,
-0x8c, 0x8b, 0x8a, 0x89, 0x87, 0x85, 0x83, 0x80, 0x7c, 0x7a, 0x79, 0x78,
-0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x7a, 0x7b, 0x7d, 0x7e, 0x7e, 0x7f,
-0x7f, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c,
-0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x74, 0x73, 0x71, 0x70,
-0x6f, 0x70, 0x71, 0x73, 0x75, 0x77, 0x78, 0x7a, 0x7c, 0x7e, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7b, 0x78, 0x75, 0x72,
-0x6f, 0x6d, 0x6a, 0x68, 0x66, 0x65, 0x66, 0x68, 0x6a, 0x6d, 0x70, 0x73,
-0x76, 0x7a, 0x7d, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x78, 0x79, 0x7b,
-0x7c, 0x7f, 0x81, 0x83, 0x86, 0x88, 0x8b, 0x8d, 0x8e, 0x8f, 0x90, 0x90,
-0x91, 0x91, 0x92, 0x91, 0x90, 0x8f, 0x8c, 0x89, 0x86, 0x84, 0x82, 0x80,
-0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x85, 0x87,
-0x8a, 0x8d, 0x90, 0x93, 0x95, 0x98, 0x9c, 0x9e, 0xa0, 0xa1, 0xa1, 0x9f,
-0x9d, 0x99, 0x95, 0x8e, 0x85, 0x7b, 0x71, 0x68, 0x61, 0x5c, 0x5a, 0x5b,
-0x5d, 0x61, 0x67, 0x6f, 0x78, 0x82, 0x8b, 0x93, 0x99, 0x9e, 0xa1, 0xa2,
-0xa2, 0xa1, 0x9d, 0x99, 0x92, 0x8a, 0x81, 0x77, 0x6e, 0x67, 0x63, 0x60,
-0x5d, 0x5c, 0x5c, 0x5e, 0x62, 0x69, 0x70, 0x77, 0x7c, 0x81, 0x84, 0x87,
-0x89, 0x8b, 0x8d, 0x8d, 0x8d, 0x8c, 0x8a, 0x86, 0x82, 0x7d, 0x78, 0x73,
-0x6e, 0x69, 0x65, 0x61, 0x60, 0x60, 0x63, 0x68, 0x6e, 0x73, 0x77, 0x7a,
-0x7b, 0x7c, 0x7d, 0x7c, 0x7a, 0x76, 0x72, 0x6f, 0x6c, 0x6a, 0x68, 0x67,
-0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x6a, 0x6b, 0x6c,
-0x6d, 0x6e, 0x6f, 0x70, 0x70, 0x6f, 0x6d, 0x6b, 0x68, 0x66, 0x63, 0x61,
-0x61, 0x63, 0x67, 0x6d, 0x73, 0x7a, 0x80, 0x86, 0x8b, 0x8e, 0x8f, 0x8e,
-0x8d, 0x8c, 0x8d, 0x8f, 0x90, 0x92, 0x93, 0x94, 0x95, 0x96, 0x95, 0x92,
-0x8f, 0x8c, 0x8c, 0x8d, 0x91, 0x95, 0x99, 0x9e, 0xa4, 0xab, 0xb3, 0xba,
-0xc0, 0xc5, 0xca, 0xce, 0xd3, 0xd5, 0xd4, 0xcf, 0xc4, 0xb2, 0x9c, 0x83,
-0x6a, 0x55, 0x46, 0x3d, 0x39, 0x3c, 0x45, 0x56, 0x6c, 0x86, 0x9f, 0xb3,
-0xc1, 0xc8, 0xc9, 0xc7, 0xc0, 0xb6, 0xa8, 0x98, 0x87, 0x75, 0x63, 0x52,
-0x43, 0x36, 0x2e, 0x2b, 0x2d, 0x31, 0x39, 0x45, 0x56, 0x6a, 0x80, 0x93,
-0xa1, 0xa8, 0xab, 0xac, 0xab, 0xa8, 0xa3, 0x9b, 0x93, 0x8c, 0x86, 0x82,
-0x7f, 0x7c, 0x7b, 0x7c, 0x7e, 0x82, 0x85, 0x89, 0x8e, 0x93, 0x98, 0x9c,
-0x9d, 0x9c, 0x99, 0x95, 0x91, 0x8f, 0x8c, 0x89, 0x85, 0x82, 0x80, 0x7f,
-0x80, 0x82, 0x84, 0x87, 0x8a, 0x8d, 0x8f, 0x90, 0x8e, 0x8a, 0x84, 0x7d,
-0x76, 0x6f, 0x69, 0x64, 0x5e, 0x59, 0x54, 0x4f, 0x4c, 0x49, 0x48, 0x49,
-0x4c, 0x52, 0x58, 0x5f, 0x66, 0x6b, 0x6f, 0x71, 0x71, 0x6f, 0x6a, 0x63,
-0x5c, 0x56, 0x52, 0x51, 0x51, 0x52, 0x52, 0x52, 0x53, 0x54, 0x56, 0x59,
-0x5d, 0x63, 0x6a, 0x72, 0x7a, 0x81, 0x85, 0x87, 0x86, 0x83, 0x7e, 0x7a,
-0x78, 0x78, 0x7c, 0x83, 0x8b, 0x91, 0x96, 0x9a, 0x9d, 0xa0, 0xa3, 0xa7,
-0xac, 0xb3, 0xbc, 0xc7, 0xd2, 0xdb, 0xe0, 0xe0, 0xd9, 0xc9, 0xb2, 0x94,
-0x73, 0x55, 0x3f, 0x36, 0x37, 0x42, 0x53, 0x67, 0x7e, 0x96, 0xad, 0xc1,
-0xcf, 0xd3, 0xd0, 0xc6, 0xb9, 0xac, 0x9f, 0x93, 0x87, 0x7b, 0x6e, 0x61,
-0x56, 0x4d, 0x47, 0x44, 0x46, 0x4c, 0x57, 0x66, 0x77, 0x89, 0x99, 0xa5,
-0xac, 0xab, 0xa5, 0x9a, 0x8e, 0x83, 0x7c, 0x79, 0x7a, 0x7e, 0x85, 0x8c,
-0x94, 0x9a, 0x9b, 0x98, 0x92, 0x8a, 0x85, 0x81, 0x7f, 0x7e, 0x7e, 0x7f,
-0x80, 0x81, 0x7f, 0x79, 0x71, 0x69, 0x64, 0x64, 0x69, 0x72, 0x80, 0x8e,
-0x9d, 0xa8, 0xad, 0xaa, 0xa1, 0x93, 0x83, 0x72, 0x63, 0x56, 0x4c, 0x48,
-0x49, 0x4f, 0x56, 0x5e, 0x65, 0x6c, 0x71, 0x73, 0x71, 0x6b, 0x63, 0x5e,
-0x5b, 0x5b, 0x5b, 0x5a, 0x57, 0x53, 0x50, 0x4e, 0x4b, 0x49, 0x46, 0x46,
-0x4b, 0x54, 0x60, 0x6d, 0x78, 0x80, 0x85, 0x87, 0x85, 0x7e, 0x74, 0x68,
-0x5c, 0x55, 0x52, 0x53, 0x59, 0x64, 0x72, 0x82, 0x91, 0x9d, 0xa6, 0xab,
-0xad, 0xab, 0xa6, 0xa0, 0x98, 0x93, 0x8f, 0x8f, 0x90, 0x95, 0x9d, 0xa9,
-0xb9, 0xcc, 0xdf, 0xed, 0xf2, 0xeb, 0xd7, 0xb8, 0x91, 0x67, 0x3e, 0x1b,
-0x02, 0x00, 0x00, 0x15, 0x37, 0x61, 0x8b, 0xb2, 0xd2, 0xe6, 0xed, 0xe6,
-0xd3, 0xba, 0xa1, 0x8c, 0x7d, 0x72, 0x67, 0x5d, 0x52, 0x4a, 0x46, 0x46,
-0x4a, 0x50, 0x57, 0x5f, 0x67, 0x71, 0x7a, 0x80, 0x83, 0x81, 0x7c, 0x77,
-0x74, 0x75, 0x7d, 0x8a, 0x99, 0xa6, 0xae, 0xb0, 0xac, 0xa2, 0x96, 0x87,
-0x7a, 0x6e, 0x65, 0x60, 0x60, 0x64, 0x6c, 0x78, 0x83, 0x8c, 0x90, 0x91,
-0x90, 0x8f, 0x90, 0x91, 0x91, 0x8e, 0x89, 0x83, 0x7d, 0x79, 0x77, 0x77,
-0x7a, 0x7f, 0x84, 0x89, 0x8d, 0x8f, 0x8e, 0x8a, 0x85, 0x80, 0x7b, 0x77,
-0x75, 0x72, 0x6f, 0x6a, 0x63, 0x5a, 0x51, 0x48, 0x41, 0x3d, 0x3c, 0x3e,
-0x43, 0x4a, 0x53, 0x5d, 0x69, 0x75, 0x80, 0x8a, 0x91, 0x92, 0x8d, 0x80,
-0x6f, 0x5d, 0x4e, 0x45, 0x42, 0x45, 0x4c, 0x58, 0x67, 0x76, 0x84, 0x8b,
-0x8a, 0x81, 0x75, 0x6b, 0x67, 0x6a, 0x74, 0x81, 0x91, 0xa1, 0xae, 0xb6,
-0xb9, 0xb8, 0xb7, 0xbb, 0xc2, 0xcb, 0xd1, 0xd4, 0xd5, 0xd2, 0xc9, 0xb4,
-0x91, 0x63, 0x33, 0x10, 0x03, 0x0c, 0x26, 0x47, 0x69, 0x8a, 0xa9, 0xc4,
-0xd6, 0xda, 0xcd, 0xb3, 0x93, 0x76, 0x61, 0x56, 0x56, 0x5f, 0x6f, 0x82,
-0x94, 0xa0, 0xa7, 0xa7, 0xa3, 0x99, 0x88, 0x71, 0x56, 0x3a, 0x24, 0x16,
-0x14, 0x1b, 0x29, 0x3d, 0x57, 0x75, 0x96, 0xb6, 0xcd, 0xd7, 0xd2, 0xbe,
-0xa3, 0x85, 0x6b, 0x59, 0x51, 0x52, 0x5c, 0x6c, 0x7f, 0x8f, 0x9a, 0x9e,
-0x9b, 0x92, 0x86, 0x77, 0x6a, 0x61, 0x5e, 0x63, 0x6d, 0x7a, 0x87, 0x92,
-0x9e, 0xaa, 0xb7, 0xc1, 0xc4, 0xbd, 0xab, 0x91, 0x75, 0x5d, 0x4b, 0x42,
-0x42, 0x4c, 0x5d, 0x72, 0x88, 0x98, 0xa1, 0x9f, 0x92, 0x7d, 0x66, 0x52,
-0x47, 0x46, 0x4e, 0x5a, 0x66, 0x6e, 0x70, 0x6b, 0x62, 0x59, 0x55, 0x57,
-0x60, 0x6d, 0x7a, 0x82, 0x85, 0x82, 0x7c, 0x73, 0x67, 0x5a, 0x4f, 0x4b,
-0x4e, 0x5a, 0x69, 0x77, 0x82, 0x88, 0x8b, 0x8d, 0x8f, 0x91, 0x96, 0x9e,
-0xaa, 0xbb, 0xcd, 0xdd, 0xea, 0xf5, 0xfb, 0xfd, 0xf4, 0xdd, 0xb7, 0x85,
-0x52, 0x29, 0x13, 0x12, 0x25, 0x46, 0x6f, 0x9d, 0xc7, 0xe8, 0xf7, 0xf0,
-0xd4, 0xaa, 0x7e, 0x5b, 0x48, 0x49, 0x59, 0x72, 0x8b, 0x9b, 0xa0, 0x98,
-0x87, 0x73, 0x5f, 0x4e, 0x41, 0x37, 0x30, 0x2e, 0x31, 0x37, 0x3d, 0x42,
-0x45, 0x4b, 0x56, 0x69, 0x80, 0x97, 0xa4, 0xa5, 0x98, 0x83, 0x6d, 0x5e,
-0x58, 0x5c, 0x67, 0x75, 0x83, 0x8d, 0x92, 0x93, 0x8f, 0x89, 0x81, 0x7b,
-0x79, 0x7c, 0x85, 0x91, 0x9d, 0xa5, 0xa7, 0xa3, 0x9d, 0x97, 0x96, 0x9a,
-0xa1, 0xa7, 0xa9, 0xa3, 0x96, 0x84, 0x72, 0x63, 0x5b, 0x5b, 0x61, 0x6b,
-0x77, 0x82, 0x8c, 0x90, 0x8e, 0x84, 0x74, 0x60, 0x50, 0x45, 0x42, 0x46,
-0x4e, 0x58, 0x62, 0x6a, 0x6e, 0x6f, 0x6d, 0x6a, 0x66, 0x64, 0x62, 0x61,
-0x61, 0x63, 0x68, 0x70, 0x78, 0x7e, 0x80, 0x7d, 0x74, 0x69, 0x60, 0x5c,
-0x5f, 0x69, 0x77, 0x8a, 0x9d, 0xaf, 0xbe, 0xcb, 0xd5, 0xdb, 0xdf, 0xe0,
-0xdf, 0xdc, 0xd8, 0xd2, 0xc8, 0xb7, 0x9e, 0x7d, 0x5a, 0x3f, 0x35, 0x41,
-0x61, 0x8b, 0xb4, 0xd2, 0xe3, 0xe7, 0xe0, 0xd0, 0xb7, 0x96, 0x72, 0x53,
-0x42, 0x42, 0x53, 0x6b, 0x82, 0x90, 0x92, 0x8a, 0x7c, 0x6d, 0x60, 0x56,
-0x4e, 0x47, 0x42, 0x3e, 0x3e, 0x43, 0x4d, 0x5a, 0x67, 0x72, 0x78, 0x7b,
-0x7b, 0x77, 0x70, 0x64, 0x57, 0x4d, 0x4d, 0x5a, 0x71, 0x8d, 0xa5, 0xb2,
-0xb3, 0xa9, 0x99, 0x87, 0x7a, 0x75, 0x79, 0x85, 0x95, 0xa4, 0xaf, 0xb3,
-0xb0, 0xa8, 0x9c, 0x8e, 0x7f, 0x73, 0x6b, 0x69, 0x6f, 0x7b, 0x88, 0x95,
-0x9e, 0xa1, 0x9f, 0x9a, 0x92, 0x89, 0x7f, 0x74, 0x6a, 0x60, 0x59, 0x58,
-0x5c, 0x65, 0x71, 0x7b, 0x80, 0x80, 0x7b, 0x74, 0x6c, 0x63, 0x58, 0x4d,
-0x44, 0x40, 0x42, 0x4b, 0x57, 0x65, 0x73, 0x80, 0x8a, 0x90, 0x94, 0x98,
-0x9c, 0x9f, 0x9e, 0x96, 0x86, 0x75, 0x69, 0x67, 0x70, 0x82, 0x97, 0xaa,
-0xb9, 0xc6, 0xd0, 0xdb, 0xe4, 0xea, 0xea, 0xdf, 0xc7, 0xa3, 0x78, 0x53,
-0x3d, 0x3e, 0x54, 0x76, 0x99, 0xb4, 0xc5, 0xcb, 0xc7, 0xb7, 0x9c, 0x78,
-0x55, 0x40, 0x43, 0x5e, 0x87, 0xae, 0xc6, 0xc8, 0xb6, 0x9a, 0x7b, 0x62,
-0x50, 0x45, 0x3e, 0x3a, 0x38, 0x3c, 0x47, 0x5c, 0x78, 0x94, 0xaa, 0xb3,
-0xaf, 0xa2, 0x90, 0x7d, 0x68, 0x53, 0x3f, 0x33, 0x35, 0x47, 0x67, 0x8b,
-0xa9, 0xb9, 0xbc, 0xb3, 0xa3, 0x90, 0x7d, 0x6b, 0x5e, 0x57, 0x58, 0x61,
-0x70, 0x80, 0x8d, 0x96, 0x99, 0x97, 0x94, 0x90, 0x8b, 0x84, 0x7a, 0x6d,
-0x5e, 0x52, 0x4b, 0x4d, 0x5a, 0x6f, 0x86, 0x98, 0xa1, 0x9c, 0x8c, 0x74,
-0x5a, 0x46, 0x3c, 0x3e, 0x4c, 0x62, 0x79, 0x8a, 0x90, 0x8a, 0x7c, 0x6b,
-0x5d, 0x55, 0x53, 0x56, 0x5c, 0x65, 0x72, 0x81, 0x8e, 0x95, 0x95, 0x90,
-0x8a, 0x88, 0x89, 0x8a, 0x88, 0x84, 0x7d, 0x78, 0x78, 0x7d, 0x87, 0x95,
-0xa2, 0xad, 0xb4, 0xb5, 0xb3, 0xae, 0xa6, 0x99, 0x85, 0x6b, 0x54, 0x49,
-0x56, 0x79, 0xa9, 0xd3, 0xe6, 0xdd, 0xbe, 0x95, 0x70, 0x55, 0x45, 0x3d,
-0x3d, 0x49, 0x63, 0x87, 0xae, 0xcc, 0xd9, 0xcf, 0xb4, 0x90, 0x71, 0x5e,
-0x5b, 0x63, 0x70, 0x79, 0x7c, 0x7b, 0x7d, 0x85, 0x93, 0x9f, 0xa2, 0x98,
-0x85, 0x70, 0x5f, 0x55, 0x52, 0x53, 0x5a, 0x68, 0x7b, 0x90, 0xa1, 0xa7,
-0x9f, 0x8a, 0x6d, 0x50, 0x3b, 0x33, 0x3b, 0x51, 0x6e, 0x89, 0x9c, 0xa1,
-0x99, 0x89, 0x76, 0x65, 0x58, 0x50, 0x4f, 0x55, 0x63, 0x75, 0x85, 0x8e,
-0x8e, 0x84, 0x77, 0x6a, 0x61, 0x5e, 0x60, 0x64, 0x69, 0x6c, 0x6e, 0x6d,
-0x6b, 0x6a, 0x6b, 0x6e, 0x72, 0x76, 0x76, 0x74, 0x71, 0x6d, 0x6c, 0x6c,
-0x6d, 0x6f, 0x72, 0x75, 0x7a, 0x80, 0x88, 0x91, 0x99, 0x9d, 0x9c, 0x95,
-0x8b, 0x82, 0x7b, 0x77, 0x75, 0x75, 0x79, 0x83, 0x93, 0xa5, 0xb4, 0xba,
-0xb9, 0xb3, 0xab, 0xa1, 0x91, 0x78, 0x5a, 0x44, 0x42, 0x5a, 0x87, 0xba,
-0xdf, 0xec, 0xdf, 0xbf, 0x98, 0x72, 0x54, 0x43, 0x3f, 0x4a, 0x61, 0x80,
-0xa0, 0xba, 0xc9, 0xcc, 0xc1, 0xaa, 0x8d, 0x70, 0x5c, 0x54, 0x58, 0x62,
-0x6c, 0x72, 0x77, 0x80, 0x8f, 0x9f, 0xaa, 0xaa, 0x9b, 0x83, 0x68, 0x51,
-0x40, 0x37, 0x39, 0x47, 0x62, 0x81, 0x9d, 0xaa, 0xa6, 0x94, 0x7a, 0x61,
-0x4d, 0x41, 0x3e, 0x45, 0x58, 0x71, 0x8a, 0x99, 0x9b, 0x90, 0x81, 0x73,
-0x6a, 0x64, 0x61, 0x5f, 0x61, 0x6a, 0x75, 0x81, 0x87, 0x87, 0x83, 0x7f,
-0x7b, 0x74, 0x6a, 0x5f, 0x55, 0x53, 0x5a, 0x66, 0x74, 0x7f, 0x84, 0x86,
-0x84, 0x7e, 0x75, 0x68, 0x5c, 0x54, 0x54, 0x5b, 0x68, 0x77, 0x86, 0x90,
-0x96, 0x95, 0x8f, 0x86, 0x7d, 0x78, 0x78, 0x7a, 0x7f, 0x83, 0x87, 0x8a,
-0x8b, 0x8a, 0x88, 0x89, 0x8c, 0x93, 0x9a, 0xa0, 0xa4, 0xa7, 0xa6, 0x9e,
-0x8d, 0x74, 0x5b, 0x4b, 0x50, 0x6c, 0x97, 0xc2, 0xde, 0xe3, 0xd0, 0xae,
-0x86, 0x63, 0x4b, 0x42, 0x49, 0x5f, 0x7e, 0x9d, 0xb6, 0xc5, 0xc8, 0xc1,
-0xaf, 0x97, 0x7d, 0x65, 0x57, 0x54, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x96,
-0xa5, 0xac, 0xa6, 0x91, 0x74, 0x58, 0x46, 0x40, 0x42, 0x48, 0x50, 0x5e,
-0x71, 0x88, 0x9c, 0xa3, 0x9a, 0x82, 0x62, 0x46, 0x36, 0x35, 0x42, 0x57,
-0x6e, 0x84, 0x92, 0x99, 0x96, 0x8c, 0x7e, 0x6f, 0x65, 0x60, 0x60, 0x66,
-0x6e, 0x77, 0x7e, 0x84, 0x86, 0x85, 0x84, 0x83, 0x84, 0x83, 0x7f, 0x77,
-0x6c, 0x62, 0x5d, 0x5f, 0x69, 0x77, 0x84, 0x8d, 0x92, 0x93, 0x8f, 0x87,
-0x79, 0x6b, 0x60, 0x5d, 0x63, 0x71, 0x80, 0x8b, 0x91, 0x93, 0x93, 0x94,
-0x95, 0x93, 0x8f, 0x87, 0x80, 0x7a, 0x77, 0x77, 0x79, 0x7d, 0x82, 0x87,
-0x8c, 0x92, 0x9c, 0xa9, 0xb6, 0xb8, 0xa8, 0x84, 0x57, 0x34, 0x2c, 0x45,
-0x74, 0xa8, 0xcc, 0xd8, 0xcd, 0xb4, 0x97, 0x7c, 0x66, 0x58, 0x53, 0x58,
-0x69, 0x80, 0x98, 0xab, 0xb5, 0xb6, 0xae, 0x9f, 0x8c, 0x79, 0x6c, 0x68,
-0x6b, 0x73, 0x7a, 0x7f, 0x82, 0x85, 0x8a, 0x8f, 0x90, 0x89, 0x7c, 0x6c,
-0x5e, 0x57, 0x56, 0x5a, 0x61, 0x68, 0x6f, 0x75, 0x7a, 0x7a, 0x76, 0x6d,
-0x60, 0x54, 0x4b, 0x4b, 0x54, 0x65, 0x78, 0x86, 0x8b, 0x85, 0x78, 0x6d,
-0x68, 0x69, 0x6e, 0x71, 0x71, 0x6d, 0x6b, 0x6f, 0x7a, 0x87, 0x92, 0x96,
-0x92, 0x88, 0x7e, 0x77, 0x72, 0x70, 0x6f, 0x6f, 0x72, 0x78, 0x7e, 0x84,
-0x8a, 0x8f, 0x95, 0x9a, 0x9a, 0x93, 0x86, 0x77, 0x6c, 0x69, 0x6d, 0x78,
-0x84, 0x90, 0x98, 0x9e, 0xa0, 0xa0, 0x9d, 0x9a, 0x97, 0x94, 0x8f, 0x86,
-0x7a, 0x72, 0x71, 0x79, 0x85, 0x91, 0x98, 0x9e, 0xa7, 0xb3, 0xbb, 0xb6,
-0x9e, 0x75, 0x4a, 0x30, 0x33, 0x51, 0x7e, 0xa8, 0xc1, 0xc6, 0xba, 0xa6,
-0x8f, 0x79, 0x67, 0x5b, 0x57, 0x5a, 0x66, 0x77, 0x8c, 0xa2, 0xb1, 0xb5,
-0xac, 0x99, 0x83, 0x73, 0x6e, 0x71, 0x75, 0x77, 0x76, 0x76, 0x7d, 0x8b,
-0x9a, 0xa3, 0x9d, 0x89, 0x6f, 0x56, 0x46, 0x44, 0x4f, 0x63, 0x7b, 0x8d,
-0x95, 0x90, 0x7f, 0x6a, 0x56, 0x49, 0x44, 0x46, 0x4e, 0x59, 0x69, 0x7c,
-0x8c, 0x94, 0x8e, 0x7e, 0x69, 0x58, 0x50, 0x52, 0x59, 0x63, 0x6d, 0x77,
-0x82, 0x8c, 0x93, 0x95, 0x90, 0x85, 0x79, 0x6f, 0x69, 0x68, 0x6c, 0x74,
-0x7e, 0x87, 0x8d, 0x8d, 0x89, 0x83, 0x80, 0x82, 0x87, 0x8c, 0x8e, 0x8b,
-0x85, 0x7f, 0x7d, 0x7f, 0x84, 0x88, 0x8c, 0x90, 0x94, 0x9a, 0xa0, 0xa4,
-0xa5, 0xa2, 0x9b, 0x93, 0x8c, 0x87, 0x86, 0x88, 0x8c, 0x92, 0x9c, 0xaa,
-0xb9, 0xc3, 0xbf, 0xa9, 0x84, 0x5c, 0x42, 0x43, 0x61, 0x8e, 0xb9, 0xce,
-0xc6, 0xa8, 0x83, 0x65, 0x57, 0x59, 0x64, 0x72, 0x7d, 0x84, 0x89, 0x8d,
-0x93, 0x98, 0x9b, 0x97, 0x8b, 0x7a, 0x6c, 0x65, 0x6a, 0x76, 0x83, 0x8b,
-0x8d, 0x8b, 0x8a, 0x8b, 0x8c, 0x89, 0x7f, 0x71, 0x64, 0x5c, 0x5b, 0x61,
-0x6d, 0x7b, 0x89, 0x93, 0x94, 0x8a, 0x78, 0x65, 0x57, 0x51, 0x54, 0x5c,
-0x67, 0x72, 0x7b, 0x80, 0x80, 0x79, 0x6d, 0x60, 0x57, 0x56, 0x5d, 0x68,
-0x74, 0x7d, 0x81, 0x81, 0x7d, 0x76, 0x70, 0x6c, 0x6e, 0x75, 0x7f, 0x87,
-0x8a, 0x86, 0x7f, 0x79, 0x75, 0x75, 0x77, 0x77, 0x76, 0x73, 0x72, 0x72,
-0x75, 0x78, 0x7b, 0x7e, 0x80, 0x81, 0x83, 0x83, 0x82, 0x7e, 0x7a, 0x78,
-0x79, 0x80, 0x8b, 0x98, 0xa0, 0xa1, 0x9b, 0x93, 0x8c, 0x8b, 0x8f, 0x95,
-0x9a, 0x9f, 0xa5, 0xaf, 0xbb, 0xc0, 0xb7, 0x9c, 0x75, 0x54, 0x4a, 0x5e,
-0x8a, 0xba, 0xd8, 0xd7, 0xbb, 0x93, 0x71, 0x60, 0x5f, 0x66, 0x6d, 0x70,
-0x75, 0x7f, 0x8f, 0xa2, 0xb2, 0xb6, 0xab, 0x94, 0x78, 0x61, 0x56, 0x57,
-0x62, 0x70, 0x7d, 0x86, 0x8d, 0x94, 0x9b, 0x9d, 0x96, 0x85, 0x6d, 0x56,
-0x49, 0x4a, 0x58, 0x6d, 0x83, 0x94, 0x9e, 0x9e, 0x93, 0x80, 0x6b, 0x5a,
-0x52, 0x55, 0x5e, 0x6b, 0x78, 0x84, 0x8f, 0x94, 0x91, 0x83, 0x6d, 0x56,
-0x48, 0x4a, 0x5b, 0x71, 0x84, 0x8d, 0x8a, 0x81, 0x78, 0x72, 0x71, 0x73,
-0x78, 0x7e, 0x83, 0x86, 0x88, 0x88, 0x89, 0x89, 0x87, 0x83, 0x7d, 0x75,
-0x70, 0x70, 0x75, 0x7b, 0x7e, 0x7b, 0x73, 0x6b, 0x66, 0x67, 0x6b, 0x72,
-0x79, 0x7f, 0x84, 0x86, 0x86, 0x83, 0x7f, 0x7c, 0x7c, 0x7d, 0x81, 0x88,
-0x90, 0x9a, 0xa6, 0xb2, 0xbe, 0xc6, 0xc4, 0xb5, 0x97, 0x71, 0x51, 0x44,
-0x53, 0x79, 0xa9, 0xd1, 0xe3, 0xdb, 0xc0, 0x9b, 0x79, 0x61, 0x58, 0x5b,
-0x6a, 0x7f, 0x93, 0xa2, 0xa9, 0xaa, 0xa7, 0xa1, 0x99, 0x8c, 0x7d, 0x70,
-0x68, 0x69, 0x70, 0x79, 0x81, 0x86, 0x89, 0x8b, 0x8a, 0x84, 0x7b, 0x71,
-0x69, 0x68, 0x6c, 0x72, 0x76, 0x78, 0x7c, 0x83, 0x8a, 0x8d, 0x88, 0x7b,
-0x6d, 0x64, 0x65, 0x6c, 0x74, 0x7b, 0x81, 0x86, 0x8b, 0x8d, 0x88, 0x7b,
-0x69, 0x59, 0x52, 0x56, 0x64, 0x76, 0x87, 0x91, 0x94, 0x8e, 0x82, 0x76,
-0x71, 0x77, 0x86, 0x96, 0x9e, 0x9b, 0x91, 0x85, 0x7f, 0x7f, 0x82, 0x85,
-0x84, 0x82, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7a, 0x77, 0x74, 0x71,
-0x6e, 0x6c, 0x6a, 0x6b, 0x6e, 0x73, 0x79, 0x7f, 0x84, 0x86, 0x86, 0x85,
-0x83, 0x81, 0x82, 0x84, 0x8a, 0x94, 0xa3, 0xb1, 0xb7, 0xae, 0x94, 0x70,
-0x4f, 0x42, 0x51, 0x76, 0xa5, 0xc9, 0xd6, 0xc8, 0xa9, 0x85, 0x6a, 0x5d,
-0x61, 0x70, 0x85, 0x97, 0xa3, 0xa8, 0xa8, 0xa5, 0xa0, 0x99, 0x8e, 0x7f,
-0x6f, 0x65, 0x65, 0x6d, 0x7a, 0x86, 0x8d, 0x8f, 0x8d, 0x8a, 0x86, 0x81,
-0x78, 0x6e, 0x65, 0x62, 0x66, 0x6e, 0x7a, 0x87, 0x93, 0x9d, 0xa0, 0x9c,
-0x8e, 0x7a, 0x68, 0x5d, 0x5e, 0x67, 0x74, 0x82, 0x8c, 0x91, 0x92, 0x8c,
-0x7f, 0x6b, 0x57, 0x48, 0x45, 0x4f, 0x63, 0x79, 0x8b, 0x95, 0x95, 0x8f,
-0x85, 0x7c, 0x77, 0x78, 0x7f, 0x89, 0x92, 0x98, 0x98, 0x95, 0x90, 0x89,
-0x81, 0x78, 0x71, 0x6d, 0x6f, 0x76, 0x81, 0x8b, 0x8f, 0x8e, 0x88, 0x7f,
-0x76, 0x6f, 0x6b, 0x6c, 0x70, 0x78, 0x80, 0x88, 0x8c, 0x8e, 0x8e, 0x8b,
-0x87, 0x82, 0x7d, 0x7a, 0x7d, 0x85, 0x92, 0xa3, 0xb0, 0xb5, 0xad, 0x96,
-0x75, 0x54, 0x40, 0x41, 0x5b, 0x84, 0xae, 0xca, 0xd0, 0xc1, 0xa6, 0x88,
-0x71, 0x65, 0x65, 0x6f, 0x7c, 0x8a, 0x95, 0x9d, 0xa5, 0xab, 0xad, 0xa5,
-0x92, 0x7a, 0x63, 0x57, 0x5a, 0x69, 0x7b, 0x88, 0x8c, 0x87, 0x7f, 0x79,
-0x74, 0x71, 0x6f, 0x6f, 0x70, 0x74, 0x78, 0x7c, 0x80, 0x85, 0x8b, 0x90,
-0x91, 0x8e, 0x86, 0x7e, 0x79, 0x79, 0x7b, 0x7c, 0x7b, 0x79, 0x79, 0x7c,
-0x81, 0x84, 0x82, 0x7a, 0x6e, 0x63, 0x5d, 0x5d, 0x62, 0x69, 0x72, 0x7b,
-0x85, 0x8c, 0x91, 0x92, 0x8e, 0x88, 0x82, 0x7d, 0x7d, 0x82, 0x89, 0x8f,
-0x90, 0x8b, 0x80, 0x73, 0x6b, 0x6b, 0x73, 0x7f, 0x89, 0x8d, 0x89, 0x80,
-0x76, 0x6f, 0x6c, 0x6f, 0x76, 0x80, 0x89, 0x8f, 0x92, 0x92, 0x91, 0x90,
-0x8e, 0x8b, 0x87, 0x85, 0x86, 0x8c, 0x97, 0xa3, 0xae, 0xb3, 0xae, 0x9c,
-0x7f, 0x5d, 0x43, 0x3c, 0x4f, 0x77, 0xa5, 0xc8, 0xd3, 0xc5, 0xa7, 0x88,
-0x73, 0x6d, 0x72, 0x7c, 0x86, 0x8f, 0x95, 0x99, 0x9d, 0xa0, 0xa2, 0xa0,
-0x98, 0x88, 0x77, 0x6a, 0x65, 0x6b, 0x75, 0x7e, 0x82, 0x82, 0x80, 0x7d,
-0x79, 0x73, 0x6c, 0x65, 0x64, 0x6b, 0x79, 0x86, 0x8d, 0x8e, 0x8a, 0x87,
-0x87, 0x88, 0x88, 0x84, 0x7e, 0x79, 0x78, 0x7b, 0x7f, 0x84, 0x89, 0x8b,
-0x8b, 0x88, 0x81, 0x78, 0x6f, 0x68, 0x65, 0x68, 0x6e, 0x78, 0x82, 0x8c,
-0x91, 0x90, 0x88, 0x7d, 0x73, 0x71, 0x77, 0x83, 0x8d, 0x91, 0x8d, 0x82,
-0x76, 0x6e, 0x6a, 0x6b, 0x6f, 0x74, 0x78, 0x7a, 0x79, 0x75, 0x70, 0x6b,
-0x69, 0x6b, 0x6f, 0x73, 0x75, 0x75, 0x74, 0x72, 0x72, 0x74, 0x78, 0x7e,
-0x84, 0x88, 0x88, 0x83, 0x7d, 0x78, 0x7a, 0x81, 0x8b, 0x94, 0x98, 0x9a,
-0x9c, 0x9f, 0x9f, 0x97, 0x83, 0x68, 0x51, 0x49, 0x57, 0x75, 0x99, 0xb1,
-0xb7, 0xa9, 0x8e, 0x73, 0x62, 0x60, 0x6d, 0x81, 0x93, 0x9e, 0xa0, 0x9c,
-0x97, 0x94, 0x93, 0x90, 0x8a, 0x7f, 0x74, 0x6e, 0x6e, 0x74, 0x7b, 0x7e,
-0x7c, 0x76, 0x70, 0x6c, 0x6b, 0x6c, 0x6d, 0x6f, 0x70, 0x73, 0x76, 0x7a,
-0x7f, 0x84, 0x87, 0x89, 0x8a, 0x87, 0x83, 0x7d, 0x77, 0x73, 0x72, 0x73,
-0x76, 0x7b, 0x7e, 0x82, 0x83, 0x83, 0x81, 0x7b, 0x75, 0x70, 0x6d, 0x6e,
-0x72, 0x75, 0x77, 0x77, 0x78, 0x7a, 0x7e, 0x83, 0x84, 0x83, 0x7f, 0x7b,
-0x7b, 0x7e, 0x84, 0x88, 0x87, 0x7f, 0x72, 0x64, 0x5a, 0x56, 0x5a, 0x63,
-0x70, 0x7c, 0x83, 0x82, 0x79, 0x6b, 0x5c, 0x54, 0x54, 0x5d, 0x6a, 0x78,
-0x82, 0x88, 0x8a, 0x88, 0x82, 0x7a, 0x71, 0x6c, 0x6c, 0x71, 0x7c, 0x8a,
-0x9a, 0xab, 0xb8, 0xb8, 0xa7, 0x84, 0x5b, 0x3a, 0x32, 0x47, 0x70, 0x9c,
-0xbb, 0xc2, 0xb4, 0x95, 0x72, 0x54, 0x44, 0x46, 0x5a, 0x77, 0x94, 0xa6,
-0xa9, 0xa0, 0x91, 0x84, 0x7a, 0x74, 0x70, 0x6d, 0x6c, 0x6e, 0x73, 0x77,
-0x78, 0x75, 0x71, 0x70, 0x72, 0x74, 0x75, 0x74, 0x71, 0x70, 0x72, 0x75,
-0x77, 0x75, 0x74, 0x75, 0x7b, 0x84, 0x8c, 0x8d, 0x86, 0x7a, 0x70, 0x6c,
-0x6e, 0x74, 0x7b, 0x82, 0x88, 0x8b, 0x8b, 0x87, 0x7e, 0x75, 0x70, 0x71,
-0x79, 0x84, 0x8c, 0x8f, 0x8d, 0x88, 0x83, 0x7e, 0x79, 0x75, 0x75, 0x7a,
-0x81, 0x88, 0x8c, 0x8c, 0x89, 0x84, 0x7c, 0x73, 0x69, 0x61, 0x60, 0x67,
-0x75, 0x85, 0x8f, 0x8f, 0x85, 0x76, 0x68, 0x60, 0x60, 0x67, 0x72, 0x7c,
-0x82, 0x84, 0x81, 0x7a, 0x72, 0x6c, 0x67, 0x66, 0x69, 0x6f, 0x79, 0x84,
-0x8d, 0x92, 0x91, 0x8d, 0x87, 0x85, 0x86, 0x8c, 0x97, 0xa4, 0xab, 0xa9,
-0x99, 0x7f, 0x64, 0x54, 0x57, 0x6c, 0x8a, 0xa5, 0xb3, 0xaf, 0x9c, 0x84,
-0x6e, 0x60, 0x5d, 0x63, 0x70, 0x7e, 0x8b, 0x94, 0x97, 0x97, 0x95, 0x91,
-0x8b, 0x82, 0x76, 0x6a, 0x61, 0x5f, 0x64, 0x6d, 0x79, 0x84, 0x8e, 0x93,
-0x92, 0x87, 0x76, 0x62, 0x54, 0x53, 0x61, 0x76, 0x8b, 0x97, 0x98, 0x92,
-0x88, 0x80, 0x7a, 0x73, 0x6d, 0x68, 0x69, 0x71, 0x7f, 0x8e, 0x99, 0x9c,
-0x99, 0x92, 0x89, 0x80, 0x78, 0x74, 0x75, 0x7a, 0x7f, 0x82, 0x83, 0x83,
-0x85, 0x88, 0x88, 0x83, 0x7a, 0x71, 0x6e, 0x70, 0x76, 0x7c, 0x80, 0x81,
-0x83, 0x85, 0x86, 0x84, 0x7d, 0x75, 0x71, 0x71, 0x76, 0x7a, 0x78, 0x71,
-0x6a, 0x69, 0x70, 0x7c, 0x85, 0x86, 0x7e, 0x70, 0x62, 0x5a, 0x5d, 0x6a,
-0x7c, 0x8b, 0x92, 0x8c, 0x7f, 0x73, 0x6e, 0x72, 0x7d, 0x87, 0x8b, 0x88,
-0x84, 0x83, 0x86, 0x8d, 0x93, 0x96, 0x95, 0x96, 0x9b, 0xa1, 0xa3, 0x9b,
-0x88, 0x6f, 0x5c, 0x58, 0x67, 0x82, 0x9e, 0xaf, 0xb0, 0xa0, 0x88, 0x6f,
-0x60, 0x60, 0x6d, 0x82, 0x95, 0xa1, 0xa4, 0x9f, 0x98, 0x90, 0x89, 0x80,
-0x77, 0x70, 0x6d, 0x6f, 0x76, 0x7d, 0x80, 0x7f, 0x7c, 0x79, 0x77, 0x78,
-0x78, 0x77, 0x74, 0x72, 0x72, 0x76, 0x7c, 0x82, 0x86, 0x87, 0x85, 0x82,
-0x7f, 0x7f, 0x81, 0x84, 0x87, 0x88, 0x86, 0x81, 0x7c, 0x79, 0x7a, 0x7e,
-0x83, 0x85, 0x83, 0x7d, 0x76, 0x6f, 0x6d, 0x70, 0x76, 0x7d, 0x82, 0x83,
-0x80, 0x7c, 0x7a, 0x7c, 0x80, 0x86, 0x8b, 0x8e, 0x90, 0x90, 0x8f, 0x8b,
-0x85, 0x7f, 0x77, 0x71, 0x6c, 0x6b, 0x6f, 0x77, 0x81, 0x87, 0x86, 0x7c,
-0x6e, 0x61, 0x5b, 0x5f, 0x69, 0x73, 0x7b, 0x7e, 0x80, 0x81, 0x82, 0x83,
-0x81, 0x7c, 0x76, 0x70, 0x6d, 0x6d, 0x6f, 0x74, 0x79, 0x7f, 0x85, 0x88,
-0x87, 0x83, 0x7c, 0x74, 0x6c, 0x67, 0x65, 0x66, 0x6d, 0x7a, 0x8b, 0x9b,
-0xa4, 0xa3, 0x9b, 0x91, 0x88, 0x81, 0x7b, 0x73, 0x6c, 0x6a, 0x72, 0x86,
-0x9e, 0xb1, 0xb5, 0xa7, 0x8f, 0x76, 0x66, 0x63, 0x6d, 0x7d, 0x8f, 0x9c,
-0xa0, 0x9c, 0x92, 0x88, 0x83, 0x84, 0x87, 0x88, 0x84, 0x7d, 0x77, 0x78,
-0x7e, 0x86, 0x8d, 0x90, 0x8f, 0x8c, 0x88, 0x82, 0x7a, 0x71, 0x6b, 0x6c,
-0x74, 0x82, 0x8f, 0x95, 0x92, 0x87, 0x7b, 0x71, 0x6c, 0x6d, 0x70, 0x73,
-0x76, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x7f, 0x7e, 0x7b, 0x77, 0x73, 0x72,
-0x75, 0x7c, 0x85, 0x8d, 0x90, 0x8f, 0x8b, 0x85, 0x7f, 0x7c, 0x7b, 0x7d,
-0x81, 0x88, 0x8d, 0x8f, 0x8b, 0x84, 0x7c, 0x75, 0x73, 0x73, 0x75, 0x77,
-0x79, 0x7b, 0x7f, 0x83, 0x85, 0x83, 0x7c, 0x75, 0x6f, 0x6e, 0x71, 0x78,
-0x7e, 0x7f, 0x7b, 0x74, 0x6f, 0x6f, 0x73, 0x7a, 0x7e, 0x7d, 0x77, 0x70,
-0x6c, 0x6e, 0x74, 0x7a, 0x7e, 0x7e, 0x7b, 0x77, 0x74, 0x74, 0x75, 0x75,
-0x76, 0x75, 0x75, 0x76, 0x78, 0x7c, 0x81, 0x87, 0x8b, 0x8d, 0x8c, 0x89,
-0x85, 0x80, 0x7d, 0x7d, 0x82, 0x8e, 0x9d, 0xa7, 0xa7, 0x98, 0x81, 0x6c,
-0x64, 0x6c, 0x81, 0x99, 0xa8, 0xaa, 0x9f, 0x8d, 0x7e, 0x77, 0x78, 0x7e,
-0x85, 0x88, 0x88, 0x86, 0x85, 0x87, 0x8b, 0x8f, 0x90, 0x8b, 0x82, 0x78,
-0x71, 0x6d, 0x6e, 0x71, 0x73, 0x75, 0x76, 0x77, 0x79, 0x79, 0x77, 0x73,
-0x6c, 0x67, 0x65, 0x68, 0x6f, 0x77, 0x7d, 0x80, 0x81, 0x81, 0x80, 0x7f,
-0x7c, 0x78, 0x74, 0x71, 0x72, 0x77, 0x7f, 0x86, 0x8b, 0x8d, 0x89, 0x83,
-0x7b, 0x75, 0x74, 0x79, 0x81, 0x89, 0x8e, 0x8f, 0x8c, 0x86, 0x80, 0x7b,
-0x7a, 0x7d, 0x84, 0x8b, 0x8f, 0x8e, 0x89, 0x82, 0x7d, 0x7b, 0x7b, 0x7c,
-0x7d, 0x7c, 0x7d, 0x7f, 0x83, 0x86, 0x86, 0x82, 0x7d, 0x78, 0x75, 0x72,
-0x6f, 0x6e, 0x6f, 0x73, 0x79, 0x7e, 0x80, 0x7d, 0x76, 0x6e, 0x69, 0x67,
-0x6a, 0x6f, 0x77, 0x7e, 0x81, 0x80, 0x7b, 0x74, 0x6d, 0x6a, 0x6b, 0x6f,
-0x75, 0x79, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7b, 0x77, 0x74, 0x74,
-0x76, 0x7b, 0x80, 0x85, 0x87, 0x87, 0x84, 0x7f, 0x78, 0x74, 0x74, 0x79,
-0x82, 0x89, 0x8d, 0x8b, 0x87, 0x85, 0x86, 0x8a, 0x90, 0x94, 0x92, 0x8c,
-0x83, 0x78, 0x70, 0x6d, 0x72, 0x7d, 0x8b, 0x94, 0x95, 0x8d, 0x7f, 0x70,
-0x67, 0x65, 0x6a, 0x74, 0x80, 0x8a, 0x90, 0x90, 0x89, 0x80, 0x78, 0x74,
-0x75, 0x79, 0x7d, 0x80, 0x80, 0x7d, 0x79, 0x74, 0x71, 0x71, 0x74, 0x78,
-0x7c, 0x7e, 0x7c, 0x79, 0x76, 0x75, 0x77, 0x79, 0x7b, 0x7c, 0x7d, 0x7e,
-0x81, 0x84, 0x86, 0x86, 0x86, 0x85, 0x84, 0x82, 0x80, 0x7d, 0x7c, 0x7d,
-0x7f, 0x81, 0x82, 0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82,
-0x83, 0x84, 0x85, 0x86, 0x84, 0x82, 0x80, 0x80, 0x81, 0x85, 0x89, 0x8a,
-0x89, 0x85, 0x80, 0x7b, 0x77, 0x76, 0x79, 0x7e, 0x85, 0x89, 0x89, 0x86,
-0x80, 0x7a, 0x76, 0x74, 0x75, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7b, 0x7a,
-0x78, 0x76, 0x74, 0x74, 0x75, 0x76, 0x78, 0x7a, 0x7d, 0x7e, 0x7e, 0x7c,
-0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x78, 0x74, 0x70, 0x70, 0x74, 0x7b, 0x81,
-0x83, 0x81, 0x7c, 0x76, 0x72, 0x71, 0x72, 0x75, 0x78, 0x7c, 0x80, 0x83,
-0x85, 0x84, 0x81, 0x7d, 0x7a, 0x78, 0x78, 0x79, 0x7b, 0x7f, 0x82, 0x85,
-0x86, 0x84, 0x82, 0x80, 0x81, 0x84, 0x86, 0x86, 0x83, 0x81, 0x82, 0x88,
-0x91, 0x96, 0x95, 0x8b, 0x7c, 0x6f, 0x69, 0x6e, 0x7b, 0x8a, 0x94, 0x95,
-0x8d, 0x7f, 0x72, 0x6a, 0x6c, 0x75, 0x81, 0x8b, 0x90, 0x8f, 0x8a, 0x83,
-0x7d, 0x79, 0x77, 0x78, 0x7a, 0x7f, 0x84, 0x87, 0x87, 0x84, 0x7f, 0x79,
-0x74, 0x72, 0x72, 0x76, 0x7b, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7d, 0x7a,
-0x76, 0x74, 0x74, 0x7a, 0x82, 0x89, 0x8d, 0x8a, 0x84, 0x7c, 0x78, 0x77,
-0x79, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x7f, 0x7c, 0x7a, 0x79, 0x7b,
-0x7c, 0x7e, 0x7f, 0x81, 0x83, 0x86, 0x89, 0x8b, 0x8a, 0x88, 0x87, 0x86,
-0x87, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7d, 0x79, 0x77, 0x78,
-0x7c, 0x80, 0x82, 0x7f, 0x79, 0x73, 0x70, 0x71, 0x75, 0x79, 0x7c, 0x7d,
-0x7d, 0x7c, 0x7c, 0x7a, 0x78, 0x75, 0x74, 0x76, 0x7b, 0x81, 0x86, 0x86,
-0x81, 0x79, 0x72, 0x6e, 0x6f, 0x73, 0x79, 0x7f, 0x83, 0x85, 0x84, 0x80,
-0x7c, 0x78, 0x75, 0x75, 0x76, 0x79, 0x7e, 0x83, 0x87, 0x88, 0x87, 0x84,
-0x81, 0x7f, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7c, 0x7a,
-0x79, 0x7b, 0x7e, 0x81, 0x83, 0x80, 0x7c, 0x77, 0x74, 0x74, 0x76, 0x79,
-0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-0x7c, 0x7c, 0x7e, 0x80, 0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x79,
-0x77, 0x76, 0x78, 0x7b, 0x7f, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83,
-0x85, 0x86, 0x88, 0x8b, 0x8e, 0x91, 0x93, 0x92, 0x8d, 0x85, 0x7a, 0x71,
-0x6e, 0x73, 0x7f, 0x8b, 0x93, 0x92, 0x89, 0x7d, 0x73, 0x70, 0x72, 0x78,
-0x7f, 0x85, 0x89, 0x8a, 0x88, 0x84, 0x7f, 0x7c, 0x7c, 0x7f, 0x83, 0x86,
-0x87, 0x86, 0x84, 0x80, 0x7d, 0x79, 0x77, 0x77, 0x7a, 0x7c, 0x7b, 0x78,
-0x74, 0x73, 0x76, 0x7b, 0x7e, 0x7e, 0x7a, 0x75, 0x74, 0x78, 0x7d, 0x81,
-0x83, 0x82, 0x81, 0x80, 0x81, 0x80, 0x7e, 0x7b, 0x79, 0x79, 0x7b, 0x7e,
-0x80, 0x80, 0x7e, 0x7b, 0x79, 0x7a, 0x7b, 0x7e, 0x80, 0x82, 0x83, 0x82,
-0x80, 0x7e, 0x7c, 0x7c, 0x7e, 0x82, 0x86, 0x88, 0x86, 0x83, 0x80, 0x7e,
-0x7e, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x84, 0x81, 0x7e, 0x7b, 0x7b,
-0x7e, 0x81, 0x83, 0x83, 0x7f, 0x7b, 0x79, 0x7a, 0x7e, 0x83, 0x85, 0x85,
-0x82, 0x7f, 0x7c, 0x7c, 0x7d, 0x7f, 0x81, 0x83, 0x84, 0x84, 0x83, 0x81,
-0x7f, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x81, 0x83, 0x84, 0x83, 0x81, 0x7f,
-0x7d, 0x7d, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x7f,
-0x7d, 0x7c, 0x7d, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7e,
-0x7d, 0x7c, 0x7c, 0x7d, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7e,
-0x7f, 0x81, 0x82, 0x81, 0x7f, 0x7d, 0x7b, 0x7b, 0x7d, 0x80, 0x83, 0x84,
-0x82, 0x7f, 0x7c, 0x7b, 0x7d, 0x7f, 0x81, 0x82, 0x83, 0x82, 0x80, 0x7d,
-0x7b, 0x79, 0x7a, 0x7d, 0x81, 0x83, 0x84, 0x82, 0x7f, 0x7c, 0x7a, 0x7b,
-0x7d, 0x7f, 0x81, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x81,
-0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x81,
-0x81, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x81,
-0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84,
-0x84, 0x82, 0x80, 0x7d, 0x7c, 0x7d, 0x7f, 0x82, 0x84, 0x84, 0x82, 0x80,
-0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x81, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x80,
-0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f,
-0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7e,
-0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x7f,
-0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x83, 0x81, 0x7f,
-0x7d, 0x7b, 0x7c, 0x7e, 0x81, 0x82, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x81, 0x81, 0x82,
-0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7d, 0x7f, 0x81, 0x82,
-0x82, 0x81, 0x80, 0x7e, 0x7c, 0x7c, 0x7c, 0x7f, 0x81, 0x83, 0x83, 0x81,
-0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x82, 0x84, 0x85,
-0x83, 0x81, 0x7f, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f,
-0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d,
-0x7e, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x81, 0x82, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7f,
-0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80,
-0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x83, 0x81, 0x7e, 0x7b, 0x7a,
-0x7a, 0x7d, 0x7f, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e,
-0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x84, 0x84, 0x82, 0x80,
-0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x80,
-0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x82, 0x80, 0x7f, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f,
-0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f,
-0x7f, 0x7e, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-0x82, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f,
-0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f,
-0x80, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81,
-0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d,
-0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7d,
-0x7d, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f,
-0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80,
-0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
-0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7e,
-0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x81, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x80,
-0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80,
-0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7d,
-0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7e,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
-0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f,
-0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f,
-0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7e, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80,
-0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80,
-0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80
-};
-
-const size_t game_sound_10100_22050_8bit_wav_len = sizeof(game_sound_10100_22050_8bit_wav);
@@ -0,0 +1,26 @@
+/**
+ * @file embedded_sounds.c
+ * @brief Embedded sound lookup
+ */
+
+#include "embedded_sounds.h"
+
+// Linked by target_add_binary_data() in src/CMakeLists.txt
+extern const uint8_t embedded_sounds_bin_start[] asm("_binary_embedded_sounds_bin_start");
+
+const embedded_sound_t *embedded_sounds_find(uint16_t sound_id)
+{
+    uint32_t slot = ((uint32_t)sound_id * g_embedded_sound_hash_mul) >> (32 - g_embedded_sound_hash_bits);
+    uint16_t index = g_embedded_sound_slots[slot];
+
+    // Perfect hash: the slot holds either this ID or nothing
+    if (index == 0 || g_embedded_sounds[index - 1].sound_id != sound_id) {
+        return NULL;
+    }
+    return &g_embedded_sounds[index - 1];
+}
+
+const uint8_t *embedded_sounds_pcm(const embedded_sound_t *sound)
+{
+    return embedded_sounds_bin_start + sound->wav.data_offset;
+}
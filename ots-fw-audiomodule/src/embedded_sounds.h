@@ -0,0 +1,57 @@
+/**
+ * @file embedded_sounds.h
+ * @brief Embedded sounds linked into flash
+ *
+ * All embedded sounds live in one PCM blob (embedded_sounds.bin) generated
+ * at build time from sounds/embedded/<id>_<name>.wav by
+ * tools/gen_embedded_sounds.py, together with a table of pre-parsed formats
+ * and a perfect hash from sound ID to entry. Nothing is initialised at boot
+ * and lookups are O(1). Adding a sound needs no code change: drop the file
+ * into sounds/embedded/ and rebuild.
+ */
+
+#ifndef EMBEDDED_SOUNDS_H
+#define EMBEDDED_SOUNDS_H
+
+#include "wav_utils.h"
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Embedded sound entry
+ */
+typedef struct {
+    uint16_t sound_id;
+    const char *name;
+    wav_info_t wav;         ///< data_offset/data_size locate the PCM in the blob
+} embedded_sound_t;
+
+// Generated table (embedded_sound_table.c)
+extern const embedded_sound_t g_embedded_sounds[];      // Sorted by sound_id
+extern const size_t g_embedded_sound_count;
+extern const size_t g_embedded_sound_blob_size;
+extern const uint16_t g_embedded_sound_slots[];
+extern const uint32_t g_embedded_sound_hash_mul;
+extern const uint8_t g_embedded_sound_hash_bits;
+
+/**
+ * @brief Find an embedded sound by ID
+ *
+ * @return Entry, or NULL if the sound is not embedded
+ */
+const embedded_sound_t *embedded_sounds_find(uint16_t sound_id);
+
+/**
+ * @brief Get the PCM data of an entry (flash-mapped, read in place)
+ */
+const uint8_t *embedded_sounds_pcm(const embedded_sound_t *sound);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EMBEDDED_SOUNDS_H
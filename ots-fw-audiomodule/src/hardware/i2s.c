@@ -5,21 +5,77 @@
 
 #include "i2s.h"
 #include "driver/i2s_std.h"
+#include "esp_attr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
+#include <string.h>
 
 static const char *TAG = "i2s";
 static uint32_t s_current_sample_rate = 44100;
 static i2s_chan_handle_t tx_handle = NULL;
 
+// DMA depth (applied when the channel is created)
+static uint32_t s_dma_desc_num = I2S_DEFAULT_DMA_DESC_NUM;
+static uint32_t s_dma_frame_num = I2S_DEFAULT_DMA_FRAME_NUM;
+// Latency held across rate changes (0 = frame count fixed)
+static uint32_t s_dma_latency_us = 0;
+static uint32_t s_dma_latency_desc = I2S_DEFAULT_DMA_DESC_NUM;
+
+// Output health (underruns counted from the DMA ISR)
+static volatile uint32_t s_underruns = 0;
+static i2s_stats_t s_stats;
+static int64_t s_last_write_end_us = 0;
+
+/**
+ * @brief TX queue overflow: every DMA buffer was sent with no new data
+ *        loaded, so the codec got (auto-cleared) silence - an underrun
+ */
+static IRAM_ATTR bool on_send_q_ovf(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    s_underruns++;
+    return false;
+}
+
+/**
+ * @brief DMA depth covering latency_us at rate, with at least desc_num buffers
+ */
+static void depth_for_latency(uint32_t desc_num, uint32_t latency_us, uint32_t rate,
+                              uint32_t *out_desc, uint32_t *out_frames)
+{
+    uint32_t total = (uint32_t)(((uint64_t)latency_us * rate + 999999) / 1000000);
+    // More buffers once one would exceed the DMA buffer size
+    uint32_t desc = (total + I2S_MAX_DMA_FRAME_NUM - 1) / I2S_MAX_DMA_FRAME_NUM;
+    if (desc < desc_num) {
+        desc = desc_num;
+    }
+    if (desc > I2S_MAX_DMA_DESC_NUM) {
+        desc = I2S_MAX_DMA_DESC_NUM;
+    }
+    uint32_t frames = (total + desc - 1) / desc;
+    if (frames < I2S_MIN_DMA_FRAME_NUM) {
+        frames = I2S_MIN_DMA_FRAME_NUM;
+    }
+    if (frames > I2S_MAX_DMA_FRAME_NUM) {
+        frames = I2S_MAX_DMA_FRAME_NUM;
+    }
+    *out_desc = desc;
+    *out_frames = frames;
+}
+
 esp_err_t i2s_init(uint32_t sample_rate)
 {
     ESP_LOGI(TAG, "Initializing I2S @ %lu Hz", (unsigned long)sample_rate);
 
+    if (s_dma_latency_us) {
+        depth_for_latency(s_dma_latency_desc, s_dma_latency_us, sample_rate,
+                          &s_dma_desc_num, &s_dma_frame_num);
+    }
+
     // Channel configuration
     i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
-    chan_cfg.dma_desc_num = 8;
-    chan_cfg.dma_frame_num = 256;
+    chan_cfg.dma_desc_num = s_dma_desc_num;
+    chan_cfg.dma_frame_num = s_dma_frame_num;
     chan_cfg.auto_clear = true;
     
     esp_err_t ret = i2s_new_channel(&chan_cfg, &tx_handle, NULL);
@@ -57,6 +113,15 @@ esp_err_t i2s_init(uint32_t sample_rate)
         return ret;
     }
     
+    // Underrun reporting (must be registered before the channel is enabled)
+    i2s_event_callbacks_t cbs = {
+        .on_send_q_ovf = on_send_q_ovf,
+    };
+    ret = i2s_channel_register_event_callback(tx_handle, &cbs, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Underrun callback not registered: %s", esp_err_to_name(ret));
+    }
+    
     ret = i2s_channel_enable(tx_handle);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "I2S channel enable failed: %s", esp_err_to_name(ret));
@@ -66,10 +131,102 @@ esp_err_t i2s_init(uint32_t sample_rate)
     }
     
     s_current_sample_rate = sample_rate;
-    ESP_LOGI(TAG, "I2S initialized successfully");
+    s_last_write_end_us = 0;
+    ESP_LOGI(TAG, "I2S initialized successfully (DMA %lu x %lu frames, %lu us)",
+             (unsigned long)s_dma_desc_num, (unsigned long)s_dma_frame_num,
+             (unsigned long)i2s_get_output_latency_us());
     return ESP_OK;
 }
 
+static esp_err_t apply_dma_config(uint32_t desc_num, uint32_t frame_num)
+{
+    if (desc_num < I2S_MIN_DMA_DESC_NUM || desc_num > I2S_MAX_DMA_DESC_NUM ||
+        frame_num < I2S_MIN_DMA_FRAME_NUM || frame_num > I2S_MAX_DMA_FRAME_NUM) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (desc_num == s_dma_desc_num && frame_num == s_dma_frame_num) {
+        return ESP_OK;
+    }
+    
+    uint32_t old_desc = s_dma_desc_num;
+    uint32_t old_frames = s_dma_frame_num;
+    s_dma_desc_num = desc_num;
+    s_dma_frame_num = frame_num;
+    
+    if (!tx_handle) {
+        return ESP_OK;  // Used by i2s_init()
+    }
+    
+    // DMA depth is fixed per channel: recreate it at the current rate
+    ESP_LOGI(TAG, "Reconfiguring I2S DMA to %lu x %lu frames",
+             (unsigned long)desc_num, (unsigned long)frame_num);
+    i2s_channel_disable(tx_handle);
+    i2s_del_channel(tx_handle);
+    tx_handle = NULL;
+    
+    esp_err_t ret = i2s_init(s_current_sample_rate);
+    if (ret != ESP_OK) {
+        // Fall back to the previous (working) depth, as is
+        uint32_t latency_us = s_dma_latency_us;
+        s_dma_latency_us = 0;
+        s_dma_desc_num = old_desc;
+        s_dma_frame_num = old_frames;
+        if (i2s_init(s_current_sample_rate) != ESP_OK) {
+            ESP_LOGE(TAG, "I2S restore failed, output disabled");
+        }
+        s_dma_latency_us = latency_us;
+    }
+    return ret;
+}
+
+/**
+ * @brief Apply a depth with the given latency target (i2s_init follows the target)
+ */
+static esp_err_t apply_dma_target(uint32_t desc_num, uint32_t frame_num,
+                                  uint32_t latency_us, uint32_t latency_desc)
+{
+    uint32_t old_latency = s_dma_latency_us;
+    uint32_t old_latency_desc = s_dma_latency_desc;
+    s_dma_latency_us = latency_us;
+    s_dma_latency_desc = latency_desc;
+
+    esp_err_t ret = apply_dma_config(desc_num, frame_num);
+    if (ret != ESP_OK) {
+        s_dma_latency_us = old_latency;
+        s_dma_latency_desc = old_latency_desc;
+    }
+    return ret;
+}
+
+esp_err_t i2s_set_dma_config(uint32_t desc_num, uint32_t frame_num)
+{
+    return apply_dma_target(desc_num, frame_num, 0, s_dma_latency_desc);
+}
+
+esp_err_t i2s_set_dma_latency(uint32_t desc_num, uint32_t latency_us)
+{
+    if (desc_num < I2S_MIN_DMA_DESC_NUM || desc_num > I2S_MAX_DMA_DESC_NUM || latency_us == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t desc, frames;
+    depth_for_latency(desc_num, latency_us, s_current_sample_rate, &desc, &frames);
+    return apply_dma_target(desc, frames, latency_us, desc_num);
+}
+
+void i2s_get_dma_config(uint32_t *desc_num, uint32_t *frame_num)
+{
+    if (desc_num) *desc_num = s_dma_desc_num;
+    if (frame_num) *frame_num = s_dma_frame_num;
+}
+
+uint32_t i2s_get_output_latency_us(void)
+{
+    uint64_t frames = (uint64_t)s_dma_desc_num * s_dma_frame_num;
+    return (uint32_t)(frames * 1000000 / s_current_sample_rate);
+}
+
 esp_err_t i2s_set_sample_rate(uint32_t rate)
 {
     if (!tx_handle) {
@@ -77,6 +234,10 @@ esp_err_t i2s_set_sample_rate(uint32_t rate)
         return ESP_FAIL;
     }
     
+    if (rate == s_current_sample_rate) {
+        return ESP_OK;
+    }
+    
     ESP_LOGI(TAG, "Reconfiguring I2S to %lu Hz", (unsigned long)rate);
     
     // Disable channel before reconfiguration
@@ -105,9 +266,25 @@ esp_err_t i2s_set_sample_rate(uint32_t rate)
     }
     
     s_current_sample_rate = rate;
+
+    // Same latency at the new rate (the depth is counted in frames)
+    if (s_dma_latency_us) {
+        uint32_t desc, frames;
+        depth_for_latency(s_dma_latency_desc, s_dma_latency_us, rate, &desc, &frames);
+        ret = apply_dma_config(desc, frames);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "DMA depth for %lu us at %lu Hz not applied: %s",
+                     (unsigned long)s_dma_latency_us, (unsigned long)rate, esp_err_to_name(ret));
+        }
+    }
     return ESP_OK;
 }
 
+uint32_t i2s_get_sample_rate(void)
+{
+    return s_current_sample_rate;
+}
+
 esp_err_t i2s_write_audio(const void *data, size_t size, size_t *bytes_written)
 {
     if (!tx_handle) {
@@ -115,5 +292,42 @@ esp_err_t i2s_write_audio(const void *data, size_t size, size_t *bytes_written)
         return ESP_FAIL;
     }
     
-    return i2s_channel_write(tx_handle, data, size, bytes_written, portMAX_DELAY);
+    // A writer that stays away longer than the DMA holds starves it
+    int64_t start_us = esp_timer_get_time();
+    if (s_last_write_end_us != 0) {
+        int64_t gap = start_us - s_last_write_end_us;
+        uint32_t gap_us = (gap > UINT32_MAX) ? UINT32_MAX : (uint32_t)gap;
+        if (gap_us > s_stats.max_write_gap_us) {
+            s_stats.max_write_gap_us = gap_us;
+        }
+        if (gap_us > i2s_get_output_latency_us()) {
+            s_stats.late_writes++;
+        }
+    }
+    
+    esp_err_t ret = i2s_channel_write(tx_handle, data, size, bytes_written, portMAX_DELAY);
+    
+    s_last_write_end_us = esp_timer_get_time();
+    s_stats.writes++;
+    return ret;
+}
+
+uint32_t i2s_get_underruns(void)
+{
+    return s_underruns;
+}
+
+void i2s_get_stats(i2s_stats_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    *out = s_stats;
+    out->underruns = s_underruns;
+}
+
+void i2s_reset_stats(void)
+{
+    s_underruns = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
 }
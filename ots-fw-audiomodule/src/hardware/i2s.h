@@ -30,6 +30,25 @@ extern "C" {
 #define I2S_DI_IO      I2S_GPIO_UNUSED  // Data in (not used for playback)
 #endif
 
+// DMA depth: desc_num buffers of frame_num stereo frames each. The total is
+// the output latency and how long the writer may stall before an underrun.
+#define I2S_DEFAULT_DMA_DESC_NUM   8
+#define I2S_DEFAULT_DMA_FRAME_NUM  256
+#define I2S_MIN_DMA_DESC_NUM       2
+#define I2S_MAX_DMA_DESC_NUM       16
+#define I2S_MIN_DMA_FRAME_NUM      64
+#define I2S_MAX_DMA_FRAME_NUM      1023  // 4092-byte DMA buffer limit / 4 bytes per frame
+
+/**
+ * @brief Output health counters
+ */
+typedef struct {
+    uint32_t underruns;         ///< DMA ran out of data (silence was played)
+    uint32_t late_writes;       ///< Writes that came later than the DMA depth after the previous one
+    uint32_t writes;            ///< Write calls
+    uint32_t max_write_gap_us;  ///< Longest time between two writes
+} i2s_stats_t;
+
 /**
  * @brief Initialize I2S peripheral
  * @param sample_rate Sample rate in Hz (e.g., 44100, 48000)
@@ -39,11 +58,78 @@ esp_err_t i2s_init(uint32_t sample_rate);
 
 /**
  * @brief Reconfigure I2S sample rate
+ * 
+ * Briefly disables the channel, so call it only while the output is silent.
+ * With a latency set by i2s_set_dma_latency() the channel is recreated with
+ * the depth that gives it at the new rate.
+ * The ES8388 runs as slave with MCLK = 256 x rate and follows without
+ * register changes.
+ * 
  * @param sample_rate New sample rate in Hz
- * @return ESP_OK on success, error code otherwise
+ * @return ESP_OK on success (also when already at this rate), error code otherwise
  */
 esp_err_t i2s_set_sample_rate(uint32_t sample_rate);
 
+/**
+ * @brief Get the current I2S sample rate
+ * @return Sample rate in Hz
+ */
+uint32_t i2s_get_sample_rate(void);
+
+/**
+ * @brief Set the DMA depth
+ * 
+ * Before i2s_init() this only sets the depth used by it. Afterwards the
+ * channel is recreated (a short gap in output), so call it only while idle.
+ * On failure the previous depth is restored.
+ * 
+ * @param desc_num Number of DMA buffers (I2S_MIN_DMA_DESC_NUM-I2S_MAX_DMA_DESC_NUM)
+ * @param frame_num Frames per buffer (I2S_MIN_DMA_FRAME_NUM-I2S_MAX_DMA_FRAME_NUM)
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, or the channel creation error
+ */
+esp_err_t i2s_set_dma_config(uint32_t desc_num, uint32_t frame_num);
+
+/**
+ * @brief Set the DMA depth as an output latency
+ * 
+ * Like i2s_set_dma_config(), with the frame count derived from the current
+ * rate and derived again on every rate change, so the latency (the time
+ * the mixer may stall) stays the same at higher rates. Buffers are added
+ * once one would exceed I2S_MAX_DMA_FRAME_NUM. i2s_set_dma_config() goes
+ * back to a fixed frame count.
+ * 
+ * @param desc_num Number of DMA buffers (minimum)
+ * @param latency_us Output latency to hold
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, or the channel creation error
+ */
+esp_err_t i2s_set_dma_latency(uint32_t desc_num, uint32_t latency_us);
+
+/**
+ * @brief Get the DMA depth
+ */
+void i2s_get_dma_config(uint32_t *desc_num, uint32_t *frame_num);
+
+/**
+ * @brief Output latency of the DMA at the current rate
+ * @return desc_num x frame_num frames in microseconds
+ */
+uint32_t i2s_get_output_latency_us(void);
+
+/**
+ * @brief Get the underrun count (cheap, for per-write checks)
+ */
+uint32_t i2s_get_underruns(void);
+
+/**
+ * @brief Get output health counters
+ */
+void i2s_get_stats(i2s_stats_t *out);
+
+/**
+ * @brief Reset output health counters
+ */
+void i2s_reset_stats(void);
+
 /**
  * @brief Write audio data to I2S
  * @param data Pointer to audio data buffer
@@ -4,18 +4,29 @@
  * 
  * Multi-source WAV playback system with CAN bus control and serial commands.
  * Uses modular architecture with hardware abstraction layer.
+ * 
+ * Boot order is chosen so the module answers on CAN as early as possible:
+ * the SD card (mount, library scan, bank) comes up in a background task
+ * while CAN and the codec initialize; embedded sounds play right away and
+ * SD-only requests wait in the CAN handler until the card is ready.
  */
 
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_err.h"
 #include "nvs_flash.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 #include "can_driver.h"
 #include "can_audio_handler.h"
 #include "audio_mixer.h"
 #include "audio_player.h"
+#include "sound_library.h"
+#include "sound_bank.h"
 #include "audio_console.h"
+#include "audio_calibration.h"
+#include "boot_timeline.h"
 
 // Hardware abstraction layer
 #include "hardware/gpio.h"
@@ -35,6 +46,39 @@ static const char *TAG = "MAIN";
 // Global state
 static bool g_sd_mounted = false;
 
+#define SD_INIT_TASK_STACK_SIZE  4096
+#define SD_INIT_TASK_PRIORITY    3     // Below CAN RX (5) and the mixer
+
+/**
+ * @brief Mount the SD card and index it, then exit
+ * 
+ * Runs beside the rest of boot. The SD card is on its own SPI bus, so it
+ * does not contend with the codec's I2C/I2S setup.
+ */
+static void sd_init_task(void *arg)
+{
+    esp_err_t ret = sdcard_init();
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "SD card mounted successfully");
+        
+        // Index /sdcard/sounds once so playback never probes the card
+        sound_library_scan();
+        
+        // Optional packed bank (one descriptor shared by all bank voices)
+        ret = sound_bank_open(SOUND_BANK_PATH);
+        if (ret != ESP_OK && ret != ESP_ERR_NOT_FOUND) {
+            ESP_LOGW(TAG, "Sound bank unusable: %s", esp_err_to_name(ret));
+        }
+        g_sd_mounted = true;
+        audio_player_set_sd_state(AUDIO_SD_READY);
+    } else {
+        ESP_LOGW(TAG, "SD card mount failed, continuing without SD");
+        audio_player_set_sd_state(AUDIO_SD_UNAVAILABLE);
+    }
+    boot_timeline_mark(BOOT_STAGE_SD_READY);
+    vTaskDelete(NULL);
+}
+
 
 /*------------------------------------------------------------------------
  *  Main Application
@@ -45,20 +89,53 @@ void app_main(void)
     ESP_LOGI(TAG, "=== ESP32-A1S Audio Module Starting ===");
     ESP_LOGI(TAG, "Version: %s", AUDIO_MODULE_VERSION);
 
-    // Mount SD card
-    esp_err_t ret = sdcard_init();
-    if (ret == ESP_OK) {
-        g_sd_mounted = true;
-        ESP_LOGI(TAG, "SD card mounted successfully");
+    // NVS (calibrated I2S DMA depth)
+    esp_err_t ret = nvs_flash_init();
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        ret = nvs_flash_init();
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "NVS init failed: %s (using default I2S DMA depth)", esp_err_to_name(ret));
+    }
+
+    // Mount SD card in the background (SD-only sounds wait for it)
+    if (xTaskCreate(sd_init_task, "sd_init", SD_INIT_TASK_STACK_SIZE, NULL,
+                    SD_INIT_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGW(TAG, "SD init task not created, continuing without SD");
+        audio_player_set_sd_state(AUDIO_SD_UNAVAILABLE);
+    }
+    
+    // Initialize CAN driver first: the main controller discovers modules
+    // shortly after power-up
+    ESP_LOGI(TAG, "Initializing CAN driver...");
+    can_config_t can_config = {
+        .tx_gpio = CAN_TX_GPIO,
+        .rx_gpio = CAN_RX_GPIO,
+        .bitrate = CAN_BITRATE,
+        .loopback = false,
+        .mock_mode = false
+    };
+    ret = can_driver_init(&can_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "CAN driver init failed, running in mock mode");
     } else {
-        ESP_LOGW(TAG, "SD card mount failed, continuing without SD");
-        g_sd_mounted = false;
+        ESP_LOGI(TAG, "CAN driver initialized @ %d bps", CAN_BITRATE);
     }
+
+    // Initialize and start CAN handler (PLAY before the codec and mixer are
+    // up is ACKed and queued, then played at BOOT_STAGE_AUDIO_READY)
+    ESP_ERROR_CHECK(can_audio_handler_init(&g_sd_mounted));
+    ESP_ERROR_CHECK(can_audio_handler_start_task());
+    ESP_LOGI(TAG, "CAN handler started");
+    ESP_LOGI(TAG, "CAN discovery: Audio Module v1.0 on block 0x420-0x42F");
+    boot_timeline_mark(BOOT_STAGE_CAN_READY);
     
     // Initialize hardware layer
     ESP_LOGI(TAG, "Initializing hardware...");
     ESP_ERROR_CHECK(gpio_init());
     ESP_ERROR_CHECK(i2c_init());
+    audio_calibration_load();  // DMA depth from `i2s calibrate`, if stored
     ESP_ERROR_CHECK(i2s_init(DEFAULT_SAMPLE_RATE));
     
     // Initialize ES8388 codec
@@ -107,29 +184,13 @@ void app_main(void)
             audio_mixer_set_hardware_ready(false);
         }
     }
-    
-    // Initialize CAN driver
-    ESP_LOGI(TAG, "Initializing CAN driver...");
-    can_config_t can_config = {
-        .tx_gpio = CAN_TX_GPIO,
-        .rx_gpio = CAN_RX_GPIO,
-        .bitrate = CAN_BITRATE,
-        .loopback = false,
-        .mock_mode = false
-    };
-    ret = can_driver_init(&can_config);
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "CAN driver init failed, running in mock mode");
+    if (codec_ok && mixer_ok) {
+        boot_timeline_mark(BOOT_STAGE_AUDIO_READY);
     } else {
-        ESP_LOGI(TAG, "CAN driver initialized @ %d bps", CAN_BITRATE);
+        // Queued and later PLAY requests end with an error instead of waiting
+        can_audio_handler_set_audio_failed();
     }
 
-    // Initialize and start CAN handler
-    ESP_ERROR_CHECK(can_audio_handler_init(&g_sd_mounted));
-    ESP_ERROR_CHECK(can_audio_handler_start_task());
-    ESP_LOGI(TAG, "CAN handler started");
-    ESP_LOGI(TAG, "CAN discovery: Audio Module v1.0 on block 0x420-0x42F");
-
     // Boot-ready sound: played by the audio module itself (not via CAN)
     // Sound index 0100 is reserved for this purpose.
     if (codec_ok && mixer_ok) {
@@ -137,6 +198,7 @@ void app_main(void)
         audio_source_handle_t handle = INVALID_SOURCE_HANDLE;
         esp_err_t play_ret = audio_player_play_sound(sound_id, 80, false, false, &handle);
         if (play_ret == ESP_OK) {
+            boot_timeline_mark(BOOT_STAGE_READY_SOUND);
             ESP_LOGI(TAG, "Played boot sound: audio-ready (id=%u, handle=%d)", (unsigned)sound_id, (int)handle);
         } else {
             ESP_LOGW(TAG, "Boot sound audio-ready failed (id=%u): %s", (unsigned)sound_id, esp_err_to_name(play_ret));
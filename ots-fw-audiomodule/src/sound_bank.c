@@ -0,0 +1,412 @@
+/**
+ * @file sound_bank.c
+ * @brief Packed sound bank reader implementation
+ */
+
+#include "sound_bank.h"
+#include "sound_library.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char *TAG = "SOUND_BANK";
+
+typedef struct {
+    uint16_t sound_id;
+    wav_info_t wav;         // data_offset/data_size are absolute bank offsets
+} bank_entry_t;
+
+static struct {
+    int fd;
+    SemaphoreHandle_t lock;
+    bank_entry_t *entries;  // Sorted by sound_id
+    size_t count;
+    uint32_t file_size;
+    uint64_t bytes_read;
+    uint32_t reads;
+} g_bank = { .fd = -1 };
+
+static int compare_entries(const void *a, const void *b)
+{
+    return (int)((const bank_entry_t *)a)->sound_id - (int)((const bank_entry_t *)b)->sound_id;
+}
+
+/**
+ * @brief Parse and validate one table entry
+ * @return true if the entry is playable
+ */
+static bool parse_entry(const uint8_t *raw, uint32_t file_size, bank_entry_t *out)
+{
+    uint16_t sound_id = wav_read_le16(raw + 0);
+    uint8_t format = raw[2];
+    uint32_t offset = wav_read_le32(raw + 12);
+    uint32_t size = wav_read_le32(raw + 16);
+
+    if (format != SOUND_BANK_FORMAT_PCM) {
+        ESP_LOGW(TAG, "Sound %u: unsupported format %u, skipped", sound_id, format);
+        return false;
+    }
+    if (offset > file_size || size > file_size - offset) {
+        ESP_LOGW(TAG, "Sound %u: blob outside bank (offset %lu size %lu), skipped",
+                 sound_id, (unsigned long)offset, (unsigned long)size);
+        return false;
+    }
+
+    out->sound_id = sound_id;
+    out->wav.num_channels = raw[3];
+    out->wav.bits_per_sample = raw[4];
+    out->wav.sample_rate = wav_read_le32(raw + 8);
+    out->wav.data_offset = offset;
+    out->wav.data_size = size;
+
+    if ((out->wav.bits_per_sample != 8 && out->wav.bits_per_sample != 16) ||
+        out->wav.num_channels < 1 || out->wav.num_channels > 2 ||
+        out->wav.sample_rate == 0) {
+        ESP_LOGW(TAG, "Sound %u: unsupported PCM %luHz %uch %ubit, skipped", sound_id,
+                 (unsigned long)out->wav.sample_rate, out->wav.num_channels,
+                 out->wav.bits_per_sample);
+        return false;
+    }
+    return true;
+}
+
+esp_err_t sound_bank_open(const char *path)
+{
+    if (g_bank.lock == NULL) {
+        g_bank.lock = xSemaphoreCreateMutex();
+        if (g_bank.lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    sound_bank_close();
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    struct stat st;
+    uint8_t header[SOUND_BANK_HEADER_SIZE];
+    if (fstat(fd, &st) != 0 ||
+        pread(fd, header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+        memcmp(header, SOUND_BANK_MAGIC, 4) != 0) {
+        ESP_LOGE(TAG, "%s is not a sound bank", path);
+        close(fd);
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    uint16_t version = wav_read_le16(header + 4);
+    uint16_t count = wav_read_le16(header + 6);
+    uint16_t entry_size = wav_read_le16(header + 8);
+    uint32_t file_size = wav_read_le32(header + 12);
+
+    if (version != SOUND_BANK_VERSION) {
+        ESP_LOGE(TAG, "Unsupported bank version %u (expected %d)", version, SOUND_BANK_VERSION);
+        close(fd);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    // Newer tools may append fields to an entry; the first ENTRY_SIZE bytes stay compatible
+    if (entry_size < SOUND_BANK_ENTRY_SIZE || count > SOUND_BANK_MAX_ENTRIES ||
+        file_size != (uint32_t)st.st_size) {
+        ESP_LOGE(TAG, "Corrupt bank header (entries %u, entry size %u, size %lu/%ld)",
+                 count, entry_size, (unsigned long)file_size, (long)st.st_size);
+        close(fd);
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    size_t table_bytes = (size_t)count * entry_size;
+    uint8_t *table = malloc(table_bytes);
+    bank_entry_t *entries = heap_caps_malloc(count * sizeof(bank_entry_t) + 1,
+                                             MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (entries == NULL) {
+        entries = malloc(count * sizeof(bank_entry_t) + 1);
+    }
+    if (table == NULL || entries == NULL) {
+        free(table);
+        free(entries);
+        close(fd);
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (pread(fd, table, table_bytes, SOUND_BANK_HEADER_SIZE) != (ssize_t)table_bytes) {
+        ESP_LOGE(TAG, "Short read on bank table");
+        free(table);
+        free(entries);
+        close(fd);
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+
+    size_t valid = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (parse_entry(table + i * entry_size, file_size, &entries[valid])) {
+            valid++;
+        }
+    }
+    free(table);
+
+    // The builder writes sorted tables; sort anyway so lookups stay correct
+    qsort(entries, valid, sizeof(entries[0]), compare_entries);
+
+    xSemaphoreTake(g_bank.lock, portMAX_DELAY);
+    g_bank.fd = fd;
+    g_bank.entries = entries;
+    g_bank.count = valid;
+    g_bank.file_size = file_size;
+    g_bank.bytes_read = 0;
+    g_bank.reads = 0;
+    xSemaphoreGive(g_bank.lock);
+
+    ESP_LOGI(TAG, "Opened %s: %zu sound(s), %lu bytes", path, valid, (unsigned long)file_size);
+    return ESP_OK;
+}
+
+void sound_bank_close(void)
+{
+    if (g_bank.lock == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(g_bank.lock, portMAX_DELAY);
+    if (g_bank.fd >= 0) {
+        close(g_bank.fd);
+        g_bank.fd = -1;
+    }
+    free(g_bank.entries);
+    g_bank.entries = NULL;
+    g_bank.count = 0;
+    g_bank.file_size = 0;
+    xSemaphoreGive(g_bank.lock);
+}
+
+bool sound_bank_is_open(void)
+{
+    return g_bank.fd >= 0;
+}
+
+esp_err_t sound_bank_lookup(uint16_t sound_id, wav_info_t *wav)
+{
+    if (g_bank.lock == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    bank_entry_t key = { .sound_id = sound_id };
+
+    xSemaphoreTake(g_bank.lock, portMAX_DELAY);
+    const bank_entry_t *entry = g_bank.count
+        ? bsearch(&key, g_bank.entries, g_bank.count, sizeof(key), compare_entries)
+        : NULL;
+    if (entry) {
+        if (wav) {
+            *wav = entry->wav;
+        }
+        ret = ESP_OK;
+    }
+    xSemaphoreGive(g_bank.lock);
+    return ret;
+}
+
+esp_err_t sound_bank_get_entry(size_t index, uint16_t *sound_id, wav_info_t *wav)
+{
+    if (g_bank.lock == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    xSemaphoreTake(g_bank.lock, portMAX_DELAY);
+    if (index < g_bank.count) {
+        if (sound_id) *sound_id = g_bank.entries[index].sound_id;
+        if (wav) *wav = g_bank.entries[index].wav;
+        ret = ESP_OK;
+    }
+    xSemaphoreGive(g_bank.lock);
+    return ret;
+}
+
+size_t sound_bank_read(uint32_t offset, void *buf, size_t len)
+{
+    if (g_bank.lock == NULL) {
+        return 0;
+    }
+
+    // FATFS keeps one position per descriptor: serialize so each pread's
+    // seek+read pair is atomic. A 1 KiB read holds the lock for well under a ms.
+    xSemaphoreTake(g_bank.lock, portMAX_DELAY);
+    ssize_t n = (g_bank.fd >= 0) ? pread(g_bank.fd, buf, len, offset) : -1;
+    if (n > 0) {
+        g_bank.bytes_read += (size_t)n;
+        g_bank.reads++;
+    }
+    xSemaphoreGive(g_bank.lock);
+
+    return (n > 0) ? (size_t)n : 0;
+}
+
+void sound_bank_get_stats(sound_bank_stats_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    memset(out, 0, sizeof(*out));
+    if (g_bank.lock == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(g_bank.lock, portMAX_DELAY);
+    out->open = g_bank.fd >= 0;
+    out->entries = g_bank.count;
+    out->file_size = g_bank.file_size;
+    out->bytes_read = g_bank.bytes_read;
+    out->reads = g_bank.reads;
+    xSemaphoreGive(g_bank.lock);
+}
+
+/*------------------------------------------------------------------------
+ *  Throughput benchmark
+ *-----------------------------------------------------------------------*/
+
+#define BENCH_MAX_VOICES    8
+#define BENCH_CHUNK_BYTES   1024    // Decoder read size (512 x 16-bit samples)
+
+typedef struct {
+    int index;
+    bool use_bank;
+    volatile bool *stop;
+    SemaphoreHandle_t done;
+    uint64_t bytes;
+    uint32_t worst_us;
+    bool open_failed;
+} bench_voice_t;
+
+static void bench_voice_task(void *arg)
+{
+    bench_voice_t *v = (bench_voice_t *)arg;
+    uint8_t buf[BENCH_CHUNK_BYTES];
+    FILE *fp = NULL;
+    wav_info_t wav = {0};
+    uint32_t pos = 0;
+
+    if (v->use_bank) {
+        uint16_t id;
+        sound_bank_stats_t bank;
+        sound_bank_get_stats(&bank);
+        if (bank.entries == 0 || sound_bank_get_entry(v->index % bank.entries, &id, &wav) != ESP_OK) {
+            v->open_failed = true;
+        }
+    } else {
+        sound_library_entry_t entry;
+        sound_library_stats_t lib;
+        sound_library_get_stats(&lib);
+        if (lib.entries > 0 && sound_library_get_entry(v->index % lib.entries, &entry) == ESP_OK) {
+            char path[64];
+            sound_library_entry_path(&entry, path, sizeof(path));
+            fp = fopen(path, "rb");
+            wav = entry.wav;
+        }
+        if (fp == NULL) {
+            v->open_failed = true;
+        } else {
+            fseek(fp, wav.data_offset, SEEK_SET);
+        }
+    }
+
+    if (wav.data_size == 0) {
+        v->open_failed = true;
+    }
+
+    while (!v->open_failed && !*v->stop) {
+        uint32_t left = wav.data_size - pos;
+        size_t want = left < sizeof(buf) ? left : sizeof(buf);
+        int64_t t0 = esp_timer_get_time();
+        size_t n = v->use_bank ? sound_bank_read(wav.data_offset + pos, buf, want)
+                               : fread(buf, 1, want, fp);
+        uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+        if (us > v->worst_us) {
+            v->worst_us = us;
+        }
+
+        v->bytes += n;
+        pos += n;
+        if (n == 0 || pos >= wav.data_size) {
+            // Loop the sound like a looping voice would
+            pos = 0;
+            if (fp) {
+                fseek(fp, wav.data_offset, SEEK_SET);
+            }
+            if (n == 0 && want > 0) {
+                break;  // Read error
+            }
+        }
+    }
+
+    if (fp) {
+        fclose(fp);
+    }
+    xSemaphoreGive(v->done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t sound_bank_benchmark(int voices, uint32_t duration_ms, bool use_bank,
+                               sound_bank_bench_t *out)
+{
+    if (out == NULL || voices < 1 || voices > BENCH_MAX_VOICES || duration_ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (use_bank && !sound_bank_is_open()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    bench_voice_t v[BENCH_MAX_VOICES];
+    volatile bool stop = false;
+    SemaphoreHandle_t done = xSemaphoreCreateCounting(BENCH_MAX_VOICES, 0);
+    if (done == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    int started = 0;
+    int64_t t0 = esp_timer_get_time();
+    for (int i = 0; i < voices; i++) {
+        v[i] = (bench_voice_t){ .index = i, .use_bank = use_bank, .stop = &stop, .done = done };
+        // Same priority as decoder tasks
+        if (xTaskCreate(bench_voice_task, "bank_bench", 4096, &v[i], 8, NULL) == pdPASS) {
+            started++;
+        }
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(duration_ms));
+    stop = true;
+    for (int i = 0; i < started; i++) {
+        xSemaphoreTake(done, portMAX_DELAY);
+    }
+    uint32_t elapsed_ms = (uint32_t)((esp_timer_get_time() - t0) / 1000);
+    vSemaphoreDelete(done);
+
+    memset(out, 0, sizeof(*out));
+    out->duration_ms = elapsed_ms;
+    for (int i = 0; i < started; i++) {
+        if (v[i].open_failed) {
+            out->open_failures++;
+            continue;
+        }
+        out->voices++;
+        out->bytes += v[i].bytes;
+        if (v[i].worst_us > out->worst_chunk_us) {
+            out->worst_chunk_us = v[i].worst_us;
+        }
+    }
+    out->kbps = elapsed_ms ? (uint32_t)((out->bytes * 1000 / elapsed_ms) / 1024) : 0;
+
+    ESP_LOGI(TAG, "%s: %d voice(s) (%d failed to open), %lu KiB/s, worst chunk %lu us",
+             use_bank ? "bank" : "files", out->voices, out->open_failures,
+             (unsigned long)out->kbps, (unsigned long)out->worst_chunk_us);
+    return ESP_OK;
+}
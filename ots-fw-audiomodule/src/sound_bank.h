@@ -0,0 +1,144 @@
+/**
+ * @file sound_bank.h
+ * @brief Packed sound bank on the SD card
+ *
+ * One file holds every sound: a fixed header, a table of entries sorted by
+ * sound ID, then the PCM blobs, each aligned to SOUND_BANK_ALIGN bytes so a
+ * chunk read never straddles more sectors than needed. Built on the host by
+ * tools/build_sound_bank.py.
+ *
+ * The bank is opened once at mount. Voices read their PCM with offset reads
+ * (pread) on that single descriptor, so the number of concurrent bank voices
+ * is not limited by the FATFS max_files setting and playback never walks a
+ * directory or parses a header.
+ *
+ * File layout (all fields little-endian):
+ *
+ *   header  (16 bytes)   magic "OTSB", version, entry_count, entry_size,
+ *                        align_shift, reserved
+ *   entries (entry_count * entry_size bytes, sorted by sound_id)
+ *   padding to 1 << align_shift, then blobs (each padded likewise)
+ */
+
+#ifndef SOUND_BANK_H
+#define SOUND_BANK_H
+
+#include "esp_err.h"
+#include "wav_utils.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SOUND_BANK_PATH         "/sdcard/sounds.bank"
+#define SOUND_BANK_MAGIC        "OTSB"
+#define SOUND_BANK_VERSION      1
+#define SOUND_BANK_HEADER_SIZE  16
+#define SOUND_BANK_ENTRY_SIZE   20
+#define SOUND_BANK_MAX_ENTRIES  256
+
+/**
+ * @brief Blob encodings
+ *
+ * Only PCM is decoded by the firmware; other codes are reserved so a bank
+ * built by a newer tool is rejected per entry instead of played as noise.
+ */
+typedef enum {
+    SOUND_BANK_FORMAT_PCM = 1,
+    SOUND_BANK_FORMAT_IMA_ADPCM = 2,   // Reserved
+} sound_bank_format_t;
+
+/**
+ * @brief Bank statistics
+ */
+typedef struct {
+    bool open;
+    size_t entries;
+    uint32_t file_size;
+    uint64_t bytes_read;    ///< PCM bytes served to voices
+    uint32_t reads;         ///< Offset reads issued
+} sound_bank_stats_t;
+
+/**
+ * @brief Open the bank and load its entry table
+ *
+ * @param path Bank file (SOUND_BANK_PATH)
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the file does not exist,
+ *         ESP_ERR_INVALID_VERSION / ESP_ERR_INVALID_RESPONSE for a bad bank
+ */
+esp_err_t sound_bank_open(const char *path);
+
+/**
+ * @brief Close the bank (voices still reading get read errors)
+ */
+void sound_bank_close(void);
+
+/**
+ * @brief Check whether a bank is open
+ */
+bool sound_bank_is_open(void);
+
+/**
+ * @brief Look up a sound
+ *
+ * @param sound_id Sound ID
+ * @param wav Output format; data_offset/data_size locate the blob in the bank
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND
+ */
+esp_err_t sound_bank_lookup(uint16_t sound_id, wav_info_t *wav);
+
+/**
+ * @brief Get entry by position (sorted by sound ID), for listings
+ */
+esp_err_t sound_bank_get_entry(size_t index, uint16_t *sound_id, wav_info_t *wav);
+
+/**
+ * @brief Read bytes at an absolute bank offset
+ *
+ * Thread-safe; any number of voices can read concurrently.
+ *
+ * @return Bytes read (0 at end of file or on error)
+ */
+size_t sound_bank_read(uint32_t offset, void *buf, size_t len);
+
+/**
+ * @brief Get bank statistics
+ */
+void sound_bank_get_stats(sound_bank_stats_t *out);
+
+/**
+ * @brief Concurrent-voice SD throughput result
+ */
+typedef struct {
+    int voices;             ///< Voices that ran
+    int open_failures;      ///< Voices that could not open their file
+    uint32_t duration_ms;
+    uint64_t bytes;         ///< Total bytes read by all voices
+    uint32_t kbps;          ///< Aggregate KiB/s
+    uint32_t worst_chunk_us;///< Slowest single chunk read
+} sound_bank_bench_t;
+
+/**
+ * @brief Measure SD read throughput with concurrent voices
+ *
+ * Each voice is a task reading 1 KiB chunks (a decoder's read size) in a
+ * loop. With use_bank, voices read the bank blobs through the shared
+ * descriptor; otherwise each voice opens its own indexed sound file, which
+ * is what file-per-voice playback does (and is capped by max_files).
+ *
+ * @param voices Number of concurrent voices (1-8)
+ * @param duration_ms How long to read
+ * @param use_bank Bank offset reads (true) or one file per voice (false)
+ * @param out Result
+ */
+esp_err_t sound_bank_benchmark(int voices, uint32_t duration_ms, bool use_bank,
+                               sound_bank_bench_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SOUND_BANK_H
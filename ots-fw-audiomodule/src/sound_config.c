@@ -5,11 +5,13 @@
 
 #include "sound_config.h"
 #include <stddef.h>
+#include <stdlib.h>
 
 /**
  * Sound registry mapping CAN indices to WAV files
  * 
- * Add new sounds here to make them available via CAN bus
+ * Add new sounds here to make them available via CAN bus.
+ * Keep entries sorted by index: sound_config_lookup() binary-searches.
  */
 const sound_entry_t g_sound_registry[] = {
     // Test sounds
@@ -77,12 +79,13 @@ const sound_entry_t g_sound_registry[] = {
 
 const size_t g_sound_registry_size = sizeof(g_sound_registry) / sizeof(g_sound_registry[0]);
 
+static int compare_index(const void *key, const void *entry)
+{
+    return (int)*(const uint16_t *)key - (int)((const sound_entry_t *)entry)->index;
+}
+
 const sound_entry_t* sound_config_lookup(uint16_t index)
 {
-    for (size_t i = 0; i < g_sound_registry_size; i++) {
-        if (g_sound_registry[i].index == index) {
-            return &g_sound_registry[i];
-        }
-    }
-    return NULL;
+    return bsearch(&index, g_sound_registry, g_sound_registry_size,
+                   sizeof(g_sound_registry[0]), compare_index);
 }
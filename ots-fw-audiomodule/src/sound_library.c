@@ -0,0 +1,259 @@
+/**
+ * @file sound_library.c
+ * @brief SD card sound library index implementation
+ */
+
+#include "sound_library.h"
+#include "hardware/sdcard.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <ctype.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static const char *TAG = "SOUND_LIB";
+
+static struct {
+    SemaphoreHandle_t lock;
+    sound_library_entry_t *entries;   // Sorted by sound_id
+    size_t count;
+    bool enabled;
+    sound_library_stats_t stats;
+} g_lib = { .enabled = true };
+
+/**
+ * @brief Parse "<digits>.wav" into a sound ID
+ * @return true if the name is a sound file name
+ */
+static bool parse_sound_name(const char *name, uint16_t *sound_id)
+{
+    size_t len = strlen(name);
+    if (len < 5 || len >= SOUND_LIBRARY_NAME_LEN || strcasecmp(name + len - 4, ".wav") != 0) {
+        return false;
+    }
+
+    uint32_t id = 0;
+    for (size_t i = 0; i < len - 4; i++) {
+        if (!isdigit((unsigned char)name[i])) {
+            return false;
+        }
+        id = id * 10 + (uint32_t)(name[i] - '0');
+        if (id > UINT16_MAX) {
+            return false;
+        }
+    }
+
+    *sound_id = (uint16_t)id;
+    return true;
+}
+
+static int compare_entries(const void *a, const void *b)
+{
+    const sound_library_entry_t *ea = a;
+    const sound_library_entry_t *eb = b;
+    return (int)ea->sound_id - (int)eb->sound_id;
+}
+
+// Scan order: by ID, then by file name, so duplicates resolve the same way
+// on every mount (qsort is not stable and readdir order is arbitrary)
+static int compare_scan_order(const void *a, const void *b)
+{
+    const int by_id = compare_entries(a, b);
+    if (by_id != 0) {
+        return by_id;
+    }
+    return strcmp(((const sound_library_entry_t *)a)->name, ((const sound_library_entry_t *)b)->name);
+}
+
+static const sound_library_entry_t *find_entry(uint16_t sound_id)
+{
+    sound_library_entry_t key = { .sound_id = sound_id };
+    if (g_lib.count == 0) {
+        return NULL;
+    }
+    return bsearch(&key, g_lib.entries, g_lib.count, sizeof(key), compare_entries);
+}
+
+/**
+ * @brief Read one file's header into an entry
+ */
+static bool index_file(const char *name, uint16_t sound_id, sound_library_entry_t *entry)
+{
+    char path[64];
+    snprintf(path, sizeof(path), SOUND_LIBRARY_DIR "/%s", name);
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        ESP_LOGW(TAG, "Cannot open %s", path);
+        return false;
+    }
+    esp_err_t ret = wav_parse_header(f, &entry->wav);
+    fclose(f);
+
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Invalid WAV, not indexed: %s", path);
+        return false;
+    }
+
+    entry->sound_id = sound_id;
+    strncpy(entry->name, name, sizeof(entry->name) - 1);
+    entry->name[sizeof(entry->name) - 1] = '\0';
+    return true;
+}
+
+esp_err_t sound_library_scan(void)
+{
+    if (!sdcard_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (g_lib.lock == NULL) {
+        g_lib.lock = xSemaphoreCreateMutex();
+        if (g_lib.lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    int64_t start_us = esp_timer_get_time();
+
+    // Table is small (~40 bytes per entry); prefer PSRAM, keep internal RAM free
+    const size_t table_size = SOUND_LIBRARY_MAX_ENTRIES * sizeof(sound_library_entry_t);
+    sound_library_entry_t *table = heap_caps_malloc(table_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (table == NULL) {
+        table = malloc(table_size);
+        if (table == NULL) {
+            ESP_LOGE(TAG, "Failed to allocate index (%zu bytes)", table_size);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    size_t count = 0;
+    size_t skipped = 0;
+
+    DIR *dir = opendir(SOUND_LIBRARY_DIR);
+    if (dir == NULL) {
+        ESP_LOGW(TAG, "%s not found, SD sound library is empty", SOUND_LIBRARY_DIR);
+    } else {
+        struct dirent *de;
+        while ((de = readdir(dir)) != NULL) {
+            uint16_t sound_id;
+            if (de->d_type == DT_DIR || !parse_sound_name(de->d_name, &sound_id)) {
+                continue;
+            }
+            if (count >= SOUND_LIBRARY_MAX_ENTRIES) {
+                ESP_LOGW(TAG, "Index full (%d), skipping %s", SOUND_LIBRARY_MAX_ENTRIES, de->d_name);
+                skipped++;
+                continue;
+            }
+            if (index_file(de->d_name, sound_id, &table[count])) {
+                count++;
+            } else {
+                skipped++;
+            }
+        }
+        closedir(dir);
+    }
+
+    qsort(table, count, sizeof(table[0]), compare_scan_order);
+
+    // Two names for one ID (e.g. 4.wav and 0004.wav): the lowest name wins (0004.wav)
+    size_t unique = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (unique > 0 && table[unique - 1].sound_id == table[i].sound_id) {
+            ESP_LOGW(TAG, "Duplicate sound %u: %s ignored", table[i].sound_id, table[i].name);
+            skipped++;
+            continue;
+        }
+        table[unique++] = table[i];
+    }
+
+    uint32_t scan_ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+
+    xSemaphoreTake(g_lib.lock, portMAX_DELAY);
+    sound_library_entry_t *old = g_lib.entries;
+    g_lib.entries = table;
+    g_lib.count = unique;
+    g_lib.stats.entries = unique;
+    g_lib.stats.skipped = skipped;
+    g_lib.stats.scan_ms = scan_ms;
+    xSemaphoreGive(g_lib.lock);
+
+    free(old);
+
+    ESP_LOGI(TAG, "Indexed %zu sound(s) in %lu ms (%zu skipped)",
+             unique, (unsigned long)scan_ms, skipped);
+    return ESP_OK;
+}
+
+esp_err_t sound_library_lookup(uint16_t sound_id, sound_library_entry_t *out)
+{
+    if (g_lib.lock == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    xSemaphoreTake(g_lib.lock, portMAX_DELAY);
+    const sound_library_entry_t *entry = find_entry(sound_id);
+    if (entry) {
+        if (out) {
+            *out = *entry;
+        }
+        g_lib.stats.hits++;
+    } else {
+        g_lib.stats.misses++;
+    }
+    xSemaphoreGive(g_lib.lock);
+
+    return entry ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t sound_library_get_entry(size_t index, sound_library_entry_t *out)
+{
+    if (g_lib.lock == NULL || out == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    xSemaphoreTake(g_lib.lock, portMAX_DELAY);
+    if (index < g_lib.count) {
+        *out = g_lib.entries[index];
+        ret = ESP_OK;
+    }
+    xSemaphoreGive(g_lib.lock);
+    return ret;
+}
+
+void sound_library_entry_path(const sound_library_entry_t *entry, char *path, size_t path_size)
+{
+    snprintf(path, path_size, SOUND_LIBRARY_DIR "/%s", entry->name);
+}
+
+void sound_library_set_enabled(bool enabled)
+{
+    g_lib.enabled = enabled;
+    ESP_LOGI(TAG, "SD sound index %s", enabled ? "enabled" : "bypassed");
+}
+
+bool sound_library_is_enabled(void)
+{
+    return g_lib.enabled;
+}
+
+void sound_library_get_stats(sound_library_stats_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    if (g_lib.lock) {
+        xSemaphoreTake(g_lib.lock, portMAX_DELAY);
+        *out = g_lib.stats;
+        xSemaphoreGive(g_lib.lock);
+    } else {
+        *out = g_lib.stats;
+    }
+}
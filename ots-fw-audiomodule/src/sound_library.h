@@ -0,0 +1,105 @@
+/**
+ * @file sound_library.h
+ * @brief SD card sound library index
+ *
+ * Scans /sdcard/sounds once (at mount, or on demand) and keeps an in-RAM
+ * table of sound ID -> file name, PCM data offset/size and parsed WAV
+ * header. Playback then opens the file once and seeks straight to the PCM
+ * data; IDs that are not on the card are rejected without touching the SD
+ * bus, so embedded fallbacks start immediately.
+ *
+ * Files are matched by name: "<id>.wav" (e.g. 0004.wav, 10100.wav).
+ */
+
+#ifndef SOUND_LIBRARY_H
+#define SOUND_LIBRARY_H
+
+#include "esp_err.h"
+#include "wav_utils.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SOUND_LIBRARY_DIR           "/sdcard/sounds"
+#define SOUND_LIBRARY_MAX_ENTRIES   256
+#define SOUND_LIBRARY_NAME_LEN      16   // 8.3 names and "65535.wav"
+
+/**
+ * @brief One indexed sound file
+ */
+typedef struct {
+    uint16_t sound_id;
+    char name[SOUND_LIBRARY_NAME_LEN];  ///< File name inside SOUND_LIBRARY_DIR
+    wav_info_t wav;                     ///< Parsed header (data_offset/data_size locate the PCM)
+} sound_library_entry_t;
+
+/**
+ * @brief Index statistics
+ */
+typedef struct {
+    size_t entries;         ///< Sounds in the index
+    size_t skipped;         ///< Files ignored (bad name, invalid WAV, table full)
+    uint32_t scan_ms;       ///< Duration of the last scan
+    uint32_t hits;          ///< Lookups answered from the index
+    uint32_t misses;        ///< Lookups for IDs not on the card
+} sound_library_stats_t;
+
+/**
+ * @brief Build (or rebuild) the index from SOUND_LIBRARY_DIR
+ *
+ * Safe to call while sounds are playing: the table is swapped under a lock.
+ *
+ * @return ESP_OK on success (an empty or missing directory is not an error),
+ *         ESP_ERR_INVALID_STATE if the SD card is not mounted,
+ *         ESP_ERR_NO_MEM if the table cannot be allocated
+ */
+esp_err_t sound_library_scan(void);
+
+/**
+ * @brief Look up a sound by ID
+ *
+ * @param sound_id Sound ID
+ * @param out Copy of the entry (can be NULL to only test presence)
+ * @return ESP_OK if indexed, ESP_ERR_NOT_FOUND otherwise
+ */
+esp_err_t sound_library_lookup(uint16_t sound_id, sound_library_entry_t *out);
+
+/**
+ * @brief Get entry by position (sorted by sound ID), for listings
+ *
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND past the end
+ */
+esp_err_t sound_library_get_entry(size_t index, sound_library_entry_t *out);
+
+/**
+ * @brief Build the full path of an entry
+ */
+void sound_library_entry_path(const sound_library_entry_t *entry, char *path, size_t path_size);
+
+/**
+ * @brief Enable or bypass the index
+ *
+ * When bypassed, SD playback probes /sdcard/sounds/%04d.wav on every request
+ * (the pre-index behaviour), which is useful for latency comparisons.
+ */
+void sound_library_set_enabled(bool enabled);
+
+/**
+ * @brief Check whether the index is used for SD playback
+ */
+bool sound_library_is_enabled(void);
+
+/**
+ * @brief Get index statistics
+ */
+void sound_library_get_stats(sound_library_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SOUND_LIBRARY_H
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""Build (or inspect) a packed sound bank for the audio module SD card.
+
+The firmware plays sounds by ID. Instead of one WAV file per sound it can
+read a single packed bank, ``/sdcard/sounds.bank``: one open file, a sorted
+entry table, and sector-aligned PCM blobs read with offset reads. See
+``src/sound_bank.h`` for the layout.
+
+Input files are ``<id>.wav`` (``0004.wav``, ``10100.wav``), PCM 8/16-bit,
+mono or stereo, any sample rate. Other files are ignored.
+
+Examples:
+
+  # Build from the repository's sounds/ directory
+  python3 tools/build_sound_bank.py sounds -o sounds.bank
+
+  # Copy to the card root, then on the device console: bank reload
+  cp sounds.bank /media/$USER/SDCARD/
+
+  # Inspect an existing bank
+  python3 tools/build_sound_bank.py --list sounds.bank
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+from typing import Any
+
+MAGIC = b"OTSB"
+VERSION = 1
+HEADER = struct.Struct("<4sHHHBBI")  # magic, version, count, entry_size, align_shift, reserved, file_size
+ENTRY = struct.Struct("<HBBBBHIII")  # id, format, channels, bits, reserved, reserved, rate, offset, size
+FORMAT_PCM = 1
+MAX_ENTRIES = 256
+
+SOUND_NAME = re.compile(r"^(\d+)\.wav$", re.IGNORECASE)
+
+
+def parse_wav(path: str) -> dict[str, Any]:
+    """Return format and PCM bytes of a RIFF/WAVE PCM file."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < 12 or data[0:4] != b"RIFF" or data[8:12] != b"WAVE":
+        raise ValueError("not a RIFF/WAVE file")
+
+    fmt = None
+    pcm = None
+    pos = 12
+    while pos + 8 <= len(data):
+        chunk_id = data[pos:pos + 4]
+        size = struct.unpack_from("<I", data, pos + 4)[0]
+        body = data[pos + 8:pos + 8 + size]
+        if chunk_id == b"fmt ":
+            fmt = struct.unpack_from("<HHIIHH", body, 0)
+        elif chunk_id == b"data":
+            pcm = body
+        pos += 8 + size + (size & 1)  # Chunks are word aligned
+
+    if fmt is None or pcm is None:
+        raise ValueError("missing fmt or data chunk")
+    audio_format, channels, rate, _byte_rate, _block_align, bits = fmt
+    if audio_format != 1:
+        raise ValueError(f"not PCM (format {audio_format})")
+    if bits not in (8, 16) or channels not in (1, 2):
+        raise ValueError(f"unsupported {bits}-bit {channels}ch")
+    return {"channels": channels, "rate": rate, "bits": bits, "pcm": pcm}
+
+
+def collect(src_dir: str) -> list[dict[str, Any]]:
+    sounds: dict[int, dict[str, Any]] = {}
+    for name in sorted(os.listdir(src_dir)):
+        m = SOUND_NAME.match(name)
+        if not m:
+            continue
+        sound_id = int(m.group(1))
+        if sound_id > 0xFFFF:
+            print(f"WARN: {name}: ID out of range, skipped", file=sys.stderr)
+            continue
+        if sound_id in sounds:
+            print(f"WARN: {name}: duplicate ID {sound_id}, skipped", file=sys.stderr)
+            continue
+        try:
+            wav = parse_wav(os.path.join(src_dir, name))
+        except (OSError, ValueError, struct.error) as e:
+            print(f"WARN: {name}: {e}, skipped", file=sys.stderr)
+            continue
+        wav["id"] = sound_id
+        wav["name"] = name
+        sounds[sound_id] = wav
+    return [sounds[k] for k in sorted(sounds)]
+
+
+def align_up(value: int, align: int) -> int:
+    return (value + align - 1) & ~(align - 1)
+
+
+def build(sounds: list[dict[str, Any]], align: int) -> bytes:
+    if len(sounds) > MAX_ENTRIES:
+        raise ValueError(f"{len(sounds)} sounds, firmware limit is {MAX_ENTRIES}")
+
+    offset = align_up(HEADER.size + ENTRY.size * len(sounds), align)
+    entries = []
+    blobs = bytearray()
+    for s in sounds:
+        s["offset"] = offset
+        entries.append(ENTRY.pack(s["id"], FORMAT_PCM, s["channels"], s["bits"], 0, 0,
+                                  s["rate"], offset, len(s["pcm"])))
+        padded = align_up(len(s["pcm"]), align)
+        blobs += s["pcm"] + bytes(padded - len(s["pcm"]))
+        offset += padded
+
+    table = b"".join(entries)
+    head_len = align_up(HEADER.size + len(table), align)
+    file_size = head_len + len(blobs)
+    header = HEADER.pack(MAGIC, VERSION, len(sounds), ENTRY.size, align.bit_length() - 1, 0, file_size)
+    out = header + table
+    return out + bytes(head_len - len(out)) + bytes(blobs)
+
+
+def read_bank(path: str) -> dict[str, Any]:
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, count, entry_size, align_shift, _, file_size = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError("not a sound bank")
+    entries = []
+    for i in range(count):
+        sid, fmt, ch, bits, _, _, rate, off, size = ENTRY.unpack_from(data, HEADER.size + i * entry_size)
+        entries.append({"id": sid, "format": fmt, "channels": ch, "bits": bits,
+                        "rate": rate, "offset": off, "size": size})
+    return {"version": version, "align": 1 << align_shift, "file_size": file_size,
+            "actual_size": len(data), "entries": entries}
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Build or inspect an audio module sound bank")
+    ap.add_argument("source", help="Directory of <id>.wav files, or a bank with --list")
+    ap.add_argument("-o", "--output", default="sounds.bank", help="Output file (default: sounds.bank)")
+    ap.add_argument("--align", type=int, default=512, help="Blob alignment in bytes, power of two (default: 512)")
+    ap.add_argument("--list", action="store_true", help="List the entries of an existing bank")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    if args.list:
+        try:
+            bank = read_bank(args.source)
+        except (OSError, ValueError, struct.error) as e:
+            print(f"ERROR: {args.source}: {e}", file=sys.stderr)
+            return 1
+        if args.json:
+            print(json.dumps(bank, indent=2))
+            return 0
+        print(f"{args.source}: v{bank['version']}, {len(bank['entries'])} sound(s), "
+              f"align {bank['align']}, {bank['actual_size']} bytes")
+        if bank["file_size"] != bank["actual_size"]:
+            print(f"  WARNING: header says {bank['file_size']} bytes (truncated copy?)")
+        for e in bank["entries"]:
+            print(f"  ID {e['id']:5d}: @{e['offset']:<8d} {e['rate']:5d}Hz {e['channels']}ch "
+                  f"{e['bits']:2d}bit {e['size']:7d} bytes")
+        return 0
+
+    if args.align < 16 or args.align & (args.align - 1):
+        print("ERROR: --align must be a power of two >= 16", file=sys.stderr)
+        return 1
+    if not os.path.isdir(args.source):
+        print(f"ERROR: {args.source} is not a directory", file=sys.stderr)
+        return 1
+
+    sounds = collect(args.source)
+    if not sounds:
+        print(f"ERROR: no <id>.wav PCM files in {args.source}", file=sys.stderr)
+        return 1
+    try:
+        data = build(sounds, args.align)
+    except ValueError as e:
+        print(f"ERROR: {e}", file=sys.stderr)
+        return 1
+    with open(args.output, "wb") as f:
+        f.write(data)
+
+    pcm_total = sum(len(s["pcm"]) for s in sounds)
+    if args.json:
+        print(json.dumps({
+            "output": args.output,
+            "bytes": len(data),
+            "pcm_bytes": pcm_total,
+            "sounds": [{k: s[k] for k in ("id", "name", "rate", "channels", "bits", "offset")} |
+                       {"size": len(s["pcm"])} for s in sounds],
+        }, indent=2))
+        return 0
+
+    for s in sounds:
+        print(f"  ID {s['id']:5d}: {s['name']:<12} {s['rate']:5d}Hz {s['channels']}ch "
+              f"{s['bits']:2d}bit {len(s['pcm']):7d} bytes @{s['offset']}")
+    print(f"Wrote {args.output}: {len(sounds)} sound(s), {len(data)} bytes "
+          f"({len(data) - pcm_total} bytes table + padding)")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -1,12 +1,15 @@
 #!/bin/bash
 #
-# embed_sounds.sh - Convert WAV files to embedded C arrays
+# embed_sounds.sh - Convert WAV files for flash embedding
 #
 # This script:
 # 1. Scans sounds/*.wav files matching SD card naming (0000-9999.wav)
 # 2. Converts them to 8-bit 22kHz mono format for flash embedding
-# 3. Generates C header and source files for each sound
-# 4. Places generated files in include/embedded/ and src/embedded/
+# 3. Writes sounds/embedded/<id>_<name>.wav
+#
+# The build packs every file in sounds/embedded/ into one flash blob with a
+# generated lookup table (tools/gen_embedded_sounds.py, run by CMake), so no
+# source file needs editing after converting.
 #
 # Usage:
 #   ./tools/embed_sounds.sh
@@ -14,7 +17,6 @@
 #
 # Requirements:
 #   - ffmpeg (for audio conversion)
-#   - xxd (for binary to C array conversion)
 
 set -e  # Exit on error
 
@@ -29,8 +31,7 @@ NC='\033[0m' # No Color
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
 PROJECT_ROOT="$(dirname "$SCRIPT_DIR")"
 SOUNDS_DIR="$PROJECT_ROOT/sounds"
-EMBEDDED_INC_DIR="$PROJECT_ROOT/include/embedded"
-EMBEDDED_SRC_DIR="$PROJECT_ROOT/src/embedded"
+EMBEDDED_DIR="$SOUNDS_DIR/embedded"
 
 # Audio format settings for embedded sounds
 EMBED_SAMPLE_RATE=22050
@@ -49,21 +50,8 @@ if ! command -v ffmpeg &> /dev/null; then
     exit 1
 fi
 
-if ! command -v xxd &> /dev/null; then
-    echo -e "${RED}Error: xxd not found. Please install: sudo apt install xxd${NC}"
-    exit 1
-fi
-
-# Create output directories
-mkdir -p "$EMBEDDED_INC_DIR"
-mkdir -p "$EMBEDDED_SRC_DIR"
-
-# Function to convert sound index to variable name
-# Example: 0000 -> game_sound_0000, 0042 -> game_sound_0042
-sound_id_to_varname() {
-    local sound_id="$1"
-    echo "game_sound_${sound_id}_22050_8bit"
-}
+# Create output directory
+mkdir -p "$EMBEDDED_DIR"
 
 # Function to get friendly name for game sounds
 get_friendly_name() {
@@ -78,10 +66,10 @@ get_friendly_name() {
         0006) echo "game_alert_naval" ;;
         0007) echo "game_nuke_launch" ;;
         0100) echo "audio_ready" ;;
-        10000) echo "test_tone_1s_440hz" ;;
-        10001) echo "test_tone_2s_880hz" ;;
-        10002) echo "test_tone_5s_220hz" ;;
-        10100) echo "quack_sound" ;;
+        10000) echo "test_tone_440hz_1s" ;;
+        10001) echo "test_tone_880hz_2s" ;;
+        10002) echo "test_tone_220hz_5s" ;;
+        10100) echo "quack" ;;
         *) echo "sound_${sound_id}" ;;
     esac
 }
@@ -90,23 +78,23 @@ get_friendly_name() {
 process_sound() {
     local input_file="$1"
     local sound_id="$2"
-    local varname=$(sound_id_to_varname "$sound_id")
     local friendly_name=$(get_friendly_name "$sound_id")
-    
-    local temp_wav="$EMBEDDED_SRC_DIR/${varname}.wav"
-    local output_c="$EMBEDDED_SRC_DIR/${varname}.c"
-    local output_h="$EMBEDDED_INC_DIR/${varname}.h"
+    local output_wav="$EMBEDDED_DIR/${sound_id}_${friendly_name}.wav"
     
     echo -e "${YELLOW}Processing sound ${sound_id} (${friendly_name})...${NC}"
     echo "  Input:  $input_file"
     
-    # Step 1: Convert to 8-bit 22kHz mono
+    # One file per ID: drop a previous conversion stored under another name
+    rm -f "$EMBEDDED_DIR/${sound_id}"_*.wav
+    
+    # Convert to 8-bit 22kHz mono
     echo -n "  Converting to 8-bit 22kHz mono... "
     if ffmpeg -i "$input_file" \
         -ar "$EMBED_SAMPLE_RATE" \
         -ac "$EMBED_CHANNELS" \
         -acodec pcm_u8 \
-        -y "$temp_wav" \
+        -map_metadata -1 \
+        -y "$output_wav" \
         -loglevel error; then
         echo -e "${GREEN}✓${NC}"
     else
@@ -114,71 +102,8 @@ process_sound() {
         return 1
     fi
     
-    # Get file size
-    local file_size=$(stat -f%z "$temp_wav" 2>/dev/null || stat -c%s "$temp_wav" 2>/dev/null)
-    
-    # Step 2: Generate C header file
-    echo -n "  Generating header... "
-    cat > "$output_h" << EOF
-/**
- * @file ${varname}.h
- * @brief Embedded sound: ${friendly_name} (ID ${sound_id})
- * 
- * Auto-generated from ${input_file}
- * Format: 8-bit PCM, 22050 Hz, Mono
- * Size: ${file_size} bytes
- */
-
-#pragma once
-
-#include <stdint.h>
-#include <stddef.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-extern const uint8_t ${varname}_wav[];
-extern const size_t ${varname}_wav_len;
-
-#ifdef __cplusplus
-}
-#endif
-EOF
-    echo -e "${GREEN}✓${NC}"
-    
-    # Step 3: Generate C source file with embedded data
-    echo -n "  Generating source... "
-    
-    # Generate header
-    cat > "$output_c" << EOF
-/**
- * @file ${varname}.c
- * @brief Embedded sound data: ${friendly_name} (ID ${sound_id})
- * 
- * Auto-generated from ${input_file}
- * Format: 8-bit PCM, 22050 Hz, Mono
- * Size: ${file_size} bytes
- */
-
-#include "embedded/${varname}.h"
-
-EOF
-    
-    # Convert WAV to C array using xxd and wrap in array declaration
-    echo "const uint8_t ${varname}_wav[] = {" >> "$output_c"
-    xxd -i < "$temp_wav" | sed 's/^  //' >> "$output_c"
-    echo "};" >> "$output_c"
-    echo "" >> "$output_c"
-    echo "const size_t ${varname}_wav_len = sizeof(${varname}_wav);" >> "$output_c"
-    
-    echo -e "${GREEN}✓${NC}"
-    
-    # Clean up temporary WAV file
-    rm -f "$temp_wav"
-    
-    echo "  Output: $output_h"
-    echo "  Output: $output_c"
+    local file_size=$(stat -f%z "$output_wav" 2>/dev/null || stat -c%s "$output_wav" 2>/dev/null)
+    echo "  Output: $output_wav"
     echo "  Size:   ${file_size} bytes"
     echo ""
     
@@ -254,13 +179,10 @@ if [ $failed_count -gt 0 ]; then
 fi
 echo ""
 echo -e "${YELLOW}Next steps:${NC}"
-echo "1. Add includes to src/audio_player.c:"
-echo "   #include \"embedded/game_sound_XXXX_22050_8bit.h\""
-echo ""
-echo "2. Add entries to embedded_game_sounds[] array:"
-echo "   { XXXX, game_sound_XXXX_22050_8bit_wav, game_sound_XXXX_22050_8bit_wav_len, \"name\" }"
+echo "1. Check the list of embedded sounds:"
+echo "   python3 tools/gen_embedded_sounds.py --list sounds/embedded"
 echo ""
-echo "3. Rebuild firmware:"
+echo "2. Rebuild firmware (the sound table is generated by the build):"
 echo "   pio run -e esp32-a1s-espidf"
 echo -e "${BLUE}================================================${NC}"
 
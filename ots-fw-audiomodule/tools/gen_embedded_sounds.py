@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""Generate the embedded sound blob and its lookup table at build time.
+
+Run by src/CMakeLists.txt on every build where sounds/embedded/ changed.
+Every ``<id>_<name>.wav`` in the input directory (PCM, normally the 8-bit
+22050 Hz mono files written by tools/embed_sounds.sh) becomes one entry:
+
+- ``embedded_sounds.bin``: the PCM data of all sounds back to back (WAV
+  headers stripped, each blob 4-byte aligned), linked into flash with
+  ``target_add_binary_data`` and read in place through the flash cache
+- ``embedded_sound_table.c``: entries sorted by ID with the pre-parsed
+  format (``wav_info_t``, offsets relative to the blob) and a perfect hash
+  from sound ID to entry, so ``embedded_sounds_find()`` is one multiply,
+  one shift and one compare
+
+Adding a sound is dropping a file into sounds/embedded/ and rebuilding.
+
+Examples:
+
+  python3 tools/gen_embedded_sounds.py sounds/embedded build/gen
+  python3 tools/gen_embedded_sounds.py --list sounds/embedded
+"""
+
+from __future__ import annotations
+
+import argparse
+import os
+import re
+import struct
+import sys
+from typing import Any
+
+SOUND_NAME = re.compile(r"^(\d+)_([A-Za-z0-9_]+)\.wav$", re.IGNORECASE)
+BLOB_ALIGN = 4
+MAX_SLOT_BITS = 12
+
+
+def parse_wav(path: str) -> dict[str, Any]:
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < 12 or data[0:4] != b"RIFF" or data[8:12] != b"WAVE":
+        raise ValueError("not a RIFF/WAVE file")
+    fmt = pcm = None
+    pos = 12
+    while pos + 8 <= len(data):
+        chunk_id = data[pos:pos + 4]
+        size = struct.unpack_from("<I", data, pos + 4)[0]
+        if chunk_id == b"fmt ":
+            fmt = struct.unpack_from("<HHIIHH", data, pos + 8)
+        elif chunk_id == b"data":
+            pcm = data[pos + 8:pos + 8 + size]
+        pos += 8 + size + (size & 1)
+    if fmt is None or pcm is None:
+        raise ValueError("missing fmt or data chunk")
+    audio_format, channels, rate, _, _, bits = fmt
+    if audio_format != 1 or bits not in (8, 16) or channels not in (1, 2):
+        raise ValueError(f"unsupported format {audio_format} {bits}-bit {channels}ch")
+    return {"rate": rate, "channels": channels, "bits": bits, "pcm": pcm}
+
+
+def collect(src_dir: str) -> list[dict[str, Any]]:
+    sounds: dict[int, dict[str, Any]] = {}
+    for fname in sorted(os.listdir(src_dir)):
+        m = SOUND_NAME.match(fname)
+        if not m:
+            continue
+        sound_id = int(m.group(1))
+        if sound_id > 0xFFFF:
+            raise ValueError(f"{fname}: ID out of range")
+        if sound_id in sounds:
+            raise ValueError(f"{fname}: duplicate ID {sound_id} ({sounds[sound_id]['file']})")
+        try:
+            wav = parse_wav(os.path.join(src_dir, fname))
+        except (OSError, ValueError, struct.error) as e:
+            raise ValueError(f"{fname}: {e}") from e
+        wav.update(id=sound_id, name=m.group(2), file=fname)
+        sounds[sound_id] = wav
+    return [sounds[k] for k in sorted(sounds)]
+
+
+def perfect_hash(ids: list[int]) -> tuple[int, int]:
+    """Find (multiplier, bits) so ((id * mul) mod 2^32) >> (32 - bits) is collision-free."""
+    bits = max(1, (2 * max(len(ids), 1) - 1).bit_length())
+    while bits <= MAX_SLOT_BITS:
+        mul = 0x9E3779B1  # Golden ratio; deterministic search from there
+        for _ in range(200000):
+            slots = {((i * mul) & 0xFFFFFFFF) >> (32 - bits) for i in ids}
+            if len(slots) == len(ids):
+                return mul, bits
+            mul = (mul + 0x3C6EF372) & 0xFFFFFFFF | 1
+        bits += 1
+    raise ValueError("no perfect hash found")
+
+
+def slot_of(sound_id: int, mul: int, bits: int) -> int:
+    return ((sound_id * mul) & 0xFFFFFFFF) >> (32 - bits)
+
+
+def generate(sounds: list[dict[str, Any]], out_dir: str) -> None:
+    blob = bytearray()
+    for s in sounds:
+        s["offset"] = len(blob)
+        blob += s["pcm"]
+        blob += bytes((-len(blob)) % BLOB_ALIGN)
+
+    mul, bits = perfect_hash([s["id"] for s in sounds])
+    slots = [0] * (1 << bits)
+    for index, s in enumerate(sounds):
+        slots[slot_of(s["id"], mul, bits)] = index + 1
+
+    lines = [
+        "/**",
+        " * @file embedded_sound_table.c",
+        " * @brief Embedded sound index (GENERATED by tools/gen_embedded_sounds.py, do not edit)",
+        " */",
+        "",
+        '#include "embedded_sounds.h"',
+        "",
+        f"const size_t g_embedded_sound_count = {len(sounds)};",
+        f"const size_t g_embedded_sound_blob_size = {len(blob)};",
+        f"const uint32_t g_embedded_sound_hash_mul = 0x{mul:08X}u;",
+        f"const uint8_t g_embedded_sound_hash_bits = {bits};",
+        "",
+        "const embedded_sound_t g_embedded_sounds[] = {",
+    ]
+    for s in sounds:
+        lines.append(
+            f'    {{ {s["id"]:5d}, "{s["name"]}", {{ {s["rate"]}, {s["channels"]}, {s["bits"]}, '
+            f'{s["offset"]}, {len(s["pcm"])} }} }},'
+        )
+    lines += [
+        "};",
+        "",
+        "// Entry index + 1 per hash slot (0 = empty)",
+        f"const uint16_t g_embedded_sound_slots[{len(slots)}] = {{",
+    ]
+    for i in range(0, len(slots), 16):
+        lines.append("    " + ", ".join(str(v) for v in slots[i:i + 16]) + ",")
+    lines += ["};", ""]
+
+    os.makedirs(out_dir, exist_ok=True)
+    _write_if_changed(os.path.join(out_dir, "embedded_sounds.bin"), bytes(blob))
+    _write_if_changed(os.path.join(out_dir, "embedded_sound_table.c"), "\n".join(lines).encode())
+
+
+def _write_if_changed(path: str, data: bytes) -> None:
+    # Keep timestamps stable so unchanged sounds do not relink the firmware
+    try:
+        with open(path, "rb") as f:
+            if f.read() == data:
+                return
+    except OSError:
+        pass
+    with open(path, "wb") as f:
+        f.write(data)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Generate the embedded sound blob and table")
+    ap.add_argument("source", help="Directory of <id>_<name>.wav files")
+    ap.add_argument("out_dir", nargs="?", help="Output directory for embedded_sounds.bin and embedded_sound_table.c")
+    ap.add_argument("--list", action="store_true", help="Only list the sounds that would be embedded")
+    args = ap.parse_args()
+
+    try:
+        sounds = collect(args.source)
+    except (OSError, ValueError) as e:
+        print(f"ERROR: {e}", file=sys.stderr)
+        return 1
+
+    if args.list or not args.out_dir:
+        total = 0
+        for s in sounds:
+            total += len(s["pcm"])
+            print(f"  ID {s['id']:5d}: {s['name']:<20} {s['rate']:5d}Hz {s['channels']}ch "
+                  f"{s['bits']:2d}bit {len(s['pcm']):7d} bytes")
+        print(f"{len(sounds)} sound(s), {total} PCM bytes")
+        return 0
+
+    try:
+        generate(sounds, args.out_dir)
+    except ValueError as e:
+        print(f"ERROR: {e}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""Host check of the master bus limiter (src/audio_dsp.c).
+
+Compiles src/audio_dsp.c with a small C harness and feeds it signals that
+must come out at or under AUDIO_LIMITER_THRESHOLD with no clamped samples:
+
+- single: one peak in silence
+- overlap: a second, higher peak while the attack for the first is still
+  under way (the second one must not slow the ramp for the first)
+- staircase: a rising peak every 8 samples, each before the last is reached
+- burst: loud pseudo-random noise (fixed seed) at 4x full scale
+
+Each signal runs once as a single block and once split into odd-sized
+blocks (state carried across calls). Exits non-zero if any output sample
+exceeds the threshold.
+
+With --bench it times the stages instead, in MIXER_BLOCK_FRAMES blocks
+(built with -O2 on the host):
+
+- limiter: loud noise at 4x full scale, master volume below unity
+- limiter-worst: a steadily rising level, so every sample is a new peak
+  and costs a divide (the time includes writing that input)
+- duck: duck bus ramp and add, switching ducking on and off every block
+  so the gain is always ramping
+
+and reports ns per sample and per block against the real-time budget of
+one block at --rate. Host numbers are an indication only; `dsp bench` on
+the console times the same code on the device.
+
+Examples:
+
+  python3 tools/limiter_check.py
+
+  python3 tools/limiter_check.py --json
+
+  python3 tools/limiter_check.py --bench --blocks 20000
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from typing import Any
+
+FW_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+MIXER_BLOCK_FRAMES = 512  # src/audio_mixer.h
+
+HARNESS = r"""
+#define _POSIX_C_SOURCE 199309L  /* clock_gettime under -std=c11 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "audio_dsp.h"
+
+#define N 4096
+
+static uint32_t rng = 12345;
+static int32_t noise(int32_t amp) {
+    rng = rng * 1103515245u + 12345u;
+    return (int32_t)((rng >> 8) % (uint32_t)(2 * amp + 1)) - amp;
+}
+
+static void make(const char *name, int32_t *in) {
+    memset(in, 0, N * sizeof(*in));
+    if (strcmp(name, "single") == 0) {
+        in[10] = 60000;
+    } else if (strcmp(name, "overlap") == 0) {
+        in[10] = 60000;
+        in[60] = 61000;
+    } else if (strcmp(name, "staircase") == 0) {
+        for (int i = 0; i < 16; i++) {
+            in[10 + i * 8] = (i & 1 ? -1 : 1) * (32000 + i * 4000);
+        }
+    } else if (strcmp(name, "burst") == 0) {
+        for (int i = 100; i < 1100; i++) {
+            in[i] = noise(4 * 32768);
+        }
+    }
+}
+
+static void run(const char *name, int split) {
+    static int32_t in[N];
+    static int16_t out[N];
+    static audio_limiter_t lim;
+    make(name, in);
+    audio_limiter_init(&lim);
+
+    size_t done = 0, block = split ? 37 : N;
+    while (done < N) {
+        size_t n = (N - done < block) ? N - done : block;
+        audio_limiter_process(&lim, in + done, out + done, n, AUDIO_DSP_UNITY);
+        done += n;
+        if (split) block = (block == 37) ? 101 : 37;
+    }
+
+    int max = 0, max_at = -1, over = 0;
+    for (int i = 0; i < N; i++) {
+        int a = out[i] < 0 ? -out[i] : out[i];
+        if (a > max) { max = a; max_at = i; }
+        if (a > AUDIO_LIMITER_THRESHOLD) over++;
+    }
+    printf("%s %d %d %d %d %u %ld\n", name, split, max, max_at, over,
+           (unsigned)lim.clipped_samples, (long)lim.min_gain);
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* Prints "<stage> <ns per block>"; sink keeps the output live */
+static void bench(const char *stage, int frames, long blocks) {
+    static int32_t in[N], bus[N];
+    static int16_t out[N];
+    static audio_limiter_t lim;
+    static audio_duck_t duck;
+    volatile int32_t sink = 0;
+    int32_t level = AUDIO_LIMITER_THRESHOLD;
+
+    audio_limiter_init(&lim);
+    audio_duck_init(&duck, AUDIO_DUCK_DEFAULT_PERCENT);
+    for (int i = 0; i < frames; i++) {
+        in[i] = noise(4 * 32768);
+    }
+
+    double start = now_ns();
+    for (long b = 0; b < blocks; b++) {
+        if (strcmp(stage, "limiter") == 0) {
+            audio_limiter_process(&lim, in, out, (size_t)frames, AUDIO_DSP_UNITY * 3 / 4);
+        } else if (strcmp(stage, "limiter-worst") == 0) {
+            for (int i = 0; i < frames; i++) {
+                in[i] = (i & 1) ? -++level : ++level;
+            }
+            audio_limiter_process(&lim, in, out, (size_t)frames, AUDIO_DSP_UNITY);
+            if (level > (1 << 30)) level = AUDIO_LIMITER_THRESHOLD;
+        } else {
+            memset(bus, 0, (size_t)frames * sizeof(*bus));
+            audio_duck_process(&duck, in, bus, (size_t)frames, (b & 1) != 0);
+            sink += bus[b % frames];
+        }
+        sink += out[b % frames];
+    }
+    double elapsed = now_ns() - start;
+    printf("%s %.1f\n", stage, elapsed / (double)blocks);
+}
+
+int main(int argc, char **argv) {
+    if (argc == 4 && strcmp(argv[1], "bench") == 0) {
+        const int frames = atoi(argv[2]);
+        const long blocks = atol(argv[3]);
+        if (frames <= 0 || frames > N || blocks <= 0) return 2;
+        bench("limiter", frames, blocks);
+        bench("limiter-worst", frames, blocks);
+        bench("duck", frames, blocks);
+        return 0;
+    }
+
+    const char *names[] = { "single", "overlap", "staircase", "burst" };
+    printf("threshold %d %d\n", AUDIO_LIMITER_THRESHOLD, AUDIO_LIMITER_LOOKAHEAD);
+    for (int i = 0; i < 4; i++) {
+        run(names[i], 0);
+        run(names[i], 1);
+    }
+    return 0;
+}
+"""
+
+
+def build(workdir: str, cc: str) -> str:
+    src = os.path.join(workdir, "harness.c")
+    exe = os.path.join(workdir, "harness")
+    with open(src, "w") as f:
+        f.write(HARNESS)
+    subprocess.run([
+        cc, "-O2", "-std=c11", "-Wall", "-I", os.path.join(FW_ROOT, "src"),
+        src, os.path.join(FW_ROOT, "src", "audio_dsp.c"), "-o", exe,
+    ], check=True)
+    return exe
+
+
+def run_bench(exe: str, args: argparse.Namespace) -> int:
+    out = subprocess.run([exe, "bench", str(args.frames), str(args.blocks)], check=True,
+                         capture_output=True, text=True).stdout
+    budget_ns = args.frames * 1e9 / args.rate
+    results: list[dict[str, Any]] = []
+    for line in out.splitlines():
+        stage, ns_block = line.split()
+        ns_block_f = float(ns_block)
+        results.append({
+            "stage": stage,
+            "nsPerBlock": round(ns_block_f, 1),
+            "nsPerSample": round(ns_block_f / args.frames, 2),
+            "budgetPercent": round(100.0 * ns_block_f / budget_ns, 4),
+        })
+
+    if args.json:
+        print(json.dumps({"frames": args.frames, "blocks": args.blocks, "rate": args.rate,
+                          "budgetNs": round(budget_ns), "results": results}, indent=2))
+        return 0
+
+    print(f"DSP stages (host, -O2): {args.frames}-frame blocks x {args.blocks}, "
+          f"budget {budget_ns / 1e6:.2f} ms per block at {args.rate} Hz")
+    print(f"  {'stage':<14} {'ns/sample':>10} {'us/block':>9} {'budget':>8}")
+    for r in results:
+        print(f"  {r['stage']:<14} {r['nsPerSample']:>10} {r['nsPerBlock'] / 1000:>9.2f} "
+              f"{r['budgetPercent']:>7.3f}%")
+    return 0
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Host check of the master bus limiter")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="Host C compiler (default: $CC or cc)")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    ap.add_argument("--bench", action="store_true", help="Time the limiter and ducking instead of checking them")
+    ap.add_argument("--frames", type=int, default=MIXER_BLOCK_FRAMES,
+                    help=f"Frames per block for --bench (default: {MIXER_BLOCK_FRAMES})")
+    ap.add_argument("--blocks", type=int, default=5000, help="Blocks timed per stage for --bench (default: 5000)")
+    ap.add_argument("--rate", type=int, default=22050, help="Output rate for the --bench budget (default: 22050)")
+    args = ap.parse_args()
+
+    if not shutil.which(args.cc):
+        print(f"ERROR: C compiler '{args.cc}' not found", file=sys.stderr)
+        return 1
+    if args.bench and not (0 < args.frames <= 4096 and args.blocks > 0 and args.rate > 0):
+        print("ERROR: --frames must be 1-4096, --blocks and --rate positive", file=sys.stderr)
+        return 1
+
+    with tempfile.TemporaryDirectory() as workdir:
+        exe = build(workdir, args.cc)
+        if args.bench:
+            return run_bench(exe, args)
+        out = subprocess.run([exe], check=True, capture_output=True, text=True).stdout
+
+    lines = out.split("\n")
+    _, threshold, lookahead = lines[0].split()
+    results: list[dict[str, Any]] = []
+    for line in lines[1:]:
+        if not line:
+            continue
+        name, split, peak, at, over, clipped, min_gain = line.split()
+        results.append({
+            "signal": name,
+            "blocks": "split" if int(split) else "single",
+            "peak": int(peak),
+            "peakAt": int(at),
+            "overThreshold": int(over),
+            "clipped": int(clipped),
+            "minGain": round(int(min_gain) / 65536, 4),
+        })
+    failed = [r for r in results if r["overThreshold"] or r["clipped"]]
+
+    if args.json:
+        print(json.dumps({"threshold": int(threshold), "lookahead": int(lookahead),
+                          "results": results, "ok": not failed}, indent=2))
+        return 1 if failed else 0
+
+    print(f"Limiter: threshold {threshold}, look-ahead {lookahead} samples")
+    print(f"  {'signal':<10} {'blocks':<7} {'peak':>6} {'at':>5} {'over':>5} {'clip':>5} {'min gain':>9}")
+    for r in results:
+        print(f"  {r['signal']:<10} {r['blocks']:<7} {r['peak']:>6} {r['peakAt']:>5} "
+              f"{r['overThreshold']:>5} {r['clipped']:>5} {r['minGain']:>9}")
+    print("FAIL" if failed else "OK")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
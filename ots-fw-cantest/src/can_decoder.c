@@ -17,6 +17,7 @@
 #define CAN_ID_STOP_ACK        0x424
 #define CAN_ID_SOUND_FINISHED  0x425
 #define CAN_ID_SOUND_STATUS    0x426
+#define CAN_ID_SOUND_PERF      0x427
 
 void can_decoder_init(void) {
     // Nothing to initialize yet
@@ -33,6 +34,7 @@ const char* can_decoder_get_message_name(uint16_t can_id) {
         case CAN_ID_STOP_ACK:        return "STOP_ACK";
         case CAN_ID_SOUND_FINISHED:  return "SOUND_FINISHED";
         case CAN_ID_SOUND_STATUS:    return "SOUND_STATUS";
+        case CAN_ID_SOUND_PERF:      return "SOUND_PERF";
         default:                     return "UNKNOWN";
     }
 }
@@ -129,6 +131,31 @@ static void decode_sound_status(const can_frame_t *frame) {
     if (error_code != 0) {
         printf(", Error: 0x%02X", error_code);
     }
+    if (frame->dlc >= 8) {
+        printf(", Active: %u", frame->data[7]);
+    }
+}
+
+static void decode_sound_perf(const can_frame_t *frame) {
+    if (frame->dlc < 8) return;
+    
+    // 0xFF = not available
+    if (frame->data[0] == 0xFF) {
+        printf("      Min fill: -");
+    } else {
+        printf("      Min fill: %u%%", frame->data[0]);
+    }
+    printf(", Mixer p99: %u%% of budget", frame->data[1]);
+    printf("\n      Underruns: %u, Starved: %u, Decoder CPU: %u%%",
+           frame->data[2], frame->data[3], frame->data[4]);
+    // Heap in 4 KiB units, saturating at 254
+    printf("\n      Heap: %s%u KiB", (frame->data[5] >= 254) ? ">= " : "", frame->data[5] * 4u);
+    if (frame->data[6] != 0xFF) {
+        printf(", PSRAM free: %u%%", frame->data[6]);
+    }
+    if (frame->data[7] != 0xFF) {
+        printf(", Last TTFS: %u ms", frame->data[7]);
+    }
 }
 
 void can_decoder_print_frame(const can_frame_t *frame, bool show_raw, bool show_parsed) {
@@ -170,6 +197,9 @@ void can_decoder_print_frame(const can_frame_t *frame, bool show_raw, bool show_
             case CAN_ID_SOUND_STATUS:
                 decode_sound_status(frame);
                 break;
+            case CAN_ID_SOUND_PERF:
+                decode_sound_perf(frame);
+                break;
             case CAN_ID_MODULE_QUERY:
                 printf("      (Broadcast discovery query)");
                 break;
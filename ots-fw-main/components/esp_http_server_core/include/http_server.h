@@ -37,8 +37,20 @@ typedef struct {
     uint8_t max_open_sockets;       // Maximum concurrent connections
     uint16_t max_uri_handlers;      // Maximum number of URI handlers
     httpd_close_func_t close_fn;    // Optional session close callback (for WebSocket cleanup)
+    bool session_tickets;           // Issue TLS session tickets so clients can resume without a full handshake
+    const int *ciphersuites;        // Zero-terminated mbedTLS ciphersuite preference list (NULL = hardware-friendly default)
+    uint16_t keep_alive_idle_s;     // TCP keep-alive idle time in seconds (0 = keep-alive disabled)
 } http_server_config_t;
 
+/**
+ * TLS session counters (HTTPS mode only)
+ */
+typedef struct {
+    uint32_t handshakes;            // Completed TLS handshakes (full or resumed)
+    uint32_t sessions_closed;       // TLS sessions torn down
+    uint32_t active_sessions;       // Currently open TLS sessions
+} http_server_tls_stats_t;
+
 /**
  * Initialize HTTP server with configuration
  * 
@@ -116,6 +128,16 @@ uint16_t http_server_get_port(void);
  */
 bool http_server_is_secure(void);
 
+/**
+ * Get TLS session counters
+ * Each reconnect costs one handshake; compare against client-side resume
+ * counts (tools/tests/tls_handshake_bench.py) to see how many were resumed.
+ * 
+ * @param out_stats Receives a copy of the counters
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if out_stats is NULL
+ */
+esp_err_t http_server_get_tls_stats(http_server_tls_stats_t *out_stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,14 +9,64 @@
 #include "http_server.h"
 #include "esp_https_server.h"
 #include "esp_log.h"
+#include "mbedtls/ssl_ciphersuites.h"
+#include "sdkconfig.h"
 #include <string.h>
 
 static const char *TAG = "HTTP_SERVER";
 
+// TCP keep-alive probing once the idle time has elapsed
+#define KEEP_ALIVE_INTERVAL_S   5
+#define KEEP_ALIVE_COUNT        3
+
 // Server state
 static httpd_handle_t s_server = NULL;
 static http_server_config_t s_config = {0};
 static bool s_initialized = false;
+static http_server_tls_stats_t s_tls_stats = {0};
+
+// Default ciphersuite preference for the RSA server certificate.
+// AES-GCM and SHA-256 run on the ESP32-S3 crypto peripherals and the RSA
+// signature uses the hardware MPI, so these are the cheapest suites to
+// negotiate. Without an explicit list mbedTLS may pick AES-256/SHA-384,
+// which falls back to software SHA-512. ECDHE only: static-RSA key
+// exchange has no forward secrecy.
+static const int s_default_ciphersuites[] = {
+    MBEDTLS_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+    MBEDTLS_TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA256,
+    MBEDTLS_TLS_ECDHE_RSA_WITH_AES_256_GCM_SHA384,
+    0
+};
+
+static void tls_session_cb(esp_https_server_user_cb_arg_t *arg) {
+    switch (arg->user_cb_state) {
+        case HTTPD_SSL_USER_CB_SESS_CREATE:
+            s_tls_stats.handshakes++;
+            s_tls_stats.active_sessions++;
+            ESP_LOGD(TAG, "TLS session opened (fd=%d, handshakes=%lu, active=%lu)",
+                     arg->sockfd, (unsigned long)s_tls_stats.handshakes,
+                     (unsigned long)s_tls_stats.active_sessions);
+            break;
+        case HTTPD_SSL_USER_CB_SESS_CLOSE:
+            s_tls_stats.sessions_closed++;
+            if (s_tls_stats.active_sessions > 0) {
+                s_tls_stats.active_sessions--;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void apply_keep_alive(httpd_config_t *cfg) {
+    if (s_config.keep_alive_idle_s == 0) {
+        return;
+    }
+    cfg->keep_alive_enable = true;
+    cfg->keep_alive_idle = s_config.keep_alive_idle_s;
+    cfg->keep_alive_interval = KEEP_ALIVE_INTERVAL_S;
+    cfg->keep_alive_count = KEEP_ALIVE_COUNT;
+}
 
 esp_err_t http_server_init(const http_server_config_t *config) {
     if (!config) {
@@ -45,8 +95,16 @@ esp_err_t http_server_init(const http_server_config_t *config) {
     memcpy(&s_config, config, sizeof(http_server_config_t));
     s_initialized = true;
 
-    ESP_LOGI(TAG, "HTTP server initialized (port=%u, tls=%s)", 
-             s_config.port, s_config.use_tls ? "yes" : "no");
+#ifndef CONFIG_ESP_TLS_SERVER_SESSION_TICKETS
+    if (s_config.use_tls && s_config.session_tickets) {
+        ESP_LOGW(TAG, "Session tickets requested but CONFIG_ESP_TLS_SERVER_SESSION_TICKETS is off");
+        s_config.session_tickets = false;
+    }
+#endif
+
+    ESP_LOGI(TAG, "HTTP server initialized (port=%u, tls=%s, tickets=%s, keep-alive=%us)", 
+             s_config.port, s_config.use_tls ? "yes" : "no",
+             s_config.session_tickets ? "yes" : "no", s_config.keep_alive_idle_s);
     return ESP_OK;
 }
 
@@ -77,12 +135,20 @@ esp_err_t http_server_start(void) {
         ssl_config.httpd.max_uri_handlers = s_config.max_uri_handlers > 0 ? s_config.max_uri_handlers : 32;
         ssl_config.httpd.lru_purge_enable = true;
         ssl_config.httpd.close_fn = close_fn;
+        apply_keep_alive(&ssl_config.httpd);
         
         // Set TLS credentials
         ssl_config.servercert = s_config.cert_pem;
         ssl_config.servercert_len = s_config.cert_len;
         ssl_config.prvtkey_pem = s_config.key_pem;
         ssl_config.prvtkey_len = s_config.key_len;
+
+        // Reconnects (page reloads, WSS retries) resume via ticket instead of
+        // paying for another RSA handshake
+        ssl_config.session_tickets = s_config.session_tickets;
+        ssl_config.ciphersuites_list = s_config.ciphersuites ? s_config.ciphersuites : s_default_ciphersuites;
+        ssl_config.user_cb = tls_session_cb;
+        memset(&s_tls_stats, 0, sizeof(s_tls_stats));
         
         ret = httpd_ssl_start(&s_server, &ssl_config);
         if (ret != ESP_OK) {
@@ -104,6 +170,7 @@ esp_err_t http_server_start(void) {
         http_config.max_uri_handlers = s_config.max_uri_handlers > 0 ? s_config.max_uri_handlers : 32;
         http_config.lru_purge_enable = true;
         http_config.close_fn = close_fn;
+        apply_keep_alive(&http_config);
         
         ret = httpd_start(&s_server, &http_config);
         if (ret != ESP_OK) {
@@ -203,3 +270,11 @@ uint16_t http_server_get_port(void) {
 bool http_server_is_secure(void) {
     return s_config.use_tls;
 }
+
+esp_err_t http_server_get_tls_stats(http_server_tls_stats_t *out_stats) {
+    if (!out_stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(out_stats, &s_tls_stats, sizeof(*out_stats));
+    return ESP_OK;
+}
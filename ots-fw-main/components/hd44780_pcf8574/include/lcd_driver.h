@@ -10,6 +10,9 @@
 #define LCD_COLS 16
 #define LCD_ROWS 2
 
+// Custom characters (CGRAM), written as character codes 0..7
+#define LCD_CGRAM_SLOTS 8
+
 // Default I2C address for LCD (PCF8574 backpack)
 #define LCD_I2C_ADDR 0x27
 
@@ -88,4 +91,26 @@ esp_err_t lcd_write_char(char c);
  */
 esp_err_t lcd_command(uint8_t cmd);
 
+/**
+ * @brief Define a custom character in CGRAM
+ * 
+ * The glyph is shown by writing character code @p slot. Leaves the cursor
+ * at the top-left cell; set it again before writing text.
+ * 
+ * @param slot CGRAM slot (0-7)
+ * @param pattern 8 rows of 5 pixels (bit 4 = leftmost column)
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t lcd_define_char(uint8_t slot, const uint8_t pattern[8]);
+
+/**
+ * @brief Total I2C bytes sent to the LCD since boot
+ * 
+ * Counts address and data bytes of every expander write. Each character or
+ * command costs 16 bytes (two nibbles, four writes each).
+ * 
+ * @return Cumulative byte count (wraps at 2^32)
+ */
+uint32_t lcd_get_i2c_bytes(void);
+
 #endif // LCD_DRIVER_H
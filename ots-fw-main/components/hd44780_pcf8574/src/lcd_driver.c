@@ -41,6 +41,7 @@ static const char *TAG = "OTS_LCD";
 #define LCD_CMD_ENTRY_MODE_SET 0x04
 #define LCD_CMD_DISPLAY_CONTROL 0x08
 #define LCD_CMD_FUNCTION_SET 0x20
+#define LCD_CMD_SET_CGRAM_ADDR 0x40
 #define LCD_CMD_SET_DDRAM_ADDR 0x80
 
 // ---- HD44780 flags
@@ -72,6 +73,9 @@ static bool s_initialized = false;
 static uint8_t s_addr = LCD_I2C_ADDR;
 static bool s_backlight_on = true;
 
+// Bytes on the wire: every expander write is one transaction (address + data)
+static uint32_t s_i2c_bytes = 0;
+
 static inline uint8_t backlight_bits(void) {
     if (s_backlight_on) {
         return LCD_BACKLIGHT_ACTIVE_LOW ? 0x00 : LCD_BACKLIGHT_MASK;
@@ -83,6 +87,7 @@ static inline esp_err_t pcf_write(uint8_t byte) {
     if (!s_dev) {
         return ESP_ERR_INVALID_STATE;
     }
+    s_i2c_bytes += 2;
     return i2c_master_transmit(s_dev, &byte, 1, 1000 / portTICK_PERIOD_MS);
 }
 
@@ -205,6 +210,24 @@ esp_err_t lcd_write_line(uint8_t row, const char *str) {
     return lcd_write_string(str);
 }
 
+esp_err_t lcd_define_char(uint8_t slot, const uint8_t pattern[8]) {
+    if (!s_initialized) return ESP_ERR_INVALID_STATE;
+    if (slot >= LCD_CGRAM_SLOTS || !pattern) return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret = cmd((uint8_t)(LCD_CMD_SET_CGRAM_ADDR | (slot << 3)));
+    if (ret != ESP_OK) return ret;
+    for (int row = 0; row < 8; row++) {
+        ret = data((uint8_t)(pattern[row] & 0x1F));
+        if (ret != ESP_OK) return ret;
+    }
+    // Writes go to CGRAM until the next DDRAM address is set
+    return cmd(LCD_CMD_SET_DDRAM_ADDR);
+}
+
+uint32_t lcd_get_i2c_bytes(void) {
+    return s_i2c_bytes;
+}
+
 esp_err_t lcd_init(i2c_master_bus_handle_t bus, uint8_t i2c_addr) {
     s_initialized = false;
     s_addr = i2c_addr;
@@ -20,9 +20,22 @@ typedef struct {
     adc_channel_id_t channel;   // Which ADC channel changed
     uint16_t raw_value;         // Raw ADC value (0-4095 for 12-bit)
     uint8_t percent;            // Converted percentage (0-100)
-    uint32_t timestamp_ms;      // Timestamp of the event
+    uint32_t timestamp_ms;      // Time the current value was first read (ms since boot)
 } adc_event_t;
 
+/**
+ * @brief Called from the I/O task when a channel's percent value changes
+ *
+ * Keep it short (e.g. module_manager_notify()): it runs between scans.
+ *
+ * @param event New value of the channel
+ */
+typedef void (*adc_change_callback_t)(const adc_event_t *event);
+
+// Raw counts a reading must move before it is treated as a change; keeps
+// ADC noise at a percent boundary from looking like slider motion
+#define ADC_CHANGE_DEADBAND_RAW 8
+
 /**
  * @brief Initialize ADC handler
  * 
@@ -42,8 +55,9 @@ bool adc_handler_is_initialized(void);
 /**
  * @brief Scan all ADC channels and update state
  * 
- * Should be called periodically (e.g., every 100ms) from I/O task
- * Updates internal state that modules can query via adc_handler_get_value()
+ * Called every I/O task loop (50ms). Updates internal state that modules
+ * can query via adc_handler_get_value() and calls the change callback for
+ * every channel whose percent value changed.
  * 
  * @return ESP_OK on success
  */
@@ -60,6 +74,13 @@ esp_err_t adc_handler_scan(void);
  */
 esp_err_t adc_handler_get_value(adc_channel_id_t channel, adc_event_t *value);
 
+/**
+ * @brief Register the change callback (one for all channels, NULL to clear)
+ * 
+ * @param callback Function called on every percent change
+ */
+void adc_handler_set_change_callback(adc_change_callback_t callback);
+
 /**
  * @brief Shutdown ADC handler
  * 
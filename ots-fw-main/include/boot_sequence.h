@@ -0,0 +1,72 @@
+#ifndef BOOT_SEQUENCE_H
+#define BOOT_SEQUENCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/**
+ * @file boot_sequence.h
+ * @brief Dependency-ordered boot steps with a per-step timeline
+ *
+ * app_main() describes its subsystems as a table of steps. A step starts as
+ * soon as every step it depends on has finished: foreground steps run in the
+ * calling task (in table order among the ready ones), background steps each
+ * get a task of their own, so slow bring-up (I/O expander retries, Wi-Fi and
+ * TLS) overlaps with the rest. Start/end times are kept for the `boot`
+ * serial command.
+ */
+
+#define BOOT_MAX_STEPS 16
+
+/** Dependency mask bit for the step at index i of the table */
+#define BOOT_DEP(i) (1u << (i))
+
+typedef struct {
+    const char *name;
+    esp_err_t (*run)(void);
+    uint32_t depends_on;    // BOOT_DEP() mask of steps that must finish first
+    bool background;        // Run in a task of its own
+    bool required;          // On failure, steps depending on it are skipped
+} boot_step_t;
+
+typedef enum {
+    BOOT_STEP_PENDING = 0,
+    BOOT_STEP_RUNNING,
+    BOOT_STEP_DONE,
+    BOOT_STEP_FAILED,
+    BOOT_STEP_SKIPPED,
+} boot_step_state_t;
+
+/**
+ * @brief Run a step table
+ *
+ * Returns once every foreground step has finished; background steps keep
+ * running and log the full timeline when the last one ends. The table must
+ * stay valid (static) until then.
+ *
+ * @param steps Step table (dependencies must point to earlier or later
+ *              entries of the same table, no cycles)
+ * @param count Number of steps (<= BOOT_MAX_STEPS)
+ * @return ESP_OK, or the error of the first required step that failed
+ */
+esp_err_t boot_sequence_run(const boot_step_t *steps, uint8_t count);
+
+/**
+ * @brief Step state and times
+ *
+ * @param index Step index
+ * @param state Output state (may be NULL)
+ * @param start_us Output start time since boot, 0 if not started (may be NULL)
+ * @param end_us Output end time since boot, 0 if not finished (may be NULL)
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for a bad index
+ */
+esp_err_t boot_sequence_get_step(uint8_t index, boot_step_state_t *state,
+                                 int64_t *start_us, int64_t *end_us);
+
+/**
+ * @brief Log the boot timeline (one line per step)
+ */
+void boot_sequence_log_timeline(void);
+
+#endif // BOOT_SEQUENCE_H
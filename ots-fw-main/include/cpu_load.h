@@ -0,0 +1,36 @@
+#ifndef CPU_LOAD_H
+#define CPU_LOAD_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * @file cpu_load.h
+ * @brief Cumulative per-core CPU usage from the FreeRTOS idle tasks
+ *
+ * Reads the run-time counters of the idle tasks (needs
+ * CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, clocked by esp_timer). Counters
+ * are cumulative so any number of readers can compute the load of their
+ * own window: busy% = 100 - 100 * d(idle_us) / d(uptime_us).
+ *
+ * idle_us is 32-bit and wraps about every 71 minutes; take differences
+ * modulo 2^32.
+ */
+
+#define CPU_LOAD_MAX_CORES 2
+
+typedef struct {
+    int64_t uptime_us;
+    uint32_t idle_us[CPU_LOAD_MAX_CORES];
+    uint8_t cores;
+} cpu_load_counters_t;
+
+/**
+ * @brief Read the idle counters of all cores
+ *
+ * @param out Filled with the current counters
+ * @return ESP_OK, or ESP_ERR_NOT_SUPPORTED if run-time stats are disabled
+ */
+esp_err_t cpu_load_get_counters(cpu_load_counters_t *out);
+
+#endif // CPU_LOAD_H
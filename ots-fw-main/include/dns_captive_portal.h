@@ -27,7 +27,9 @@ esp_err_t dns_captive_portal_start(void);
 /**
  * @brief Stop the captive portal DNS server
  * 
- * Shuts down the DNS server task and closes the UDP socket.
+ * Signals the DNS server task, which closes its UDP socket and exits, and
+ * waits (up to about one select() timeout) for it to finish so a following
+ * start can bind port 53 again.
  */
 void dns_captive_portal_stop(void);
 
@@ -0,0 +1,97 @@
+#ifndef DNS_RESPONDER_H
+#define DNS_RESPONDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file dns_responder.h
+ * @brief Captive portal DNS answers and per-client rate limiting
+ *
+ * Replies are built from templates prepared once at start: the query's
+ * header and question are copied, the flags/counts overwritten from a
+ * fixed header and, for A (and ANY) queries, a fixed A record pointing at
+ * the AP address is appended. Other query types (AAAA, HTTPS, ...) get an
+ * empty NOERROR reply, so clients fall back to IPv4 at once.
+ *
+ * Pure logic with caller-supplied times: no FreeRTOS, lwIP or ESP-IDF
+ * calls, so tools/tests/dns_captive_bench.py can run it on the host.
+ */
+
+#define DNS_RESPONDER_MAX_PACKET 512    // Classic UDP DNS limit
+#define DNS_RESPONDER_ANSWER_LEN 16     // Compressed name + A record
+#define DNS_RATE_LIMIT_CLIENTS 8        // AP allows 4 stations; spare slots for churn
+
+typedef struct {
+    uint8_t header[10];                         // Flags + counts (after the ID), with answer
+    uint8_t header_empty[10];                   // Same, no answer
+    uint8_t answer[DNS_RESPONDER_ANSWER_LEN];   // Name pointer, A/IN, TTL, AP address
+} dns_responder_t;
+
+typedef enum {
+    DNS_REPLY_NONE = 0,     // Not a query we answer (malformed, response, other opcode)
+    DNS_REPLY_ADDRESS,      // A record appended
+    DNS_REPLY_EMPTY,        // No answer for this query type
+} dns_reply_t;
+
+typedef struct {
+    uint32_t addr;          // Client IPv4 address (network order), 0 = free slot
+    uint32_t tokens_milli;  // Token bucket, in thousandths of a query
+    uint32_t last_ms;
+} dns_rate_client_t;
+
+typedef struct {
+    dns_rate_client_t clients[DNS_RATE_LIMIT_CLIENTS];
+    uint32_t burst;         // Queries a client may send back to back
+    uint32_t per_sec;       // Sustained queries per second per client
+} dns_rate_limiter_t;
+
+/**
+ * @brief Prepare the reply templates
+ *
+ * @param r Responder
+ * @param ip Address returned for every A query
+ * @param ttl_s TTL of the A record (0 keeps clients from caching it)
+ */
+void dns_responder_init(dns_responder_t *r, const uint8_t ip[4], uint32_t ttl_s);
+
+/**
+ * @brief Build the reply to a query
+ *
+ * Only standard queries with exactly one question are answered.
+ *
+ * @param r Responder
+ * @param query Received packet
+ * @param len Length of the packet
+ * @param out Reply buffer (DNS_RESPONDER_MAX_PACKET is always enough)
+ * @param out_size Size of the reply buffer
+ * @param out_len Length of the reply
+ * @return What was built; DNS_REPLY_NONE means send nothing
+ */
+dns_reply_t dns_responder_reply(const dns_responder_t *r, const uint8_t *query, size_t len,
+                                uint8_t *out, size_t out_size, size_t *out_len);
+
+/**
+ * @brief Initialize (or reset) a rate limiter
+ *
+ * @param rl Rate limiter
+ * @param burst Queries a client may send back to back
+ * @param per_sec Sustained queries per second per client
+ */
+void dns_rate_limiter_init(dns_rate_limiter_t *rl, uint32_t burst, uint32_t per_sec);
+
+/**
+ * @brief Take a token for a query from a client
+ *
+ * Unknown clients take the free (or least recently seen) slot and start
+ * with a full bucket.
+ *
+ * @param rl Rate limiter
+ * @param addr Client IPv4 address
+ * @param now_ms Current time
+ * @return true if the query should be answered
+ */
+bool dns_rate_limiter_allow(dns_rate_limiter_t *rl, uint32_t addr, uint32_t now_ms);
+
+#endif // DNS_RESPONDER_H
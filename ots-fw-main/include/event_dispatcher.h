@@ -4,8 +4,18 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_err.h"
+#include "esp_timer.h"
 #include "protocol.h"
 
+/**
+ * Blocking handlers (EVENT_HANDLER_BLOCKING) run on worker tasks. Build with
+ * -DEVENT_DISPATCHER_DEFER_BLOCKING=0 to run them on the dispatcher task
+ * like fast handlers, e.g. to compare dispatch latency.
+ */
+#ifndef EVENT_DISPATCHER_DEFER_BLOCKING
+#define EVENT_DISPATCHER_DEFER_BLOCKING 1
+#endif
+
 /**
  * @brief Event source types
  */
@@ -25,10 +35,21 @@ typedef struct {
     game_event_type_t type;
     event_source_t source;
     uint64_t timestamp;
+    uint32_t queued_us;     // Set by event_dispatcher_stamp(); 0 = not in latency stats
     char message[128];
     char data[256];
 } internal_event_t;
 
+/**
+ * @brief Mark an event with the current time, for the dispatch latency statistics
+ *
+ * Called by producers right before posting (the post functions take a const
+ * event). event_dispatcher_post_simple/post_game_event stamp on their own.
+ */
+static inline void event_dispatcher_stamp(internal_event_t *event) {
+    event->queued_us = (uint32_t)esp_timer_get_time() | 1u;  // Never 0
+}
+
 /**
  * @brief Event handler callback function type
  * 
@@ -37,6 +58,71 @@ typedef struct {
  */
 typedef bool (*event_handler_t)(const internal_event_t *event);
 
+/**
+ * @brief How a handler is run
+ */
+typedef enum {
+    EVENT_HANDLER_FAST = 0,     // On the dispatcher task; must not wait on I2C, CAN, ...
+    EVENT_HANDLER_BLOCKING,     // On a worker task with its own queue, events in order
+} event_handler_mode_t;
+
+/**
+ * @brief Per-event-type counters
+ *
+ * A posted event ends up either dispatched or dropped. Producers that stage
+ * their data and post one event for it (game_snapshot.c) count a submit
+ * that found an event already queued as coalesced.
+ */
+typedef struct {
+    uint32_t posted;        // Queued
+    uint32_t coalesced;     // Taken over by an already queued event (no post)
+    uint32_t dropped;       // Rejected on a full queue, or evicted for a critical event
+    uint32_t dispatched;    // Delivered to the handlers
+} event_type_stats_t;
+
+// Handler execution time histogram: <10us, <100us, <1ms, <10ms, >=10ms
+#define EVENT_HANDLER_HIST_BUCKETS 5
+extern const uint32_t event_handler_hist_bounds_us[EVENT_HANDLER_HIST_BUCKETS - 1];
+// Dispatch latency histogram: <100us, <1ms, <10ms, <100ms, >=100ms
+extern const uint32_t event_latency_hist_bounds_us[EVENT_HANDLER_HIST_BUCKETS - 1];
+
+/**
+ * @brief Execution time of one registered handler (across all its event types)
+ */
+typedef struct {
+    const char *name;       // Name given at registration, NULL if none
+    event_handler_t handler;
+    bool blocking;          // Registered as EVENT_HANDLER_BLOCKING
+    uint32_t calls;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t hist[EVENT_HANDLER_HIST_BUCKETS];
+    uint32_t over_budget;       // Calls longer than the fast/blocking time budget
+    uint32_t stalls;            // Calls the watchdog saw still running
+    uint32_t deferred_dropped;  // Events lost to a handler queue full for 250 ms (blocking only)
+    uint64_t lag_total_us;      // Post -> handler done (blocking only)
+    uint32_t lag_max_us;
+} event_handler_stats_t;
+
+/**
+ * @brief Time from post until the dispatcher task is done with an event
+ *
+ * Covers the fast handlers and handing the event to blocking ones; their own
+ * post-to-done time is the per-handler lag.
+ */
+typedef struct {
+    uint32_t count;
+    uint64_t total_us;
+    uint32_t max_us;
+    uint32_t hist[EVENT_HANDLER_HIST_BUCKETS];
+} event_latency_stats_t;
+
+typedef struct {
+    uint32_t size;          // Queue capacity
+    uint32_t depth;         // Events waiting now
+    uint32_t high_water;    // Highest depth seen after a post
+} event_queue_stats_t;
+
 /**
  * @brief Initialize event dispatcher
  * 
@@ -55,6 +141,34 @@ esp_err_t event_dispatcher_init(void);
  */
 esp_err_t event_dispatcher_register(game_event_type_t event_type, event_handler_t handler);
 
+/**
+ * @brief Register an event handler with a name for the statistics
+ * 
+ * @param event_type Event type to handle (or GAME_EVENT_INVALID for all events)
+ * @param handler Callback function
+ * @param name Static string shown by event_dispatcher_log_stats() and /api/status
+ * @return ESP_OK on success
+ */
+esp_err_t event_dispatcher_register_named(game_event_type_t event_type, event_handler_t handler,
+                                          const char *name);
+
+/**
+ * @brief Register a named event handler that may block
+ * 
+ * A blocking handler gets a queue of its own and runs on one of the
+ * dispatcher's worker tasks, so I2C or CAN traffic in it no longer holds up
+ * other handlers. It sees its events in posting order, but later than fast
+ * handlers (which have run by then), and its return value is ignored.
+ * 
+ * @param event_type Event type to handle (or GAME_EVENT_INVALID for all events)
+ * @param handler Callback function
+ * @param name Static string for the statistics (may be NULL)
+ * @param mode EVENT_HANDLER_FAST or EVENT_HANDLER_BLOCKING
+ * @return ESP_OK on success
+ */
+esp_err_t event_dispatcher_register_ex(game_event_type_t event_type, event_handler_t handler,
+                                       const char *name, event_handler_mode_t mode);
+
 /**
  * @brief Unregister an event handler
  * 
@@ -72,6 +186,20 @@ esp_err_t event_dispatcher_unregister(game_event_type_t event_type, event_handle
  */
 esp_err_t event_dispatcher_post(const internal_event_t *event);
 
+/**
+ * @brief Post several events in order
+ * 
+ * Checks queue space once for the whole batch; when everything fits (the
+ * normal case) the events are queued back to back. Events that do not fit
+ * go through event_dispatcher_post() so its drop/evict policy still applies.
+ * 
+ * @param events Events to post
+ * @param count Number of events
+ * @param out_posted Number of events queued (may be NULL)
+ * @return ESP_OK if every event was queued, ESP_ERR_NO_MEM if any was dropped
+ */
+esp_err_t event_dispatcher_post_batch(const internal_event_t *events, size_t count, size_t *out_posted);
+
 /**
  * @brief Post a simple event with just type and source
  * 
@@ -81,6 +209,16 @@ esp_err_t event_dispatcher_post(const internal_event_t *event);
  */
 esp_err_t event_dispatcher_post_simple(game_event_type_t type, event_source_t source);
 
+/**
+ * @brief Count an update that an already queued event of the same type will carry
+ *
+ * For producers that stage data and queue one event for it: a later update
+ * replaces the staged data instead of being posted.
+ *
+ * @param type Event type
+ */
+void event_dispatcher_note_coalesced(game_event_type_t type);
+
 /**
  * @brief Convert game_event_t to internal_event_t and post
  * 
@@ -104,4 +242,60 @@ void* event_dispatcher_get_queue(void);
  */
 bool event_dispatcher_is_running(void);
 
+/**
+ * @brief Get number of events lost to queue pressure
+ * 
+ * Counts both rejected posts and queued events evicted to make room for
+ * critical ones. Callers compare it across a post to detect lost state.
+ * 
+ * @return Cumulative dropped event count
+ */
+uint32_t event_dispatcher_get_dropped_count(void);
+
+/**
+ * @brief Get the counters of one event type
+ * 
+ * @param type Event type
+ * @param out_stats Receives a copy of the counters
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for an unknown type or NULL out_stats
+ */
+esp_err_t event_dispatcher_get_type_stats(game_event_type_t type, event_type_stats_t *out_stats);
+
+/**
+ * @brief Get the number of handlers with execution time statistics
+ */
+uint8_t event_dispatcher_get_handler_count(void);
+
+/**
+ * @brief Get the execution time statistics of one handler
+ * 
+ * @param index 0 .. event_dispatcher_get_handler_count() - 1
+ * @param out_stats Receives a copy of the statistics
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for a bad index or NULL out_stats
+ */
+esp_err_t event_dispatcher_get_handler_stats(uint8_t index, event_handler_stats_t *out_stats);
+
+/**
+ * @brief Get the queue depth and its high-water mark
+ */
+void event_dispatcher_get_queue_stats(event_queue_stats_t *out_stats);
+
+/**
+ * @brief Get the dispatch latency of stamped events (see event_dispatcher_stamp())
+ */
+void event_dispatcher_get_latency_stats(event_latency_stats_t *out_stats);
+
+/**
+ * @brief Clear the per-type counters, handler times, latency and high-water mark
+ * 
+ * The cumulative event_dispatcher_get_dropped_count() is left alone: callers
+ * compare it across a post.
+ */
+void event_dispatcher_reset_stats(void);
+
+/**
+ * @brief Log queue, per-type and per-handler statistics to the console
+ */
+void event_dispatcher_log_stats(void);
+
 #endif // EVENT_DISPATCHER_H
@@ -0,0 +1,149 @@
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "game_state_manager.h"
+#include "nuke_state_manager.h"
+
+/**
+ * @file game_snapshot.h
+ * @brief Full-state snapshots for resynchronizing with the userscript
+ *
+ * Module state is normally built from the event stream. When events are lost
+ * (event queue pressure, WebSocket reconnect, sequence gap) the userscript
+ * sends a `snapshot` message carrying the complete state. The snapshot is
+ * staged here by the WebSocket handler and applied on the event dispatcher
+ * task, so no regular event is processed while it is half-applied.
+ *
+ * Blocking modules handle their events on worker tasks, behind the
+ * dispatcher. They sync from the snapshot when INTERNAL_EVENT_STATE_SNAPSHOT
+ * reaches them (game_snapshot_sync_nukes()), so events queued ahead of it on
+ * their worker are handled first and cannot undo the resync.
+ *
+ * Must stay in sync with GameSnapshot in ots-shared/src/game.ts.
+ */
+
+// Snapshot format version understood by this firmware
+#define GAME_SNAPSHOT_VERSION 1
+
+// In-flight nukes carried by one snapshot (extra entries are ignored)
+// Override per build via PlatformIO build flags: -DGAME_SNAPSHOT_MAX_NUKES=256
+#ifndef GAME_SNAPSHOT_MAX_NUKES
+#define GAME_SNAPSHOT_MAX_NUKES 128
+#endif
+
+/**
+ * @brief Complete game state as reported by the userscript
+ */
+typedef struct {
+    uint32_t version;
+    uint32_t seq;               // Sequence number of the last event sent before the snapshot
+    uint64_t timestamp;
+    game_phase_t phase;
+
+    bool has_troops;
+    uint32_t troops_current;
+    uint32_t troops_max;
+
+    bool has_attack_ratio;
+    uint8_t attack_percent;     // attackRatio * 100
+
+    uint16_t nuke_count;
+    bool nukes_truncated;       // Sender had more than GAME_SNAPSHOT_MAX_NUKES
+    nuke_tracker_entry_t nukes[GAME_SNAPSHOT_MAX_NUKES];
+
+    uint16_t land_alerts;       // Active land invasions targeting the player
+    uint16_t naval_alerts;      // Active naval invasions targeting the player
+} game_snapshot_t;
+
+/**
+ * @brief Initialize snapshot staging
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t game_snapshot_init(void);
+
+/**
+ * @brief Stage a snapshot and queue INTERNAL_EVENT_STATE_SNAPSHOT
+ *
+ * The snapshot is copied; a newer snapshot replaces one that has not been
+ * applied yet.
+ *
+ * @param snapshot Parsed snapshot
+ * @return ESP_OK if the snapshot was staged and the event queued
+ */
+esp_err_t game_snapshot_submit(const game_snapshot_t *snapshot);
+
+/**
+ * @brief Forget that an INTERNAL_EVENT_STATE_SNAPSHOT is queued
+ *
+ * Called by the event dispatcher when it evicts the queued event to make
+ * room for another critical event. The staged snapshot is discarded and
+ * the next game_snapshot_submit() queues a new event.
+ */
+void game_snapshot_evicted(void);
+
+/**
+ * @brief Apply the staged snapshot to game state
+ *
+ * Sets the game phase and makes the snapshot the applied one. The nuke
+ * tracker is synced by the modules, see game_snapshot_sync_nukes().
+ *
+ * Must be called from the event dispatcher task when handling
+ * INTERNAL_EVENT_STATE_SNAPSHOT, before the event is routed to modules.
+ *
+ * @return ESP_OK if a snapshot was applied, ESP_ERR_NOT_FOUND if none staged
+ */
+esp_err_t game_snapshot_apply(void);
+
+/**
+ * @brief Get the most recently applied snapshot
+ *
+ * Only for fast handlers (event dispatcher task) handling
+ * INTERNAL_EVENT_STATE_SNAPSHOT: the next snapshot is applied on that task.
+ * Blocking modules use game_snapshot_sync_nukes() and
+ * game_snapshot_get_invasions().
+ *
+ * @return Applied snapshot, or NULL if none has been applied yet
+ */
+const game_snapshot_t* game_snapshot_get_applied(void);
+
+/**
+ * @brief Sync one direction of the nuke tracker to the applied snapshot
+ *
+ * Called by the module that registers launches of @p direction when it
+ * handles INTERNAL_EVENT_STATE_SNAPSHOT, on its own task. Outside a match
+ * the direction is cleared. Reads the applied snapshot under the snapshot
+ * lock; if a newer one was applied meanwhile it is used, and the events
+ * between the two are still queued behind this one.
+ *
+ * @param direction Direction to sync
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND if no snapshot was applied,
+ *         ESP_ERR_NO_MEM if some nukes did not fit the tracker
+ */
+esp_err_t game_snapshot_sync_nukes(nuke_direction_t direction);
+
+/**
+ * @brief Get the invasion counts of the applied snapshot
+ *
+ * Safe from any task (read under the snapshot lock). Both are 0 outside a
+ * match.
+ *
+ * @param out_land Active land invasions targeting the player
+ * @param out_naval Active naval invasions targeting the player
+ * @return false if no snapshot was applied yet (counts set to 0)
+ */
+bool game_snapshot_get_invasions(uint16_t *out_land, uint16_t *out_naval);
+
+/**
+ * @brief Map a protocol phase string ("lobby", "in-game", ...) to game_phase_t
+ *
+ * @param str Phase string from ots-shared GamePhase
+ * @param out_phase Output phase
+ * @return true if the string is a known phase
+ */
+bool game_snapshot_parse_phase(const char *str, game_phase_t *out_phase);
+
+#endif // GAME_SNAPSHOT_H
@@ -38,6 +38,16 @@ esp_err_t game_state_init(void);
  */
 void game_state_update(game_event_type_t event_type);
 
+/**
+ * @brief Force the game phase (used when applying a state snapshot)
+ *
+ * Unlike game_state_update(), this has no side effects besides the state
+ * change callback.
+ *
+ * @param phase New game phase
+ */
+void game_state_set_phase(game_phase_t phase);
+
 /**
  * @brief Get current game phase
  * 
@@ -16,6 +16,17 @@ typedef struct {
     char last_error[64];
 } module_status_t;
 
+/**
+ * @brief Sentinel returned by next_wake_ms() when the module has no pending
+ * time-based work and should only run again after module_manager_notify()
+ */
+#define MODULE_WAKE_NEVER UINT32_MAX
+
+/**
+ * @brief Poll interval used for modules that do not provide next_wake_ms()
+ */
+#define MODULE_DEFAULT_UPDATE_MS 50
+
 /**
  * @brief Hardware module interface
  * 
@@ -24,6 +35,9 @@ typedef struct {
 typedef struct hardware_module {
     const char *name;                           // Module name
     bool enabled;                               // Module enabled flag
+    bool blocking_events;                       // handle_event() does I2C/CAN I/O: run it on an event worker
+    const game_event_type_t *event_types;       // Blocking only: types handle_event() takes, ending
+                                                // with GAME_EVENT_INVALID (NULL = every event)
     
     /**
      * @brief Initialize module hardware
@@ -33,14 +47,29 @@ typedef struct hardware_module {
     esp_err_t (*init)(void);
     
     /**
-     * @brief Update module state (periodic call)
-     * Called regularly by module manager for time-based operations
+     * @brief Update module state (scheduled call)
+     * Called by the module scheduler when the module's wake deadline expires
+     * or after module_manager_notify(). May be NULL if the module is purely
+     * event-driven.
      * @return ESP_OK on success
      */
     esp_err_t (*update)(void);
     
+    /**
+     * @brief Get delay until the next update() is due (optional)
+     * Called by the scheduler right after each update(). If NULL, the module
+     * is polled every MODULE_DEFAULT_UPDATE_MS.
+     * @return Milliseconds until next update, or MODULE_WAKE_NEVER
+     */
+    uint32_t (*next_wake_ms)(void);
+    
     /**
      * @brief Handle incoming event
+     * Runs on the event dispatcher task, or on an event worker task when
+     * blocking_events is set (see event_dispatcher_register_ex()). A blocking
+     * module gets only the types in event_types, each copied to its worker
+     * queue, so the list should hold just the types it acts on. Either way
+     * it is called only while the module is enabled and initialized.
      * @param event Event to process
      * @return true if event was handled
      */
@@ -0,0 +1,85 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/**
+ * @file json_writer.h
+ * @brief Streaming JSON writer into a caller-provided buffer
+ *
+ * Builds outbound messages directly as text: no cJSON tree, no heap.
+ * Commas, string escaping and integer formatting are handled by the
+ * writer; the caller only emits keys and values in order.
+ *
+ * Calls after the buffer fills are ignored and json_writer_finish()
+ * reports ESP_ERR_INVALID_SIZE, so a message is checked once at the end
+ * instead of after every field.
+ *
+ * Example:
+ * @code
+ * char buf[96];
+ * json_writer_t w;
+ * json_writer_init(&w, buf, sizeof(buf));
+ * json_writer_begin_object(&w);
+ * json_writer_field_string(&w, "type", "cmd");
+ * json_writer_field_uint(&w, "percent", 50);
+ * json_writer_end_object(&w);
+ * size_t len;
+ * if (json_writer_finish(&w, &len) == ESP_OK) { send(buf, len); }
+ * @endcode
+ */
+
+#define JSON_WRITER_MAX_DEPTH 8
+
+typedef struct {
+    char *buf;
+    size_t cap;
+    size_t len;
+    uint8_t depth;
+    bool overflow;          // Buffer too small or nesting too deep
+    bool after_key;         // Next value belongs to the key just written
+    uint8_t has_members;    // Bit d: container at depth d already has a member
+} json_writer_t;
+
+/**
+ * @brief Start writing into buf (always NUL-terminated, even on overflow)
+ */
+void json_writer_init(json_writer_t *w, char *buf, size_t cap);
+
+void json_writer_begin_object(json_writer_t *w);
+void json_writer_end_object(json_writer_t *w);
+void json_writer_begin_array(json_writer_t *w);
+void json_writer_end_array(json_writer_t *w);
+
+/**
+ * @brief Write an object key; the next call writes its value
+ */
+void json_writer_key(json_writer_t *w, const char *key);
+
+/** @brief Write an escaped string value (NULL writes null) */
+void json_writer_string(json_writer_t *w, const char *value);
+void json_writer_int(json_writer_t *w, int64_t value);
+void json_writer_uint(json_writer_t *w, uint64_t value);
+void json_writer_bool(json_writer_t *w, bool value);
+void json_writer_null(json_writer_t *w);
+
+// Key + value shorthands
+void json_writer_field_string(json_writer_t *w, const char *key, const char *value);
+void json_writer_field_int(json_writer_t *w, const char *key, int64_t value);
+void json_writer_field_uint(json_writer_t *w, const char *key, uint64_t value);
+void json_writer_field_bool(json_writer_t *w, const char *key, bool value);
+
+/**
+ * @brief Check the result
+ *
+ * @param w Writer
+ * @param out_len Output length without the NUL (may be NULL)
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE if the buffer was too small,
+ *         ESP_ERR_INVALID_STATE if an object/array is still open
+ */
+esp_err_t json_writer_finish(const json_writer_t *w, size_t *out_len);
+
+#endif // JSON_WRITER_H
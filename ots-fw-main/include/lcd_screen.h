@@ -0,0 +1,109 @@
+#ifndef LCD_SCREEN_H
+#define LCD_SCREEN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "lcd_driver.h"
+
+/**
+ * @file lcd_screen.h
+ * @brief Screen composition for the 16x2 LCD
+ *
+ * Screens are composed in a RAM frame (static templates from flash plus
+ * dynamic fields written into fixed slots) and flushed by diffing against a
+ * shadow of what the LCD currently shows: only changed cells go over I2C,
+ * with one cursor move per run of changes.
+ *
+ * Each character costs 16 I2C bytes on the PCF8574 backpack, so a scan-dot
+ * animation frame that rewrote a full line (cursor + 16 cells) now sends
+ * two cells and one cursor move.
+ *
+ * Whoever else writes the LCD directly (troops module in game) must be
+ * followed by lcd_screen_invalidate() before the next flush.
+ */
+
+// Progress bar glyphs (CGRAM slots 1-4: 1..4 of 5 pixel columns filled)
+#define LCD_GLYPH_BAR_1     1
+#define LCD_GLYPH_BAR_4     4
+#define LCD_GLYPH_FULL      0xFF   // Built-in full block (HD44780 ROM A00)
+
+/**
+ * @brief Full-screen template (stored in flash)
+ */
+typedef struct {
+    char lines[LCD_ROWS][LCD_COLS + 1];
+} lcd_screen_template_t;
+
+/**
+ * @brief Fixed-width animation (frames stored back to back in flash)
+ *
+ * Frames are placed into the slot one at a time; the flush diff turns each
+ * step into the cells that changed from the previous frame.
+ */
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+    uint8_t width;
+    uint8_t frame_count;
+    const char *frames;     // frame_count * width characters
+} lcd_animation_t;
+
+/**
+ * @brief Composition statistics
+ */
+typedef struct {
+    uint32_t flushes;        // lcd_screen_flush() calls that sent anything
+    uint32_t cells_written;  // Characters sent
+    uint32_t cursor_moves;   // Cursor commands sent
+} lcd_screen_stats_t;
+
+/**
+ * @brief Load CGRAM glyphs and forget the shadow
+ *
+ * Call once after lcd_init() succeeded.
+ */
+esp_err_t lcd_screen_init(void);
+
+/**
+ * @brief Replace the frame with a template (nothing is sent until flush)
+ */
+void lcd_screen_load(const lcd_screen_template_t *tmpl);
+
+/**
+ * @brief Write text into a slot of the frame (clipped to the row)
+ */
+void lcd_screen_put(uint8_t col, uint8_t row, const char *text, size_t len);
+
+/**
+ * @brief Write one animation frame into its slot
+ */
+void lcd_screen_put_frame(const lcd_animation_t *anim, uint8_t frame);
+
+/**
+ * @brief Render a horizontal progress bar with 5 steps per cell
+ *
+ * @param width Cells used by the bar
+ * @param value Filled amount, 0..max
+ */
+void lcd_screen_put_bar(uint8_t col, uint8_t row, uint8_t width, uint32_t value, uint32_t max);
+
+/**
+ * @brief Send the cells that differ from what the LCD shows
+ *
+ * @return ESP_OK, or the first LCD write error (shadow is then invalidated)
+ */
+esp_err_t lcd_screen_flush(void);
+
+/**
+ * @brief Forget what the LCD shows; the next flush rewrites every cell
+ */
+void lcd_screen_invalidate(void);
+
+/**
+ * @brief Get composition statistics
+ */
+void lcd_screen_get_stats(lcd_screen_stats_t *out);
+
+#endif // LCD_SCREEN_H
@@ -18,6 +18,10 @@ esp_err_t module_manager_init(void);
 /**
  * @brief Register a hardware module
  * 
+ * May be called after the scheduler started; the module is neither updated
+ * nor routed events until module_manager_init_all() initialized it.
+ * Registration itself is not reentrant (one registering task at a time).
+ * 
  * @param module Pointer to module structure
  * @return ESP_OK on success
  */
@@ -26,22 +30,68 @@ esp_err_t module_manager_register(hardware_module_t *module);
 /**
  * @brief Initialize all registered modules
  * 
- * Calls init() on each registered module
+ * Calls init() on each registered module not initialized yet, so it can be
+ * called again after registering more modules
  * 
  * @return ESP_OK if all modules initialized successfully
  */
 esp_err_t module_manager_init_all(void);
 
 /**
- * @brief Update all modules (periodic)
+ * @brief Per-module scheduler statistics
+ */
+typedef struct {
+    uint32_t wakeups;           // Number of update() calls since boot
+    uint64_t busy_us;           // Total time spent in update() since boot
+    uint32_t max_update_us;     // Longest single update() call
+    uint32_t notifications;     // Number of module_manager_notify() requests
+} module_sched_stats_t;
+
+/**
+ * @brief Update all modules (unconditional)
  * 
- * Calls update() on each enabled module
- * Should be called regularly (e.g., from main loop or task)
+ * Calls update() on each enabled module regardless of its wake deadline.
+ * Normal operation uses the scheduler task instead (module_manager_start_scheduler).
  * 
  * @return ESP_OK on success
  */
 esp_err_t module_manager_update_all(void);
 
+/**
+ * @brief Start the deadline-driven module update task
+ * 
+ * The task sleeps until the earliest module wake deadline or until a module
+ * requests an update through module_manager_notify(), then runs only the
+ * modules that are due.
+ * 
+ * @return ESP_OK on success
+ */
+esp_err_t module_manager_start_scheduler(void);
+
+/**
+ * @brief Request an update() for a module as soon as possible
+ * 
+ * Call this when a module's state becomes dirty outside of update()
+ * (e.g. from an event handler). Safe to call from any task.
+ * 
+ * @param module Registered module to wake
+ */
+void module_manager_notify(const hardware_module_t *module);
+
+/**
+ * @brief Get scheduler statistics for a module
+ * 
+ * @param index Module index
+ * @param stats Output statistics
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG for a bad index
+ */
+esp_err_t module_manager_get_stats(uint8_t index, module_sched_stats_t *stats);
+
+/**
+ * @brief Log per-module wake-ups/s and CPU usage since the previous call
+ */
+void module_manager_log_stats(void);
+
 /**
  * @brief Route event to all modules
  * 
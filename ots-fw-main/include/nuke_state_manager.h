@@ -5,6 +5,22 @@
 #include <stdbool.h>
 #include "esp_err.h"
 
+// Hash table slots (rounded up to a power of two, allocated in PSRAM when
+// available). Up to 7/8 of the slots can hold in-flight nukes.
+// Override per build via PlatformIO build flags: -DNUKE_TRACKER_CAPACITY=4096
+#ifndef NUKE_TRACKER_CAPACITY
+#define NUKE_TRACKER_CAPACITY 2048
+#endif
+
+// Nukes still in flight after this long are assumed to have lost their
+// resolve event and are expired by nuke_tracker_expire_stale().
+#ifndef NUKE_TRACKER_MAX_FLIGHT_MS
+#define NUKE_TRACKER_MAX_FLIGHT_MS 120000
+#endif
+
+// How often modules with in-flight nukes should run the expiry sweep
+#define NUKE_TRACKER_SWEEP_INTERVAL_MS 5000
+
 /**
  * @brief Nuke types tracked by the system
  */
@@ -32,6 +48,15 @@ typedef enum {
     NUKE_STATE_INTERCEPTED = 2
 } nuke_state_t;
 
+/**
+ * @brief One in-flight nuke (used to resynchronize the tracker)
+ */
+typedef struct {
+    uint32_t unit_id;
+    nuke_type_t type;
+    nuke_direction_t direction;
+} nuke_tracker_entry_t;
+
 /**
  * @brief Initialize the nuke tracker
  * 
@@ -42,10 +67,12 @@ esp_err_t nuke_tracker_init(void);
 /**
  * @brief Register a nuke launch (incoming or outgoing)
  * 
- * @param unit_id Unique unit ID from game
+ * O(1) average: unit IDs are indexed by an open-addressing hash table.
+ * 
+ * @param unit_id Unique unit ID from game (must be non-zero)
  * @param type Nuke type (atom/hydro/mirv)
  * @param direction Incoming or outgoing
- * @return ESP_OK on success
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if the table is full
  */
 esp_err_t nuke_tracker_register_launch(uint32_t unit_id, nuke_type_t type, nuke_direction_t direction);
 
@@ -61,12 +88,52 @@ esp_err_t nuke_tracker_resolve_nuke(uint32_t unit_id, bool exploded);
 /**
  * @brief Get count of active (in-flight) nukes of a specific type and direction
  * 
+ * O(1): counters are maintained on register/resolve/expire.
+ * 
  * @param type Nuke type to query
  * @param direction Direction to query
- * @return Number of active nukes, or 0 if none
+ * @return Number of active nukes (saturates at 255), or 0 if none
  */
 uint8_t nuke_tracker_get_active_count(nuke_type_t type, nuke_direction_t direction);
 
+/**
+ * @brief Get count of active nukes of all types for a direction
+ * 
+ * @param direction Direction to query
+ * @return Number of active nukes
+ */
+uint16_t nuke_tracker_get_total_active(nuke_direction_t direction);
+
+/**
+ * @brief Expire nukes whose resolve event was lost
+ * 
+ * Removes nukes of the given direction that have been in flight for longer
+ * than NUKE_TRACKER_MAX_FLIGHT_MS. Scans the whole table; call it at most
+ * every NUKE_TRACKER_SWEEP_INTERVAL_MS.
+ * 
+ * @param direction Direction to sweep
+ * @return Number of nukes expired
+ */
+uint32_t nuke_tracker_expire_stale(nuke_direction_t direction);
+
+/**
+ * @brief Replace the tracked nukes of one direction with an authoritative list
+ * 
+ * Used when applying a state snapshot. Nukes of @p direction missing from
+ * @p entries are dropped, new ones are registered, and nukes already tracked
+ * keep their launch time so expiry stays accurate. Entries and tracked nukes
+ * of the other direction are left alone: each direction is synced by the
+ * module that registers its launches, in order with its own events. Runs
+ * under the tracker lock, so readers never observe a partially synced table.
+ * 
+ * @param entries In-flight nukes, both directions (may be NULL when count is 0)
+ * @param count Number of entries
+ * @param direction Direction to sync
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if some entries did not fit
+ */
+esp_err_t nuke_tracker_sync(const nuke_tracker_entry_t *entries, uint32_t count,
+                            nuke_direction_t direction);
+
 /**
  * @brief Clear all tracked nukes (e.g., on game end)
  */
@@ -75,6 +142,8 @@ void nuke_tracker_clear_all(void);
 /**
  * @brief Get statistics for debugging
  * 
+ * Exploded/intercepted counts are cumulative since the last clear.
+ * 
  * @param type Nuke type
  * @param direction Direction
  * @param out_in_flight Output: count in flight
@@ -85,4 +154,15 @@ void nuke_tracker_get_stats(nuke_type_t type, nuke_direction_t direction,
                            uint8_t *out_in_flight, uint8_t *out_exploded, 
                            uint8_t *out_intercepted);
 
+/**
+ * @brief Benchmark the tracker with a synthetic barrage
+ * 
+ * Registers, counts and resolves @p count nukes on a private table (the live
+ * tracker is not modified) and logs timing per operation.
+ * 
+ * @param count Number of nukes in the barrage
+ * @return ESP_OK on success
+ */
+esp_err_t nuke_tracker_benchmark(uint32_t count);
+
 #endif // NUKE_TRACKER_H
@@ -30,6 +30,7 @@ typedef enum {
     INTERNAL_EVENT_WS_DISCONNECTED,
     INTERNAL_EVENT_WS_ERROR,
     INTERNAL_EVENT_BUTTON_PRESSED,
+    INTERNAL_EVENT_STATE_SNAPSHOT,      // Staged snapshot ready (see game_snapshot.h)
     GAME_EVENT_INVALID
 } game_event_type_t;
 
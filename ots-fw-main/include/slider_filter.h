@@ -0,0 +1,82 @@
+#ifndef SLIDER_FILTER_H
+#define SLIDER_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file slider_filter.h
+ * @brief Decides which slider positions are sent to the game
+ *
+ * Fed with every new slider sample, the filter tracks whether the slider
+ * is moving:
+ * - The first change after a rest is sent at once (leading edge), so the
+ *   game reacts as soon as the hand moves.
+ * - While moving, intermediate positions go out at most every
+ *   min_interval_ms.
+ * - Once no change was seen for settle_ms, the resting position is sent
+ *   once as the final value (if it differs from the last one sent).
+ *
+ * Pure logic with caller-supplied times: no FreeRTOS or ESP-IDF calls, so
+ * tools/tests/slider_sweep_bench.py can run it on the host.
+ */
+
+typedef struct {
+    uint32_t min_interval_ms;   // Throttle for intermediate updates while moving
+    uint32_t settle_ms;         // No change for this long = slider at rest
+    uint8_t threshold;          // Minimum change (percent) for an intermediate update
+} slider_filter_config_t;
+
+typedef enum {
+    SLIDER_SEND_NONE = 0,
+    SLIDER_SEND_INTERMEDIATE,   // Slider still moving
+    SLIDER_SEND_FINAL,          // Slider at rest
+} slider_send_t;
+
+typedef struct {
+    slider_filter_config_t cfg;
+    uint8_t sample;             // Latest sample
+    uint8_t sent;               // Last value sent
+    bool have_sample;
+    bool have_sent;
+    bool moving;
+    uint32_t last_motion_ms;    // Time of the latest sample that changed
+    uint32_t last_send_ms;
+} slider_filter_t;
+
+/**
+ * @brief Initialize (or reset) a filter
+ *
+ * After a reset the next sample is sent as a final value.
+ */
+void slider_filter_init(slider_filter_t *f, const slider_filter_config_t *cfg);
+
+/**
+ * @brief Forget what was sent, so the current position is sent again
+ */
+void slider_filter_resend(slider_filter_t *f);
+
+/**
+ * @brief Feed the latest sample and decide whether to send
+ *
+ * May be called again with the same sample (e.g. on a timer) to let the
+ * throttle and settle timers expire.
+ *
+ * @param f Filter
+ * @param percent Latest slider position (0-100)
+ * @param sample_ms Time the sample was taken
+ * @param now_ms Current time
+ * @param out_percent Value to send when the result is not SLIDER_SEND_NONE
+ * @return What to send
+ */
+slider_send_t slider_filter_update(slider_filter_t *f, uint8_t percent, uint32_t sample_ms,
+                                   uint32_t now_ms, uint8_t *out_percent);
+
+/**
+ * @brief Time until slider_filter_update() should run again without a new sample
+ *
+ * @return Milliseconds, or UINT32_MAX if only a new sample can change anything
+ */
+uint32_t slider_filter_next_ms(const slider_filter_t *f, uint32_t now_ms);
+
+#endif // SLIDER_FILTER_H
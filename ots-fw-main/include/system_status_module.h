@@ -30,4 +30,12 @@ const hardware_module_t* system_status_module_get(void);
  */
 void system_status_refresh_display(void);
 
+/**
+ * @brief Log LCD traffic since the previous call (serial "lcd-stats")
+ * 
+ * Run it twice on a screen to get that screen's I2C bytes per second
+ * (e.g. the waiting-for-connection animation).
+ */
+void system_status_log_lcd_stats(void);
+
 #endif // SYSTEM_STATUS_MODULE_H
@@ -12,9 +12,11 @@
 // ADS1015 configuration
 #define ADS1015_CHANNEL_AIN0    0       // Slider on AIN0
 
-// Polling intervals
-#define TROOPS_SLIDER_POLL_MS   100     // Poll slider every 100ms
+// Slider pipeline: the ADC pushes changes (see adc_handler_set_change_callback),
+// slider_filter picks what is sent
 #define TROOPS_CHANGE_THRESHOLD 1       // Send command on ≥1% change
+#define TROOPS_SLIDER_MIN_INTERVAL_MS 150   // Throttle for intermediate commands while moving
+#define TROOPS_SLIDER_SETTLE_MS 120     // Slider at rest after this long without change
 
 // LCD dimensions
 #define LCD_COLS                16
@@ -33,6 +35,23 @@ typedef struct {
     bool initialized;               // Module initialization complete
 } troops_module_state_t;
 
+/**
+ * @brief Slider command statistics (since boot or the last reset)
+ *
+ * Latency is measured on the device: from the ADC sample that produced the
+ * value to the command being queued. For final commands, settle latency is
+ * from the last slider motion to the command.
+ */
+typedef struct {
+    uint32_t changes;               // Slider changes reported by the ADC
+    uint32_t sent_intermediate;     // Commands sent while moving
+    uint32_t sent_final;            // Commands sent once at rest
+    uint32_t latency_avg_ms;        // Sample -> command, all commands
+    uint32_t latency_max_ms;
+    uint32_t settle_avg_ms;         // Last motion -> final command
+    uint32_t settle_max_ms;
+} troops_slider_stats_t;
+
 /**
  * @brief Get the troops module instance
  * 
@@ -49,4 +68,21 @@ const hardware_module_t* troops_module_get(void);
  */
 void troops_format_count(uint32_t troops, char* buffer, size_t buffer_size);
 
+/**
+ * @brief Get slider command statistics
+ *
+ * @param out Output statistics
+ */
+void troops_get_slider_stats(troops_slider_stats_t *out);
+
+/**
+ * @brief Reset slider command statistics (e.g. before a test sweep)
+ */
+void troops_reset_slider_stats(void);
+
+/**
+ * @brief Log slider command statistics
+ */
+void troops_log_slider_stats(void);
+
 #endif // TROOPS_MODULE_H
@@ -0,0 +1,84 @@
+#ifndef WIFI_SCANNER_H
+#define WIFI_SCANNER_H
+
+#include "esp_err.h"
+#include "esp_wifi.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @file wifi_scanner.h
+ * @brief Background WiFi scanner with a cached result list
+ *
+ * Scans run in a dedicated task, so /api/scan answers from the cache
+ * without blocking the HTTP server. The cache holds one entry per SSID
+ * (strongest BSSID), sorted by RSSI, and drops networks that have not
+ * been seen for a while. Scans only happen while clients are asking for
+ * results: every WIFI_SCAN_REFRESH_MS while requests keep coming, and
+ * never more often than WIFI_SCAN_MIN_INTERVAL_MS.
+ *
+ * Every scan that changes the list bumps a generation counter; each entry
+ * remembers the generation it last changed in, so clients can fetch only
+ * what changed since their last poll.
+ */
+
+#define WIFI_SCAN_MAX_APS 20                // Cached networks (one per SSID)
+#define WIFI_SCAN_REFRESH_MS 15000          // Rescan period while clients poll
+#define WIFI_SCAN_MIN_INTERVAL_MS 5000      // Floor between two scans
+#define WIFI_SCAN_IDLE_MS 60000             // Stop scanning after this long without requests
+#define WIFI_SCAN_AP_TTL_MS 45000           // Drop networks not seen for this long
+
+typedef struct {
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+    wifi_auth_mode_t authmode;
+    uint32_t age_ms;        // Time since the network was last seen
+    uint32_t generation;    // Generation in which the entry last changed
+} wifi_scan_ap_t;
+
+typedef struct {
+    uint32_t generation;    // Current cache generation (0 = no scan yet)
+    uint32_t scan_age_ms;   // Time since the last completed scan (UINT32_MAX if none)
+    bool scanning;          // A scan is in progress
+    bool full;              // Result holds the whole list (not just changes)
+} wifi_scan_info_t;
+
+/**
+ * @brief Create the scanner task
+ *
+ * Call after the WiFi driver is initialized. No scan runs until
+ * wifi_scanner_request() is called.
+ *
+ * @return ESP_OK on success (or if already running)
+ * @return ESP_ERR_NO_MEM if the task or mutex could not be created
+ */
+esp_err_t wifi_scanner_init(void);
+
+/**
+ * @brief Note that a client wants scan results
+ *
+ * Keeps periodic scanning alive for WIFI_SCAN_IDLE_MS and wakes the
+ * scanner right away if the cache is stale. Never blocks.
+ */
+void wifi_scanner_request(void);
+
+/**
+ * @brief Copy cached networks (strongest first)
+ *
+ * With since_generation = 0 the whole list is returned. Otherwise only
+ * entries that changed after that generation are returned, unless
+ * networks were dropped since then, in which case the whole list is
+ * returned and info->full is set so the client replaces its copy.
+ *
+ * @param since_generation Generation the client already has (0 = none)
+ * @param out Output array
+ * @param max Capacity of out
+ * @param info Output cache state (may be NULL)
+ * @return Number of entries written to out
+ */
+size_t wifi_scanner_get(uint32_t since_generation, wifi_scan_ap_t *out, size_t max,
+                        wifi_scan_info_t *info);
+
+#endif // WIFI_SCANNER_H
@@ -88,6 +88,38 @@ esp_err_t ws_handlers_send_text(const char *data, size_t len);
  */
 esp_err_t ws_handlers_send_event(const game_event_t *event);
 
+/**
+ * Ask the userscript for a full state snapshot
+ * 
+ * Sent when events were lost (sequence gap, event queue overflow) or module
+ * state looks inconsistent. Rate-limited to one request per second.
+ * 
+ * @param reason Short reason tag forwarded in the request params
+ * @return ESP_OK if sent or suppressed by the rate limit,
+ *         ESP_ERR_INVALID_STATE if no userscript is connected
+ */
+esp_err_t ws_handlers_request_snapshot(const char *reason);
+
+/**
+ * Receive-side counters for incoming text frames
+ */
+typedef struct {
+    uint32_t frames;     ///< Text frames handled
+    uint32_t events;     ///< Events received (batched and unbatched)
+    uint32_t batches;    ///< "batch" frames among them
+    uint64_t busy_us;    ///< Time spent parsing and dispatching frames
+} ws_handlers_rx_stats_t;
+
+/**
+ * Get receive-side counters
+ * 
+ * busy_us / events is the firmware cost per received event; compare it for
+ * batched and unbatched senders.
+ * 
+ * @param out Filled with a copy of the counters
+ */
+void ws_handlers_get_rx_stats(ws_handlers_rx_stats_t *out);
+
 /**
  * Broadcast text to all clients asynchronously
  * 
@@ -0,0 +1,138 @@
+#ifndef WS_IO_H
+#define WS_IO_H
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file ws_io.h
+ * @brief Dedicated WebSocket I/O task
+ *
+ * The HTTP server runs every handler on a single httpd task, so a long
+ * request (OTA upload, /api/scan, asset download) used to stall WebSocket
+ * ingest and egress until it finished.
+ *
+ * Once the /ws upgrade completes, the session is detached from httpd with
+ * httpd_req_async_handler_begin() and handed to this task, which owns:
+ * - the socket set (select() over all attached sessions)
+ * - a receive buffer per session (frames are parsed here, not by httpd)
+ * - the outbound send queue (frames are written here, not via httpd_queue_work)
+ *
+ * Game traffic latency is then independent of HTTP activity.
+ *
+ * Closing hands the socket back to httpd (httpd_req_async_handler_complete +
+ * httpd_sess_trigger_close) so the normal close_fn cleanup still runs.
+ */
+
+// Detached sessions are never LRU-purged by httpd. Keep this below the
+// server's max_open_sockets (4) so HTTP requests such as OTA always get a slot.
+#define WS_IO_MAX_SESSIONS 3
+
+/**
+ * Text frame callback, invoked on the WS I/O task
+ *
+ * @param fd Session socket
+ * @param payload NUL-terminated payload (valid only during the call)
+ * @param len Payload length
+ */
+typedef void (*ws_io_text_handler_t)(int fd, char *payload, size_t len);
+
+/**
+ * WebSocket I/O statistics
+ */
+typedef struct {
+    uint32_t sessions_attached;     // Sessions handed over since start
+    uint32_t sessions_active;       // Currently attached sessions
+    uint32_t frames_rx;             // Text frames delivered to the handler
+    uint32_t frames_tx;             // Frames written (per session)
+    uint32_t send_dropped;          // Messages dropped because the send queue was full
+    uint32_t send_heap_allocs;      // Queued messages too large (or too many) for the fixed slots
+    uint32_t rx_handle_avg_us;      // Mean time from socket readable to handler return
+    uint32_t rx_handle_max_us;
+    uint32_t tx_queue_avg_us;       // Mean time a message waited in the send queue
+    uint32_t tx_queue_max_us;
+} ws_io_stats_t;
+
+/**
+ * Start the WebSocket I/O task
+ *
+ * @param server HTTP server handle owning the WebSocket sessions
+ * @param on_text Handler for complete text frames
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t ws_io_start(httpd_handle_t server, ws_io_text_handler_t on_text);
+
+/**
+ * Check if the WebSocket I/O task is running
+ *
+ * @return true if running
+ */
+bool ws_io_is_running(void);
+
+/**
+ * Take over an upgraded WebSocket session
+ *
+ * Must be called from the /ws handler on the upgrade request. On success
+ * httpd no longer polls the socket; all further frames arrive through the
+ * text handler.
+ *
+ * @param req Upgrade request
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if all session slots are in use,
+ *         ESP_ERR_INVALID_STATE if the task is not running
+ */
+esp_err_t ws_io_attach(httpd_req_t *req);
+
+/**
+ * Check if a session is owned by the WS I/O task
+ *
+ * @param fd Session socket
+ * @return true if attached
+ */
+bool ws_io_owns(int fd);
+
+/**
+ * Get number of attached sessions
+ *
+ * @return Attached session count
+ */
+int ws_io_get_session_count(void);
+
+/**
+ * Queue a text frame
+ *
+ * The data is copied (into a fixed slot when it fits, else the heap);
+ * the call never blocks on the network.
+ *
+ * @param fd Target session, or -1 for every attached session
+ * @param data Text data
+ * @param len Data length
+ * @return ESP_OK if queued, ESP_ERR_NO_MEM if the queue is full or
+ *         allocation failed, ESP_ERR_INVALID_STATE if not running
+ */
+esp_err_t ws_io_send_text(int fd, const char *data, size_t len);
+
+/**
+ * Get I/O statistics
+ *
+ * @param out_stats Receives a copy of the statistics
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if out_stats is NULL
+ */
+esp_err_t ws_io_get_stats(ws_io_stats_t *out_stats);
+
+/**
+ * Log I/O statistics and reset the latency maxima
+ */
+void ws_io_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WS_IO_H
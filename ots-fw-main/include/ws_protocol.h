@@ -5,6 +5,8 @@
 #include <stdbool.h>
 #include "esp_err.h"
 #include "protocol.h"
+#include "game_snapshot.h"
+#include "json_writer.h"
 
 /**
  * @brief WebSocket message types
@@ -15,9 +17,46 @@ typedef enum {
     WS_MSG_STATE,
     WS_MSG_COMMAND,
     WS_MSG_RESPONSE,
+    WS_MSG_SNAPSHOT,    // Body decoded into ws_protocol_sink_t.snapshot
+    WS_MSG_BATCH,       // Events delivered to ws_protocol_sink_t.on_batch_event
     WS_MSG_UNKNOWN
 } ws_message_type_t;
 
+// Most events decoded from one `batch` message; the rest are skipped
+#define WS_BATCH_MAX_EVENTS 16
+
+/**
+ * @brief Parsed `event` payload (also one element of a `batch`)
+ */
+typedef struct {
+    game_event_type_t event_type;
+    uint32_t timestamp;
+    uint32_t seq;       // Per-connection sequence number (0 = not numbered)
+    char message[64];
+    // TROOP_UPDATE carries JSON data; 128 bytes is too small and causes truncation.
+    char data[512];
+} ws_event_payload_t;
+
+/**
+ * @brief Callback for each event of a `batch` message
+ *
+ * @param event Decoded event (valid only during the call)
+ * @param ctx Caller context
+ */
+typedef void (*ws_protocol_event_cb_t)(const ws_event_payload_t *event, void *ctx);
+
+/**
+ * @brief Where ws_protocol_parse() puts the bodies of large messages
+ *
+ * Snapshots are much larger than the other message types and batches carry
+ * up to WS_BATCH_MAX_EVENTS events, so neither is stored in ws_message_t.
+ */
+typedef struct {
+    ws_protocol_event_cb_t on_batch_event;  // Called for each event of a `batch`
+    void *ctx;                              // Passed to on_batch_event
+    game_snapshot_t *snapshot;              // Body of a `snapshot`
+} ws_protocol_sink_t;
+
 /**
  * @brief Parsed WebSocket message
  */
@@ -28,18 +67,21 @@ typedef struct {
             char client_type[32];
         } handshake;
         
-        struct {
-            game_event_type_t event_type;
-            uint32_t timestamp;
-            char message[64];
-            // TROOP_UPDATE carries JSON data; 128 bytes is too small and causes truncation.
-            char data[512];
-        } event;
+        ws_event_payload_t event;
         
         struct {
             char action[32];
             char params[128];
         } command;
+
+        struct {
+            esp_err_t status;   // ESP_ERR_INVALID_SIZE: more than WS_BATCH_MAX_EVENTS sent
+            size_t count;       // Events delivered to the sink
+        } batch;
+
+        struct {
+            esp_err_t status;   // ESP_OK if the sink's snapshot was filled in
+        } snapshot;
     } payload;
 } ws_message_t;
 
@@ -53,12 +95,20 @@ esp_err_t ws_protocol_init(void);
 /**
  * @brief Parse incoming WebSocket message
  * 
+ * The frame is parsed once. Batch events go to sink->on_batch_event, in
+ * order, reusing a single decode buffer; a snapshot is decoded into
+ * sink->snapshot. Their outcome is in msg->payload.batch/snapshot
+ * (ESP_ERR_INVALID_ARG when malformed, or when the sink has no place for
+ * them).
+ * 
  * @param json_str JSON string to parse
  * @param len Length of JSON string
  * @param msg Output parsed message structure
+ * @param sink Storage for batch and snapshot bodies (may be NULL)
  * @return ESP_OK if parsed successfully
  */
-esp_err_t ws_protocol_parse(const char *json_str, size_t len, ws_message_t *msg);
+esp_err_t ws_protocol_parse(const char *json_str, size_t len, ws_message_t *msg,
+                            const ws_protocol_sink_t *sink);
 
 /**
  * @brief Build handshake message
@@ -80,6 +130,25 @@ esp_err_t ws_protocol_build_handshake(const char *client_type, char *out_buffer,
  */
 esp_err_t ws_protocol_build_event(const game_event_t *event, char *out_buffer, size_t buffer_size);
 
+/**
+ * @brief Open a firmware command message
+ * 
+ * Writes {"type":"cmd","payload":{"action":"<action>","params":{ so the
+ * caller can add the params fields, then close it with
+ * ws_protocol_end_command().
+ * 
+ * @param w Writer positioned at the start of its buffer
+ * @param action Command action (e.g. "set-troops-percent")
+ */
+void ws_protocol_begin_command(json_writer_t *w, const char *action);
+
+/**
+ * @brief Close a command opened by ws_protocol_begin_command()
+ * 
+ * @param w Writer
+ */
+void ws_protocol_end_command(json_writer_t *w);
+
 /**
  * @brief Validate JSON message format
  * 
@@ -19,9 +19,11 @@ typedef struct {
 
 // ADC channel state tracking
 typedef struct {
-    uint16_t last_raw_value;       // Last raw ADC reading
+    uint16_t last_raw_value;       // Raw reading behind last_percent (moves by >= deadband)
     uint8_t last_percent;          // Last percentage value
     uint32_t last_read_time;       // Time of last successful read (ms)
+    uint32_t last_change_time;     // Time last_percent was first read (ms)
+    bool have_value;
 } adc_channel_state_t;
 
 // Channel configuration
@@ -37,6 +39,7 @@ static const adc_channel_config_t channel_configs[ADC_CHANNEL_COUNT] = {
 // Channel states
 static adc_channel_state_t channel_states[ADC_CHANNEL_COUNT] = {0};
 static bool initialized = false;
+static adc_change_callback_t s_change_callback = NULL;
 
 esp_err_t adc_handler_init(void) {
     if (initialized) {
@@ -58,6 +61,8 @@ esp_err_t adc_handler_init(void) {
         channel_states[i].last_raw_value = 0;
         channel_states[i].last_percent = 0;
         channel_states[i].last_read_time = 0;
+        channel_states[i].last_change_time = 0;
+        channel_states[i].have_value = false;
     }
     
     initialized = true;
@@ -87,14 +92,37 @@ esp_err_t adc_handler_scan(void) {
             continue;
         }
         
+        state->last_read_time = now;
+
+        // Ignore moves inside the deadband so noise does not look like motion
+        const int delta = (int)raw_value - (int)state->last_raw_value;
+        if (state->have_value && delta < ADC_CHANGE_DEADBAND_RAW && delta > -ADC_CHANGE_DEADBAND_RAW) {
+            continue;
+        }
+        
         // Convert to percentage (12-bit ADC: 0-4095)
         uint8_t new_percent = (raw_value * 100) / 4095;
         if (new_percent > 100) new_percent = 100;
         
-        // Update state unconditionally - modules handle change detection
+        const bool changed = !state->have_value || new_percent != state->last_percent;
         state->last_raw_value = raw_value;
         state->last_percent = new_percent;
-        state->last_read_time = now;
+        state->have_value = true;
+        if (changed) {
+            state->last_change_time = now;
+        }
+
+        // Push the change instead of waiting for the module's next poll
+        adc_change_callback_t callback = s_change_callback;
+        if (changed && callback) {
+            const adc_event_t event = {
+                .channel = config->id,
+                .raw_value = (uint16_t)raw_value,
+                .percent = new_percent,
+                .timestamp_ms = now,
+            };
+            callback(&event);
+        }
     }
     
     return ESP_OK;
@@ -111,11 +139,15 @@ esp_err_t adc_handler_get_value(adc_channel_id_t channel, adc_event_t *value) {
     value->channel = config->id;
     value->raw_value = state->last_raw_value;
     value->percent = state->last_percent;
-    value->timestamp_ms = state->last_read_time / 1000;
+    value->timestamp_ms = state->last_change_time;
     
     return ESP_OK;
 }
 
+void adc_handler_set_change_callback(adc_change_callback_t callback) {
+    s_change_callback = callback;
+}
+
 esp_err_t adc_handler_shutdown(void) {
     if (!initialized) {
         return ESP_OK;
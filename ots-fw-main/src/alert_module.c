@@ -2,6 +2,8 @@
 #include "module_io.h"
 #include "led_handler.h"
 #include "nuke_state_manager.h"
+#include "game_snapshot.h"
+#include "module_manager.h"
 #include "ots_common.h"
 #include "esp_log.h"
 #include "cJSON.h"
@@ -34,12 +36,6 @@ static esp_err_t alert_module_init(void) {
     return ESP_OK;
 }
 
-// Module update (periodic)
-static esp_err_t alert_module_update(void) {
-    // Nothing to do here - LED blinking handled by led_controller
-    return ESP_OK;
-}
-
 // Helper to update LED state based on active nuke count
 static void update_nuke_led_state(uint8_t led_index, nuke_type_t nuke_type) {
     uint8_t count = nuke_tracker_get_active_count(nuke_type, NUKE_DIR_INCOMING);
@@ -66,6 +62,43 @@ static void update_nuke_led_state(uint8_t led_index, nuke_type_t nuke_type) {
     }
 }
 
+// Track an incoming nuke and refresh its LED
+static void register_incoming_nuke(uint32_t unit_id, nuke_type_t nuke_type, uint8_t led_index) {
+    const bool was_idle = (nuke_tracker_get_total_active(NUKE_DIR_INCOMING) == 0);
+    nuke_tracker_register_launch(unit_id, nuke_type, NUKE_DIR_INCOMING);
+    update_nuke_led_state(led_index, nuke_type);
+    
+    // First nuke in flight: arm the expiry sweep
+    if (was_idle) {
+        module_manager_notify(&alert_module);
+    }
+}
+
+// Set an invasion alert LED from a snapshot count (timer-based like ALERT_LAND/NAVAL)
+static void apply_invasion_alert(uint8_t led_index, uint16_t active) {
+    if (active > 0) {
+        led_controller_alert_on(led_index, 15000);
+        led_controller_alert_on(0, 15000);  // Warning LED
+    } else {
+        led_command_t cmd = {.type = LED_TYPE_ALERT, .index = led_index, .effect = LED_EFFECT_OFF};
+        led_controller_send_command(&cmd);
+    }
+}
+
+// Module update: expire incoming nukes whose resolve event was lost
+static esp_err_t alert_module_update(void) {
+    if (nuke_tracker_expire_stale(NUKE_DIR_INCOMING) > 0) {
+        update_nuke_led_state(1, NUKE_TYPE_ATOM);
+        update_nuke_led_state(2, NUKE_TYPE_HYDRO);
+        update_nuke_led_state(3, NUKE_TYPE_MIRV);
+    }
+    return ESP_OK;
+}
+
+static uint32_t alert_module_next_wake_ms(void) {
+    return nuke_tracker_get_total_active(NUKE_DIR_INCOMING) > 0 ? NUKE_TRACKER_SWEEP_INTERVAL_MS : MODULE_WAKE_NEVER;
+}
+
 // Handle events
 static bool alert_module_handle_event(const internal_event_t *event) {
     bool handled = false;
@@ -77,8 +110,7 @@ static bool alert_module_handle_event(const internal_event_t *event) {
             ESP_LOGI(TAG, "Atom alert! (unit=%lu)", (unsigned long)unit_id);
             
             if (unit_id > 0) {
-                nuke_tracker_register_launch(unit_id, NUKE_TYPE_ATOM, NUKE_DIR_INCOMING);
-                update_nuke_led_state(1, NUKE_TYPE_ATOM);
+                register_incoming_nuke(unit_id, NUKE_TYPE_ATOM, 1);
             }
             handled = true;
             break;
@@ -89,8 +121,7 @@ static bool alert_module_handle_event(const internal_event_t *event) {
             ESP_LOGI(TAG, "Hydro alert! (unit=%lu)", (unsigned long)unit_id);
             
             if (unit_id > 0) {
-                nuke_tracker_register_launch(unit_id, NUKE_TYPE_HYDRO, NUKE_DIR_INCOMING);
-                update_nuke_led_state(2, NUKE_TYPE_HYDRO);
+                register_incoming_nuke(unit_id, NUKE_TYPE_HYDRO, 2);
             }
             handled = true;
             break;
@@ -101,8 +132,7 @@ static bool alert_module_handle_event(const internal_event_t *event) {
             ESP_LOGI(TAG, "MIRV alert! (unit=%lu)", (unsigned long)unit_id);
             
             if (unit_id > 0) {
-                nuke_tracker_register_launch(unit_id, NUKE_TYPE_MIRV, NUKE_DIR_INCOMING);
-                update_nuke_led_state(3, NUKE_TYPE_MIRV);
+                register_incoming_nuke(unit_id, NUKE_TYPE_MIRV, 3);
             }
             handled = true;
             break;
@@ -153,6 +183,25 @@ static bool alert_module_handle_event(const internal_event_t *event) {
             handled = true;
             break;
         
+        // Snapshot resync: incoming nukes are synced here, on this module's
+        // worker, so launches queued ahead of the snapshot are already in
+        case INTERNAL_EVENT_STATE_SNAPSHOT: {
+            uint16_t land = 0;
+            uint16_t naval = 0;
+            game_snapshot_sync_nukes(NUKE_DIR_INCOMING);
+            update_nuke_led_state(1, NUKE_TYPE_ATOM);
+            update_nuke_led_state(2, NUKE_TYPE_HYDRO);
+            update_nuke_led_state(3, NUKE_TYPE_MIRV);
+            if (game_snapshot_get_invasions(&land, &naval)) {
+                apply_invasion_alert(4, land);
+                apply_invasion_alert(5, naval);
+            }
+            // Re-arm (or stop) the expiry sweep for the synced set
+            module_manager_notify(&alert_module);
+            handled = true;
+            break;
+        }
+
         // WebSocket disconnect - visual feedback
         case INTERNAL_EVENT_WS_DISCONNECTED: {
             ESP_LOGW(TAG, "WebSocket disconnected - showing warning");
@@ -232,12 +281,32 @@ static esp_err_t alert_module_shutdown(void) {
     return ESP_OK;
 }
 
+// Events alert_module_handle_event() acts on
+static const game_event_type_t s_alert_events[] = {
+    GAME_EVENT_ALERT_ATOM,
+    GAME_EVENT_ALERT_HYDRO,
+    GAME_EVENT_ALERT_MIRV,
+    GAME_EVENT_ALERT_LAND,
+    GAME_EVENT_ALERT_NAVAL,
+    GAME_EVENT_NUKE_EXPLODED,
+    GAME_EVENT_NUKE_INTERCEPTED,
+    GAME_EVENT_GAME_START,
+    INTERNAL_EVENT_STATE_SNAPSHOT,
+    INTERNAL_EVENT_WS_CONNECTED,
+    INTERNAL_EVENT_WS_DISCONNECTED,
+    GAME_EVENT_GAME_END,
+    GAME_EVENT_INVALID
+};
+
 // Module definition
 hardware_module_t alert_module = {
     .name = "Alert Module",
     .enabled = true,
+    .blocking_events = true,  // LEDs over I2C
+    .event_types = s_alert_events,
     .init = alert_module_init,
     .update = alert_module_update,
+    .next_wake_ms = alert_module_next_wake_ms,
     .handle_event = alert_module_handle_event,
     .get_status = alert_module_get_status,
     .shutdown = alert_module_shutdown
@@ -0,0 +1,199 @@
+#include "boot_sequence.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+
+static const char *TAG = "OTS_BOOT";
+
+#define BOOT_TASK_STACK_SIZE 8192   // Network step sets up Wi-Fi and TLS
+
+static const boot_step_t *s_steps = NULL;
+static uint8_t s_count = 0;
+static boot_step_state_t s_state[BOOT_MAX_STEPS];
+static int64_t s_start_us[BOOT_MAX_STEPS];
+static int64_t s_end_us[BOOT_MAX_STEPS];
+static uint32_t s_failed_mask = 0;        // Required steps that failed or were skipped
+static uint8_t s_finished = 0;
+static EventGroupHandle_t s_done_bits = NULL;  // Bit i: step i finished (any outcome)
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char *state_name(boot_step_state_t state) {
+    switch (state) {
+        case BOOT_STEP_PENDING: return "pending";
+        case BOOT_STEP_RUNNING: return "running";
+        case BOOT_STEP_DONE:    return "done";
+        case BOOT_STEP_FAILED:  return "FAILED";
+        case BOOT_STEP_SKIPPED: return "skipped";
+        default:                return "?";
+    }
+}
+
+static void finish_step(uint8_t index, boot_step_state_t state) {
+    bool all_done;
+
+    taskENTER_CRITICAL(&s_lock);
+    s_state[index] = state;
+    s_end_us[index] = esp_timer_get_time();
+    if (state != BOOT_STEP_DONE && s_steps[index].required) {
+        s_failed_mask |= BOOT_DEP(index);
+    }
+    all_done = (++s_finished == s_count);
+    taskEXIT_CRITICAL(&s_lock);
+
+    xEventGroupSetBits(s_done_bits, BOOT_DEP(index));
+
+    if (all_done) {
+        boot_sequence_log_timeline();
+    }
+}
+
+static void run_step(uint8_t index) {
+    const boot_step_t *step = &s_steps[index];
+
+    s_start_us[index] = esp_timer_get_time();
+    esp_err_t ret = step->run ? step->run() : ESP_OK;
+    const uint32_t took_ms = (uint32_t)((esp_timer_get_time() - s_start_us[index]) / 1000);
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "%s ready (%lu ms)", step->name, (unsigned long)took_ms);
+    } else {
+        ESP_LOGE(TAG, "%s failed after %lu ms: %s", step->name, (unsigned long)took_ms,
+                 esp_err_to_name(ret));
+    }
+    finish_step(index, (ret == ESP_OK) ? BOOT_STEP_DONE : BOOT_STEP_FAILED);
+}
+
+static void boot_step_task(void *arg) {
+    run_step((uint8_t)(uintptr_t)arg);
+    vTaskDelete(NULL);
+}
+
+esp_err_t boot_sequence_run(const boot_step_t *steps, uint8_t count) {
+    if (!steps || count == 0 || count > BOOT_MAX_STEPS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_steps) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_done_bits = xEventGroupCreate();
+    if (!s_done_bits) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_steps = steps;
+    s_count = count;
+
+    const uint32_t all_mask = BOOT_DEP(count) - 1;
+    uint32_t foreground_mask = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (!steps[i].background) {
+            foreground_mask |= BOOT_DEP(i);
+        }
+    }
+
+    // Background steps run at the caller's priority so they share the CPU
+    // with the foreground steps instead of preempting them
+    const UBaseType_t priority = uxTaskPriorityGet(NULL);
+
+    while (true) {
+        const uint32_t finished = xEventGroupGetBits(s_done_bits) & all_mask;
+        if ((finished & foreground_mask) == foreground_mask) {
+            break;
+        }
+
+        // Launch every ready background step first, then run one ready
+        // foreground step (table order) and look again
+        bool started = false;
+        bool running = false;
+        int foreground = -1;
+        for (uint8_t i = 0; i < count; i++) {
+            if (s_state[i] == BOOT_STEP_RUNNING) {
+                running = true;
+            }
+            if (s_state[i] != BOOT_STEP_PENDING) {
+                continue;
+            }
+            const uint32_t deps = steps[i].depends_on & all_mask;
+            if ((deps & finished) != deps) {
+                continue;
+            }
+
+            if (deps & s_failed_mask) {
+                ESP_LOGW(TAG, "%s skipped (a step it needs failed)", steps[i].name);
+                s_start_us[i] = esp_timer_get_time();
+                finish_step(i, BOOT_STEP_SKIPPED);
+                started = true;
+            } else if (!steps[i].background) {
+                if (foreground < 0) {
+                    foreground = i;
+                }
+            } else {
+                s_state[i] = BOOT_STEP_RUNNING;
+                if (xTaskCreate(boot_step_task, steps[i].name, BOOT_TASK_STACK_SIZE,
+                                (void *)(uintptr_t)i, priority, NULL) != pdPASS) {
+                    ESP_LOGW(TAG, "No task for %s, running it in the foreground", steps[i].name);
+                    run_step(i);
+                }
+                started = true;
+                running = true;
+            }
+        }
+
+        if (foreground >= 0) {
+            s_state[foreground] = BOOT_STEP_RUNNING;
+            run_step((uint8_t)foreground);
+            continue;
+        }
+        if (started) {
+            continue;
+        }
+        if (!running) {
+            ESP_LOGE(TAG, "Boot steps cannot start (dependency cycle?)");
+            return ESP_ERR_INVALID_STATE;
+        }
+        // Wait for any running step to finish
+        xEventGroupWaitBits(s_done_bits, all_mask & ~finished, pdFALSE, pdFALSE, portMAX_DELAY);
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (s_failed_mask & BOOT_DEP(i) & foreground_mask) {
+            return (s_state[i] == BOOT_STEP_SKIPPED) ? ESP_ERR_INVALID_STATE : ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t boot_sequence_get_step(uint8_t index, boot_step_state_t *state,
+                                 int64_t *start_us, int64_t *end_us) {
+    if (index >= s_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (state) *state = s_state[index];
+    if (start_us) *start_us = s_start_us[index];
+    if (end_us) *end_us = (s_state[index] >= BOOT_STEP_DONE) ? s_end_us[index] : 0;
+    return ESP_OK;
+}
+
+void boot_sequence_log_timeline(void) {
+    if (!s_steps) {
+        ESP_LOGI(TAG, "Boot sequence not started");
+        return;
+    }
+
+    ESP_LOGI(TAG, "Boot timeline (ms since app start, bootloader not included):");
+    for (uint8_t i = 0; i < s_count; i++) {
+        const int64_t start_us = s_start_us[i];
+        const int64_t end_us = (s_state[i] >= BOOT_STEP_DONE) ? s_end_us[i] : esp_timer_get_time();
+        if (s_state[i] == BOOT_STEP_PENDING) {
+            ESP_LOGI(TAG, "  %-12s %-10s %-7s", s_steps[i].name,
+                     s_steps[i].background ? "background" : "foreground", state_name(s_state[i]));
+            continue;
+        }
+        ESP_LOGI(TAG, "  %-12s %-10s %-7s start=%5lu end=%5lu (%lu ms)", s_steps[i].name,
+                 s_steps[i].background ? "background" : "foreground", state_name(s_state[i]),
+                 (unsigned long)(start_us / 1000), (unsigned long)(end_us / 1000),
+                 (unsigned long)((end_us - start_us) / 1000));
+    }
+}
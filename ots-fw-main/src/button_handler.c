@@ -89,6 +89,7 @@ esp_err_t button_handler_scan(void) {
                     };
                     // Store button index in first byte of data
                     int_event.data[0] = i;
+                    event_dispatcher_stamp(&int_event);
                     event_dispatcher_post(&int_event);
                 }
                 
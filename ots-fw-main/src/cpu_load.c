@@ -0,0 +1,24 @@
+#include "cpu_load.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+esp_err_t cpu_load_get_counters(cpu_load_counters_t *out) {
+    if (!out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(out, 0, sizeof(*out));
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    out->uptime_us = esp_timer_get_time();
+    out->cores = portNUM_PROCESSORS < CPU_LOAD_MAX_CORES ? portNUM_PROCESSORS : CPU_LOAD_MAX_CORES;
+    for (uint8_t core = 0; core < out->cores; core++) {
+        TaskHandle_t idle = xTaskGetIdleTaskHandleForCore(core);
+        out->idle_us[core] = idle ? (uint32_t)ulTaskGetRunTimeCounter(idle) : 0;
+    }
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
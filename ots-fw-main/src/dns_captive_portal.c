@@ -11,91 +11,208 @@
  * - Responds to all A record queries
  * - Returns the AP IP (192.168.4.1 by default)
  * - Runs in a dedicated FreeRTOS task
+ *
+ * Phones fire a burst of connectivity-check lookups when they join the AP.
+ * The task waits in select() and then drains everything queued (up to
+ * DNS_BATCH_MAX) with non-blocking reads; replies come from templates
+ * prepared at start (see dns_responder.h). Each client is rate limited
+ * so one flooding station cannot starve the others or the AP.
+ *
+ * Each task gets its own context (buffers, limiter, stats) and owns its
+ * socket; stop() only signals it and waits for it to exit.
  */
 
 #include "dns_captive_portal.h"
+#include "dns_responder.h"
+#include "config.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "lwip/sockets.h"
 #include "lwip/inet.h"
 #include "lwip/errno.h"
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "OTS_DNS";
 
-// Default ESP-IDF softAP IP is 192.168.4.1 unless explicitly changed
-#define CAPTIVE_PORTAL_IP_A 192
-#define CAPTIVE_PORTAL_IP_B 168
-#define CAPTIVE_PORTAL_IP_C 4
-#define CAPTIVE_PORTAL_IP_D 1
 #define CAPTIVE_DNS_PORT 53
 #define DNS_TASK_STACK_SIZE 4096
 #define DNS_TASK_PRIORITY 4
+#define DNS_BATCH_MAX 16            // Packets handled per wake-up before select() again
+#define DNS_SELECT_TIMEOUT_MS 500
+#define DNS_STOP_WAIT_MS (DNS_SELECT_TIMEOUT_MS + 200)  // One select() timeout plus slack
+#define DNS_ANSWER_TTL_S 0
+#define DNS_CLIENT_BURST 24         // Covers a phone's connect-time probe burst
+#define DNS_CLIENT_PER_SEC 12
 
-static TaskHandle_t s_dns_task = NULL;
-static int s_dns_sock = -1;
-static volatile bool s_dns_running = false;
+typedef struct {
+    uint32_t queries;
+    uint32_t answered;
+    uint32_t rate_limited;
+    uint32_t ignored;       // Malformed or not a standard query
+    uint32_t batches;
+    uint32_t max_batch;
+} dns_stats_t;
+
+// Everything one DNS task works on. Allocated by start and freed by the
+// task when it exits, so a task still winding down after stop never shares
+// buffers or its socket with the one a quick restart creates.
+typedef struct {
+    volatile bool running;          // Cleared by stop
+    dns_responder_t responder;
+    dns_rate_limiter_t limiter;
+    dns_stats_t stats;
+    uint8_t rx[DNS_RESPONDER_MAX_PACKET];
+    uint8_t tx[DNS_RESPONDER_MAX_PACKET];
+} dns_task_ctx_t;
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static dns_task_ctx_t *s_ctx = NULL;    // Current task, NULL when stopped
+static uint32_t s_live_tasks = 0;       // Tasks not yet exited (including stopped ones)
 
 static void dns_task(void *arg);
 
+static uint32_t live_tasks(void) {
+    taskENTER_CRITICAL(&s_lock);
+    const uint32_t n = s_live_tasks;
+    taskEXIT_CRITICAL(&s_lock);
+    return n;
+}
+
 esp_err_t dns_captive_portal_start(void) {
-    if (s_dns_task) {
+    if (dns_captive_portal_is_running()) {
         ESP_LOGW(TAG, "Captive DNS already running");
         return ESP_OK;
     }
-    
-    s_dns_running = true;
-    
-    BaseType_t ok = xTaskCreate(dns_task, "captive_dns", DNS_TASK_STACK_SIZE, NULL, 
-                                 DNS_TASK_PRIORITY, &s_dns_task);
+
+    dns_task_ctx_t *ctx = calloc(1, sizeof(*ctx));
+    if (!ctx) {
+        ESP_LOGE(TAG, "No memory for captive DNS task");
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->running = true;
+
+    taskENTER_CRITICAL(&s_lock);
+    s_ctx = ctx;
+    s_live_tasks++;
+    taskEXIT_CRITICAL(&s_lock);
+
+    BaseType_t ok = xTaskCreate(dns_task, "captive_dns", DNS_TASK_STACK_SIZE, ctx,
+                                 DNS_TASK_PRIORITY, NULL);
     if (ok != pdPASS) {
         ESP_LOGE(TAG, "Failed to create captive DNS task");
-        s_dns_task = NULL;
-        s_dns_running = false;
+        taskENTER_CRITICAL(&s_lock);
+        s_ctx = NULL;
+        s_live_tasks--;
+        taskEXIT_CRITICAL(&s_lock);
+        free(ctx);
         return ESP_FAIL;
     }
-    
+
     ESP_LOGI(TAG, "Captive DNS task created");
     return ESP_OK;
 }
 
 void dns_captive_portal_stop(void) {
-    if (!s_dns_running) {
+    taskENTER_CRITICAL(&s_lock);
+    dns_task_ctx_t *ctx = s_ctx;
+    s_ctx = NULL;
+    if (ctx) {
+        ctx->running = false;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (!ctx) {
         return;
     }
-    
+
+    // The task closes its own socket: closing it here could pull the fd out
+    // from under select()/recvfrom() and hand the number to a new socket.
+    // It notices within one select() timeout; wait so port 53 is free again.
     ESP_LOGI(TAG, "Stopping captive DNS server");
-    s_dns_running = false;
-    
-    if (s_dns_sock >= 0) {
-        shutdown(s_dns_sock, SHUT_RDWR);
-        close(s_dns_sock);
-        s_dns_sock = -1;
+    const int64_t deadline_us = esp_timer_get_time() + (int64_t)DNS_STOP_WAIT_MS * 1000;
+    while (live_tasks() > 0 && esp_timer_get_time() < deadline_us) {
+        vTaskDelay(pdMS_TO_TICKS(10));
     }
-    
-    // Task will exit on its own
-    if (s_dns_task) {
-        s_dns_task = NULL;
+    if (live_tasks() > 0) {
+        ESP_LOGW(TAG, "Captive DNS task still exiting after %d ms", DNS_STOP_WAIT_MS);
     }
 }
 
 bool dns_captive_portal_is_running(void) {
-    return s_dns_running && s_dns_task != NULL;
+    taskENTER_CRITICAL(&s_lock);
+    const bool running = (s_ctx != NULL);
+    taskEXIT_CRITICAL(&s_lock);
+    return running;
+}
+
+static void handle_query(dns_task_ctx_t *ctx, int sock, int len, const struct sockaddr_in *from,
+                         socklen_t from_len, uint32_t now_ms) {
+    ctx->stats.queries++;
+    if (!dns_rate_limiter_allow(&ctx->limiter, from->sin_addr.s_addr, now_ms)) {
+        ctx->stats.rate_limited++;
+        return;
+    }
+
+    size_t tx_len = 0;
+    if (dns_responder_reply(&ctx->responder, ctx->rx, (size_t)len, ctx->tx, sizeof(ctx->tx),
+                            &tx_len) == DNS_REPLY_NONE) {
+        ctx->stats.ignored++;
+        return;
+    }
+    if (sendto(sock, ctx->tx, tx_len, 0, (const struct sockaddr *)from, from_len) > 0) {
+        ctx->stats.answered++;
+    }
+}
+
+// Handle everything queued on the socket, up to DNS_BATCH_MAX packets
+static void drain_socket(dns_task_ctx_t *ctx, int sock) {
+    const uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    uint32_t batch = 0;
+
+    while (batch < DNS_BATCH_MAX) {
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        const int n = recvfrom(sock, ctx->rx, sizeof(ctx->rx), MSG_DONTWAIT, (struct sockaddr *)&from,
+                               &from_len);
+        if (n <= 0) {
+            break;  // EAGAIN: queue empty
+        }
+        handle_query(ctx, sock, n, &from, from_len, now_ms);
+        batch++;
+    }
+
+    if (batch > 0) {
+        ctx->stats.batches++;
+        if (batch > ctx->stats.max_batch) {
+            ctx->stats.max_batch = batch;
+        }
+    }
+}
+
+// Drop the task's context and count it out; stop() may be waiting on that
+static void dns_task_exit(dns_task_ctx_t *ctx) {
+    taskENTER_CRITICAL(&s_lock);
+    if (s_ctx == ctx) {
+        s_ctx = NULL;   // Exiting on an error, not through stop()
+    }
+    s_live_tasks--;
+    taskEXIT_CRITICAL(&s_lock);
+    free(ctx);
+    vTaskDelete(NULL);
 }
 
 static void dns_task(void *arg) {
-    (void)arg;
+    dns_task_ctx_t *ctx = (dns_task_ctx_t *)arg;
     
     int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
     if (sock < 0) {
         ESP_LOGE(TAG, "DNS socket() failed: errno=%d", errno);
-        s_dns_running = false;
-        s_dns_task = NULL;
-        vTaskDelete(NULL);
+        dns_task_exit(ctx);
         return;
     }
-    s_dns_sock = sock;
     
     int reuse = 1;
     (void)setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
@@ -109,119 +226,40 @@ static void dns_task(void *arg) {
     if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
         ESP_LOGE(TAG, "DNS bind() failed: errno=%d", errno);
         close(sock);
-        s_dns_sock = -1;
-        s_dns_running = false;
-        s_dns_task = NULL;
-        vTaskDelete(NULL);
+        dns_task_exit(ctx);
         return;
     }
     
-    ESP_LOGI(TAG, "Captive DNS started on UDP/%u", (unsigned)CAPTIVE_DNS_PORT);
+    const uint8_t ap_ip[4] = {CAPTIVE_PORTAL_IP_A, CAPTIVE_PORTAL_IP_B, CAPTIVE_PORTAL_IP_C,
+                              CAPTIVE_PORTAL_IP_D};
+    dns_responder_init(&ctx->responder, ap_ip, DNS_ANSWER_TTL_S);
+    dns_rate_limiter_init(&ctx->limiter, DNS_CLIENT_BURST, DNS_CLIENT_PER_SEC);
     
-    // Receive buffer large enough for typical DNS queries
-    uint8_t rx[256];
-    uint8_t tx[256];
+    ESP_LOGI(TAG, "Captive DNS started on UDP/%u", (unsigned)CAPTIVE_DNS_PORT);
     
-    while (s_dns_running) {
-        struct sockaddr_in from;
-        socklen_t from_len = sizeof(from);
-        int n = recvfrom(sock, rx, sizeof(rx), 0, (struct sockaddr *)&from, &from_len);
-        if (n <= 0) {
-            // Socket closed or error; exit if we are stopping
-            if (!s_dns_running) {
-                break;
-            }
-            continue;
-        }
-        
-        // Minimal DNS parsing/response
-        // Header: 12 bytes
-        if (n < 12) {
-            continue;
-        }
-        
-        // Only handle standard queries with exactly 1 question
-        uint16_t qdcount = (uint16_t)((rx[4] << 8) | rx[5]);
-        if (qdcount != 1) {
+    while (ctx->running) {
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(sock, &readable);
+        struct timeval timeout = {
+            .tv_sec = 0,
+            .tv_usec = DNS_SELECT_TIMEOUT_MS * 1000,
+        };
+        const int ready = select(sock + 1, &readable, NULL, NULL, &timeout);
+        if (ready < 0) {
+            vTaskDelay(pdMS_TO_TICKS(10));
             continue;
         }
-        
-        // Find end of QNAME
-        int offset = 12;
-        while (offset < n && rx[offset] != 0) {
-            offset += (int)rx[offset] + 1;
+        if (ready > 0) {
+            drain_socket(ctx, sock);
         }
-        if (offset + 5 >= n) {
-            continue;
-        }
-        // offset points at 0 terminator
-        offset += 1;
-        
-        // QTYPE/QCLASS are 4 bytes
-        const int question_end = offset + 4;
-        if (question_end > n) {
-            continue;
-        }
-        
-        // Build response: header + original question + single A answer
-        memset(tx, 0, sizeof(tx));
-        // Transaction ID
-        tx[0] = rx[0];
-        tx[1] = rx[1];
-        // Flags: response, recursion not available, no error
-        tx[2] = 0x81;
-        tx[3] = 0x80;
-        // QDCOUNT = 1
-        tx[4] = 0x00;
-        tx[5] = 0x01;
-        // ANCOUNT = 1
-        tx[6] = 0x00;
-        tx[7] = 0x01;
-        // NSCOUNT/ARCOUNT = 0
-        tx[8] = 0x00;
-        tx[9] = 0x00;
-        tx[10] = 0x00;
-        tx[11] = 0x00;
-        
-        int tx_len = 12;
-        const int q_len = question_end - 12;
-        if (tx_len + q_len + 16 > (int)sizeof(tx)) {
-            continue;
-        }
-        memcpy(&tx[tx_len], &rx[12], (size_t)q_len);
-        tx_len += q_len;
-        
-        // Answer section
-        // NAME: pointer to 0x0c (start of QNAME)
-        tx[tx_len++] = 0xC0;
-        tx[tx_len++] = 0x0C;
-        // TYPE: A
-        tx[tx_len++] = 0x00;
-        tx[tx_len++] = 0x01;
-        // CLASS: IN
-        tx[tx_len++] = 0x00;
-        tx[tx_len++] = 0x01;
-        // TTL: 0
-        tx[tx_len++] = 0x00;
-        tx[tx_len++] = 0x00;
-        tx[tx_len++] = 0x00;
-        tx[tx_len++] = 0x00;
-        // RDLENGTH: 4
-        tx[tx_len++] = 0x00;
-        tx[tx_len++] = 0x04;
-        // RDATA: AP IP
-        tx[tx_len++] = CAPTIVE_PORTAL_IP_A;
-        tx[tx_len++] = CAPTIVE_PORTAL_IP_B;
-        tx[tx_len++] = CAPTIVE_PORTAL_IP_C;
-        tx[tx_len++] = CAPTIVE_PORTAL_IP_D;
-        
-        // Send response
-        (void)sendto(sock, tx, (size_t)tx_len, 0, (struct sockaddr *)&from, from_len);
     }
     
-    ESP_LOGI(TAG, "Captive DNS task exiting");
+    ESP_LOGI(TAG, "Captive DNS task exiting (%lu queries, %lu answered, %lu rate limited, %lu ignored, "
+             "%lu batches, max %lu)",
+             (unsigned long)ctx->stats.queries, (unsigned long)ctx->stats.answered,
+             (unsigned long)ctx->stats.rate_limited, (unsigned long)ctx->stats.ignored,
+             (unsigned long)ctx->stats.batches, (unsigned long)ctx->stats.max_batch);
     close(sock);
-    s_dns_sock = -1;
-    s_dns_task = NULL;
-    vTaskDelete(NULL);
+    dns_task_exit(ctx);
 }
@@ -0,0 +1,128 @@
+#include "dns_responder.h"
+#include <string.h>
+
+#define DNS_HEADER_LEN 12
+#define DNS_QTYPE_A 1
+#define DNS_QTYPE_ANY 255
+#define DNS_MAX_LABEL 63
+// Refill is capped so elapsed_ms * per_sec cannot overflow
+#define DNS_RATE_MAX_ELAPSED_MS 60000
+
+static void fill_header(uint8_t *h, uint8_t ancount) {
+    h[0] = 0x81;        // Response, recursion desired
+    h[1] = 0x80;        // Recursion available, no error
+    h[2] = 0x00;        // QDCOUNT = 1
+    h[3] = 0x01;
+    h[4] = 0x00;        // ANCOUNT
+    h[5] = ancount;
+    memset(&h[6], 0, 4);    // NSCOUNT/ARCOUNT = 0
+}
+
+void dns_responder_init(dns_responder_t *r, const uint8_t ip[4], uint32_t ttl_s) {
+    fill_header(r->header, 1);
+    fill_header(r->header_empty, 0);
+
+    uint8_t *a = r->answer;
+    a[0] = 0xC0;        // NAME: pointer to the QNAME at offset 12
+    a[1] = 0x0C;
+    a[2] = 0x00;        // TYPE: A
+    a[3] = DNS_QTYPE_A;
+    a[4] = 0x00;        // CLASS: IN
+    a[5] = 0x01;
+    a[6] = (uint8_t)(ttl_s >> 24);
+    a[7] = (uint8_t)(ttl_s >> 16);
+    a[8] = (uint8_t)(ttl_s >> 8);
+    a[9] = (uint8_t)ttl_s;
+    a[10] = 0x00;       // RDLENGTH: 4
+    a[11] = 0x04;
+    memcpy(&a[12], ip, 4);
+}
+
+dns_reply_t dns_responder_reply(const dns_responder_t *r, const uint8_t *query, size_t len,
+                                uint8_t *out, size_t out_size, size_t *out_len) {
+    if (len < DNS_HEADER_LEN) {
+        return DNS_REPLY_NONE;
+    }
+    // Queries only (QR = 0), standard opcode, exactly one question
+    if ((query[2] & 0xF8) != 0 || query[4] != 0 || query[5] != 1) {
+        return DNS_REPLY_NONE;
+    }
+
+    size_t offset = DNS_HEADER_LEN;
+    while (offset < len && query[offset] != 0) {
+        if (query[offset] > DNS_MAX_LABEL) {
+            return DNS_REPLY_NONE;  // Compression pointers have no place in a question
+        }
+        offset += (size_t)query[offset] + 1;
+    }
+    // Terminating zero, then QTYPE/QCLASS
+    const size_t question_end = offset + 5;
+    if (question_end > len) {
+        return DNS_REPLY_NONE;
+    }
+    const uint16_t qtype = (uint16_t)((query[offset + 1] << 8) | query[offset + 2]);
+    const bool address = (qtype == DNS_QTYPE_A || qtype == DNS_QTYPE_ANY);
+
+    const size_t reply_len = question_end + (address ? DNS_RESPONDER_ANSWER_LEN : 0);
+    if (reply_len > out_size) {
+        return DNS_REPLY_NONE;
+    }
+
+    // Copy ID + question as received; anything after the question (EDNS) is dropped
+    out[0] = query[0];
+    out[1] = query[1];
+    memcpy(&out[2], address ? r->header : r->header_empty, sizeof(r->header));
+    memcpy(&out[DNS_HEADER_LEN], &query[DNS_HEADER_LEN], question_end - DNS_HEADER_LEN);
+    if (address) {
+        memcpy(&out[question_end], r->answer, DNS_RESPONDER_ANSWER_LEN);
+    }
+    *out_len = reply_len;
+    return address ? DNS_REPLY_ADDRESS : DNS_REPLY_EMPTY;
+}
+
+void dns_rate_limiter_init(dns_rate_limiter_t *rl, uint32_t burst, uint32_t per_sec) {
+    memset(rl, 0, sizeof(*rl));
+    rl->burst = burst ? burst : 1;
+    rl->per_sec = per_sec;
+}
+
+static dns_rate_client_t *find_client(dns_rate_limiter_t *rl, uint32_t addr, uint32_t now_ms) {
+    dns_rate_client_t *slot = NULL;
+    for (int i = 0; i < DNS_RATE_LIMIT_CLIENTS; i++) {
+        dns_rate_client_t *c = &rl->clients[i];
+        if (c->addr == addr) {
+            return c;
+        }
+        if (!slot || (slot->addr != 0 && (c->addr == 0 || now_ms - c->last_ms > now_ms - slot->last_ms))) {
+            slot = c;
+        }
+    }
+
+    slot->addr = addr;
+    slot->tokens_milli = rl->burst * 1000;
+    slot->last_ms = now_ms;
+    return slot;
+}
+
+bool dns_rate_limiter_allow(dns_rate_limiter_t *rl, uint32_t addr, uint32_t now_ms) {
+    dns_rate_client_t *c = find_client(rl, addr, now_ms);
+
+    uint32_t elapsed = now_ms - c->last_ms;
+    if (elapsed > DNS_RATE_MAX_ELAPSED_MS) {
+        elapsed = DNS_RATE_MAX_ELAPSED_MS;
+    }
+    c->last_ms = now_ms;
+
+    const uint32_t cap = rl->burst * 1000;
+    // per_sec tokens per 1000 ms = per_sec thousandths per ms
+    c->tokens_milli += elapsed * rl->per_sec;
+    if (c->tokens_milli > cap) {
+        c->tokens_milli = cap;
+    }
+
+    if (c->tokens_milli < 1000) {
+        return false;
+    }
+    c->tokens_milli -= 1000;
+    return true;
+}
@@ -1,10 +1,12 @@
 #include "event_dispatcher.h"
+#include "game_snapshot.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "esp_timer.h"
 #include <string.h>
+#include <stdio.h>
 
 static const char *TAG = "OTS_EVENTS";
 
@@ -13,28 +15,94 @@ static const char *TAG = "OTS_EVENTS";
 #define EVENT_TASK_PRIORITY 5
 #define MAX_HANDLERS_PER_TYPE 8
 #define MAX_EVENT_TYPES 32
+#define MAX_HANDLER_STATS 16
+#define NO_SLOT 0xFF
+#define EVENT_TYPE_COUNT (GAME_EVENT_INVALID + 1)   // Out-of-range types count as INVALID
+
+// Blocking handlers run on a small worker pool. Each has its own queue so a
+// slow one only backs up itself; a handler always runs on the same worker,
+// which keeps its events in order.
+#define EVENT_WORKER_COUNT 2
+#define EVENT_WORKER_STACK_SIZE 4096
+#define EVENT_WORKER_PRIORITY (EVENT_TASK_PRIORITY - 1)
+#define MAX_DEFERRED_HANDLERS 6
+// Holds a nuke burst (nuke_burst_bench.py sends 18 back to back); a full
+// queue makes the dispatcher wait for the worker rather than drop
+#define DEFERRED_QUEUE_SIZE 20
+
+// Watchdog: a handler call longer than its budget is counted (and logged at
+// most every EVENT_BUDGET_WARN_INTERVAL_MS); one still running after
+// EVENT_STALL_MS is reported while it runs.
+#define EVENT_FAST_BUDGET_US 2000
+#define EVENT_BLOCKING_BUDGET_US 50000
+#define EVENT_BUDGET_WARN_INTERVAL_MS 5000
+#define EVENT_WATCHDOG_PERIOD_MS 100
+#define EVENT_STALL_MS 250
+
+typedef struct {
+    event_handler_t handler;
+    uint8_t stats_slot;     // Index into handler_stats
+    uint8_t deferred;       // Index into deferred_handlers, NO_SLOT for fast handlers
+} registered_handler_t;
 
 typedef struct {
     game_event_type_t event_type;
-    event_handler_t handlers[MAX_HANDLERS_PER_TYPE];
+    registered_handler_t handlers[MAX_HANDLERS_PER_TYPE];
     uint8_t handler_count;
 } event_handler_list_t;
 
+typedef struct {
+    event_handler_t handler;
+    uint8_t stats_slot;
+    uint8_t worker;
+    QueueHandle_t queue;    // Events waiting for this handler
+} deferred_handler_t;
+
+// What a dispatcher/worker task is running, read by the watchdog timer
+typedef struct {
+    volatile uint8_t stats_slot;    // NO_SLOT when idle
+    volatile uint32_t start_us;
+    bool stall_reported;
+} exec_context_t;
+
+#define EXEC_DISPATCHER 0           // exec_contexts[0]; workers follow
+
 static QueueHandle_t event_queue = NULL;
 static TaskHandle_t event_task_handle = NULL;
 static bool is_running = false;
+static volatile uint32_t dropped_count = 0;
 
 // Handler registry
 static event_handler_list_t handler_registry[MAX_EVENT_TYPES];
 static uint8_t registry_count = 0;
 
 // Wildcard handlers (for all events)
-static event_handler_t wildcard_handlers[MAX_HANDLERS_PER_TYPE];
+static registered_handler_t wildcard_handlers[MAX_HANDLERS_PER_TYPE];
 static uint8_t wildcard_count = 0;
 
+// Blocking handlers and the worker pool (created on first use)
+static deferred_handler_t deferred_handlers[MAX_DEFERRED_HANDLERS];
+static uint8_t deferred_count = 0;
+static QueueHandle_t worker_queues[EVENT_WORKER_COUNT];    // deferred_handlers indices, in event order
+static exec_context_t exec_contexts[1 + EVENT_WORKER_COUNT];
+static esp_timer_handle_t watchdog_timer = NULL;
+
+// Always-on statistics, updated without locks from the posting tasks: a rare
+// lost count under contention is acceptable for telemetry.
+const uint32_t event_handler_hist_bounds_us[EVENT_HANDLER_HIST_BUCKETS - 1] = {10, 100, 1000, 10000};
+const uint32_t event_latency_hist_bounds_us[EVENT_HANDLER_HIST_BUCKETS - 1] = {100, 1000, 10000, 100000};
+static event_type_stats_t type_stats[EVENT_TYPE_COUNT];
+static event_handler_stats_t handler_stats[MAX_HANDLER_STATS];
+static uint32_t handler_budget_warned_ms[MAX_HANDLER_STATS];
+static uint8_t handler_stats_count = 0;
+static volatile uint32_t queue_high_water = 0;
+static event_latency_stats_t latency_stats;
+
 // Forward declarations
 static void event_dispatcher_task(void *pvParameters);
 static void dispatch_event_to_handlers(const internal_event_t *event);
+static void event_worker_task(void *pvParameters);
+static void watchdog_check(void *arg);
 
 esp_err_t event_dispatcher_init(void) {
     ESP_LOGI(TAG, "Initializing event dispatcher...");
@@ -56,6 +124,22 @@ esp_err_t event_dispatcher_init(void) {
     memset(wildcard_handlers, 0, sizeof(wildcard_handlers));
     registry_count = 0;
     wildcard_count = 0;
+    memset(handler_stats, 0, sizeof(handler_stats));
+    handler_stats_count = 0;
+    event_dispatcher_reset_stats();
+    for (int i = 0; i < 1 + EVENT_WORKER_COUNT; i++) {
+        exec_contexts[i].stats_slot = NO_SLOT;
+    }
+
+    const esp_timer_create_args_t watchdog_args = {
+        .callback = watchdog_check,
+        .name = "evt_wdog",
+    };
+    if (esp_timer_create(&watchdog_args, &watchdog_timer) == ESP_OK) {
+        esp_timer_start_periodic(watchdog_timer, EVENT_WATCHDOG_PERIOD_MS * 1000ULL);
+    } else {
+        ESP_LOGW(TAG, "Failed to create handler watchdog timer");
+    }
     
     // Mark running *before* creating the task.
     // Otherwise the task can start immediately, see is_running==false, and exit.
@@ -83,10 +167,97 @@ esp_err_t event_dispatcher_init(void) {
     return ESP_OK;
 }
 
+// One statistics slot per handler function, shared by all its event types
+static uint8_t stats_slot_for(event_handler_t handler, const char *name) {
+    for (uint8_t i = 0; i < handler_stats_count; i++) {
+        if (handler_stats[i].handler == handler) {
+            if (name && !handler_stats[i].name) {
+                handler_stats[i].name = name;
+            }
+            return i;
+        }
+    }
+    if (handler_stats_count >= MAX_HANDLER_STATS) {
+        ESP_LOGW(TAG, "Handler stats full; %s not timed", name ? name : "handler");
+        return NO_SLOT;
+    }
+    handler_stats[handler_stats_count].handler = handler;
+    handler_stats[handler_stats_count].name = name;
+    return handler_stats_count++;
+}
+
+// Per-handler queue on a worker; workers are started with the first one
+static esp_err_t add_deferred_handler(event_handler_t handler, uint8_t stats_slot, uint8_t *out_index) {
+    for (uint8_t i = 0; i < deferred_count; i++) {
+        if (deferred_handlers[i].handler == handler) {
+            *out_index = i;  // Same handler for another event type: same queue
+            return ESP_OK;
+        }
+    }
+    if (deferred_count >= MAX_DEFERRED_HANDLERS) {
+        ESP_LOGE(TAG, "Too many blocking handlers");
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (!worker_queues[0]) {
+        for (int w = 0; w < EVENT_WORKER_COUNT; w++) {
+            // One entry per event any of its handlers can hold: never full
+            worker_queues[w] = xQueueCreate(MAX_DEFERRED_HANDLERS * DEFERRED_QUEUE_SIZE, sizeof(uint8_t));
+            char name[12];
+            snprintf(name, sizeof(name), "evt_work%d", w);
+            if (!worker_queues[w] ||
+                xTaskCreate(event_worker_task, name, EVENT_WORKER_STACK_SIZE, (void *)(intptr_t)w,
+                            EVENT_WORKER_PRIORITY, NULL) != pdPASS) {
+                ESP_LOGE(TAG, "Failed to start event worker %d", w);
+                return ESP_FAIL;
+            }
+        }
+    }
+
+    deferred_handler_t *dh = &deferred_handlers[deferred_count];
+    dh->queue = xQueueCreate(DEFERRED_QUEUE_SIZE, sizeof(internal_event_t));
+    if (!dh->queue) {
+        ESP_LOGE(TAG, "Failed to create handler queue");
+        return ESP_ERR_NO_MEM;
+    }
+    dh->handler = handler;
+    dh->stats_slot = stats_slot;
+    dh->worker = deferred_count % EVENT_WORKER_COUNT;
+    *out_index = deferred_count++;
+    return ESP_OK;
+}
+
 esp_err_t event_dispatcher_register(game_event_type_t event_type, event_handler_t handler) {
+    return event_dispatcher_register_ex(event_type, handler, NULL, EVENT_HANDLER_FAST);
+}
+
+esp_err_t event_dispatcher_register_named(game_event_type_t event_type, event_handler_t handler,
+                                          const char *name) {
+    return event_dispatcher_register_ex(event_type, handler, name, EVENT_HANDLER_FAST);
+}
+
+esp_err_t event_dispatcher_register_ex(game_event_type_t event_type, event_handler_t handler,
+                                       const char *name, event_handler_mode_t mode) {
     if (!handler) {
         return ESP_ERR_INVALID_ARG;
     }
+
+    registered_handler_t entry = {
+        .handler = handler,
+        .stats_slot = stats_slot_for(handler, name),
+        .deferred = NO_SLOT,
+    };
+#if EVENT_DISPATCHER_DEFER_BLOCKING
+    if (mode == EVENT_HANDLER_BLOCKING) {
+        esp_err_t ret = add_deferred_handler(handler, entry.stats_slot, &entry.deferred);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+#endif
+    if (entry.stats_slot != NO_SLOT) {
+        handler_stats[entry.stats_slot].blocking = (mode == EVENT_HANDLER_BLOCKING);
+    }
     
     // Handle wildcard registration (all events)
     if (event_type == GAME_EVENT_INVALID) {
@@ -94,8 +265,11 @@ esp_err_t event_dispatcher_register(game_event_type_t event_type, event_handler_
             ESP_LOGE(TAG, "Too many wildcard handlers");
             return ESP_ERR_NO_MEM;
         }
-        wildcard_handlers[wildcard_count++] = handler;
-        ESP_LOGI(TAG, "Registered wildcard handler");
+        // Handlers may be added while events are dispatched: entry before count
+        wildcard_handlers[wildcard_count] = entry;
+        wildcard_count++;
+        ESP_LOGI(TAG, "Registered wildcard handler %s%s", name ? name : "",
+                 (entry.deferred != NO_SLOT) ? " (blocking, on a worker)" : "");
         return ESP_OK;
     }
     
@@ -125,7 +299,8 @@ esp_err_t event_dispatcher_register(game_event_type_t event_type, event_handler_
         return ESP_ERR_NO_MEM;
     }
     
-    list->handlers[list->handler_count++] = handler;
+    list->handlers[list->handler_count] = entry;
+    list->handler_count++;
     ESP_LOGD(TAG, "Registered handler for event type %d", event_type);
     return ESP_OK;
 }
@@ -138,7 +313,7 @@ esp_err_t event_dispatcher_unregister(game_event_type_t event_type, event_handle
     // Handle wildcard unregistration
     if (event_type == GAME_EVENT_INVALID) {
         for (int i = 0; i < wildcard_count; i++) {
-            if (wildcard_handlers[i] == handler) {
+            if (wildcard_handlers[i].handler == handler) {
                 // Shift remaining handlers
                 for (int j = i; j < wildcard_count - 1; j++) {
                     wildcard_handlers[j] = wildcard_handlers[j + 1];
@@ -157,7 +332,7 @@ esp_err_t event_dispatcher_unregister(game_event_type_t event_type, event_handle
             
             // Find and remove handler
             for (int j = 0; j < list->handler_count; j++) {
-                if (list->handlers[j] == handler) {
+                if (list->handlers[j].handler == handler) {
                     // Shift remaining handlers
                     for (int k = j; k < list->handler_count - 1; k++) {
                         list->handlers[k] = list->handlers[k + 1];
@@ -172,6 +347,18 @@ esp_err_t event_dispatcher_unregister(game_event_type_t event_type, event_handle
     return ESP_ERR_NOT_FOUND;
 }
 
+static inline event_type_stats_t *stats_of(game_event_type_t type) {
+    return &type_stats[((unsigned)type < EVENT_TYPE_COUNT) ? (unsigned)type : GAME_EVENT_INVALID];
+}
+
+static inline void note_queued(game_event_type_t type) {
+    stats_of(type)->posted++;
+    const uint32_t depth = (uint32_t)uxQueueMessagesWaiting(event_queue);
+    if (depth > queue_high_water) {
+        queue_high_water = depth;
+    }
+}
+
 esp_err_t event_dispatcher_post(const internal_event_t *event) {
     if (!event || !event_queue) {
         return ESP_ERR_INVALID_ARG;
@@ -183,6 +370,8 @@ esp_err_t event_dispatcher_post(const internal_event_t *event) {
         const bool is_low_priority = (event->type == GAME_EVENT_INFO || event->type == GAME_EVENT_TROOP_UPDATE);
         if (is_low_priority) {
             ESP_LOGD(TAG, "Event queue full, dropping low-priority event type %d", event->type);
+            stats_of(event->type)->dropped++;
+            dropped_count++;
             return ESP_ERR_NO_MEM;
         }
 
@@ -192,26 +381,69 @@ esp_err_t event_dispatcher_post(const internal_event_t *event) {
             event->type == GAME_EVENT_GAME_END ||
             event->type == INTERNAL_EVENT_WS_CONNECTED ||
             event->type == INTERNAL_EVENT_WS_DISCONNECTED ||
-            event->type == INTERNAL_EVENT_WS_ERROR
+            event->type == INTERNAL_EVENT_WS_ERROR ||
+            event->type == INTERNAL_EVENT_STATE_SNAPSHOT
         );
 
         if (is_critical) {
             internal_event_t dropped = {0};
             if (xQueueReceive(event_queue, &dropped, 0) == pdTRUE) {
+                if (dropped.type == INTERNAL_EVENT_STATE_SNAPSHOT) {
+                    // Otherwise submit keeps waiting for an event that never comes
+                    game_snapshot_evicted();
+                }
+                stats_of(dropped.type)->dropped++;
+                dropped_count++;
                 ESP_LOGW(TAG, "Event queue full; dropped type %d to enqueue critical type %d", dropped.type, event->type);
                 if (xQueueSend(event_queue, event, 0) == pdTRUE) {
+                    note_queued(event->type);
                     return ESP_OK;
                 }
             }
         }
 
         ESP_LOGW(TAG, "Event queue full, dropping event type %d", event->type);
+        stats_of(event->type)->dropped++;
+        dropped_count++;
         return ESP_ERR_NO_MEM;
     }
     
+    note_queued(event->type);
     return ESP_OK;
 }
 
+esp_err_t event_dispatcher_post_batch(const internal_event_t *events, size_t count, size_t *out_posted) {
+    if (out_posted) {
+        *out_posted = 0;
+    }
+    if (!events || !event_queue) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    size_t posted = 0;
+    const UBaseType_t spaces = uxQueueSpacesAvailable(event_queue);
+
+    for (size_t i = 0; i < count; i++) {
+        if (i < spaces && xQueueSend(event_queue, &events[i], 0) == pdTRUE) {
+            note_queued(events[i].type);
+            posted++;
+            continue;
+        }
+        // Out of room (or another producer took it): per-event overflow policy
+        if (event_dispatcher_post(&events[i]) == ESP_OK) {
+            posted++;
+        } else {
+            ret = ESP_ERR_NO_MEM;
+        }
+    }
+
+    if (out_posted) {
+        *out_posted = posted;
+    }
+    return ret;
+}
+
 esp_err_t event_dispatcher_post_simple(game_event_type_t type, event_source_t source) {
     internal_event_t event = {
         .type = type,
@@ -220,10 +452,15 @@ esp_err_t event_dispatcher_post_simple(game_event_type_t type, event_source_t so
         .data = {0},
         .message = {0}
     };
+    event_dispatcher_stamp(&event);
     
     return event_dispatcher_post(&event);
 }
 
+void event_dispatcher_note_coalesced(game_event_type_t type) {
+    stats_of(type)->coalesced++;
+}
+
 esp_err_t event_dispatcher_post_game_event(const game_event_t *game_event, event_source_t source) {
     if (!game_event) {
         return ESP_ERR_INVALID_ARG;
@@ -237,6 +474,7 @@ esp_err_t event_dispatcher_post_game_event(const game_event_t *game_event, event
     
     strncpy(event.message, game_event->message, sizeof(event.message) - 1);
     strncpy(event.data, game_event->data, sizeof(event.data) - 1);
+    event_dispatcher_stamp(&event);
     
     return event_dispatcher_post(&event);
 }
@@ -249,12 +487,197 @@ bool event_dispatcher_is_running(void) {
     return is_running;
 }
 
+uint32_t event_dispatcher_get_dropped_count(void) {
+    return dropped_count;
+}
+
+esp_err_t event_dispatcher_get_type_stats(game_event_type_t type, event_type_stats_t *out_stats) {
+    if (!out_stats || (unsigned)type >= EVENT_TYPE_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_stats = type_stats[type];
+    return ESP_OK;
+}
+
+uint8_t event_dispatcher_get_handler_count(void) {
+    return handler_stats_count;
+}
+
+esp_err_t event_dispatcher_get_handler_stats(uint8_t index, event_handler_stats_t *out_stats) {
+    if (!out_stats || index >= handler_stats_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_stats = handler_stats[index];
+    return ESP_OK;
+}
+
+void event_dispatcher_get_queue_stats(event_queue_stats_t *out_stats) {
+    if (!out_stats) {
+        return;
+    }
+    out_stats->size = EVENT_QUEUE_SIZE;
+    out_stats->depth = event_queue ? (uint32_t)uxQueueMessagesWaiting(event_queue) : 0;
+    out_stats->high_water = queue_high_water;
+}
+
+void event_dispatcher_get_latency_stats(event_latency_stats_t *out_stats) {
+    if (out_stats) {
+        *out_stats = latency_stats;
+    }
+}
+
+void event_dispatcher_reset_stats(void) {
+    memset(type_stats, 0, sizeof(type_stats));
+    for (uint8_t i = 0; i < handler_stats_count; i++) {
+        event_handler_stats_t *st = &handler_stats[i];
+        const event_handler_stats_t keep = {
+            .name = st->name,
+            .handler = st->handler,
+            .blocking = st->blocking,
+        };
+        *st = keep;
+    }
+    queue_high_water = 0;
+    memset(&latency_stats, 0, sizeof(latency_stats));
+}
+
+void event_dispatcher_log_stats(void) {
+    event_queue_stats_t q;
+    event_dispatcher_get_queue_stats(&q);
+    ESP_LOGI(TAG, "Event queue: depth=%lu high-water=%lu/%lu dropped(total)=%lu",
+             (unsigned long)q.depth, (unsigned long)q.high_water, (unsigned long)q.size,
+             (unsigned long)dropped_count);
+    const event_latency_stats_t *lat = &latency_stats;
+    ESP_LOGI(TAG, "Dispatch latency (post -> fast handlers done): n=%lu avg=%luus max=%luus <100us=%lu <1ms=%lu <10ms=%lu <100ms=%lu >=100ms=%lu",
+             (unsigned long)lat->count, lat->count ? (unsigned long)(lat->total_us / lat->count) : 0UL,
+             (unsigned long)lat->max_us,
+             (unsigned long)lat->hist[0], (unsigned long)lat->hist[1], (unsigned long)lat->hist[2],
+             (unsigned long)lat->hist[3], (unsigned long)lat->hist[4]);
+
+    for (unsigned t = 0; t < EVENT_TYPE_COUNT; t++) {
+        const event_type_stats_t *st = &type_stats[t];
+        if (st->posted == 0 && st->coalesced == 0 && st->dropped == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "  %-26s posted=%lu coalesced=%lu dropped=%lu dispatched=%lu",
+                 event_type_to_string((game_event_type_t)t),
+                 (unsigned long)st->posted, (unsigned long)st->coalesced,
+                 (unsigned long)st->dropped, (unsigned long)st->dispatched);
+    }
+
+    for (uint8_t i = 0; i < handler_stats_count; i++) {
+        const event_handler_stats_t *st = &handler_stats[i];
+        const uint32_t avg = st->calls ? (uint32_t)(st->total_us / st->calls) : 0;
+        ESP_LOGI(TAG, "  handler %-14s %s calls=%lu avg=%luus max=%luus <10us=%lu <100us=%lu <1ms=%lu <10ms=%lu >=10ms=%lu",
+                 st->name ? st->name : "(unnamed)", st->blocking ? "blocking" : "fast    ",
+                 (unsigned long)st->calls, (unsigned long)avg, (unsigned long)st->max_us,
+                 (unsigned long)st->hist[0], (unsigned long)st->hist[1], (unsigned long)st->hist[2],
+                 (unsigned long)st->hist[3], (unsigned long)st->hist[4]);
+        if (st->over_budget || st->stalls || st->deferred_dropped || st->lag_max_us) {
+            ESP_LOGI(TAG, "          over-budget=%lu stalls=%lu queue-dropped=%lu lag avg=%luus max=%luus",
+                     (unsigned long)st->over_budget, (unsigned long)st->stalls,
+                     (unsigned long)st->deferred_dropped,
+                     st->calls ? (unsigned long)(st->lag_total_us / st->calls) : 0UL,
+                     (unsigned long)st->lag_max_us);
+        }
+    }
+}
+
+static int hist_bucket(uint32_t value_us, const uint32_t *bounds_us) {
+    int bucket = 0;
+    while (bucket < EVENT_HANDLER_HIST_BUCKETS - 1 && value_us >= bounds_us[bucket]) {
+        bucket++;
+    }
+    return bucket;
+}
+
+static uint32_t since_queued_us(const internal_event_t *event) {
+    return (uint32_t)esp_timer_get_time() - event->queued_us;
+}
+
+static bool call_handler(event_handler_t handler, uint8_t slot, const internal_event_t *event,
+                         exec_context_t *ctx) {
+    const uint32_t start_us = (uint32_t)esp_timer_get_time();
+    ctx->start_us = start_us;
+    ctx->stall_reported = false;
+    ctx->stats_slot = slot;
+    const bool handled = handler(event);
+    ctx->stats_slot = NO_SLOT;
+    if (slot == NO_SLOT) {
+        return handled;
+    }
+
+    const uint32_t elapsed_us = (uint32_t)esp_timer_get_time() - start_us;
+    event_handler_stats_t *st = &handler_stats[slot];
+    st->calls++;
+    st->total_us += elapsed_us;
+    if (elapsed_us > st->max_us) {
+        st->max_us = elapsed_us;
+    }
+    st->hist[hist_bucket(elapsed_us, event_handler_hist_bounds_us)]++;
+
+    const uint32_t budget_us = st->blocking ? EVENT_BLOCKING_BUDGET_US : EVENT_FAST_BUDGET_US;
+    if (elapsed_us > budget_us) {
+        st->over_budget++;
+        const uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+        if (now_ms - handler_budget_warned_ms[slot] >= EVENT_BUDGET_WARN_INTERVAL_MS) {
+            handler_budget_warned_ms[slot] = now_ms;
+            ESP_LOGW(TAG, "Handler %s took %luus for event type %d (budget %luus, %lu over so far)",
+                     st->name ? st->name : "(unnamed)", (unsigned long)elapsed_us, event->type,
+                     (unsigned long)budget_us, (unsigned long)st->over_budget);
+        }
+    }
+    return handled;
+}
+
+// Hand an event to a blocking handler's worker. When its queue is full the
+// dispatcher waits for the worker to take one (running the handler here
+// instead would race with the worker and reorder its events); only a worker
+// stuck past EVENT_STALL_MS costs the event
+static void defer_event(uint8_t index, const internal_event_t *event) {
+    deferred_handler_t *dh = &deferred_handlers[index];
+    if (xQueueSend(dh->queue, event, pdMS_TO_TICKS(EVENT_STALL_MS)) != pdTRUE) {
+        if (dh->stats_slot != NO_SLOT) {
+            handler_stats[dh->stats_slot].deferred_dropped++;
+        }
+        ESP_LOGW(TAG, "Handler queue full for %d ms, %s misses event type %d", EVENT_STALL_MS,
+                 (dh->stats_slot != NO_SLOT && handler_stats[dh->stats_slot].name)
+                     ? handler_stats[dh->stats_slot].name : "handler",
+                 event->type);
+        return;
+    }
+    xQueueSend(worker_queues[dh->worker], &index, 0);
+}
+
+static bool run_handler(const registered_handler_t *entry, const internal_event_t *event) {
+    if (entry->deferred != NO_SLOT) {
+        defer_event(entry->deferred, event);
+        return false;
+    }
+    return call_handler(entry->handler, entry->stats_slot, event, &exec_contexts[EXEC_DISPATCHER]);
+}
+
+static void record_latency(const internal_event_t *event) {
+    if (event->queued_us == 0) {
+        return;  // Not stamped by its producer
+    }
+    const uint32_t latency_us = since_queued_us(event);
+    event_latency_stats_t *lat = &latency_stats;
+    lat->count++;
+    lat->total_us += latency_us;
+    if (latency_us > lat->max_us) {
+        lat->max_us = latency_us;
+    }
+    lat->hist[hist_bucket(latency_us, event_latency_hist_bounds_us)]++;
+}
+
 static void dispatch_event_to_handlers(const internal_event_t *event) {
     bool handled = false;
+    stats_of(event->type)->dispatched++;
     
     // Call wildcard handlers first
     for (int i = 0; i < wildcard_count; i++) {
-        if (wildcard_handlers[i](event)) {
+        if (run_handler(&wildcard_handlers[i], event)) {
             handled = true;
         }
     }
@@ -264,19 +687,71 @@ static void dispatch_event_to_handlers(const internal_event_t *event) {
         if (handler_registry[i].event_type == event->type) {
             event_handler_list_t *list = &handler_registry[i];
             for (int j = 0; j < list->handler_count; j++) {
-                if (list->handlers[j](event)) {
+                if (run_handler(&list->handlers[j], event)) {
                     handled = true;
                 }
             }
             break;
         }
     }
+    record_latency(event);
     
     if (!handled) {
         ESP_LOGD(TAG, "Event type %d not handled by any registered handlers", event->type);
     }
 }
 
+static void event_worker_task(void *pvParameters) {
+    const int worker = (int)(intptr_t)pvParameters;
+    exec_context_t *ctx = &exec_contexts[1 + worker];
+    internal_event_t event;
+    uint8_t index;
+
+    while (is_running) {
+        if (xQueueReceive(worker_queues[worker], &index, pdMS_TO_TICKS(100)) != pdTRUE) {
+            continue;
+        }
+        // One token per queued event, pushed after the event itself
+        deferred_handler_t *dh = &deferred_handlers[index];
+        if (xQueueReceive(dh->queue, &event, 0) != pdTRUE) {
+            continue;
+        }
+        call_handler(dh->handler, dh->stats_slot, &event, ctx);
+
+        if (dh->stats_slot != NO_SLOT && event.queued_us != 0) {
+            event_handler_stats_t *st = &handler_stats[dh->stats_slot];
+            const uint32_t lag_us = since_queued_us(&event);
+            st->lag_total_us += lag_us;
+            if (lag_us > st->lag_max_us) {
+                st->lag_max_us = lag_us;
+            }
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+// esp_timer callback: report handlers that are still running past EVENT_STALL_MS
+static void watchdog_check(void *arg) {
+    const uint32_t now_us = (uint32_t)esp_timer_get_time();
+    for (int i = 0; i < 1 + EVENT_WORKER_COUNT; i++) {
+        exec_context_t *ctx = &exec_contexts[i];
+        const uint8_t slot = ctx->stats_slot;
+        if (slot == NO_SLOT || ctx->stall_reported) {
+            continue;
+        }
+        const uint32_t running_us = now_us - ctx->start_us;
+        if (running_us < EVENT_STALL_MS * 1000U) {
+            continue;
+        }
+        ctx->stall_reported = true;
+        handler_stats[slot].stalls++;
+        ESP_LOGW(TAG, "Handler %s still running after %lums on %s",
+                 handler_stats[slot].name ? handler_stats[slot].name : "(unnamed)",
+                 (unsigned long)(running_us / 1000),
+                 (i == EXEC_DISPATCHER) ? "evt_disp" : "a worker");
+    }
+}
+
 static void event_dispatcher_task(void *pvParameters) {
     ESP_LOGI(TAG, "Event dispatcher task started");
     
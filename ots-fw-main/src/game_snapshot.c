@@ -0,0 +1,169 @@
+#include "game_snapshot.h"
+#include "event_dispatcher.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+static const char *TAG = "OTS_SNAPSHOT";
+
+// Written by the WebSocket handler, consumed by the event dispatcher task
+static game_snapshot_t s_pending;
+static bool s_have_pending = false;
+
+// Written by the event dispatcher task under s_lock. Fast handlers (same
+// task) may read it directly; blocking modules run on worker tasks and go
+// through game_snapshot_sync_nukes()/game_snapshot_get_invasions().
+static game_snapshot_t s_applied;
+static bool s_have_applied = false;
+static uint32_t s_applied_count = 0;
+
+static SemaphoreHandle_t s_lock = NULL;
+
+esp_err_t game_snapshot_init(void) {
+    if (s_lock) {
+        return ESP_OK;
+    }
+
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        ESP_LOGE(TAG, "Failed to create snapshot mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_have_pending = false;
+    s_have_applied = false;
+    return ESP_OK;
+}
+
+bool game_snapshot_parse_phase(const char *str, game_phase_t *out_phase) {
+    if (!str || !out_phase) return false;
+
+    if (strcmp(str, "lobby") == 0) *out_phase = GAME_PHASE_LOBBY;
+    else if (strcmp(str, "spawning") == 0) *out_phase = GAME_PHASE_SPAWNING;
+    else if (strcmp(str, "in-game") == 0) *out_phase = GAME_PHASE_IN_GAME;
+    else if (strcmp(str, "game-won") == 0) *out_phase = GAME_PHASE_WON;
+    else if (strcmp(str, "game-lost") == 0) *out_phase = GAME_PHASE_LOST;
+    else return false;
+
+    return true;
+}
+
+esp_err_t game_snapshot_submit(const game_snapshot_t *snapshot) {
+    if (!snapshot) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (snapshot->version != GAME_SNAPSHOT_VERSION) {
+        ESP_LOGW(TAG, "Ignoring snapshot version %lu (expected %d)",
+                 (unsigned long)snapshot->version, GAME_SNAPSHOT_VERSION);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    const bool replaced = s_have_pending;
+    memcpy(&s_pending, snapshot, sizeof(s_pending));
+    s_have_pending = true;
+    xSemaphoreGive(s_lock);
+
+    if (replaced) {
+        // An event is already queued for the older snapshot; it will apply this one.
+        ESP_LOGD(TAG, "Replaced unapplied snapshot (seq=%lu)", (unsigned long)snapshot->seq);
+        event_dispatcher_note_coalesced(INTERNAL_EVENT_STATE_SNAPSHOT);
+        return ESP_OK;
+    }
+
+    esp_err_t ret = event_dispatcher_post_simple(INTERNAL_EVENT_STATE_SNAPSHOT, EVENT_SOURCE_WEBSOCKET);
+    if (ret != ESP_OK) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        s_have_pending = false;
+        xSemaphoreGive(s_lock);
+        ESP_LOGW(TAG, "Failed to queue snapshot (seq=%lu): %s",
+                 (unsigned long)snapshot->seq, esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+void game_snapshot_evicted(void) {
+    if (!s_lock) {
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    const uint32_t seq = s_pending.seq;
+    const bool had_pending = s_have_pending;
+    s_have_pending = false;
+    xSemaphoreGive(s_lock);
+
+    if (had_pending) {
+        ESP_LOGW(TAG, "Queued snapshot evicted (seq=%lu); waiting for the next one", (unsigned long)seq);
+    }
+}
+
+esp_err_t game_snapshot_apply(void) {
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_have_pending) {
+        xSemaphoreGive(s_lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+    memcpy(&s_applied, &s_pending, sizeof(s_applied));
+    s_have_pending = false;
+    s_have_applied = true;
+    xSemaphoreGive(s_lock);
+
+    s_applied_count++;
+
+    game_state_set_phase(s_applied.phase);
+
+    ESP_LOGI(TAG, "Applied snapshot #%lu: seq=%lu phase=%d nukes=%u%s land=%u naval=%u",
+             (unsigned long)s_applied_count, (unsigned long)s_applied.seq,
+             (int)s_applied.phase, (unsigned)s_applied.nuke_count,
+             s_applied.nukes_truncated ? " (truncated)" : "",
+             (unsigned)s_applied.land_alerts, (unsigned)s_applied.naval_alerts);
+    return ESP_OK;
+}
+
+const game_snapshot_t* game_snapshot_get_applied(void) {
+    return s_have_applied ? &s_applied : NULL;
+}
+
+esp_err_t game_snapshot_sync_nukes(nuke_direction_t direction) {
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_have_applied) {
+        xSemaphoreGive(s_lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+    // Outside a match nothing is in flight, whatever the sender listed
+    const bool in_game = (s_applied.phase == GAME_PHASE_IN_GAME);
+    esp_err_t ret = nuke_tracker_sync(s_applied.nukes, in_game ? s_applied.nuke_count : 0, direction);
+    xSemaphoreGive(s_lock);
+
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "Nuke tracker sync incomplete: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+bool game_snapshot_get_invasions(uint16_t *out_land, uint16_t *out_naval) {
+    if (!s_lock || !out_land || !out_naval) {
+        return false;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    const bool have = s_have_applied;
+    const bool in_game = (s_applied.phase == GAME_PHASE_IN_GAME);
+    *out_land = (have && in_game) ? s_applied.land_alerts : 0;
+    *out_naval = (have && in_game) ? s_applied.naval_alerts : 0;
+    xSemaphoreGive(s_lock);
+    return have;
+}
@@ -76,6 +76,22 @@ void game_state_update(game_event_type_t event_type) {
     }
 }
 
+void game_state_set_phase(game_phase_t phase) {
+    game_phase_t old_phase = current_phase;
+    if (phase == old_phase) {
+        return;
+    }
+
+    current_phase = phase;
+    ESP_LOGI(TAG, "Game phase set: %s -> %s",
+             phase_to_string(old_phase),
+             phase_to_string(phase));
+
+    if (state_change_callback) {
+        state_change_callback(old_phase, phase);
+    }
+}
+
 game_phase_t game_state_get_phase(void) {
     return current_phase;
 }
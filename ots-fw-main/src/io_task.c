@@ -12,7 +12,7 @@ static const char *TAG = "OTS_IO_TASK";
 
 #define IO_TASK_STACK_SIZE 4096
 #define IO_SCAN_INTERVAL_MS 50
-#define ADC_SCAN_INTERVAL_MS 100
+#define ADC_SCAN_INTERVAL_MS 50         // Slider latency: changes are pushed to modules per scan
 
 static TaskHandle_t io_task_handle = NULL;
 static bool task_running = false;
@@ -64,8 +64,8 @@ static void io_task_main(void *pvParameters) {
         // Scan buttons every loop (50ms)
         button_handler_scan();
         
-        // Scan ADC channels less frequently (100ms)
-        if (adc_scan_counter++ >= adc_scan_divisor) {
+        // Scan ADC channels every ADC_SCAN_INTERVAL_MS
+        if (++adc_scan_counter >= adc_scan_divisor) {
             adc_handler_scan();
             adc_scan_counter = 0;
         }
@@ -0,0 +1,206 @@
+#include "json_writer.h"
+#include <string.h>
+
+static void put_bytes(json_writer_t *w, const char *data, size_t n) {
+    if (w->overflow) {
+        return;
+    }
+    // Keep one byte for the terminating NUL
+    if (w->len + n >= w->cap) {
+        w->overflow = true;
+        return;
+    }
+    memcpy(w->buf + w->len, data, n);
+    w->len += n;
+    w->buf[w->len] = '\0';
+}
+
+static void put_char(json_writer_t *w, char c) {
+    put_bytes(w, &c, 1);
+}
+
+// Comma before every member but the first of its container
+static void begin_value(json_writer_t *w) {
+    if (w->after_key) {
+        w->after_key = false;
+        return;
+    }
+    if (w->depth == 0) {
+        return;
+    }
+    const uint8_t bit = (uint8_t)(1u << (w->depth - 1));
+    if (w->has_members & bit) {
+        put_char(w, ',');
+    }
+    w->has_members |= bit;
+}
+
+static void put_escaped(json_writer_t *w, const char *s) {
+    static const char hex[] = "0123456789abcdef";
+
+    put_char(w, '"');
+    const char *run = s;
+    for (; *s; s++) {
+        const unsigned char c = (unsigned char)*s;
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;  // Copied in one run with its neighbours
+        }
+        put_bytes(w, run, (size_t)(s - run));
+        run = s + 1;
+
+        char esc[6] = {'\\', 0};
+        size_t n = 2;
+        switch (c) {
+            case '"':  esc[1] = '"';  break;
+            case '\\': esc[1] = '\\'; break;
+            case '\n': esc[1] = 'n';  break;
+            case '\r': esc[1] = 'r';  break;
+            case '\t': esc[1] = 't';  break;
+            case '\b': esc[1] = 'b';  break;
+            case '\f': esc[1] = 'f';  break;
+            default:
+                esc[1] = 'u';
+                esc[2] = '0';
+                esc[3] = '0';
+                esc[4] = hex[c >> 4];
+                esc[5] = hex[c & 0x0F];
+                n = 6;
+                break;
+        }
+        put_bytes(w, esc, n);
+    }
+    put_bytes(w, run, (size_t)(s - run));
+    put_char(w, '"');
+}
+
+static void put_uint(json_writer_t *w, uint64_t value) {
+    char digits[20];
+    size_t n = 0;
+    do {
+        digits[sizeof(digits) - 1 - n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    put_bytes(w, &digits[sizeof(digits) - n], n);
+}
+
+static void open_container(json_writer_t *w, char c) {
+    begin_value(w);
+    if (w->depth >= JSON_WRITER_MAX_DEPTH) {
+        w->overflow = true;
+        return;
+    }
+    put_char(w, c);
+    w->depth++;
+    w->has_members &= (uint8_t)~(1u << (w->depth - 1));
+}
+
+static void close_container(json_writer_t *w, char c) {
+    if (w->depth == 0) {
+        w->overflow = true;
+        return;
+    }
+    put_char(w, c);
+    w->depth--;
+}
+
+void json_writer_init(json_writer_t *w, char *buf, size_t cap) {
+    memset(w, 0, sizeof(*w));
+    w->buf = buf;
+    w->cap = cap;
+    if (buf && cap > 0) {
+        buf[0] = '\0';
+    } else {
+        w->overflow = true;
+    }
+}
+
+void json_writer_begin_object(json_writer_t *w) {
+    open_container(w, '{');
+}
+
+void json_writer_end_object(json_writer_t *w) {
+    close_container(w, '}');
+}
+
+void json_writer_begin_array(json_writer_t *w) {
+    open_container(w, '[');
+}
+
+void json_writer_end_array(json_writer_t *w) {
+    close_container(w, ']');
+}
+
+void json_writer_key(json_writer_t *w, const char *key) {
+    begin_value(w);
+    put_escaped(w, key ? key : "");
+    put_char(w, ':');
+    w->after_key = true;
+}
+
+void json_writer_string(json_writer_t *w, const char *value) {
+    if (!value) {
+        json_writer_null(w);
+        return;
+    }
+    begin_value(w);
+    put_escaped(w, value);
+}
+
+void json_writer_int(json_writer_t *w, int64_t value) {
+    begin_value(w);
+    if (value < 0) {
+        put_char(w, '-');
+        put_uint(w, (uint64_t)0 - (uint64_t)value);
+    } else {
+        put_uint(w, (uint64_t)value);
+    }
+}
+
+void json_writer_uint(json_writer_t *w, uint64_t value) {
+    begin_value(w);
+    put_uint(w, value);
+}
+
+void json_writer_bool(json_writer_t *w, bool value) {
+    begin_value(w);
+    if (value) {
+        put_bytes(w, "true", 4);
+    } else {
+        put_bytes(w, "false", 5);
+    }
+}
+
+void json_writer_null(json_writer_t *w) {
+    begin_value(w);
+    put_bytes(w, "null", 4);
+}
+
+void json_writer_field_string(json_writer_t *w, const char *key, const char *value) {
+    json_writer_key(w, key);
+    json_writer_string(w, value);
+}
+
+void json_writer_field_int(json_writer_t *w, const char *key, int64_t value) {
+    json_writer_key(w, key);
+    json_writer_int(w, value);
+}
+
+void json_writer_field_uint(json_writer_t *w, const char *key, uint64_t value) {
+    json_writer_key(w, key);
+    json_writer_uint(w, value);
+}
+
+void json_writer_field_bool(json_writer_t *w, const char *key, bool value) {
+    json_writer_key(w, key);
+    json_writer_bool(w, value);
+}
+
+esp_err_t json_writer_finish(const json_writer_t *w, size_t *out_len) {
+    if (out_len) {
+        *out_len = w->len;
+    }
+    if (w->overflow) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return (w->depth == 0 && !w->after_key) ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
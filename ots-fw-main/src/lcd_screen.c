@@ -0,0 +1,155 @@
+/**
+ * @file lcd_screen.c
+ * @brief Screen composition for the 16x2 LCD (frame + shadow diff)
+ */
+
+#include "lcd_screen.h"
+#include <esp_log.h>
+#include <string.h>
+
+static const char *TAG = "OTS_LCD_SCREEN";
+
+// Rewriting an unchanged cell costs as much as a cursor move, so runs
+// separated by at most this many unchanged cells are sent as one run
+#define RUN_MERGE_GAP 1
+
+static uint8_t s_frame[LCD_ROWS][LCD_COLS];
+static uint8_t s_shown[LCD_ROWS][LCD_COLS];
+static bool s_shown_valid = false;
+static lcd_screen_stats_t s_stats = {0};
+
+// Left-aligned columns, 1..4 of 5 pixels wide
+static const uint8_t BAR_GLYPHS[4][8] = {
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00},
+    {0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00},
+    {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00},
+};
+
+esp_err_t lcd_screen_init(void) {
+    for (uint8_t i = 0; i < 4; i++) {
+        esp_err_t ret = lcd_define_char((uint8_t)(LCD_GLYPH_BAR_1 + i), BAR_GLYPHS[i]);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to load bar glyph %u: %s", i, esp_err_to_name(ret));
+            return ret;
+        }
+    }
+    memset(s_frame, ' ', sizeof(s_frame));
+    s_shown_valid = false;
+    return ESP_OK;
+}
+
+void lcd_screen_load(const lcd_screen_template_t *tmpl) {
+    memset(s_frame, ' ', sizeof(s_frame));
+    if (!tmpl) {
+        return;
+    }
+    for (uint8_t row = 0; row < LCD_ROWS; row++) {
+        const size_t len = strnlen(tmpl->lines[row], LCD_COLS);
+        memcpy(s_frame[row], tmpl->lines[row], len);
+    }
+}
+
+void lcd_screen_put(uint8_t col, uint8_t row, const char *text, size_t len) {
+    if (!text || row >= LCD_ROWS || col >= LCD_COLS) {
+        return;
+    }
+    if (len > (size_t)(LCD_COLS - col)) {
+        len = LCD_COLS - col;
+    }
+    memcpy(&s_frame[row][col], text, len);
+}
+
+void lcd_screen_put_frame(const lcd_animation_t *anim, uint8_t frame) {
+    if (!anim || anim->frame_count == 0) {
+        return;
+    }
+    frame %= anim->frame_count;
+    lcd_screen_put(anim->col, anim->row, anim->frames + (size_t)frame * anim->width, anim->width);
+}
+
+void lcd_screen_put_bar(uint8_t col, uint8_t row, uint8_t width, uint32_t value, uint32_t max) {
+    if (row >= LCD_ROWS || col >= LCD_COLS) {
+        return;
+    }
+    if (width > LCD_COLS - col) {
+        width = LCD_COLS - col;
+    }
+    const uint32_t steps = (uint32_t)width * 5;
+    const uint32_t filled = (max == 0) ? 0 : (uint32_t)(((uint64_t)(value > max ? max : value) * steps) / max);
+
+    for (uint8_t i = 0; i < width; i++) {
+        const uint32_t cell_start = (uint32_t)i * 5;
+        uint8_t c = ' ';
+        if (filled >= cell_start + 5) {
+            c = LCD_GLYPH_FULL;
+        } else if (filled > cell_start) {
+            c = (uint8_t)(LCD_GLYPH_BAR_1 + (filled - cell_start) - 1);
+        }
+        s_frame[row][col + i] = c;
+    }
+}
+
+static esp_err_t flush_run(uint8_t row, uint8_t start, uint8_t end) {
+    esp_err_t ret = lcd_set_cursor(start, row);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    s_stats.cursor_moves++;
+    for (uint8_t col = start; col < end; col++) {
+        ret = lcd_write_char((char)s_frame[row][col]);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        s_shown[row][col] = s_frame[row][col];
+        s_stats.cells_written++;
+    }
+    return ESP_OK;
+}
+
+esp_err_t lcd_screen_flush(void) {
+    bool sent = false;
+
+    for (uint8_t row = 0; row < LCD_ROWS; row++) {
+        int run_start = -1;
+        int run_end = -1;   // Exclusive
+
+        for (int col = 0; col <= LCD_COLS; col++) {
+            const bool changed = col < LCD_COLS &&
+                                 (!s_shown_valid || s_shown[row][col] != s_frame[row][col]);
+            if (changed) {
+                if (run_start < 0) {
+                    run_start = col;
+                }
+                run_end = col + 1;
+                continue;
+            }
+            // Close the run once the gap is too wide to bridge (or at end of row)
+            if (run_start >= 0 && (col == LCD_COLS || col - run_end >= RUN_MERGE_GAP)) {
+                esp_err_t ret = flush_run(row, (uint8_t)run_start, (uint8_t)run_end);
+                if (ret != ESP_OK) {
+                    s_shown_valid = false;
+                    return ret;
+                }
+                sent = true;
+                run_start = -1;
+            }
+        }
+    }
+
+    s_shown_valid = true;
+    if (sent) {
+        s_stats.flushes++;
+    }
+    return ESP_OK;
+}
+
+void lcd_screen_invalidate(void) {
+    s_shown_valid = false;
+}
+
+void lcd_screen_get_stats(lcd_screen_stats_t *out) {
+    if (out) {
+        *out = s_stats;
+    }
+}
@@ -22,8 +22,10 @@
 #include "lcd_driver.h"
 #include "io_task.h"
 #include "network_manager.h"
+#include "wifi_scanner.h"
 #include "ota_manager.h"
 #include "game_state_manager.h"
+#include "game_snapshot.h"
 #include "event_dispatcher.h"
 #include "module_manager.h"
 #include "nuke_module.h"
@@ -37,20 +39,10 @@
 #include "wifi_credentials.h"
 #include "ots_logging.h"
 #include "serial_command_handler.h"
+#include "boot_sequence.h"
 
 static const char *TAG = "OTS_MAIN";
 
-// Module update task
-static TaskHandle_t s_module_task = NULL;
-static void module_update_task(void *pvParameters) {
-    (void)pvParameters;
-    // Keep this lightweight; modules are expected to be non-blocking.
-    while (true) {
-        (void)module_manager_update_all();
-        vTaskDelay(pdMS_TO_TICKS(50));
-    }
-}
-
 // Event handlers
 static bool handle_event(const internal_event_t *event);
 static void handle_button_press(uint8_t button_index);
@@ -182,183 +174,226 @@ static bool handle_event(const internal_event_t *event) {
         }
         return true;
     }
+
+    // Snapshot resync: apply before modules see the event (this handler is
+    // registered ahead of module routing), so they refresh from final state.
+    // The nuke and alert modules sync the tracker themselves, on their workers.
+    if (event->type == INTERNAL_EVENT_STATE_SNAPSHOT) {
+        if (game_snapshot_apply() != ESP_OK) {
+            return false;
+        }
+
+        if (game_state_get_phase() == GAME_PHASE_IN_GAME) {
+            rgb_status_set(RGB_STATUS_GAME_STARTED);
+        } else if (ws_handlers_has_userscript()) {
+            rgb_status_set(RGB_STATUS_USERSCRIPT_CONNECTED);
+        } else if (network_manager_is_connected()) {
+            rgb_status_set(RGB_STATUS_WIFI_ONLY);
+        }
+        return true;
+    }
     
     return false;
 }
 
-void app_main(void) {
-    // Configure serial log filtering as early as possible.
-    (void)ots_logging_init();
+// ============================================================================
+// Boot steps (run by boot_sequence in dependency order)
+// ============================================================================
 
-    ESP_LOGI(TAG, "===========================================" );
-    ESP_LOGI(TAG, "%s v%s", OTS_PROJECT_NAME, OTS_FIRMWARE_VERSION);
-    ESP_LOGI(TAG, "Firmware: %s", OTS_FIRMWARE_NAME);
-    ESP_LOGI(TAG, "===========================================" );
-    
+static wifi_credentials_t s_wifi_creds;
+static bool s_have_stored_creds = false;
+static bool s_io_expanders_ready = false;
+
+static esp_err_t boot_nvs(void) {
     // Initialize NVS (centralized storage subsystem)
-    ESP_LOGI(TAG, "Initializing NVS storage...");
     ESP_ERROR_CHECK(nvs_storage_init());
 
-    // Initialize RGB status LED early so we can report boot failures
-    if (rgb_status_init() != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to initialize RGB status LED!");
-        return;
-    }
-    rgb_status_set(RGB_STATUS_DISCONNECTED);
-    
-    // Initialize I2C bus early (required by LCD and I/O expanders)
-    ESP_LOGI(TAG, "Initializing I2C bus...");
-    if (ots_i2c_bus_init() != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to initialize I2C bus!");
-        return;
-    }
-    
     // Initialize WiFi credentials storage
-    ESP_LOGI(TAG, "Initializing WiFi credentials...");
-    if (wifi_credentials_init() != ESP_OK) {
+    esp_err_t ret = wifi_credentials_init();
+    if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize WiFi credentials!");
-        return;
+        return ret;
     }
 
     // Enable serial WiFi commands (wifi-clear / wifi-provision)
     (void)serial_commands_init();
-    
-    const bool have_stored_creds = wifi_credentials_exist();
-    wifi_credentials_t wifi_creds;
-    memset(&wifi_creds, 0, sizeof(wifi_creds));
-    if (have_stored_creds) {
-        if (wifi_credentials_load(&wifi_creds) != ESP_OK) {
+
+    s_have_stored_creds = wifi_credentials_exist();
+    memset(&s_wifi_creds, 0, sizeof(s_wifi_creds));
+    if (s_have_stored_creds) {
+        if (wifi_credentials_load(&s_wifi_creds) != ESP_OK) {
             ESP_LOGW(TAG, "Expected stored credentials but could not load; entering portal mode");
         }
     }
 
-    if (have_stored_creds) {
-        ESP_LOGI(TAG, "Stored WiFi credentials found: SSID=%s", wifi_creds.ssid);
-        // Mode will be set later after HTTP server init
+    if (s_have_stored_creds) {
+        ESP_LOGI(TAG, "Stored WiFi credentials found: SSID=%s", s_wifi_creds.ssid);
     } else {
         ESP_LOGW(TAG, "No stored WiFi credentials (NVS clear); starting captive portal mode");
-        // Mode will be set later after HTTP server init
     }
-    
-    // Initialize I/O expanders with error recovery
-    ESP_LOGI(TAG, "Initializing I/O expanders...");
-    bool io_expanders_ready = io_expander_begin(ots_i2c_bus_get(), MCP23017_ADDRESSES, MCP23017_COUNT);
-    if (!io_expanders_ready) {
-        ESP_LOGE(TAG, "Failed to initialize I/O expanders - continuing without hardware I/O boards");
-    } else {
-        // Register recovery callback
-        io_expander_set_recovery_callback(handle_io_expander_recovery);
+    return ESP_OK;
+}
 
-        // Initialize module I/O
-        if (module_io_init() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize module I/O - continuing without hardware modules");
-            io_expanders_ready = false;
-        }
+static esp_err_t boot_rgb(void) {
+    // RGB status LED first so we can report boot failures
+    esp_err_t ret = rgb_status_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize RGB status LED!");
+        return ret;
+    }
+    rgb_status_set(RGB_STATUS_DISCONNECTED);
+    return ESP_OK;
+}
+
+static esp_err_t boot_i2c(void) {
+    // I2C bus (required by LCD and I/O expanders)
+    esp_err_t ret = ots_i2c_bus_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize I2C bus!");
     }
+    return ret;
+}
 
+static esp_err_t boot_core(void) {
     // Initialize event dispatcher
     if (event_dispatcher_init() != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize event dispatcher!");
-        return;
+        return ESP_FAIL;
     }
     
     // Register event handler (handles game state events)
-    event_dispatcher_register(GAME_EVENT_INVALID, handle_event);
+    event_dispatcher_register_named(GAME_EVENT_INVALID, handle_event, "main");
 
     // Initialize module manager (modules may not require MCP23017 boards).
     if (module_manager_init() != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize module manager");
-        return;
+        return ESP_FAIL;
     }
 
     // Route all events to modules as well.
-    event_dispatcher_register(GAME_EVENT_INVALID, module_manager_route_event);
+    event_dispatcher_register_named(GAME_EVENT_INVALID, module_manager_route_event, "modules");
 
-    // Register modules.
-    // Always register SystemStatus so the LCD can show boot/connection screens
-    // even when the MCP23017 I/O boards are absent.
-    ESP_LOGI(TAG, "Registering hardware modules...");
+    // Initialize game state manager
+    if (game_state_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize game state!");
+        return ESP_FAIL;
+    }
+    game_state_set_callback(handle_game_state_change);
+
+    if (game_snapshot_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize snapshot staging!");
+    }
+    return ESP_OK;
+}
+
+static esp_err_t boot_display(void) {
+    // Modules that do not need the MCP23017 boards: SystemStatus so the LCD
+    // shows boot/connection screens even without them, Troops (LCD-driven)
+    // and Sound (CAN bus).
+    ESP_LOGI(TAG, "Registering display and CAN modules...");
     module_manager_register((hardware_module_t *)system_status_module_get());
-    // Troops is LCD-driven and should be available regardless of MCP23017 presence.
     module_manager_register((hardware_module_t *)troops_module_get());
-    // Sound module uses CAN bus (not MCP23017), register independently
     module_manager_register(sound_module_get());
-    
-    if (io_expanders_ready) {
-        module_manager_register(&nuke_module);
-        module_manager_register(&alert_module);
-        module_manager_register(&main_power_module);
-
-        // Initialize all hardware modules (includes splash screen)
-        if (module_manager_init_all() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize hardware modules - continuing without hardware modules");
-            io_expanders_ready = false;
-        }
-    } else {
-        // Still initialize SystemStatus (LCD screens) even without MCP23017 boards.
-        if (module_manager_init_all() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize SystemStatus module");
-        }
+
+    // Initializes the LCD and shows the splash screen
+    if (module_manager_init_all() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize SystemStatus module");
     }
 
-    // Start periodic module updates (LCD screen refresh, timers, etc.).
-    if (!s_module_task) {
-        BaseType_t ok = xTaskCreate(
-            module_update_task,
-            "mod_upd",
-            4096,
-            NULL,
-            4,
-            &s_module_task
-        );
-        if (ok != pdPASS) {
-            ESP_LOGE(TAG, "Failed to start module update task");
-            s_module_task = NULL;
-        }
+    // Start deadline-driven module updates (LCD screen refresh, timers, etc.).
+    // Modules are expected to be non-blocking.
+    esp_err_t ret = module_manager_start_scheduler();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start module update task");
     }
-    
-    // Initialize game state manager
-    if (game_state_init() != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to initialize game state!");
-        return;
+    return ret;
+}
+
+static esp_err_t boot_io_expanders(void) {
+    // Initialize I/O expanders with error recovery (retries when boards are
+    // absent, hence a background step; the LCD shares the bus meanwhile)
+    s_io_expanders_ready = io_expander_begin(ots_i2c_bus_get(), MCP23017_ADDRESSES, MCP23017_COUNT);
+    if (!s_io_expanders_ready) {
+        ESP_LOGE(TAG, "Failed to initialize I/O expanders - continuing without hardware I/O boards");
+        return ESP_OK;
     }
-    game_state_set_callback(handle_game_state_change);
-    
+
+    // Register recovery callback
+    io_expander_set_recovery_callback(handle_io_expander_recovery);
+
+    // Initialize module I/O
+    if (module_io_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize module I/O - continuing without hardware modules");
+        s_io_expanders_ready = false;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t boot_modules(void) {
+    if (!s_io_expanders_ready) {
+        return ESP_OK;
+    }
+
+    ESP_LOGI(TAG, "Registering hardware modules...");
+    module_manager_register(&nuke_module);
+    module_manager_register(&alert_module);
+    module_manager_register(&main_power_module);
+
+    if (module_manager_init_all() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize hardware modules - continuing without hardware modules");
+        s_io_expanders_ready = false;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t boot_inputs(void) {
+    if (!s_io_expanders_ready) {
+        return ESP_OK;
+    }
+
     // Initialize LED controller
-    if (io_expanders_ready) {
-        if (led_controller_init() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize LED controller!");
-            return;
-        }
+    if (led_controller_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize LED controller!");
+        return ESP_FAIL;
     }
     
     // Initialize button handler
-    if (io_expanders_ready) {
-        if (button_handler_init() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize button handler!");
-            return;
-        }
+    if (button_handler_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize button handler!");
+        return ESP_FAIL;
     }
     
     // Initialize ADC handler
-    if (io_expanders_ready) {
-        if (adc_handler_init() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize ADC handler!");
-            return;
-        }
+    if (adc_handler_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize ADC handler!");
+        return ESP_FAIL;
     }
-    
+
+    // Start dedicated I/O task (button/ADC scanning, LED updates)
+    if (io_task_start() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start I/O task!");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t boot_network(void) {
     // Initialize network manager with credentials from NVS/config
-    if (network_manager_init(wifi_creds.ssid, wifi_creds.password, MDNS_HOSTNAME) != ESP_OK) {
+    if (network_manager_init(s_wifi_creds.ssid, s_wifi_creds.password, MDNS_HOSTNAME) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize network manager!");
-        return;
+        return ESP_FAIL;
     }
     network_manager_set_event_callback(handle_network_event);
 
+    // Background WiFi scans for /api/scan (never blocks the HTTP server)
+    if (wifi_scanner_init() != ESP_OK) {
+        ESP_LOGW(TAG, "WiFi scanner unavailable, /api/scan will stay empty");
+    }
+
     // Initialize WebSocket protocol
     if (ws_protocol_init() != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize WebSocket protocol!");
-        return;
+        return ESP_FAIL;
     }
 
     // ========== HTTP SERVER INITIALIZATION ==========
@@ -380,30 +415,33 @@ void app_main(void) {
         .key_len = ots_server_key_pem_len,
         .max_open_sockets = 4,  // ESP-IDF limit: 7 total (3 internal + 4 user)
         .max_uri_handlers = 32,
-        .close_fn = ws_handlers_get_session_close_callback()  // WebSocket session close callback
+        .close_fn = ws_handlers_get_session_close_callback(),  // WebSocket session close callback
+        .session_tickets = true,    // Resume on reconnect instead of a full RSA handshake
+        .ciphersuites = NULL,       // Hardware-accelerated AES-GCM/SHA-256 preference
+        .keep_alive_idle_s = 15     // Detect dead WSS peers without waiting for LRU purge
     };
     
     if (http_server_init(&server_config) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize HTTP server!");
-        return;
+        return ESP_FAIL;
     }
     
     if (http_server_start() != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start HTTP server!");
-        return;
+        return ESP_FAIL;
     }
     
     // Register WebSocket handlers (must be first for /ws route)
     if (ws_handlers_register(http_server_get_handle()) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to register WebSocket handlers!");
-        return;
+        return ESP_FAIL;
     }
     ws_handlers_set_connection_callback(handle_ws_connection);
     
     // Register webapp handlers (UI and configuration endpoints)
     if (webapp_handlers_register(http_server_get_handle()) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to register webapp handlers!");
-        return;
+        return ESP_FAIL;
     }
     
     ESP_LOGI(TAG, "HTTP server ready with WebSocket and webapp handlers");
@@ -412,11 +450,11 @@ void app_main(void) {
     // Initialize OTA managers (HTTP and Arduino protocols)
     if (ota_manager_init(OTA_PORT, OTA_HOSTNAME) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize HTTP OTA manager!");
-        return;
+        return ESP_FAIL;
     }
     
     // Start network services
-    if (!have_stored_creds || strlen(wifi_creds.ssid) == 0) {
+    if (!s_have_stored_creds || strlen(s_wifi_creds.ssid) == 0) {
         // Portal mode: start AP only.
         rgb_status_set(RGB_STATUS_WIFI_CONNECTING);  // Blue for captive portal setup
         (void)network_manager_start_captive_portal("OTS-SETUP", "");
@@ -429,17 +467,58 @@ void app_main(void) {
         webapp_handlers_set_mode(WEBAPP_MODE_NORMAL);
         if (network_manager_start() != ESP_OK) {
             ESP_LOGE(TAG, "Failed to start network!");
-            return;
+            return ESP_FAIL;
         }
     }
+    return ESP_OK;
+}
+
+enum {
+    STEP_NVS,
+    STEP_RGB,
+    STEP_I2C,
+    STEP_CORE,
+    STEP_DISPLAY,
+    STEP_IO_EXPANDERS,
+    STEP_NETWORK,
+    STEP_MODULES,
+    STEP_INPUTS,
+    STEP_COUNT
+};
+
+// LCD splash comes up right after the I2C bus and the core services. The
+// I/O expanders (slow when boards are missing) and Wi-Fi/TLS run in
+// background tasks; hardware modules and input scanning follow the expanders.
+static const boot_step_t s_boot_steps[STEP_COUNT] = {
+    [STEP_NVS]          = { "nvs",       boot_nvs,          0, false, true },
+    [STEP_RGB]          = { "rgb",       boot_rgb,          0, false, true },
+    [STEP_I2C]          = { "i2c",       boot_i2c,          0, false, true },
+    [STEP_CORE]         = { "core",      boot_core,         0, false, true },
+    [STEP_DISPLAY]      = { "display",   boot_display,
+                            BOOT_DEP(STEP_I2C) | BOOT_DEP(STEP_CORE), false, true },
+    [STEP_IO_EXPANDERS] = { "io_exp",    boot_io_expanders,
+                            BOOT_DEP(STEP_RGB) | BOOT_DEP(STEP_I2C), true, false },
+    [STEP_NETWORK]      = { "network",   boot_network,
+                            BOOT_DEP(STEP_NVS) | BOOT_DEP(STEP_RGB) | BOOT_DEP(STEP_DISPLAY), true, true },
+    [STEP_MODULES]      = { "modules",   boot_modules,
+                            BOOT_DEP(STEP_DISPLAY) | BOOT_DEP(STEP_IO_EXPANDERS), false, false },
+    [STEP_INPUTS]       = { "inputs",    boot_inputs,       BOOT_DEP(STEP_MODULES), false, true },
+};
+
+void app_main(void) {
+    // Configure serial log filtering as early as possible.
+    (void)ots_logging_init();
+
+    ESP_LOGI(TAG, "===========================================" );
+    ESP_LOGI(TAG, "%s v%s", OTS_PROJECT_NAME, OTS_FIRMWARE_VERSION);
+    ESP_LOGI(TAG, "Firmware: %s", OTS_FIRMWARE_NAME);
+    ESP_LOGI(TAG, "===========================================" );
     
-    // Start dedicated I/O task
-    if (io_expanders_ready) {
-        if (io_task_start() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to start I/O task!");
-            return;
-        }
+    esp_err_t ret = boot_sequence_run(s_boot_steps, STEP_COUNT);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Boot incomplete: %s (see `boot` for the failed step)", esp_err_to_name(ret));
+        return;
     }
     
-    ESP_LOGI(TAG, "OTS Firmware initialized successfully");
+    ESP_LOGI(TAG, "OTS Firmware initialized (network continues in the background)");
 }
@@ -26,12 +26,6 @@ static esp_err_t main_power_module_init(void) {
     return ESP_OK;
 }
 
-// Module update (periodic)
-static esp_err_t main_power_module_update(void) {
-    // Nothing to do here - LED state controlled by events
-    return ESP_OK;
-}
-
 // Handle events
 static bool main_power_module_handle_event(const internal_event_t *event) {
     bool handled = false;
@@ -100,7 +94,7 @@ hardware_module_t main_power_module = {
     .name = "Main Power Module",
     .enabled = true,
     .init = main_power_module_init,
-    .update = main_power_module_update,
+    .update = NULL,  // Event-driven only: LED state controlled by events
     .handle_event = main_power_module_handle_event,
     .get_status = main_power_module_get_status,
     .shutdown = main_power_module_shutdown
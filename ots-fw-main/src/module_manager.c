@@ -1,19 +1,44 @@
 #include "module_manager.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include <string.h>
 
 static const char *TAG = "OTS_MOD_MGR";
 
 #define MAX_MODULES 8
 
+#define SCHED_TASK_STACK_SIZE 4096
+#define SCHED_TASK_PRIORITY 4
+#define DEADLINE_NONE UINT64_MAX
+
 static hardware_module_t *registered_modules[MAX_MODULES];
-static uint8_t module_count = 0;
+static volatile uint8_t module_count = 0;
+static volatile uint32_t s_initialized_mask = 0;  // Modules whose init() succeeded
+
+// Scheduler state (deadlines in ms since boot)
+static TaskHandle_t s_sched_task = NULL;
+static uint64_t s_deadline_ms[MAX_MODULES];
+static uint32_t s_pending_mask = 0;
+static portMUX_TYPE s_pending_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Statistics
+static module_sched_stats_t s_stats[MAX_MODULES];
+static uint32_t s_sched_wakeups = 0;
+static module_sched_stats_t s_last_report[MAX_MODULES];
+static uint32_t s_last_report_wakeups = 0;
+static uint64_t s_last_report_us = 0;
 
 esp_err_t module_manager_init(void) {
     ESP_LOGI(TAG, "Initializing module manager...");
     
     memset(registered_modules, 0, sizeof(registered_modules));
     module_count = 0;
+    s_initialized_mask = 0;
+    memset(s_stats, 0, sizeof(s_stats));
+    memset(s_last_report, 0, sizeof(s_last_report));
+    s_pending_mask = 0;
     
     ESP_LOGI(TAG, "Module manager initialized");
     return ESP_OK;
@@ -30,18 +55,76 @@ esp_err_t module_manager_register(hardware_module_t *module) {
         return ESP_ERR_NO_MEM;
     }
     
-    registered_modules[module_count++] = module;
+    // Modules may be registered while the scheduler runs (boot steps):
+    // publish the slot before the count
+    const uint8_t index = module_count;
+    s_deadline_ms[index] = 0;  // First update runs as soon as the module is initialized
+    registered_modules[index] = module;
+    taskENTER_CRITICAL(&s_pending_lock);
+    module_count = index + 1;
+    taskEXIT_CRITICAL(&s_pending_lock);
     ESP_LOGI(TAG, "Registered module: %s", module->name);
     
     return ESP_OK;
 }
 
+// Blocking modules are called by the dispatcher's workers, not through
+// module_manager_route_event(); their events pass the same checks here
+static bool deliver_blocking_event(int index, const internal_event_t *event) {
+    hardware_module_t *module = registered_modules[index];
+    if (!module->enabled || !(s_initialized_mask & (1u << index))) {
+        return false;
+    }
+    return module->handle_event(event);
+}
+
+// event_handler_t has no context argument: one entry point per module slot
+#define BLOCKING_ENTRY(i) \
+    static bool blocking_event_##i(const internal_event_t *event) { return deliver_blocking_event(i, event); }
+BLOCKING_ENTRY(0)
+BLOCKING_ENTRY(1)
+BLOCKING_ENTRY(2)
+BLOCKING_ENTRY(3)
+BLOCKING_ENTRY(4)
+BLOCKING_ENTRY(5)
+BLOCKING_ENTRY(6)
+BLOCKING_ENTRY(7)
+
+static const event_handler_t s_blocking_entries[] = {
+    blocking_event_0, blocking_event_1, blocking_event_2, blocking_event_3,
+    blocking_event_4, blocking_event_5, blocking_event_6, blocking_event_7,
+};
+_Static_assert(sizeof(s_blocking_entries) / sizeof(s_blocking_entries[0]) == MAX_MODULES,
+               "one blocking entry point per module slot");
+
+// Every event a blocking handler is registered for is copied to its worker
+// queue, so register only the types it handles
+static esp_err_t register_blocking_events(int index) {
+    const hardware_module_t *module = registered_modules[index];
+    const event_handler_t entry = s_blocking_entries[index];
+    if (!module->event_types) {
+        ESP_LOGW(TAG, "Module %s has no event types: every event goes to its worker", module->name);
+        return event_dispatcher_register_ex(GAME_EVENT_INVALID, entry, module->name, EVENT_HANDLER_BLOCKING);
+    }
+    for (const game_event_type_t *type = module->event_types; *type != GAME_EVENT_INVALID; type++) {
+        esp_err_t ret = event_dispatcher_register_ex(*type, entry, module->name, EVENT_HANDLER_BLOCKING);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    return ESP_OK;
+}
+
 esp_err_t module_manager_init_all(void) {
     ESP_LOGI(TAG, "Initializing %d modules...", module_count);
     
     for (int i = 0; i < module_count; i++) {
         hardware_module_t *module = registered_modules[i];
         
+        if (s_initialized_mask & (1u << i)) {
+            continue;  // Initialized by an earlier call
+        }
+        
         if (!module->enabled) {
             ESP_LOGI(TAG, "Module %s is disabled, skipping", module->name);
             continue;
@@ -55,12 +138,56 @@ esp_err_t module_manager_init_all(void) {
                 return ret;
             }
         }
+        
+        taskENTER_CRITICAL(&s_pending_lock);
+        s_initialized_mask |= (1u << i);
+        taskEXIT_CRITICAL(&s_pending_lock);
+        
+        // Blocking handlers get their own dispatcher registration (and
+        // worker) for the types they handle; module_manager_route_event()
+        // skips them
+        if (module->blocking_events && module->handle_event) {
+            esp_err_t ret = register_blocking_events(i);
+            if (ret != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to register events of module %s: %d", module->name, ret);
+                taskENTER_CRITICAL(&s_pending_lock);
+                s_initialized_mask &= ~(1u << i);
+                taskEXIT_CRITICAL(&s_pending_lock);
+                return ret;
+            }
+        }
+        
+        module_manager_notify(module);  // Scheduler may already be running
     }
     
     ESP_LOGI(TAG, "All modules initialized successfully");
     return ESP_OK;
 }
 
+// Run a single module update and compute its next deadline
+static void run_module_update(int index) {
+    hardware_module_t *module = registered_modules[index];
+    
+    const int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = module->update();
+    const int64_t end_us = esp_timer_get_time();
+    
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Module %s update failed: %d", module->name, ret);
+    }
+    
+    const uint32_t elapsed_us = (uint32_t)(end_us - start_us);
+    module_sched_stats_t *stats = &s_stats[index];
+    stats->wakeups++;
+    stats->busy_us += elapsed_us;
+    if (elapsed_us > stats->max_update_us) {
+        stats->max_update_us = elapsed_us;
+    }
+    
+    const uint32_t wake_ms = module->next_wake_ms ? module->next_wake_ms() : MODULE_DEFAULT_UPDATE_MS;
+    s_deadline_ms[index] = (wake_ms == MODULE_WAKE_NEVER) ? DEADLINE_NONE : (uint64_t)(end_us / 1000) + wake_ms;
+}
+
 esp_err_t module_manager_update_all(void) {
     for (int i = 0; i < module_count; i++) {
         hardware_module_t *module = registered_modules[i];
@@ -70,16 +197,149 @@ esp_err_t module_manager_update_all(void) {
         }
         
         if (module->update) {
-            esp_err_t ret = module->update();
-            if (ret != ESP_OK) {
-                ESP_LOGW(TAG, "Module %s update failed: %d", module->name, ret);
+            run_module_update(i);
+        }
+    }
+    
+    return ESP_OK;
+}
+
+static void module_scheduler_task(void *pvParameters) {
+    (void)pvParameters;
+    
+    while (true) {
+        taskENTER_CRITICAL(&s_pending_lock);
+        const uint32_t pending = s_pending_mask;
+        const uint32_t initialized = s_initialized_mask;
+        const int count = module_count;
+        s_pending_mask = 0;
+        taskEXIT_CRITICAL(&s_pending_lock);
+        
+        uint64_t now_ms = esp_timer_get_time() / 1000;
+        uint64_t earliest_ms = DEADLINE_NONE;
+        
+        for (int i = 0; i < count; i++) {
+            hardware_module_t *module = registered_modules[i];
+            if (!module->enabled || !module->update || !(initialized & (1u << i))) {
+                continue;
+            }
+            
+            if ((pending & (1u << i)) || now_ms >= s_deadline_ms[i]) {
+                run_module_update(i);
+                now_ms = esp_timer_get_time() / 1000;
+            }
+            
+            if (s_deadline_ms[i] < earliest_ms) {
+                earliest_ms = s_deadline_ms[i];
             }
         }
+        
+        // Sleep until the earliest deadline or a notification.
+        TickType_t wait_ticks = portMAX_DELAY;
+        if (earliest_ms != DEADLINE_NONE) {
+            const uint64_t delay_ms = (earliest_ms > now_ms) ? (earliest_ms - now_ms) : 0;
+            wait_ticks = pdMS_TO_TICKS(delay_ms);
+            if (wait_ticks == 0) {
+                wait_ticks = 1;  // Always yield to lower-priority tasks
+            }
+        }
+        
+        (void)ulTaskNotifyTake(pdTRUE, wait_ticks);
+        s_sched_wakeups++;
+    }
+}
+
+esp_err_t module_manager_start_scheduler(void) {
+    if (s_sched_task) {
+        return ESP_OK;
+    }
+    
+    BaseType_t ok = xTaskCreate(
+        module_scheduler_task,
+        "mod_upd",
+        SCHED_TASK_STACK_SIZE,
+        NULL,
+        SCHED_TASK_PRIORITY,
+        &s_sched_task
+    );
+    if (ok != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start module scheduler task");
+        s_sched_task = NULL;
+        return ESP_FAIL;
+    }
+    
+    s_last_report_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "Module scheduler started");
+    return ESP_OK;
+}
+
+void module_manager_notify(const hardware_module_t *module) {
+    if (!module) {
+        return;
     }
     
+    for (int i = 0; i < module_count; i++) {
+        if (registered_modules[i] == module) {
+            taskENTER_CRITICAL(&s_pending_lock);
+            s_pending_mask |= (1u << i);
+            taskEXIT_CRITICAL(&s_pending_lock);
+            s_stats[i].notifications++;
+            
+            if (s_sched_task) {
+                xTaskNotifyGive(s_sched_task);
+            }
+            return;
+        }
+    }
+}
+
+esp_err_t module_manager_get_stats(uint8_t index, module_sched_stats_t *stats) {
+    if (index >= module_count || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = s_stats[index];
     return ESP_OK;
 }
 
+void module_manager_log_stats(void) {
+    const int64_t now_us = esp_timer_get_time();
+    const uint64_t window_us = (uint64_t)(now_us - s_last_report_us);
+    if (window_us == 0) {
+        return;
+    }
+    
+    uint64_t total_busy_us = 0;
+    ESP_LOGI(TAG, "Module scheduler stats (last %lu ms):", (unsigned long)(window_us / 1000));
+    for (int i = 0; i < module_count; i++) {
+        const module_sched_stats_t *cur = &s_stats[i];
+        const module_sched_stats_t *prev = &s_last_report[i];
+        const uint32_t wakeups = cur->wakeups - prev->wakeups;
+        const uint64_t busy_us = cur->busy_us - prev->busy_us;
+        total_busy_us += busy_us;
+        
+        // Rates are reported in hundredths to avoid floating point.
+        const uint32_t wakes_per_s_x100 = (uint32_t)(((uint64_t)wakeups * 100000000ULL) / window_us);
+        const uint32_t cpu_x100 = (uint32_t)((busy_us * 10000ULL) / window_us);
+        ESP_LOGI(TAG, "  %-14s wake/s=%lu.%02lu cpu=%lu.%02lu%% max=%luus notify=%lu",
+                 registered_modules[i]->name,
+                 (unsigned long)(wakes_per_s_x100 / 100), (unsigned long)(wakes_per_s_x100 % 100),
+                 (unsigned long)(cpu_x100 / 100), (unsigned long)(cpu_x100 % 100),
+                 (unsigned long)cur->max_update_us,
+                 (unsigned long)(cur->notifications - prev->notifications));
+        s_last_report[i] = *cur;
+    }
+    
+    const uint32_t sched_wakeups = s_sched_wakeups - s_last_report_wakeups;
+    const uint32_t sched_per_s_x100 = (uint32_t)(((uint64_t)sched_wakeups * 100000000ULL) / window_us);
+    const uint32_t idle_x100 = 10000 - (uint32_t)((total_busy_us * 10000ULL) / window_us);
+    ESP_LOGI(TAG, "  scheduler      wake/s=%lu.%02lu idle=%lu.%02lu%%",
+             (unsigned long)(sched_per_s_x100 / 100), (unsigned long)(sched_per_s_x100 % 100),
+             (unsigned long)(idle_x100 / 100), (unsigned long)(idle_x100 % 100));
+    
+    s_last_report_wakeups = s_sched_wakeups;
+    s_last_report_us = now_us;
+}
+
 bool module_manager_route_event(const internal_event_t *event) {
     if (!event) {
         return false;
@@ -87,10 +347,11 @@ bool module_manager_route_event(const internal_event_t *event) {
     
     bool handled = false;
     
+    const uint32_t initialized = s_initialized_mask;
     for (int i = 0; i < module_count; i++) {
         hardware_module_t *module = registered_modules[i];
         
-        if (!module->enabled) {
+        if (!module->enabled || module->blocking_events || !(initialized & (1u << i))) {
             continue;
         }
         
@@ -3,6 +3,8 @@
 #include "button_handler.h"
 #include "led_handler.h"
 #include "nuke_state_manager.h"
+#include "game_snapshot.h"
+#include "module_manager.h"
 #include "ws_handlers.h"
 #include "ots_common.h"
 #include "esp_log.h"
@@ -34,13 +36,6 @@ static esp_err_t nuke_module_init(void) {
     return ESP_OK;
 }
 
-// Module update (periodic)
-static esp_err_t nuke_module_update(void) {
-    // Nothing to do here - button scanning handled by button_handler
-    // LED blinking handled by led_controller
-    return ESP_OK;
-}
-
 // Button to nuke type mapping - all buttons use unified NUKE_LAUNCHED event
 typedef struct {
     game_event_type_t event_type;
@@ -69,6 +64,20 @@ static void update_nuke_button_led_state(uint8_t led_index, nuke_type_t nuke_typ
     }
 }
 
+// Module update: expire outgoing nukes whose resolve event was lost
+static esp_err_t nuke_module_update(void) {
+    if (nuke_tracker_expire_stale(NUKE_DIR_OUTGOING) > 0) {
+        for (int i = 0; i < 3; i++) {
+            update_nuke_button_led_state(i, (nuke_type_t)i);
+        }
+    }
+    return ESP_OK;
+}
+
+static uint32_t nuke_module_next_wake_ms(void) {
+    return nuke_tracker_get_total_active(NUKE_DIR_OUTGOING) > 0 ? NUKE_TRACKER_SWEEP_INTERVAL_MS : MODULE_WAKE_NEVER;
+}
+
 // Handle events
 static bool nuke_module_handle_event(const internal_event_t *event) {
     // Handle button press events
@@ -126,10 +135,15 @@ static bool nuke_module_handle_event(const internal_event_t *event) {
                 event_type_to_string(event->type), led_index, (unsigned long)unit_id);
         
         if (unit_id > 0) {
+            const bool was_idle = (nuke_tracker_get_total_active(NUKE_DIR_OUTGOING) == 0);
             // Register outgoing nuke in tracker
             nuke_tracker_register_launch(unit_id, nuke_type, NUKE_DIR_OUTGOING);
             // Update LED state
             update_nuke_button_led_state(led_index, nuke_type);
+            // First nuke in flight: arm the expiry sweep
+            if (was_idle) {
+                module_manager_notify(&nuke_module);
+            }
         }
         
         return true;
@@ -198,6 +212,18 @@ static bool nuke_module_handle_event(const internal_event_t *event) {
         return true;
     }
     
+    // Handle snapshot resync - outgoing nukes are synced here, on this
+    // module's worker, after the launches queued ahead of the snapshot
+    if (event->type == INTERNAL_EVENT_STATE_SNAPSHOT) {
+        game_snapshot_sync_nukes(NUKE_DIR_OUTGOING);
+        for (int i = 0; i < 3; i++) {
+            update_nuke_button_led_state(i, (nuke_type_t)i);
+        }
+        // Re-arm (or stop) the expiry sweep for the synced set
+        module_manager_notify(&nuke_module);
+        return true;
+    }
+    
     // Handle game end - clear all tracking
     if (event->type == GAME_EVENT_GAME_END) {
         
@@ -235,12 +261,28 @@ static esp_err_t nuke_module_shutdown(void) {
     return ESP_OK;
 }
 
+// Events nuke_module_handle_event() acts on
+static const game_event_type_t s_nuke_events[] = {
+    INTERNAL_EVENT_BUTTON_PRESSED,
+    GAME_EVENT_NUKE_LAUNCHED,
+    GAME_EVENT_NUKE_EXPLODED,
+    GAME_EVENT_NUKE_INTERCEPTED,
+    INTERNAL_EVENT_WS_CONNECTED,
+    INTERNAL_EVENT_WS_DISCONNECTED,
+    INTERNAL_EVENT_STATE_SNAPSHOT,
+    GAME_EVENT_GAME_END,
+    GAME_EVENT_INVALID
+};
+
 // Module definition
 hardware_module_t nuke_module = {
     .name = "Nuke Module",
     .enabled = true,
+    .blocking_events = true,  // LEDs over I2C
+    .event_types = s_nuke_events,
     .init = nuke_module_init,
     .update = nuke_module_update,
+    .next_wake_ms = nuke_module_next_wake_ms,
     .handle_event = nuke_module_handle_event,
     .get_status = nuke_module_get_status,
     .shutdown = nuke_module_shutdown
@@ -1,32 +1,230 @@
 #include "nuke_state_manager.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include <string.h>
 
 static const char *TAG = "OTS_NUKE_TRK";
 
-#define MAX_TRACKED_NUKES 32  // Maximum simultaneous nukes to track
+// Maximum load before new launches are rejected (7/8 of capacity).
+// Linear probing degrades quickly past this point.
+#define MAX_LOAD_NUM 7
+#define MAX_LOAD_DEN 8
 
+#define DIR_COUNT 2
+
+/**
+ * Slot in the open-addressing table. unit_id 0 marks an empty slot
+ * (the game never assigns unit ID 0).
+ */
 typedef struct {
     uint32_t unit_id;
-    nuke_type_t type;
-    nuke_direction_t direction;
-    nuke_state_t state;
-    bool active;
-} tracked_nuke_t;
+    uint32_t launch_ms;
+    uint8_t type;
+    uint8_t direction;
+} nuke_slot_t;
+
+typedef struct {
+    nuke_slot_t *slots;
+    uint32_t capacity;      // Power of two
+    uint32_t mask;
+    uint8_t hash_shift;
+    uint32_t used;
+    uint32_t max_probe;     // Longest probe sequence seen (diagnostics)
+    uint16_t in_flight[NUKE_TYPE_COUNT][DIR_COUNT];
+    uint16_t exploded[NUKE_TYPE_COUNT][DIR_COUNT];
+    uint16_t intercepted[NUKE_TYPE_COUNT][DIR_COUNT];
+    uint16_t total_in_flight[DIR_COUNT];
+    uint32_t dropped;
+    uint32_t expired;
+} nuke_table_t;
 
-static tracked_nuke_t tracked_nukes[MAX_TRACKED_NUKES];
+static nuke_table_t s_table;
+static SemaphoreHandle_t s_lock = NULL;
 static bool initialized = false;
 
+// ============================================================================
+// Hash table internals (no locking)
+// ============================================================================
+
+static inline uint32_t now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static inline uint32_t table_home(const nuke_table_t *t, uint32_t unit_id) {
+    // Fibonacci hashing: game unit IDs are mostly sequential, the multiply
+    // spreads them across the table.
+    return (unit_id * 2654435761u) >> t->hash_shift;
+}
+
+static inline void counter_inc(uint16_t *counter) {
+    if (*counter < UINT16_MAX) (*counter)++;
+}
+
+static inline void counter_dec(uint16_t *counter) {
+    if (*counter > 0) (*counter)--;
+}
+
+static esp_err_t table_init(nuke_table_t *t, uint32_t capacity) {
+    uint32_t cap = 16;
+    uint8_t bits = 4;
+    while (cap < capacity) {
+        cap <<= 1;
+        bits++;
+    }
+
+    memset(t, 0, sizeof(*t));
+
+    // Prefer PSRAM; fall back to internal RAM when PSRAM is not enabled.
+    t->slots = heap_caps_calloc(cap, sizeof(nuke_slot_t), MALLOC_CAP_SPIRAM);
+    if (!t->slots) {
+        t->slots = heap_caps_calloc(cap, sizeof(nuke_slot_t), MALLOC_CAP_8BIT);
+    }
+    if (!t->slots) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    t->capacity = cap;
+    t->mask = cap - 1;
+    t->hash_shift = 32 - bits;
+    return ESP_OK;
+}
+
+static void table_free(nuke_table_t *t) {
+    heap_caps_free(t->slots);
+    memset(t, 0, sizeof(*t));
+}
+
+static void table_clear(nuke_table_t *t) {
+    memset(t->slots, 0, t->capacity * sizeof(nuke_slot_t));
+    t->used = 0;
+    memset(t->in_flight, 0, sizeof(t->in_flight));
+    memset(t->exploded, 0, sizeof(t->exploded));
+    memset(t->intercepted, 0, sizeof(t->intercepted));
+    memset(t->total_in_flight, 0, sizeof(t->total_in_flight));
+}
+
+// Returns slot index holding unit_id, or capacity if not present
+static uint32_t table_find(const nuke_table_t *t, uint32_t unit_id) {
+    uint32_t i = table_home(t, unit_id);
+    for (uint32_t probe = 0; probe < t->capacity; probe++) {
+        const uint32_t id = t->slots[i].unit_id;
+        if (id == unit_id) return i;
+        if (id == 0) break;
+        i = (i + 1) & t->mask;
+    }
+    return t->capacity;
+}
+
+static esp_err_t table_insert(nuke_table_t *t, uint32_t unit_id, nuke_type_t type,
+                              nuke_direction_t direction, uint32_t launch_ms) {
+    uint32_t i = table_home(t, unit_id);
+    uint32_t probe = 0;
+    while (t->slots[i].unit_id != 0) {
+        if (t->slots[i].unit_id == unit_id) {
+            return ESP_ERR_INVALID_STATE;  // Already tracked
+        }
+        i = (i + 1) & t->mask;
+        probe++;
+    }
+
+    if (t->used >= (t->capacity / MAX_LOAD_DEN) * MAX_LOAD_NUM) {
+        t->dropped++;
+        return ESP_ERR_NO_MEM;
+    }
+
+    t->slots[i].unit_id = unit_id;
+    t->slots[i].launch_ms = launch_ms;
+    t->slots[i].type = (uint8_t)type;
+    t->slots[i].direction = (uint8_t)direction;
+    t->used++;
+    if (probe > t->max_probe) t->max_probe = probe;
+
+    counter_inc(&t->in_flight[type][direction]);
+    counter_inc(&t->total_in_flight[direction]);
+    return ESP_OK;
+}
+
+// Backward-shift deletion keeps probe chains intact without tombstones
+static void table_remove_at(nuke_table_t *t, uint32_t i) {
+    const nuke_slot_t *slot = &t->slots[i];
+    counter_dec(&t->in_flight[slot->type][slot->direction]);
+    counter_dec(&t->total_in_flight[slot->direction]);
+    t->used--;
+
+    uint32_t j = i;
+    while (true) {
+        j = (j + 1) & t->mask;
+        if (t->slots[j].unit_id == 0) break;
+
+        // Entry at j may move into the hole at i if its home slot is not
+        // within the cyclic range (i, j].
+        const uint32_t home = table_home(t, t->slots[j].unit_id);
+        if (((j - home) & t->mask) >= ((j - i) & t->mask)) {
+            t->slots[i] = t->slots[j];
+            i = j;
+        }
+    }
+    t->slots[i].unit_id = 0;
+}
+
+static uint32_t table_expire(nuke_table_t *t, nuke_direction_t direction,
+                             uint32_t now, uint32_t max_age_ms) {
+    if (t->total_in_flight[direction] == 0) return 0;
+
+    uint32_t count = 0;
+    uint32_t i = 0;
+    while (i < t->capacity) {
+        const nuke_slot_t *slot = &t->slots[i];
+        if (slot->unit_id != 0 && slot->direction == direction &&
+            (now - slot->launch_ms) > max_age_ms) {
+            ESP_LOGW(TAG, "Expiring nuke %lu (type=%d dir=%s): no resolve event after %lu ms",
+                     (unsigned long)slot->unit_id, slot->type,
+                     direction == NUKE_DIR_INCOMING ? "IN" : "OUT",
+                     (unsigned long)(now - slot->launch_ms));
+            table_remove_at(t, i);
+            count++;
+            continue;  // Re-check slot i: backward shift may have moved an entry here
+        }
+        i++;
+    }
+
+    t->expired += count;
+    return count;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
 esp_err_t nuke_tracker_init(void) {
     if (initialized) {
         ESP_LOGW(TAG, "Already initialized");
         return ESP_OK;
     }
-    
-    memset(tracked_nukes, 0, sizeof(tracked_nukes));
+
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        ESP_LOGE(TAG, "Failed to create tracker mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = table_init(&s_table, NUKE_TRACKER_CAPACITY);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to allocate nuke table (%d slots)", NUKE_TRACKER_CAPACITY);
+        vSemaphoreDelete(s_lock);
+        s_lock = NULL;
+        return ret;
+    }
     initialized = true;
-    
-    ESP_LOGI(TAG, "Nuke tracker initialized (max %d nukes)", MAX_TRACKED_NUKES);
+
+    ESP_LOGI(TAG, "Nuke tracker initialized (%lu slots, max %lu nukes, %s)",
+             (unsigned long)s_table.capacity,
+             (unsigned long)(s_table.capacity / MAX_LOAD_DEN) * MAX_LOAD_NUM,
+             esp_ptr_external_ram(s_table.slots) ? "PSRAM" : "internal RAM");
     return ESP_OK;
 }
 
@@ -35,39 +233,31 @@ esp_err_t nuke_tracker_register_launch(uint32_t unit_id, nuke_type_t type, nuke_
         ESP_LOGE(TAG, "Not initialized");
         return ESP_ERR_INVALID_STATE;
     }
-    
-    if (type >= NUKE_TYPE_COUNT) {
-        ESP_LOGE(TAG, "Invalid nuke type: %d", type);
+
+    if (type >= NUKE_TYPE_COUNT || unit_id == 0) {
+        ESP_LOGE(TAG, "Invalid nuke: unit=%lu type=%d", (unsigned long)unit_id, type);
         return ESP_ERR_INVALID_ARG;
     }
-    
-    // Check if already tracked
-    for (int i = 0; i < MAX_TRACKED_NUKES; i++) {
-        if (tracked_nukes[i].active && tracked_nukes[i].unit_id == unit_id) {
-            ESP_LOGW(TAG, "Nuke %lu already tracked", (unsigned long)unit_id);
-            return ESP_OK;
-        }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    esp_err_t ret = table_insert(&s_table, unit_id, type, direction, now_ms());
+    const uint32_t used = s_table.used;
+    xSemaphoreGive(s_lock);
+
+    if (ret == ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "Nuke %lu already tracked", (unsigned long)unit_id);
+        return ESP_OK;
     }
-    
-    // Find empty slot
-    for (int i = 0; i < MAX_TRACKED_NUKES; i++) {
-        if (!tracked_nukes[i].active) {
-            tracked_nukes[i].unit_id = unit_id;
-            tracked_nukes[i].type = type;
-            tracked_nukes[i].direction = direction;
-            tracked_nukes[i].state = NUKE_STATE_IN_FLIGHT;
-            tracked_nukes[i].active = true;
-            
-            ESP_LOGI(TAG, "Registered nuke %lu: type=%d dir=%s", 
-                    (unsigned long)unit_id, type, 
-                    direction == NUKE_DIR_INCOMING ? "IN" : "OUT");
-            
-            return ESP_OK;
-        }
+    if (ret == ESP_ERR_NO_MEM) {
+        ESP_LOGE(TAG, "Nuke table full, dropping nuke %lu (%lu tracked)",
+                 (unsigned long)unit_id, (unsigned long)used);
+        return ret;
     }
-    
-    ESP_LOGE(TAG, "No free slots for nuke tracking (max %d)", MAX_TRACKED_NUKES);
-    return ESP_ERR_NO_MEM;
+
+    ESP_LOGI(TAG, "Registered nuke %lu: type=%d dir=%s",
+            (unsigned long)unit_id, type,
+            direction == NUKE_DIR_INCOMING ? "IN" : "OUT");
+    return ESP_OK;
 }
 
 esp_err_t nuke_tracker_resolve_nuke(uint32_t unit_id, bool exploded) {
@@ -75,56 +265,145 @@ esp_err_t nuke_tracker_resolve_nuke(uint32_t unit_id, bool exploded) {
         ESP_LOGE(TAG, "Not initialized");
         return ESP_ERR_INVALID_STATE;
     }
-    
-    for (int i = 0; i < MAX_TRACKED_NUKES; i++) {
-        if (tracked_nukes[i].active && tracked_nukes[i].unit_id == unit_id) {
-            tracked_nukes[i].state = exploded ? NUKE_STATE_EXPLODED : NUKE_STATE_INTERCEPTED;
-            
-            ESP_LOGI(TAG, "Resolved nuke %lu: type=%d dir=%s state=%s", 
-                    (unsigned long)unit_id, tracked_nukes[i].type,
-                    tracked_nukes[i].direction == NUKE_DIR_INCOMING ? "IN" : "OUT",
-                    exploded ? "EXPLODED" : "INTERCEPTED");
-            
-            // Deactivate the slot
-            tracked_nukes[i].active = false;
-            
-            return ESP_OK;
-        }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    const uint32_t i = table_find(&s_table, unit_id);
+    if (i == s_table.capacity) {
+        xSemaphoreGive(s_lock);
+        ESP_LOGW(TAG, "Nuke %lu not found in tracker", (unsigned long)unit_id);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    const nuke_type_t type = (nuke_type_t)s_table.slots[i].type;
+    const nuke_direction_t direction = (nuke_direction_t)s_table.slots[i].direction;
+    if (exploded) {
+        counter_inc(&s_table.exploded[type][direction]);
+    } else {
+        counter_inc(&s_table.intercepted[type][direction]);
     }
-    
-    ESP_LOGW(TAG, "Nuke %lu not found in tracker", (unsigned long)unit_id);
-    return ESP_ERR_NOT_FOUND;
+    table_remove_at(&s_table, i);
+    xSemaphoreGive(s_lock);
+
+    ESP_LOGI(TAG, "Resolved nuke %lu: type=%d dir=%s state=%s",
+            (unsigned long)unit_id, type,
+            direction == NUKE_DIR_INCOMING ? "IN" : "OUT",
+            exploded ? "EXPLODED" : "INTERCEPTED");
+    return ESP_OK;
 }
 
 uint8_t nuke_tracker_get_active_count(nuke_type_t type, nuke_direction_t direction) {
     if (!initialized || type >= NUKE_TYPE_COUNT) {
         return 0;
     }
-    
-    uint8_t count = 0;
-    for (int i = 0; i < MAX_TRACKED_NUKES; i++) {
-        if (tracked_nukes[i].active && 
-            tracked_nukes[i].type == type && 
-            tracked_nukes[i].direction == direction &&
-            tracked_nukes[i].state == NUKE_STATE_IN_FLIGHT) {
-            count++;
-        }
+
+    // Counters are maintained incrementally; a single aligned read needs no lock.
+    const uint16_t count = s_table.in_flight[type][direction];
+    return count > UINT8_MAX ? UINT8_MAX : (uint8_t)count;
+}
+
+uint16_t nuke_tracker_get_total_active(nuke_direction_t direction) {
+    if (!initialized) {
+        return 0;
+    }
+    return s_table.total_in_flight[direction];
+}
+
+uint32_t nuke_tracker_expire_stale(nuke_direction_t direction) {
+    if (!initialized) {
+        return 0;
     }
-    
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    const uint32_t count = table_expire(&s_table, direction, now_ms(), NUKE_TRACKER_MAX_FLIGHT_MS);
+    xSemaphoreGive(s_lock);
     return count;
 }
 
+static bool entries_contain(const nuke_tracker_entry_t *entries, uint32_t count,
+                            const nuke_slot_t *slot) {
+    for (uint32_t k = 0; k < count; k++) {
+        if (entries[k].unit_id == slot->unit_id &&
+            entries[k].type == (nuke_type_t)slot->type &&
+            entries[k].direction == (nuke_direction_t)slot->direction) {
+            return true;
+        }
+    }
+    return false;
+}
+
+esp_err_t nuke_tracker_sync(const nuke_tracker_entry_t *entries, uint32_t count,
+                            nuke_direction_t direction) {
+    if (!initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (count > 0 && !entries) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t listed = 0;
+    uint32_t removed = 0;
+    uint32_t added = 0;
+    uint32_t rejected = 0;
+    const uint32_t now = now_ms();
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+
+    // Drop nukes the snapshot no longer lists. Snapshots are small, so a
+    // linear scan of the entries per occupied slot is cheaper than hashing.
+    uint32_t i = 0;
+    while (i < s_table.capacity && s_table.used > 0) {
+        const nuke_slot_t *slot = &s_table.slots[i];
+        if (slot->unit_id != 0 && slot->direction == direction &&
+            !entries_contain(entries, count, slot)) {
+            table_remove_at(&s_table, i);
+            removed++;
+            continue;  // Re-check slot i: backward shift may have moved an entry here
+        }
+        i++;
+    }
+
+    // Register nukes we missed; tracked ones keep their launch time
+    for (uint32_t k = 0; k < count; k++) {
+        const nuke_tracker_entry_t *e = &entries[k];
+        if (e->direction != direction || e->unit_id == 0 || e->type >= NUKE_TYPE_COUNT) {
+            continue;
+        }
+        listed++;
+        const esp_err_t ret = table_insert(&s_table, e->unit_id, e->type, e->direction, now);
+        if (ret == ESP_OK) {
+            added++;
+        } else if (ret == ESP_ERR_NO_MEM) {
+            rejected++;
+        }
+    }
+
+    xSemaphoreGive(s_lock);
+
+    ESP_LOGI(TAG, "Synced %s nukes: %lu listed, %lu added, %lu removed",
+             (direction == NUKE_DIR_INCOMING) ? "incoming" : "outgoing",
+             (unsigned long)listed, (unsigned long)added, (unsigned long)removed);
+    if (rejected > 0) {
+        ESP_LOGE(TAG, "Nuke table full, %lu snapshot nukes not tracked", (unsigned long)rejected);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
 void nuke_tracker_clear_all(void) {
     if (!initialized) {
         return;
     }
-    
-    ESP_LOGI(TAG, "Clearing all tracked nukes");
-    memset(tracked_nukes, 0, sizeof(tracked_nukes));
+
+    ESP_LOGI(TAG, "Clearing all tracked nukes (dropped=%lu expired=%lu max_probe=%lu)",
+             (unsigned long)s_table.dropped, (unsigned long)s_table.expired,
+             (unsigned long)s_table.max_probe);
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    table_clear(&s_table);
+    xSemaphoreGive(s_lock);
 }
 
 void nuke_tracker_get_stats(nuke_type_t type, nuke_direction_t direction,
-                           uint8_t *out_in_flight, uint8_t *out_exploded, 
+                           uint8_t *out_in_flight, uint8_t *out_exploded,
                            uint8_t *out_intercepted) {
     if (!initialized || type >= NUKE_TYPE_COUNT) {
         if (out_in_flight) *out_in_flight = 0;
@@ -132,28 +411,75 @@ void nuke_tracker_get_stats(nuke_type_t type, nuke_direction_t direction,
         if (out_intercepted) *out_intercepted = 0;
         return;
     }
-    
-    uint8_t in_flight = 0, exploded = 0, intercepted = 0;
-    
-    for (int i = 0; i < MAX_TRACKED_NUKES; i++) {
-        if (tracked_nukes[i].active && 
-            tracked_nukes[i].type == type && 
-            tracked_nukes[i].direction == direction) {
-            switch (tracked_nukes[i].state) {
-                case NUKE_STATE_IN_FLIGHT:
-                    in_flight++;
-                    break;
-                case NUKE_STATE_EXPLODED:
-                    exploded++;
-                    break;
-                case NUKE_STATE_INTERCEPTED:
-                    intercepted++;
-                    break;
-            }
-        }
+
+    const uint16_t in_flight = s_table.in_flight[type][direction];
+    const uint16_t exploded = s_table.exploded[type][direction];
+    const uint16_t intercepted = s_table.intercepted[type][direction];
+
+    if (out_in_flight) *out_in_flight = in_flight > UINT8_MAX ? UINT8_MAX : (uint8_t)in_flight;
+    if (out_exploded) *out_exploded = exploded > UINT8_MAX ? UINT8_MAX : (uint8_t)exploded;
+    if (out_intercepted) *out_intercepted = intercepted > UINT8_MAX ? UINT8_MAX : (uint8_t)intercepted;
+}
+
+static uint32_t gcd_u32(uint32_t a, uint32_t b) {
+    while (b != 0) {
+        const uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+esp_err_t nuke_tracker_benchmark(uint32_t count) {
+    if (count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Private table sized like the production one would need to be for this
+    // barrage; the live tracker is left untouched.
+    nuke_table_t t;
+    esp_err_t ret = table_init(&t, (count / MAX_LOAD_NUM) * MAX_LOAD_DEN + MAX_LOAD_DEN);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Benchmark: cannot allocate table for %lu nukes", (unsigned long)count);
+        return ret;
+    }
+
+    // Synthetic barrage: mostly-sequential unit IDs (as the game assigns them)
+    // with mixed types and directions.
+    const uint32_t base_id = 100000;
+    int64_t start = esp_timer_get_time();
+    for (uint32_t n = 0; n < count; n++) {
+        (void)table_insert(&t, base_id + n * 3, (nuke_type_t)(n % NUKE_TYPE_COUNT),
+                           (nuke_direction_t)((n / 7) % DIR_COUNT), 0);
+    }
+    const int64_t insert_us = esp_timer_get_time() - start;
+
+    volatile uint32_t sink = 0;
+    start = esp_timer_get_time();
+    for (uint32_t n = 0; n < count; n++) {
+        sink += t.in_flight[n % NUKE_TYPE_COUNT][n % DIR_COUNT];
+    }
+    const int64_t count_us = esp_timer_get_time() - start;
+
+    // Resolve in a scattered order (stride coprime with count)
+    uint32_t stride = 7919 % count;
+    while (stride == 0 || gcd_u32(stride, count) != 1) stride++;
+    start = esp_timer_get_time();
+    for (uint32_t n = 0, k = 0; n < count; n++, k = (k + stride) % count) {
+        const uint32_t i = table_find(&t, base_id + k * 3);
+        if (i != t.capacity) table_remove_at(&t, i);
     }
-    
-    if (out_in_flight) *out_in_flight = in_flight;
-    if (out_exploded) *out_exploded = exploded;
-    if (out_intercepted) *out_intercepted = intercepted;
+    const int64_t resolve_us = esp_timer_get_time() - start;
+
+    ESP_LOGI(TAG, "Benchmark: %lu nukes, %lu slots, max_probe=%lu dropped=%lu leftover=%lu",
+             (unsigned long)count, (unsigned long)t.capacity, (unsigned long)t.max_probe,
+             (unsigned long)t.dropped, (unsigned long)t.used);
+    ESP_LOGI(TAG, "Benchmark: register %lld us (%lld ns/op), count %lld us, resolve %lld us (%lld ns/op)",
+             (long long)insert_us, (long long)(insert_us * 1000 / count),
+             (long long)count_us,
+             (long long)resolve_us, (long long)(resolve_us * 1000 / count));
+    (void)sink;
+
+    table_free(&t);
+    return ESP_OK;
 }
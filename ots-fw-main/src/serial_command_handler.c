@@ -4,6 +4,14 @@
 #include "wifi_credentials.h"
 #include "device_settings.h"
 #include "nvs_storage.h"
+#include "module_manager.h"
+#include "nuke_state_manager.h"
+#include "ws_io.h"
+#include "ws_handlers.h"
+#include "system_status_module.h"
+#include "boot_sequence.h"
+#include "troops_module.h"
+#include "event_dispatcher.h"
 
 #include "esp_log.h"
 #include "esp_system.h"
@@ -109,6 +117,68 @@ static void handle_line(char *line) {
         return;
     }
 
+    if (strcmp(cmd, "modules") == 0 || strcmp(cmd, "mod-stats") == 0) {
+        module_manager_log_stats();
+        return;
+    }
+
+    if (strcmp(cmd, "ws-stats") == 0) {
+        ws_io_log_stats();
+        ws_handlers_rx_stats_t rx;
+        ws_handlers_get_rx_stats(&rx);
+        ESP_LOGI(TAG, "ws-rx: frames=%lu events=%lu batches=%lu busy=%lluus (%lu us/event)",
+                 (unsigned long)rx.frames, (unsigned long)rx.events, (unsigned long)rx.batches,
+                 (unsigned long long)rx.busy_us,
+                 rx.events ? (unsigned long)(rx.busy_us / rx.events) : 0UL);
+        return;
+    }
+
+    if (strcmp(cmd, "boot") == 0) {
+        boot_sequence_log_timeline();
+        return;
+    }
+
+    if (strcmp(cmd, "event-stats") == 0) {
+        char *arg = next_token(&cursor);
+        if (arg && strcmp(arg, "reset") == 0) {
+            event_dispatcher_reset_stats();
+            ESP_LOGI(TAG, "Event stats reset");
+            return;
+        }
+        event_dispatcher_log_stats();
+        return;
+    }
+
+    if (strcmp(cmd, "slider-stats") == 0) {
+        char *arg = next_token(&cursor);
+        if (arg && strcmp(arg, "reset") == 0) {
+            troops_reset_slider_stats();
+            ESP_LOGI(TAG, "Slider stats reset");
+            return;
+        }
+        troops_log_slider_stats();
+        return;
+    }
+
+    if (strcmp(cmd, "lcd-stats") == 0) {
+        system_status_log_lcd_stats();
+        return;
+    }
+
+    if (strcmp(cmd, "nuke-bench") == 0) {
+        char *count_str = next_token(&cursor);
+        long count = count_str ? strtol(count_str, NULL, 10) : 1000;
+        if (count <= 0 || count > 100000) {
+            ESP_LOGW(TAG, "Usage: nuke-bench [count 1..100000]");
+            return;
+        }
+        esp_err_t ret = nuke_tracker_benchmark((uint32_t)count);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "nuke-bench failed: %s", esp_err_to_name(ret));
+        }
+        return;
+    }
+
     if (strcmp(cmd, "reboot") == 0 || strcmp(cmd, "reset") == 0) {
         ESP_LOGI(TAG, "%s: rebooting...", cmd);
         vTaskDelay(pdMS_TO_TICKS(200));
@@ -220,7 +290,7 @@ static void handle_line(char *line) {
     }
 
     ESP_LOGW(TAG, "Unknown command: %s", cmd);
-    ESP_LOGW(TAG, "Supported: wifi-status | wifi-clear | wifi-provision <ssid> <password> | version | reboot | nvs set/erase/get <owner_name|serial_number>");
+    ESP_LOGW(TAG, "Supported: wifi-status | wifi-clear | wifi-provision <ssid> <password> | version | modules | boot | ws-stats | event-stats [reset] | slider-stats [reset] | lcd-stats | nuke-bench [count] | reboot | nvs set/erase/get <owner_name|serial_number>");
 }
 
 static void serial_task(void *arg) {
@@ -292,6 +362,6 @@ esp_err_t serial_commands_init(void) {
         return ESP_FAIL;
     }
 
-    ESP_LOGI(TAG, "Serial commands ready (wifi-status, wifi-clear, wifi-provision, version, reboot, nvs)");
+    ESP_LOGI(TAG, "Serial commands ready (wifi-status, wifi-clear, wifi-provision, version, modules, ws-stats, event-stats, slider-stats, lcd-stats, nuke-bench, reboot, nvs)");
     return ESP_OK;
 }
@@ -0,0 +1,79 @@
+#include "slider_filter.h"
+#include <string.h>
+
+static uint32_t remaining_ms(uint32_t since_ms, uint32_t period_ms, uint32_t now_ms) {
+    const uint32_t elapsed = now_ms - since_ms;
+    return (elapsed >= period_ms) ? 0 : (period_ms - elapsed);
+}
+
+static bool differs(const slider_filter_t *f, uint8_t percent) {
+    const int diff = (int)percent - (int)f->sent;
+    return (diff < 0 ? -diff : diff) >= (int)f->cfg.threshold;
+}
+
+void slider_filter_init(slider_filter_t *f, const slider_filter_config_t *cfg) {
+    memset(f, 0, sizeof(*f));
+    f->cfg = *cfg;
+    if (f->cfg.threshold == 0) {
+        f->cfg.threshold = 1;
+    }
+}
+
+void slider_filter_resend(slider_filter_t *f) {
+    f->have_sent = false;
+}
+
+slider_send_t slider_filter_update(slider_filter_t *f, uint8_t percent, uint32_t sample_ms,
+                                   uint32_t now_ms, uint8_t *out_percent) {
+    if (!f->have_sample || percent != f->sample) {
+        if (f->have_sample) {
+            f->moving = true;
+            f->last_motion_ms = sample_ms;
+        }
+        f->sample = percent;
+        f->have_sample = true;
+    }
+
+    slider_send_t result = SLIDER_SEND_NONE;
+    if (!f->have_sent) {
+        result = SLIDER_SEND_FINAL;
+    } else if (f->moving) {
+        if (remaining_ms(f->last_motion_ms, f->cfg.settle_ms, now_ms) == 0) {
+            f->moving = false;
+            if (percent != f->sent) {
+                result = SLIDER_SEND_FINAL;
+            }
+        } else if (differs(f, percent) &&
+                   remaining_ms(f->last_send_ms, f->cfg.min_interval_ms, now_ms) == 0) {
+            // The first change after a rest always passes: last_send_ms is old
+            result = SLIDER_SEND_INTERMEDIATE;
+        }
+    } else if (percent != f->sent) {
+        result = SLIDER_SEND_FINAL;
+    }
+
+    if (result != SLIDER_SEND_NONE) {
+        f->sent = percent;
+        f->have_sent = true;
+        f->last_send_ms = now_ms;
+        if (out_percent) {
+            *out_percent = percent;
+        }
+    }
+    return result;
+}
+
+uint32_t slider_filter_next_ms(const slider_filter_t *f, uint32_t now_ms) {
+    if (!f->moving) {
+        return UINT32_MAX;
+    }
+
+    uint32_t next = remaining_ms(f->last_motion_ms, f->cfg.settle_ms, now_ms);
+    if (differs(f, f->sample)) {
+        const uint32_t throttle = remaining_ms(f->last_send_ms, f->cfg.min_interval_ms, now_ms);
+        if (throttle < next) {
+            next = throttle;
+        }
+    }
+    return next;
+}
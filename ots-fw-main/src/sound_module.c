@@ -12,6 +12,11 @@
 
 static const char *TAG = "SOUND_MODULE";
 
+// Discovery runs in the CAN RX task so boot does not wait for the answer;
+// the audio module may still be booting, so the query is repeated
+#define DISCOVERY_RETRY_MS   500
+#define DISCOVERY_WINDOW_MS  5000
+
 // Module state
 typedef struct {
     bool initialized;
@@ -23,6 +28,9 @@ typedef struct {
     
     // Discovery state
     bool audio_module_discovered;
+    bool discovery_pending;             // Still querying within the window
+    uint64_t discovery_deadline_ms;
+    uint64_t last_query_ms;
     uint8_t audio_module_version_major;
     uint8_t audio_module_version_minor;
 } sound_module_state_t;
@@ -33,7 +41,6 @@ static TaskHandle_t s_can_rx_task = NULL;
 
 // Forward declarations
 static esp_err_t sound_init(void);
-static esp_err_t sound_update(void);
 static bool sound_handle_event(const internal_event_t *event);
 static void sound_get_status(module_status_t *status);
 static esp_err_t sound_shutdown(void);
@@ -61,6 +68,8 @@ static void can_rx_task(void *arg) {
                 if (can_discovery_parse_announce(&frame, &info) == ESP_OK) {
                     if (info.module_type == MODULE_TYPE_AUDIO) {
                         s_state.audio_module_discovered = true;
+                        s_state.discovery_pending = false;
+                        s_state.can_ready = true;  // Also when it answered after the window
                         s_state.audio_module_version_major = info.version_major;
                         s_state.audio_module_version_minor = info.version_minor;
                         ESP_LOGI(TAG, "Audio module v%d.%d discovered on CAN block 0x%02X",
@@ -81,15 +90,35 @@ static void can_rx_task(void *arg) {
             vTaskDelay(pdMS_TO_TICKS(1));
         }
         // If timeout (no CAN traffic), just continue and check again
+        
+        if (s_state.discovery_pending) {
+            const uint64_t now_ms = esp_timer_get_time() / 1000;
+            if (now_ms >= s_state.discovery_deadline_ms) {
+                s_state.discovery_pending = false;
+                ESP_LOGW(TAG, "✗ No audio module detected - sound features disabled");
+                s_state.can_ready = false;  // Disable sound features
+            } else if (now_ms - s_state.last_query_ms >= DISCOVERY_RETRY_MS) {
+                s_state.last_query_ms = now_ms;
+                (void)can_discovery_query_all();
+            }
+        }
     }
 }
 
+// Events sound_handle_event() acts on
+static const game_event_type_t s_sound_events[] = {
+    GAME_EVENT_SOUND_PLAY,
+    GAME_EVENT_INVALID
+};
+
 // Module interface
 static hardware_module_t s_sound_module = {
     .name = "Sound Module",
     .enabled = true,
+    .blocking_events = true,  // Play/stop commands over CAN
+    .event_types = s_sound_events,
     .init = sound_init,
-    .update = sound_update,
+    .update = NULL,  // Event-driven only: CAN RX handled by can_rx_task
     .handle_event = sound_handle_event,
     .get_status = sound_get_status,
     .shutdown = sound_shutdown
@@ -127,6 +156,9 @@ static esp_err_t sound_init(void) {
     s_state.last_sound_index = 0;
     s_state.last_play_time = 0;
     s_state.audio_module_discovered = false;
+    s_state.last_query_ms = esp_timer_get_time() / 1000;
+    s_state.discovery_deadline_ms = s_state.last_query_ms + DISCOVERY_WINDOW_MS;
+    s_state.discovery_pending = true;
     
     // Start CAN RX task to receive discovery announcements and responses
     // Use PinnedToCore with tskNO_AFFINITY and priority 6 (matches audiomodule pattern)
@@ -144,48 +176,19 @@ static esp_err_t sound_init(void) {
         return ESP_FAIL;
     }
     
-    // Send module discovery query
+    // Send module discovery query (answers are handled by can_rx_task)
     ESP_LOGI(TAG, "Discovering CAN modules...");
     ret = can_discovery_query_all();
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "Failed to send discovery query: %s", esp_err_to_name(ret));
     }
     
-    // Wait for discovery responses
-    vTaskDelay(pdMS_TO_TICKS(500));
-    
-    if (s_state.audio_module_discovered) {
-        ESP_LOGI(TAG, "✓ Audio module v%d.%d detected",
-                 s_state.audio_module_version_major,
-                 s_state.audio_module_version_minor);
-    } else {
-        ESP_LOGW(TAG, "✗ No audio module detected - sound features disabled");
-        s_state.can_ready = false;  // Disable sound features
-    }
-    
     ESP_LOGI(TAG, "Sound module initialized successfully");
     ESP_LOGI(TAG, "Mode: MOCK (CAN messages logged only)");
     
     return ESP_OK;
 }
 
-/**
- * @brief Update sound module (periodic)
- * 
- * In real implementation, this would:
- * - Check for incoming CAN STATUS messages from audio controller
- * - Update connection/playback status
- * - Handle timeouts
- */
-static esp_err_t sound_update(void) {
-    if (!s_state.initialized) return ESP_FAIL;
-    
-    // Mock: No periodic processing needed
-    // Real implementation would poll CAN RX queue for STATUS/ACK messages
-    
-    return ESP_OK;
-}
-
 /**
  * @brief Handle incoming events
  */
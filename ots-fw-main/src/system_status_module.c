@@ -12,11 +12,13 @@
 
 #include "system_status_module.h"
 #include "lcd_driver.h"
+#include "lcd_screen.h"
 #include "i2c_handler.h"
 #include "game_state_manager.h"
 #include "protocol.h"
 #include "network_manager.h"
 #include "http_server.h"
+#include "module_manager.h"
 #include <esp_log.h>
 #include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
@@ -25,12 +27,16 @@
 
 static const char *TAG = "OTS_SYS_STATUS";
 
+#define ANIMATION_FRAME_MS      250   // Scan-dot animation frame period
+#define DISPLAY_RETRY_MS        100   // Re-check interval while waiting for the WSS server
+#define SPLASH_HOLD_MS          1200  // Splash shown before the first real screen
+#define SPLASH_BAR_STEPS        20    // Progress bar updates during the splash hold
+
 // Module state
 // Animation state (shared for all animated screens)
 typedef struct {
     uint8_t frame;
     uint64_t last_update_ms;
-    char last_line2[LCD_COLS + 1];
 } animation_state_t;
 
 typedef struct {
@@ -38,89 +44,176 @@ typedef struct {
     bool lcd_available;   // Is LCD hardware present?
     bool display_active;  // Are we controlling the display?
     bool display_dirty;
+    bool lcd_owned;       // LCD content is ours since the last screen (troops module not drawn since)
     bool player_won;      // true = victory, false = defeat
     bool show_game_end;   // Show game end screen
     bool ws_connected;    // WebSocket connection status
+    uint64_t splash_start_ms;   // Splash bar running since (0 = hold over)
+    uint8_t splash_step;        // Bar steps drawn
     animation_state_t animation;
+    uint32_t stats_i2c_bytes;   // lcd_get_i2c_bytes() at the last stats report
+    int64_t stats_since_us;
 } system_status_state_t;
 
 static system_status_state_t module_state = {0};
 
+// ============================================================================
+// Screens (templates in flash, dynamic parts rendered into fixed slots)
+// ============================================================================
+
+static const lcd_screen_template_t SCREEN_SPLASH = {{
+    "  OTS Firmware  ",
+    "                ",   // Boot progress bar, cols 2-13
+}};
+static const lcd_screen_template_t SCREEN_CAPTIVE_PORTAL = {{
+    "   Setup WiFi   ",
+    "  Read Manual   ",
+}};
+static const lcd_screen_template_t SCREEN_WAITING = {{
+    " Waiting for    ",
+    " Connection     ",   // Scan dots in cols 13-15
+}};
+static const lcd_screen_template_t SCREEN_LOBBY = {{
+    " Connected!     ",
+    " Waiting Game   ",   // Scan dots in cols 13-15
+}};
+static const lcd_screen_template_t SCREEN_SPAWNING = {{
+    "   Spawning...  ",
+    " Get Ready!     ",
+}};
+static const lcd_screen_template_t SCREEN_VICTORY = {{
+    "   VICTORY!     ",
+    " Good Game!     ",
+}};
+static const lcd_screen_template_t SCREEN_DEFEAT = {{
+    "    DEFEAT      ",
+    " Good Game!     ",
+}};
+static const lcd_screen_template_t SCREEN_SHUTDOWN = {{
+    "  Shutting down ",
+    "                ",
+}};
+
+// Scan dots bouncing over the last three cells of line 2. Consecutive
+// frames differ in two cells, which is all a frame sends.
+static const lcd_animation_t ANIM_SCAN_DOTS = {
+    .col = LCD_COLS - 3,
+    .row = 1,
+    .width = 3,
+    .frame_count = 4,
+    .frames = ".  " " . " "  ." " . ",
+};
+
 // ============================================================================
 // Display Functions
 // ============================================================================
 
-// Helper to display simple two-line screens
-static void display_two_lines(const char *line1, const char *line2) {
-    lcd_clear();
-    lcd_set_cursor(0, 0);
-    lcd_write_string(line1);
-    lcd_set_cursor(0, 1);
-    lcd_write_string(line2);
+// Compose a screen and send the cells that changed
+static void show_screen(const lcd_screen_template_t *screen, const lcd_animation_t *anim) {
+    if (!module_state.lcd_owned) {
+        // Another module drew since our last screen: shadow no longer matches
+        lcd_screen_invalidate();
+        module_state.lcd_owned = true;
+    }
+    lcd_screen_load(screen);
+    if (anim) {
+        lcd_screen_put_frame(anim, module_state.animation.frame);
+    }
+    lcd_screen_flush();
 }
 
-static void display_splash(void) {
-    display_two_lines("  OTS Firmware  ", "  Booting...    ");
+// Hand the LCD to the troops module
+static void yield_display(void) {
+    module_state.display_active = false;
+    module_state.lcd_owned = false;
+    module_state.splash_start_ms = 0;  // Game started during the splash
 }
 
-static void display_captive_portal(void) {
-    display_two_lines("   Setup WiFi   ", "  Read Manual   ");
+static void draw_splash(uint8_t step) {
+    lcd_screen_load(&SCREEN_SPLASH);
+    lcd_screen_put_bar(2, 1, LCD_COLS - 4, step, SPLASH_BAR_STEPS);
+    lcd_screen_flush();
+    module_state.splash_step = step;
 }
 
-static void display_waiting_connection(void) {
-    // Line 2 animated by system_status_update(); starts at frame 0
-    display_two_lines(" Waiting for    ", " Connection   .  ");
+// Show the splash with an empty bar; update() fills it (boot goes on meanwhile)
+static void display_splash(void) {
+    module_state.splash_start_ms = esp_timer_get_time() / 1000;
+    draw_splash(0);
 }
 
-static void display_lobby(void) {
-    // Line 2 animated by system_status_update(); starts at frame 0
-    display_two_lines(" Connected!     ", " Waiting Game.  ");
+// Advance the splash bar. Returns true once the hold is over.
+static bool update_splash(void) {
+    const uint64_t elapsed_ms = esp_timer_get_time() / 1000 - module_state.splash_start_ms;
+    uint8_t step = SPLASH_BAR_STEPS;
+    if (elapsed_ms < SPLASH_HOLD_MS) {
+        step = (uint8_t)(elapsed_ms * SPLASH_BAR_STEPS / SPLASH_HOLD_MS);
+    }
+    if (step != module_state.splash_step) {
+        draw_splash(step);
+    }
+    if (step < SPLASH_BAR_STEPS) {
+        return false;
+    }
+    module_state.splash_start_ms = 0;
+    return true;
 }
 
-// Unified animation helper for all scan-dot animations
-static void animate_scan_line2(const char *prefix, uint8_t frame) {
-    static const char *suffixes[] = {".  ", " . ", "  .", " . "};
-    
-    char line2[LCD_COLS + 1];
-    memset(line2, ' ', LCD_COLS);
-    line2[LCD_COLS] = '\0';
+static void display_captive_portal(void) {
+    show_screen(&SCREEN_CAPTIVE_PORTAL, NULL);
+}
 
-    memcpy(line2, prefix, strlen(prefix));
-    const char *suffix = suffixes[frame % 4];
-    memcpy(line2 + (LCD_COLS - 3), suffix, 3);
+static void display_waiting_connection(void) {
+    // Dots animated by system_status_update(); starts at frame 0
+    show_screen(&SCREEN_WAITING, &ANIM_SCAN_DOTS);
+}
 
-    if (strncmp(module_state.animation.last_line2, line2, LCD_COLS) != 0) {
-        lcd_write_line(1, line2);
-        memcpy(module_state.animation.last_line2, line2, LCD_COLS + 1);
-    }
+static void display_lobby(void) {
+    // Dots animated by system_status_update(); starts at frame 0
+    show_screen(&SCREEN_LOBBY, &ANIM_SCAN_DOTS);
 }
 
-// Update animation if enough time has passed
-static bool update_animation_if_needed(const char *prefix) {
+// Advance the animation if enough time has passed
+static bool update_animation_if_needed(const lcd_animation_t *anim) {
     const uint64_t now_ms = esp_timer_get_time() / 1000;
     if (module_state.animation.last_update_ms == 0 || 
-        (now_ms - module_state.animation.last_update_ms) >= 250) {
+        (now_ms - module_state.animation.last_update_ms) >= ANIMATION_FRAME_MS) {
         module_state.animation.last_update_ms = now_ms;
-        module_state.animation.frame = (module_state.animation.frame + 1) % 4;
-        animate_scan_line2(prefix, module_state.animation.frame);
+        module_state.animation.frame = (module_state.animation.frame + 1) % anim->frame_count;
+        lcd_screen_put_frame(anim, module_state.animation.frame);
+        lcd_screen_flush();
         return true;
     }
     return false;
 }
 
+// Animation of the screen currently shown, or NULL if static
+static const lcd_animation_t *current_animation(void) {
+    // Waiting screen (not in portal mode)
+    if (!module_state.ws_connected && !network_manager_is_portal_mode()) {
+        return &ANIM_SCAN_DOTS;
+    }
+
+    // Lobby screen
+    if (module_state.ws_connected && !module_state.show_game_end && 
+        game_state_get_phase() == GAME_PHASE_LOBBY) {
+        return &ANIM_SCAN_DOTS;
+    }
+
+    return NULL;
+}
+
 static void reset_animation_state(void) {
     module_state.animation.frame = 0;
     module_state.animation.last_update_ms = 0;
-    memset(module_state.animation.last_line2, 0, sizeof(module_state.animation.last_line2));
 }
 
 static void display_choose_spawn(void) {
-    display_two_lines("   Spawning...  ", " Get Ready!     ");
+    show_screen(&SCREEN_SPAWNING, NULL);
 }
 
 static void display_game_end(bool victory) {
-    const char *line1 = victory ? "   VICTORY!     " : "    DEFEAT      ";
-    display_two_lines(line1, " Good Game!     ");
+    show_screen(victory ? &SCREEN_VICTORY : &SCREEN_DEFEAT, NULL);
 }
 
 // ============================================================================
@@ -139,14 +232,17 @@ static esp_err_t system_status_init(void) {
     } else {
         ESP_LOGI(TAG, "LCD initialized successfully at 0x%02X", LCD_I2C_ADDR);
         module_state.lcd_available = true;
+
+        if (lcd_screen_init() != ESP_OK) {
+            ESP_LOGW(TAG, "Bar glyphs not loaded - progress bars will show garbage");
+        }
+        module_state.lcd_owned = true;
         
-        // Show splash screen on boot
+        // Show splash screen on boot. After a short splash (bar filling, driven
+        // by update() so init does not block boot), move to the normal
+        // "waiting for connection" screen. This prevents the LCD from sitting
+        // on the splash forever if there are no events yet.
         display_splash();
-
-        // After a short splash, move to the normal "waiting for connection" screen.
-        // This prevents the LCD from sitting on "Booting..." forever if there are
-        // no events yet.
-        vTaskDelay(pdMS_TO_TICKS(1200));
     }
     
     module_state.initialized = true;
@@ -164,10 +260,13 @@ static esp_err_t system_status_update(void) {
     // Skip all LCD operations if hardware not present
     if (!module_state.lcd_available) return ESP_OK;
 
+    // Splash bar still filling
+    if (module_state.splash_start_ms && !update_splash()) return ESP_OK;
+
     // Auto-yield LCD control when game starts
     if (module_state.display_active && module_state.ws_connected && 
         !module_state.show_game_end && game_state_get_phase() == GAME_PHASE_IN_GAME) {
-        module_state.display_active = false;
+        yield_display();
     }
 
     // Handle display updates when we're in control and display is dirty
@@ -210,7 +309,7 @@ static esp_err_t system_status_update(void) {
                 display_choose_spawn();
                 break;
             case GAME_PHASE_IN_GAME:
-                module_state.display_active = false;  // Yield to troops module
+                yield_display();  // Yield to troops module
                 break;
             case GAME_PHASE_WON:
             case GAME_PHASE_LOST:
@@ -230,21 +329,41 @@ static esp_err_t system_status_update(void) {
     // Handle animations (only when display is active)
     if (!module_state.display_active) return ESP_OK;
     
-    // Animate waiting screen (not in portal mode)
-    if (!module_state.ws_connected && !network_manager_is_portal_mode()) {
-        update_animation_if_needed(" Connection   ");
-        return ESP_OK;
-    }
-
-    // Animate lobby screen
-    if (module_state.ws_connected && !module_state.show_game_end && 
-        game_state_get_phase() == GAME_PHASE_LOBBY) {
-        update_animation_if_needed(" Waiting Game");
+    const lcd_animation_t *anim = current_animation();
+    if (anim) {
+        update_animation_if_needed(anim);
     }
     
     return ESP_OK;
 }
 
+static uint32_t system_status_next_wake_ms(void) {
+    if (!module_state.initialized || !module_state.lcd_available || !module_state.display_active) {
+        return MODULE_WAKE_NEVER;
+    }
+
+    if (module_state.splash_start_ms) {
+        return SPLASH_HOLD_MS / SPLASH_BAR_STEPS;
+    }
+
+    // Screen still pending (splash kept until the WSS server is up)
+    if (module_state.display_dirty) {
+        return DISPLAY_RETRY_MS;
+    }
+
+    if (current_animation()) {
+        const uint64_t now_ms = esp_timer_get_time() / 1000;
+        const uint64_t elapsed_ms = now_ms - module_state.animation.last_update_ms;
+        if (module_state.animation.last_update_ms == 0 || elapsed_ms >= ANIMATION_FRAME_MS) {
+            return 0;
+        }
+        return (uint32_t)(ANIMATION_FRAME_MS - elapsed_ms);
+    }
+
+    // Static screen: sleep until an event marks the display dirty
+    return MODULE_WAKE_NEVER;
+}
+
 static bool system_status_handle_event(const internal_event_t *event) {
     if (!module_state.initialized || !event) return false;
     
@@ -257,6 +376,7 @@ static bool system_status_handle_event(const internal_event_t *event) {
             module_state.display_dirty = true;
             module_state.show_game_end = false;
             reset_animation_state();
+            module_manager_notify(system_status_module_get());
             return true;
             
         case INTERNAL_EVENT_WS_DISCONNECTED:
@@ -267,12 +387,29 @@ static bool system_status_handle_event(const internal_event_t *event) {
             module_state.display_dirty = true;
             module_state.show_game_end = false;
             reset_animation_state();
+            module_manager_notify(system_status_module_get());
             return true;
             
         case GAME_EVENT_GAME_START:
             ESP_LOGI(TAG, "Game started - yielding LCD control to troops module");
-            module_state.display_active = false;
+            yield_display();
             module_state.show_game_end = false;
+            module_manager_notify(system_status_module_get());
+            return true;
+
+        case INTERNAL_EVENT_STATE_SNAPSHOT:
+            // Snapshot already set the phase; show the matching screen
+            // (update() renders lobby/spawn/end screens from the phase).
+            module_state.show_game_end = false;
+            if (game_state_get_phase() == GAME_PHASE_IN_GAME) {
+                ESP_LOGI(TAG, "Snapshot: in game - yielding LCD control to troops module");
+                yield_display();
+            } else {
+                module_state.display_active = true;
+                module_state.display_dirty = true;
+                reset_animation_state();
+            }
+            module_manager_notify(system_status_module_get());
             return true;
 
         case GAME_EVENT_GAME_SPAWNING:
@@ -280,6 +417,7 @@ static bool system_status_handle_event(const internal_event_t *event) {
             module_state.display_active = true;
             module_state.display_dirty = true;
             module_state.show_game_end = false;
+            module_manager_notify(system_status_module_get());
             return true;
             
         case GAME_EVENT_GAME_END: {
@@ -298,6 +436,7 @@ static bool system_status_handle_event(const internal_event_t *event) {
                 ESP_LOGI(TAG, "Game ended (unknown outcome) - returning to lobby");
                 module_state.show_game_end = false;
             }
+            module_manager_notify(system_status_module_get());
             return true;
         }
             
@@ -319,9 +458,9 @@ static void system_status_get_status(module_status_t *status) {
 static esp_err_t system_status_shutdown(void) {
     ESP_LOGI(TAG, "Shutting down system status module");
     
-    lcd_clear();
-    lcd_set_cursor(0, 0);
-    lcd_write_string("  Shutting down ");
+    if (module_state.lcd_available) {
+        show_screen(&SCREEN_SHUTDOWN, NULL);
+    }
     
     module_state.initialized = false;
     return ESP_OK;
@@ -336,6 +475,7 @@ static const hardware_module_t system_status_module = {
     .enabled = true,
     .init = system_status_init,
     .update = system_status_update,
+    .next_wake_ms = system_status_next_wake_ms,
     .handle_event = system_status_handle_event,
     .get_status = system_status_get_status,
     .shutdown = system_status_shutdown
@@ -345,11 +485,39 @@ const hardware_module_t* system_status_module_get(void) {
     return &system_status_module;
 }
 
+void system_status_log_lcd_stats(void) {
+    if (!module_state.lcd_available) {
+        ESP_LOGI(TAG, "LCD not present");
+        return;
+    }
+
+    const int64_t now_us = esp_timer_get_time();
+    const uint32_t bytes = lcd_get_i2c_bytes();
+    const uint32_t window_bytes = bytes - module_state.stats_i2c_bytes;
+    const int64_t window_us = now_us - module_state.stats_since_us;
+
+    lcd_screen_stats_t stats;
+    lcd_screen_get_stats(&stats);
+    const lcd_animation_t *anim = module_state.display_active ? current_animation() : NULL;
+    ESP_LOGI(TAG, "LCD: %s, I2C %lu bytes in %lld ms (%lu B/s), total %lu bytes",
+             !module_state.display_active ? "yielded" : (anim ? "animating" : "static"),
+             (unsigned long)window_bytes, (long long)(window_us / 1000),
+             window_us > 0 ? (unsigned long)(((uint64_t)window_bytes * 1000000ULL) / (uint64_t)window_us) : 0UL,
+             (unsigned long)bytes);
+    ESP_LOGI(TAG, "LCD: %lu flushes, %lu cells, %lu cursor moves",
+             (unsigned long)stats.flushes, (unsigned long)stats.cells_written,
+             (unsigned long)stats.cursor_moves);
+
+    module_state.stats_i2c_bytes = bytes;
+    module_state.stats_since_us = now_us;
+}
+
 void system_status_refresh_display(void) {
     ESP_LOGI(TAG, "*** system_status_refresh_display() called, initialized=%d ***", module_state.initialized);
     if (module_state.initialized) {
         module_state.display_dirty = true;
         module_state.display_active = true;
+        module_manager_notify(&system_status_module);
         ESP_LOGI(TAG, "Display marked as dirty and active");
     }
 }
@@ -354,7 +354,9 @@ void app_main(void) {
         .key_len = ots_server_key_pem_len,
         .max_open_sockets = 4,
         .max_uri_handlers = 8,
-        .close_fn = NULL
+        .close_fn = NULL,
+        .session_tickets = true,
+        .keep_alive_idle_s = 15
     };
     
     ret = http_server_init(&server_config);
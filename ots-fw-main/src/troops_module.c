@@ -1,11 +1,15 @@
 #include "troops_module.h"
 #include "protocol.h"
 #include "ws_handlers.h"
+#include "ws_protocol.h"
 #include "event_dispatcher.h"
 #include "led_handler.h"
 #include "lcd_driver.h"
 #include "adc_handler.h"
 #include "game_state_manager.h"
+#include "game_snapshot.h"
+#include "module_manager.h"
+#include "slider_filter.h"
 #include <string.h>
 #include <stdio.h>
 #include <esp_log.h>
@@ -30,16 +34,25 @@ static troops_module_state_t module_state = {
 static bool s_have_game_percent = false;
 static uint8_t s_game_percent = 0;
 
+// Slider -> command pipeline
+static slider_filter_t s_slider;
+static troops_slider_stats_t s_slider_stats;
+static volatile uint32_t s_slider_changes = 0;     // Written by the I/O task
+static uint64_t s_latency_total_ms = 0;
+static uint64_t s_settle_total_ms = 0;
+static uint32_t s_settle_count = 0;
+
 // Forward declarations
 static esp_err_t troops_init(void);
 static esp_err_t troops_update(void);
+static uint32_t troops_next_wake_ms(void);
 static bool troops_handle_event(const internal_event_t *event);
 static void troops_get_status(module_status_t *status);
 static esp_err_t troops_shutdown(void);
 
 // Helper functions
 static void update_troop_display(void);
-static void send_percent_command(uint8_t percent);
+static void send_percent_command(uint8_t percent, bool final, uint32_t sample_ms);
 
 // Module interface
 static const hardware_module_t troops_module = {
@@ -47,6 +60,7 @@ static const hardware_module_t troops_module = {
     .enabled = true,
     .init = troops_init,
     .update = troops_update,
+    .next_wake_ms = troops_next_wake_ms,
     .handle_event = troops_handle_event,
     .get_status = troops_get_status,
     .shutdown = troops_shutdown
@@ -131,27 +145,111 @@ static void update_troop_display(void) {
 // Protocol Communication
 // ============================================================================
 
-static void send_percent_command(uint8_t percent) {
-    cJSON* root = cJSON_CreateObject();
-    cJSON_AddStringToObject(root, "type", "cmd");
-    
-    cJSON* payload = cJSON_CreateObject();
-    cJSON_AddStringToObject(payload, "action", "set-troops-percent");
-    
-    cJSON* params = cJSON_CreateObject();
-    cJSON_AddNumberToObject(params, "percent", percent);
+static void send_percent_command(uint8_t percent, bool final, uint32_t sample_ms) {
+    // Sent on every slider step: built on the stack, no cJSON tree
+    char buffer[128];
+    json_writer_t w;
+    json_writer_init(&w, buffer, sizeof(buffer));
+    ws_protocol_begin_command(&w, "set-troops-percent");
+    json_writer_field_uint(&w, "percent", percent);
+    json_writer_field_bool(&w, "final", final);
+    json_writer_field_uint(&w, "sampleMs", sample_ms);
+    ws_protocol_end_command(&w);
     
-    cJSON_AddItemToObject(payload, "params", params);
-    cJSON_AddItemToObject(root, "payload", payload);
-    
-    char* json_str = cJSON_PrintUnformatted(root);
-    if (json_str) {
-        ws_handlers_send_text(json_str, strlen(json_str));
-        ESP_LOGI(TAG, "Sent troops percent: %d%%", percent);
-        free(json_str);
+    size_t len;
+    if (json_writer_finish(&w, &len) == ESP_OK) {
+        ws_handlers_send_text(buffer, len);
+        ESP_LOGD(TAG, "Sent troops percent: %d%% (%s)", percent, final ? "final" : "moving");
     }
-    
-    cJSON_Delete(root);
+}
+
+// ============================================================================
+// Slider Pipeline
+// ============================================================================
+
+static uint32_t now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// I/O task: a slider change wakes the module right away instead of waiting
+// for a poll
+static void on_adc_change(const adc_event_t *event) {
+    if (event->channel != ADC_CHANNEL_TROOPS_SLIDER) {
+        return;
+    }
+    s_slider_changes++;
+    if (game_state_get_phase() == GAME_PHASE_IN_GAME) {
+        module_manager_notify(&troops_module);
+    }
+}
+
+static void record_send(slider_send_t kind, uint32_t now, uint32_t sample_ms, bool settled) {
+    troops_slider_stats_t *st = &s_slider_stats;
+    const uint32_t latency = now - sample_ms;
+    if (kind == SLIDER_SEND_FINAL) {
+        st->sent_final++;
+        // Only finals that end a motion have a settle time (not resends)
+        if (settled) {
+            const uint32_t settle = now - s_slider.last_motion_ms;
+            s_settle_total_ms += settle;
+            s_settle_count++;
+            st->settle_avg_ms = (uint32_t)(s_settle_total_ms / s_settle_count);
+            if (settle > st->settle_max_ms) st->settle_max_ms = settle;
+        }
+    } else {
+        st->sent_intermediate++;
+    }
+    s_latency_total_ms += latency;
+    st->latency_avg_ms = (uint32_t)(s_latency_total_ms / (st->sent_final + st->sent_intermediate));
+    if (latency > st->latency_max_ms) st->latency_max_ms = latency;
+}
+
+static void update_slider(void) {
+    adc_event_t adc_value;
+    if (adc_handler_get_value(ADC_CHANNEL_TROOPS_SLIDER, &adc_value) != ESP_OK) {
+        return;
+    }
+    module_state.slider_percent = adc_value.percent;
+
+    const uint32_t now = now_ms();
+    const bool was_moving = s_slider.moving;
+    uint8_t percent;
+    const slider_send_t kind = slider_filter_update(&s_slider, adc_value.percent,
+                                                    adc_value.timestamp_ms, now, &percent);
+    if (kind == SLIDER_SEND_NONE) {
+        return;
+    }
+
+    send_percent_command(percent, kind == SLIDER_SEND_FINAL, adc_value.timestamp_ms);
+    record_send(kind, now, adc_value.timestamp_ms, was_moving && !s_slider.moving);
+    module_state.last_sent_percent = percent;
+    module_state.display_dirty = true;
+}
+
+void troops_get_slider_stats(troops_slider_stats_t *out) {
+    if (!out) return;
+    *out = s_slider_stats;
+    out->changes = s_slider_changes;
+}
+
+void troops_reset_slider_stats(void) {
+    memset(&s_slider_stats, 0, sizeof(s_slider_stats));
+    s_slider_changes = 0;
+    s_latency_total_ms = 0;
+    s_settle_total_ms = 0;
+    s_settle_count = 0;
+}
+
+void troops_log_slider_stats(void) {
+    troops_slider_stats_t st;
+    troops_get_slider_stats(&st);
+    ESP_LOGI(TAG, "Slider: changes=%lu commands=%lu (moving %lu, final %lu)",
+             (unsigned long)st.changes,
+             (unsigned long)(st.sent_intermediate + st.sent_final),
+             (unsigned long)st.sent_intermediate, (unsigned long)st.sent_final);
+    ESP_LOGI(TAG, "Slider latency: sample->cmd avg=%lums max=%lums, motion end->final avg=%lums max=%lums",
+             (unsigned long)st.latency_avg_ms, (unsigned long)st.latency_max_ms,
+             (unsigned long)st.settle_avg_ms, (unsigned long)st.settle_max_ms);
 }
 
 // ============================================================================
@@ -163,7 +261,15 @@ static esp_err_t troops_init(void) {
     
     // Note: LCD is owned/initialized by SystemStatus at boot and this module
     // only writes during GAME_PHASE_IN_GAME.
-    // ADC is initialized and scanned by adc_handler/io_task.
+    // ADC is initialized and scanned by adc_handler/io_task; changes are
+    // pushed here through the change callback.
+    const slider_filter_config_t slider_cfg = {
+        .min_interval_ms = TROOPS_SLIDER_MIN_INTERVAL_MS,
+        .settle_ms = TROOPS_SLIDER_SETTLE_MS,
+        .threshold = TROOPS_CHANGE_THRESHOLD,
+    };
+    slider_filter_init(&s_slider, &slider_cfg);
+    adc_handler_set_change_callback(on_adc_change);
     
     module_state.initialized = true;
     module_state.display_dirty = true;
@@ -177,20 +283,7 @@ static esp_err_t troops_update(void) {
 
     // Only send slider commands during active game.
     if (game_state_get_phase() == GAME_PHASE_IN_GAME) {
-        // Query ADC value from handler (scanned by io_task)
-        adc_event_t adc_value;
-        if (adc_handler_get_value(ADC_CHANNEL_TROOPS_SLIDER, &adc_value) == ESP_OK) {
-            uint8_t new_percent = adc_value.percent;
-            module_state.slider_percent = new_percent;
-            
-            // Check for ≥1% change before sending command
-            int diff = abs((int)new_percent - (int)module_state.last_sent_percent);
-            if (diff >= TROOPS_CHANGE_THRESHOLD) {
-                send_percent_command(new_percent);
-                module_state.last_sent_percent = new_percent;
-                module_state.display_dirty = true;
-            }
-        }
+        update_slider();
     }
 
     // Update display if dirty (when allowed)
@@ -202,14 +295,51 @@ static esp_err_t troops_update(void) {
     return ESP_OK;
 }
 
+static uint32_t troops_next_wake_ms(void) {
+    // Slider changes wake the module through the ADC callback; a timer is
+    // only needed while the filter waits to throttle or settle.
+    if (!module_state.initialized || game_state_get_phase() != GAME_PHASE_IN_GAME) {
+        return MODULE_WAKE_NEVER;
+    }
+    const uint32_t next = slider_filter_next_ms(&s_slider, now_ms());
+    return (next == UINT32_MAX) ? MODULE_WAKE_NEVER : next;
+}
+
 static bool troops_handle_event(const internal_event_t *event) {
     if (!module_state.initialized || !event) return false;
     
+    // Game start: redraw the troop screen and send the slider position
+    if (event->type == GAME_EVENT_GAME_START) {
+        slider_filter_resend(&s_slider);
+        module_state.display_dirty = true;
+        module_manager_notify(&troops_module);
+        return false;
+    }
+
+    // Snapshot resync: take troop counts and the game slider from the snapshot
+    if (event->type == INTERNAL_EVENT_STATE_SNAPSHOT) {
+        const game_snapshot_t *snapshot = game_snapshot_get_applied();
+        if (snapshot) {
+            if (snapshot->has_troops) {
+                module_state.current_troops = snapshot->troops_current;
+                module_state.max_troops = snapshot->troops_max;
+            }
+            if (snapshot->has_attack_ratio) {
+                s_game_percent = snapshot->attack_percent;
+                s_have_game_percent = true;
+            }
+        }
+        module_state.display_dirty = true;
+        module_manager_notify(&troops_module);
+        return false;
+    }
+    
     // Parse event data for troop updates (from JSON payload)
     if (event->type == GAME_EVENT_TROOP_UPDATE && event->data && strlen(event->data) > 0) {
         cJSON* root = cJSON_Parse(event->data);
         if (root) {
             // TROOP_UPDATE event format: {"currentTroops":2500,"maxTroops":12141,...}
+            // Deltas: only changed fields are present, keep the last value for the rest
             cJSON* current = cJSON_GetObjectItem(root, "currentTroops");
             cJSON* max = cJSON_GetObjectItem(root, "maxTroops");
             cJSON* attack_ratio = cJSON_GetObjectItem(root, "attackRatio");
@@ -230,19 +360,17 @@ static bool troops_handle_event(const internal_event_t *event) {
                 s_have_game_percent = true;
             }
 
-            // If we are receiving TROOP_UPDATE with non-zero max troops, the game
-            // is effectively running. Use this as a fallback ONLY when we're still
-            // pre-game, in case GAME_START was dropped due to event queue pressure.
-            //
-            // IMPORTANT: Never force a return to IN_GAME after a match ends, or the
-            // end screen can get suppressed.
+            // TROOP_UPDATE with non-zero max troops while still pre-game means
+            // GAME_START was lost. Don't guess the phase: ask the userscript for
+            // a snapshot and let it set the authoritative state.
             const game_phase_t phase = game_state_get_phase();
             if (module_state.max_troops > 0 && (phase == GAME_PHASE_LOBBY || phase == GAME_PHASE_SPAWNING)) {
-                ESP_LOGW(TAG, "TROOP_UPDATE received while phase=%d; forcing GAME_START transition", (int)phase);
-                game_state_update(GAME_EVENT_GAME_START);
+                ESP_LOGW(TAG, "TROOP_UPDATE received while phase=%d; requesting snapshot", (int)phase);
+                ws_handlers_request_snapshot("phase-mismatch");
             }
             
             module_state.display_dirty = true;
+            module_manager_notify(&troops_module);
             ESP_LOGD(TAG, "Troop update: %lu / %lu", 
                      (unsigned long)module_state.current_troops,
                      (unsigned long)module_state.max_troops);
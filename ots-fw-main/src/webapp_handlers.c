@@ -19,6 +19,8 @@
 #include "device_settings.h"
 #include "network_manager.h"
 #include "dns_captive_portal.h"
+#include "wifi_scanner.h"
+#include "event_dispatcher.h"
 
 #include "config.h"
 #include "webapp/ots_webapp.h"
@@ -378,6 +380,76 @@ static size_t json_escape(const char *in, char *out, size_t out_len) {
     return o;
 }
 
+// "events": event dispatcher queue, per-type counters (active types only) and
+// handler execution times, one chunk per entry
+static void send_event_stats(httpd_req_t *req) {
+    char item[256];
+
+    event_queue_stats_t q;
+    event_dispatcher_get_queue_stats(&q);
+    snprintf(item, sizeof(item),
+             "\"events\":{\"queue\":{\"size\":%lu,\"depth\":%lu,\"highWater\":%lu,\"droppedTotal\":%lu},"
+             "\"histBoundsUs\":[%lu,%lu,%lu,%lu",
+             (unsigned long)q.size, (unsigned long)q.depth, (unsigned long)q.high_water,
+             (unsigned long)event_dispatcher_get_dropped_count(),
+             (unsigned long)event_handler_hist_bounds_us[0], (unsigned long)event_handler_hist_bounds_us[1],
+             (unsigned long)event_handler_hist_bounds_us[2], (unsigned long)event_handler_hist_bounds_us[3]);
+    httpd_resp_sendstr_chunk(req, item);
+
+    event_latency_stats_t lat;
+    event_dispatcher_get_latency_stats(&lat);
+    snprintf(item, sizeof(item),
+             "],\"latency\":{\"count\":%lu,\"avgUs\":%lu,\"maxUs\":%lu,\"hist\":[%lu,%lu,%lu,%lu,%lu],"
+             "\"histBoundsUs\":[%lu,%lu,%lu,%lu]},\"types\":[",
+             (unsigned long)lat.count, lat.count ? (unsigned long)(lat.total_us / lat.count) : 0UL,
+             (unsigned long)lat.max_us,
+             (unsigned long)lat.hist[0], (unsigned long)lat.hist[1], (unsigned long)lat.hist[2],
+             (unsigned long)lat.hist[3], (unsigned long)lat.hist[4],
+             (unsigned long)event_latency_hist_bounds_us[0], (unsigned long)event_latency_hist_bounds_us[1],
+             (unsigned long)event_latency_hist_bounds_us[2], (unsigned long)event_latency_hist_bounds_us[3]);
+    httpd_resp_sendstr_chunk(req, item);
+
+    bool first = true;
+    for (int t = 0; t <= GAME_EVENT_INVALID; t++) {
+        event_type_stats_t st;
+        if (event_dispatcher_get_type_stats((game_event_type_t)t, &st) != ESP_OK ||
+            (st.posted == 0 && st.coalesced == 0 && st.dropped == 0)) {
+            continue;
+        }
+        snprintf(item, sizeof(item),
+                 "%s{\"type\":\"%s\",\"posted\":%lu,\"coalesced\":%lu,\"dropped\":%lu,\"dispatched\":%lu}",
+                 first ? "" : ",", event_type_to_string((game_event_type_t)t),
+                 (unsigned long)st.posted, (unsigned long)st.coalesced,
+                 (unsigned long)st.dropped, (unsigned long)st.dispatched);
+        httpd_resp_sendstr_chunk(req, item);
+        first = false;
+    }
+
+    httpd_resp_sendstr_chunk(req, "],\"handlers\":[");
+    const uint8_t handler_count = event_dispatcher_get_handler_count();
+    for (uint8_t i = 0; i < handler_count; i++) {
+        event_handler_stats_t st;
+        if (event_dispatcher_get_handler_stats(i, &st) != ESP_OK) {
+            continue;
+        }
+        snprintf(item, sizeof(item),
+                 "%s{\"name\":\"%s\",\"blocking\":%s,\"calls\":%lu,\"avgUs\":%lu,\"maxUs\":%lu,"
+                 "\"hist\":[%lu,%lu,%lu,%lu,%lu],",
+                 (i == 0) ? "" : ",", st.name ? st.name : "", st.blocking ? "true" : "false",
+                 (unsigned long)st.calls, st.calls ? (unsigned long)(st.total_us / st.calls) : 0UL,
+                 (unsigned long)st.max_us,
+                 (unsigned long)st.hist[0], (unsigned long)st.hist[1], (unsigned long)st.hist[2],
+                 (unsigned long)st.hist[3], (unsigned long)st.hist[4]);
+        httpd_resp_sendstr_chunk(req, item);
+        snprintf(item, sizeof(item),
+                 "\"overBudget\":%lu,\"stalls\":%lu,\"queueDropped\":%lu,\"lagAvgUs\":%lu,\"lagMaxUs\":%lu}",
+                 (unsigned long)st.over_budget, (unsigned long)st.stalls, (unsigned long)st.deferred_dropped,
+                 st.calls ? (unsigned long)(st.lag_total_us / st.calls) : 0UL, (unsigned long)st.lag_max_us);
+        httpd_resp_sendstr_chunk(req, item);
+    }
+    httpd_resp_sendstr_chunk(req, "]}");
+}
+
 esp_err_t webapp_handle_api_status(httpd_req_t *req) {
     const char *mode_str = (s_mode == WEBAPP_MODE_CAPTIVE_PORTAL) ? "portal" : "normal";
     const bool has_creds = wifi_credentials_exist();
@@ -401,12 +473,15 @@ esp_err_t webapp_handle_api_status(httpd_req_t *req) {
 
     char resp[256];
     snprintf(resp, sizeof(resp),
-             "{\"mode\":\"%s\",\"ip\":\"%s\",\"hasCredentials\":%s,\"savedSsid\":\"%s\"}\n",
+             "{\"mode\":\"%s\",\"ip\":\"%s\",\"hasCredentials\":%s,\"savedSsid\":\"%s\",",
              mode_str, ip, has_creds ? "true" : "false", ssid_esc);
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Cache-Control", "no-store");
-    return httpd_resp_send(req, resp, HTTPD_RESP_USE_STRLEN);
+    httpd_resp_sendstr_chunk(req, resp);
+    send_event_stats(req);
+    httpd_resp_sendstr_chunk(req, "}\n");
+    return httpd_resp_sendstr_chunk(req, NULL);
 }
 
 // Helper function for GET requests (internal)
@@ -541,74 +616,56 @@ esp_err_t webapp_handle_device(httpd_req_t *req) {
 }
 
 esp_err_t webapp_handle_api_scan(httpd_req_t *req) {
-    // In portal mode, WiFi is AP-only; enable APSTA for scans.
-    if (s_mode == WEBAPP_MODE_CAPTIVE_PORTAL) {
-        esp_err_t mode_ret = esp_wifi_set_mode(WIFI_MODE_APSTA);
-        if (mode_ret != ESP_OK) {
-            ESP_LOGW(TAG, "esp_wifi_set_mode(APSTA) failed: %s", esp_err_to_name(mode_ret));
-        }
-    }
-
-    wifi_scan_config_t scan_cfg = {
-        .ssid = NULL,
-        .bssid = NULL,
-        .channel = 0,
-        .show_hidden = true,
-        .scan_type = WIFI_SCAN_TYPE_ACTIVE,
-        .scan_time = {
-            .active = {.min = 50, .max = 150},
-        },
-    };
-
-    esp_err_t ret = esp_wifi_scan_start(&scan_cfg, true /* block */);
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "esp_wifi_scan_start failed: %s", esp_err_to_name(ret));
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "scan failed");
+    // Answer from the background scanner's cache; never scan in the httpd task.
+    // ?since=<generation> returns only networks that changed after that
+    // generation ("full":false), so a polling page can merge updates.
+    uint32_t since = 0;
+    char query[48];
+    char value[16];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK) {
+        since = (uint32_t)strtoul(value, NULL, 10);
+    }
+
+    wifi_scanner_request();
+
+    wifi_scan_ap_t *aps = (wifi_scan_ap_t *)calloc(WIFI_SCAN_MAX_APS, sizeof(wifi_scan_ap_t));
+    if (!aps) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "oom");
         return ESP_OK;
     }
-
-    uint16_t ap_num = 0;
-    (void)esp_wifi_scan_get_ap_num(&ap_num);
-    if (ap_num > 20) {
-        ap_num = 20;
-    }
-
-    wifi_ap_record_t *recs = NULL;
-    if (ap_num > 0) {
-        recs = (wifi_ap_record_t *)calloc(ap_num, sizeof(wifi_ap_record_t));
-        if (!recs) {
-            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "oom");
-            return ESP_OK;
-        }
-        (void)esp_wifi_scan_get_ap_records(&ap_num, recs);
-    }
+    wifi_scan_info_t info;
+    const size_t ap_num = wifi_scanner_get(since, aps, WIFI_SCAN_MAX_APS, &info);
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Cache-Control", "no-store");
 
     httpd_resp_sendstr_chunk(req, "{\"aps\":[");
-    bool first = true;
-    for (uint16_t i = 0; i < ap_num; i++) {
-        const wifi_ap_record_t *r = &recs[i];
-        const char *ssid = (const char *)r->ssid;
-        if (!ssid || ssid[0] == '\0') {
-            continue;
-        }
+    for (size_t i = 0; i < ap_num; i++) {
+        const wifi_scan_ap_t *ap = &aps[i];
 
         char ssid_esc[96];
-        (void)json_escape(ssid, ssid_esc, sizeof(ssid_esc));
+        (void)json_escape(ap->ssid, ssid_esc, sizeof(ssid_esc));
 
         char item[220];
         snprintf(item, sizeof(item),
-                 "%s{\"ssid\":\"%s\",\"rssi\":%d,\"auth\":\"%s\"}",
-                 first ? "" : ",", ssid_esc, (int)r->rssi, auth_mode_to_str(r->authmode));
+                 "%s{\"ssid\":\"%s\",\"rssi\":%d,\"auth\":\"%s\",\"channel\":%u,\"ageMs\":%lu}",
+                 (i == 0) ? "" : ",", ssid_esc, (int)ap->rssi, auth_mode_to_str(ap->authmode),
+                 (unsigned)ap->channel, (unsigned long)ap->age_ms);
         httpd_resp_sendstr_chunk(req, item);
-        first = false;
     }
-    httpd_resp_sendstr_chunk(req, "]}\n");
+
+    // scanAgeMs is -1 until the first scan completes
+    char tail[128];
+    snprintf(tail, sizeof(tail),
+             "],\"generation\":%lu,\"full\":%s,\"scanning\":%s,\"scanAgeMs\":%ld}\n",
+             (unsigned long)info.generation, info.full ? "true" : "false",
+             info.scanning ? "true" : "false",
+             (info.scan_age_ms == UINT32_MAX) ? -1L : (long)info.scan_age_ms);
+    httpd_resp_sendstr_chunk(req, tail);
     httpd_resp_sendstr_chunk(req, NULL);
 
-    free(recs);
+    free(aps);
     return ESP_OK;
 }
 
@@ -793,6 +850,8 @@ void webapp_handlers_set_mode(webapp_mode_t mode) {
     if (s_mode == WEBAPP_MODE_CAPTIVE_PORTAL && prev != WEBAPP_MODE_CAPTIVE_PORTAL) {
         ESP_LOGI(TAG, "Entering captive portal mode");
         dns_captive_portal_start();
+        // Warm the scan cache so the setup page has networks to show
+        wifi_scanner_request();
     } else if (s_mode != WEBAPP_MODE_CAPTIVE_PORTAL && prev == WEBAPP_MODE_CAPTIVE_PORTAL) {
         ESP_LOGI(TAG, "Exiting captive portal mode");
         dns_captive_portal_stop();
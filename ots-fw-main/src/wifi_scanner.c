@@ -0,0 +1,306 @@
+/**
+ * @file wifi_scanner.c
+ * @brief Background WiFi scanner with a cached result list
+ *
+ * The scanner task sleeps until a client asks for results, then scans
+ * periodically until requests stop. The blocking scan only blocks this
+ * task; readers take a short mutex to copy the cache.
+ */
+
+#include "wifi_scanner.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <string.h>
+#include <stdlib.h>
+
+static const char *TAG = "OTS_WIFI_SCAN";
+
+#define WIFI_SCAN_TASK_STACK_SIZE 4096
+#define WIFI_SCAN_TASK_PRIORITY 2
+#define WIFI_SCAN_MAX_RECORDS 32        // Raw records fetched per scan (BSSIDs, before dedup)
+#define WIFI_SCAN_RSSI_HYST_DB 3        // Smaller RSSI moves are not reported as changes
+
+typedef struct {
+    wifi_scan_ap_t ap;
+    uint32_t last_seen_ms;
+} cache_entry_t;
+
+static cache_entry_t s_cache[WIFI_SCAN_MAX_APS];
+static size_t s_cache_count = 0;
+static uint32_t s_generation = 0;
+static uint32_t s_removed_generation = 0;  // Last generation that dropped an entry
+static uint32_t s_last_scan_ms = 0;
+static bool s_have_scan = false;
+static volatile bool s_scanning = false;
+static volatile uint32_t s_last_request_ms = 0;
+static volatile bool s_have_request = false;
+
+static SemaphoreHandle_t s_mutex = NULL;
+static TaskHandle_t s_task = NULL;
+
+static uint32_t now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static bool cache_stale(uint32_t now) {
+    return !s_have_scan || (now - s_last_scan_ms) >= WIFI_SCAN_REFRESH_MS;
+}
+
+// A BSSID is skipped if another record of the same SSID is stronger
+// (ties go to the earlier record), so each SSID is merged once
+static bool has_stronger_duplicate(const wifi_ap_record_t *recs, uint16_t count, uint16_t index) {
+    const wifi_ap_record_t *r = &recs[index];
+    for (uint16_t j = 0; j < count; j++) {
+        if (j == index || strcmp((const char *)recs[j].ssid, (const char *)r->ssid) != 0) {
+            continue;
+        }
+        if (recs[j].rssi > r->rssi || (recs[j].rssi == r->rssi && j < index)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static cache_entry_t *find_entry(const char *ssid) {
+    for (size_t i = 0; i < s_cache_count; i++) {
+        if (strcmp(s_cache[i].ap.ssid, ssid) == 0) {
+            return &s_cache[i];
+        }
+    }
+    return NULL;
+}
+
+static cache_entry_t *weakest_entry(void) {
+    cache_entry_t *weakest = NULL;
+    for (size_t i = 0; i < s_cache_count; i++) {
+        if (!weakest || s_cache[i].ap.rssi < weakest->ap.rssi) {
+            weakest = &s_cache[i];
+        }
+    }
+    return weakest;
+}
+
+static void sort_cache(void) {
+    // Insertion sort: at most WIFI_SCAN_MAX_APS entries, mostly in order already
+    for (size_t i = 1; i < s_cache_count; i++) {
+        cache_entry_t tmp = s_cache[i];
+        size_t j = i;
+        while (j > 0 && s_cache[j - 1].ap.rssi < tmp.ap.rssi) {
+            s_cache[j] = s_cache[j - 1];
+            j--;
+        }
+        s_cache[j] = tmp;
+    }
+}
+
+// Caller holds s_mutex
+static void merge_records(const wifi_ap_record_t *recs, uint16_t count, uint32_t now) {
+    const uint32_t gen = s_generation + 1;
+    bool changed = false;
+
+    for (uint16_t i = 0; i < count; i++) {
+        const wifi_ap_record_t *r = &recs[i];
+        const char *ssid = (const char *)r->ssid;
+        if (ssid[0] == '\0' || has_stronger_duplicate(recs, count, i)) {
+            continue;
+        }
+
+        cache_entry_t *e = find_entry(ssid);
+        if (!e) {
+            if (s_cache_count < WIFI_SCAN_MAX_APS) {
+                e = &s_cache[s_cache_count++];
+            } else {
+                // Full: a stronger newcomer evicts the weakest network
+                e = weakest_entry();
+                if (!e || e->ap.rssi >= r->rssi) {
+                    continue;
+                }
+                s_removed_generation = gen;
+            }
+            memset(e, 0, sizeof(*e));
+            strlcpy(e->ap.ssid, ssid, sizeof(e->ap.ssid));
+            e->ap.rssi = r->rssi;
+            e->ap.channel = r->primary;
+            e->ap.authmode = r->authmode;
+            e->ap.generation = gen;
+            changed = true;
+        } else if (abs(r->rssi - e->ap.rssi) >= WIFI_SCAN_RSSI_HYST_DB ||
+                   r->authmode != e->ap.authmode || r->primary != e->ap.channel) {
+            e->ap.rssi = r->rssi;
+            e->ap.channel = r->primary;
+            e->ap.authmode = r->authmode;
+            e->ap.generation = gen;
+            changed = true;
+        }
+        e->last_seen_ms = now;
+    }
+
+    // Age out networks that stopped showing up
+    size_t kept = 0;
+    for (size_t i = 0; i < s_cache_count; i++) {
+        if (now - s_cache[i].last_seen_ms > WIFI_SCAN_AP_TTL_MS) {
+            s_removed_generation = gen;
+            changed = true;
+            continue;
+        }
+        s_cache[kept++] = s_cache[i];
+    }
+    s_cache_count = kept;
+
+    sort_cache();
+    if (changed || s_generation == 0) {
+        s_generation = gen;
+    }
+}
+
+static void run_scan(void) {
+    // Captive portal runs AP-only; scanning needs the STA interface
+    wifi_mode_t mode = WIFI_MODE_NULL;
+    if (esp_wifi_get_mode(&mode) == ESP_OK && mode == WIFI_MODE_AP) {
+        esp_err_t mode_ret = esp_wifi_set_mode(WIFI_MODE_APSTA);
+        if (mode_ret != ESP_OK) {
+            ESP_LOGW(TAG, "esp_wifi_set_mode(APSTA) failed: %s", esp_err_to_name(mode_ret));
+        }
+    }
+
+    wifi_scan_config_t scan_cfg = {
+        .ssid = NULL,
+        .bssid = NULL,
+        .channel = 0,
+        .show_hidden = true,
+        .scan_type = WIFI_SCAN_TYPE_ACTIVE,
+        .scan_time = {
+            .active = {.min = 50, .max = 150},
+        },
+    };
+
+    s_scanning = true;
+    const int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = esp_wifi_scan_start(&scan_cfg, true /* block (this task only) */);
+    if (ret != ESP_OK) {
+        // E.g. STA busy connecting; the next period retries
+        ESP_LOGW(TAG, "esp_wifi_scan_start failed: %s", esp_err_to_name(ret));
+        s_scanning = false;
+        return;
+    }
+
+    uint16_t ap_num = WIFI_SCAN_MAX_RECORDS;
+    wifi_ap_record_t *recs = calloc(ap_num, sizeof(wifi_ap_record_t));
+    if (!recs) {
+        ESP_LOGE(TAG, "Out of memory for scan records");
+        (void)esp_wifi_clear_ap_list();
+        s_scanning = false;
+        return;
+    }
+    if (esp_wifi_scan_get_ap_records(&ap_num, recs) != ESP_OK) {
+        ap_num = 0;
+    }
+
+    const uint32_t now = now_ms();
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    merge_records(recs, ap_num, now);
+    s_last_scan_ms = now;
+    s_have_scan = true;
+    const size_t cached = s_cache_count;
+    const uint32_t gen = s_generation;
+    xSemaphoreGive(s_mutex);
+    s_scanning = false;
+
+    free(recs);
+    ESP_LOGI(TAG, "Scan done in %lu ms: %u records, %u networks cached (gen %lu)",
+             (unsigned long)((esp_timer_get_time() - start_us) / 1000), (unsigned)ap_num,
+             (unsigned)cached, (unsigned long)gen);
+}
+
+static void scanner_task(void *arg) {
+    while (true) {
+        // Woken early by wifi_scanner_request() when the cache is stale
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WIFI_SCAN_REFRESH_MS));
+
+        uint32_t now = now_ms();
+        if (!s_have_request || (now - s_last_request_ms) > WIFI_SCAN_IDLE_MS) {
+            continue;  // Nobody is looking at the results
+        }
+        if (s_have_scan && (now - s_last_scan_ms) < WIFI_SCAN_MIN_INTERVAL_MS) {
+            vTaskDelay(pdMS_TO_TICKS(WIFI_SCAN_MIN_INTERVAL_MS - (now - s_last_scan_ms)));
+        }
+        run_scan();
+    }
+}
+
+esp_err_t wifi_scanner_init(void) {
+    if (s_task) {
+        return ESP_OK;
+    }
+
+    s_mutex = xSemaphoreCreateMutex();
+    if (!s_mutex) {
+        ESP_LOGE(TAG, "Failed to create scan cache mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreate(scanner_task, "wifi_scan", WIFI_SCAN_TASK_STACK_SIZE, NULL,
+                    WIFI_SCAN_TASK_PRIORITY, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create scanner task");
+        vSemaphoreDelete(s_mutex);
+        s_mutex = NULL;
+        s_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "WiFi scanner ready (refresh %d ms while polled)", WIFI_SCAN_REFRESH_MS);
+    return ESP_OK;
+}
+
+void wifi_scanner_request(void) {
+    if (!s_task) {
+        return;
+    }
+
+    const uint32_t now = now_ms();
+    s_last_request_ms = now;
+    s_have_request = true;
+    if (!s_scanning && cache_stale(now)) {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+size_t wifi_scanner_get(uint32_t since_generation, wifi_scan_ap_t *out, size_t max,
+                        wifi_scan_info_t *info) {
+    if (!s_mutex) {
+        if (info) {
+            memset(info, 0, sizeof(*info));
+            info->scan_age_ms = UINT32_MAX;
+            info->full = true;
+        }
+        return 0;
+    }
+
+    const uint32_t now = now_ms();
+    size_t n = 0;
+
+    xSemaphoreTake(s_mutex, portMAX_DELAY);
+    // Dropped entries cannot be expressed as a delta: send everything
+    const bool full = (since_generation == 0) || (since_generation < s_removed_generation) ||
+                      (since_generation > s_generation);
+    for (size_t i = 0; i < s_cache_count && n < max; i++) {
+        if (!full && s_cache[i].ap.generation <= since_generation) {
+            continue;
+        }
+        out[n] = s_cache[i].ap;
+        out[n].age_ms = now - s_cache[i].last_seen_ms;
+        n++;
+    }
+    if (info) {
+        info->generation = s_generation;
+        info->scan_age_ms = s_have_scan ? (now - s_last_scan_ms) : UINT32_MAX;
+        info->scanning = s_scanning;
+        info->full = full;
+    }
+    xSemaphoreGive(s_mutex);
+
+    return n;
+}
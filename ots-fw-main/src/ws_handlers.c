@@ -12,24 +12,33 @@
  * - Protocol message parsing and routing
  * - Event broadcasting to connected clients
  * - Userscript connection status tracking
+ * - Event sequence tracking and snapshot resync requests
+ * - Handing upgraded sessions to the dedicated WS I/O task (ws_io)
  * 
  * Dependencies:
  * - http_server: Registers handlers with HTTP server core
  * - ws_protocol: Message parsing and building
  * - event_dispatcher: Routes protocol events to firmware
+ * - ws_io: Owns upgraded sessions so long HTTP requests cannot stall game traffic
  * 
  * This component is independent of webapp UI and configuration handlers.
  */
 
 #include "ws_handlers.h"
 #include "ws_protocol.h"
+#include "ws_io.h"
 #include "event_dispatcher.h"
+#include "cpu_load.h"
+#include "game_snapshot.h"
 #include "protocol.h"
 #include "config.h"
 #include "esp_http_server.h"
 #include "esp_log.h"
 #include "esp_timer.h"
-#include "cJSON.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/socket.h>
@@ -78,6 +87,17 @@ int ws_handlers_get_userscript_count(void) {
     return 0;
 }
 
+esp_err_t ws_handlers_request_snapshot(const char *reason) {
+    (void)reason;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void ws_handlers_get_rx_stats(ws_handlers_rx_stats_t *out) {
+    if (out) {
+        memset(out, 0, sizeof(*out));
+    }
+}
+
 #else
 
 static const char *TAG = "OTS_WS";
@@ -91,6 +111,52 @@ static int userscript_clients = 0;
 static int client_fds[MAX_CLIENTS] = {0};
 static bool client_is_userscript[MAX_CLIENTS] = {0};
 
+// Last event sequence number seen per client (0 = none yet)
+static uint32_t client_last_seq[MAX_CLIENTS] = {0};
+static uint32_t seq_gap_count = 0;
+
+// Resync requests are rate-limited: one snapshot covers any number of losses
+#define RESYNC_REQUEST_MIN_INTERVAL_MS 1000
+static int64_t last_resync_request_us = 0;
+
+// hardware-diagnostic reply, built on the caller's stack (~700 bytes today)
+#define WS_DIAGNOSTIC_BUFFER_SIZE 1024
+
+// TROOP_UPDATE pacing advertised to the userscript with the "flow-control"
+// command. The LCD needs only a few redraws per second; the interval doubles
+// while the event queue is under pressure and halves once it has drained.
+#define TROOP_INTERVAL_MIN_MS 200
+#define TROOP_INTERVAL_MAX_MS 3200
+#define TROOP_INTERVAL_BACKOFF_HOLD_MS 1000
+#define TROOP_INTERVAL_RECOVER_HOLD_MS 5000
+static uint32_t s_troop_interval_ms = TROOP_INTERVAL_MIN_MS;
+static int64_t s_troop_interval_changed_us = 0;
+
+// Decode storage, too large for the receiving task's stack. Frames arrive on
+// the WS I/O task and, for sessions httpd still owns, on the httpd task:
+// s_rx_lock serializes their handling (parse, sequence tracking, post).
+static game_snapshot_t rx_snapshot;
+static internal_event_t rx_batch[WS_BATCH_MAX_EVENTS];
+static SemaphoreHandle_t s_rx_lock = NULL;
+
+// Receive-side cost, read by diagnostics and the serial ws-stats command
+static ws_handlers_rx_stats_t s_rx_stats = {0};
+
+// Client table is touched by the httpd task (upgrade, close_fn) and the WS I/O task
+static SemaphoreHandle_t s_clients_lock = NULL;
+
+static void clients_lock(void) {
+    if (s_clients_lock) {
+        xSemaphoreTake(s_clients_lock, portMAX_DELAY);
+    }
+}
+
+static void clients_unlock(void) {
+    if (s_clients_lock) {
+        xSemaphoreGive(s_clients_lock);
+    }
+}
+
 static int find_client_index(int fd) {
     for (int i = 0; i < MAX_CLIENTS; i++) {
         if (client_fds[i] == fd) {
@@ -110,21 +176,31 @@ static bool is_client_registered(int fd) {
 }
 
 static void register_client(int fd) {
-    if (fd <= 0 || is_client_registered(fd)) {
+    if (fd <= 0) {
         return;
     }
-    for (int i = 0; i < MAX_CLIENTS; i++) {
-        if (client_fds[i] == 0) {
-            client_fds[i] = fd;
-            client_is_userscript[i] = false;
-            active_clients++;
-            ESP_LOGI(TAG, "Client connected (fd=%d), total clients: %d", fd, active_clients);
-            break;
+    clients_lock();
+    if (!is_client_registered(fd)) {
+        for (int i = 0; i < MAX_CLIENTS; i++) {
+            if (client_fds[i] == 0) {
+                client_fds[i] = fd;
+                client_is_userscript[i] = false;
+                client_last_seq[i] = 0;
+                active_clients++;
+                ESP_LOGI(TAG, "Client connected (fd=%d), total clients: %d", fd, active_clients);
+                break;
+            }
         }
     }
+    clients_unlock();
 }
 
 static void unregister_client(int fd) {
+    bool found = false;
+    bool last_userscript = false;
+    bool no_clients = false;
+
+    clients_lock();
     for (int i = 0; i < MAX_CLIENTS; i++) {
         if (client_fds[i] == fd) {
             const bool was_userscript = client_is_userscript[i];
@@ -139,27 +215,119 @@ static void unregister_client(int fd) {
             active_clients--;
             ESP_LOGI(TAG, "Client disconnected (fd=%d), total clients: %d", fd, active_clients);
 
-            // Align with test-websocket semantics: "connected" means the userscript is
-            // connected, not merely that *some* WebSocket client exists.
-            if (was_userscript && userscript_clients == 0) {
-                ESP_LOGI(TAG, "Last userscript disconnected; userscript_clients=0");
-                event_dispatcher_post_simple(INTERNAL_EVENT_WS_DISCONNECTED, EVENT_SOURCE_SYSTEM);
-                if (connection_callback) {
-                    connection_callback(false);
-                }
-            }
-
-            // If we have no clients at all, also ensure modules can reset state.
-            // (This is a no-op if the userscript transition already fired above.)
-            if (active_clients == 0 && userscript_clients == 0) {
-                event_dispatcher_post_simple(INTERNAL_EVENT_WS_DISCONNECTED, EVENT_SOURCE_SYSTEM);
-                if (connection_callback) {
-                    connection_callback(false);
-                }
-            }
+            found = true;
+            last_userscript = was_userscript && userscript_clients == 0;
+            no_clients = active_clients == 0 && userscript_clients == 0;
             break;
         }
     }
+    clients_unlock();
+
+    if (!found) {
+        return;
+    }
+
+    // Align with test-websocket semantics: "connected" means the userscript is
+    // connected, not merely that *some* WebSocket client exists.
+    if (last_userscript) {
+        ESP_LOGI(TAG, "Last userscript disconnected; userscript_clients=0");
+        event_dispatcher_post_simple(INTERNAL_EVENT_WS_DISCONNECTED, EVENT_SOURCE_SYSTEM);
+        if (connection_callback) {
+            connection_callback(false);
+        }
+    }
+
+    // If we have no clients at all, also ensure modules can reset state.
+    // (This is a no-op if the userscript transition already fired above.)
+    if (no_clients) {
+        event_dispatcher_post_simple(INTERNAL_EVENT_WS_DISCONNECTED, EVENT_SOURCE_SYSTEM);
+        if (connection_callback) {
+            connection_callback(false);
+        }
+    }
+}
+
+// Tell the userscript how often it may send TROOP_UPDATE (fd -1 = all clients)
+static void send_flow_control(int fd) {
+    char buffer[112];
+    json_writer_t w;
+    json_writer_init(&w, buffer, sizeof(buffer));
+    ws_protocol_begin_command(&w, "flow-control");
+    json_writer_field_uint(&w, "troopIntervalMs", s_troop_interval_ms);
+    ws_protocol_end_command(&w);
+
+    size_t len;
+    if (json_writer_finish(&w, &len) != ESP_OK) {
+        return;
+    }
+
+    if (fd >= 0 && ws_io_owns(fd)) {
+        ws_io_send_text(fd, buffer, len);
+    } else {
+        ws_handlers_send_text(buffer, len);
+    }
+}
+
+// Adjust the TROOP_UPDATE interval after posting one. Backing off is fast
+// (once per second), recovering is slow so the rate does not oscillate.
+static void adapt_troop_interval(bool dropped) {
+    QueueHandle_t queue = (QueueHandle_t)event_dispatcher_get_queue();
+    if (!queue) {
+        return;
+    }
+
+    const UBaseType_t waiting = uxQueueMessagesWaiting(queue);
+    const UBaseType_t capacity = waiting + uxQueueSpacesAvailable(queue);
+    const int64_t held_ms = (esp_timer_get_time() - s_troop_interval_changed_us) / 1000;
+    uint32_t next = s_troop_interval_ms;
+
+    if (dropped || waiting * 2 >= capacity) {
+        if (held_ms >= TROOP_INTERVAL_BACKOFF_HOLD_MS && next < TROOP_INTERVAL_MAX_MS) {
+            next *= 2;
+        }
+    } else if (waiting == 0 && held_ms >= TROOP_INTERVAL_RECOVER_HOLD_MS && next > TROOP_INTERVAL_MIN_MS) {
+        next /= 2;
+    }
+
+    if (next == s_troop_interval_ms) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "TROOP_UPDATE interval %lu -> %lu ms (queue %u/%u%s)",
+             (unsigned long)s_troop_interval_ms, (unsigned long)next,
+             (unsigned)waiting, (unsigned)capacity, dropped ? ", dropped" : "");
+    s_troop_interval_ms = next;
+    s_troop_interval_changed_us = esp_timer_get_time();
+    send_flow_control(-1);
+}
+
+static void identify_userscript(int fd, const char *via) {
+    bool was_zero = false;
+    bool identified = false;
+
+    clients_lock();
+    const int idx = find_client_index(fd);
+    if (idx >= 0 && !client_is_userscript[idx]) {
+        client_is_userscript[idx] = true;
+        was_zero = (userscript_clients == 0);
+        userscript_clients++;
+        identified = true;
+        ESP_LOGI(TAG, "Identified userscript client via %s (fd=%d), userscript_clients=%d",
+                 via, fd, userscript_clients);
+    }
+    clients_unlock();
+
+    if (identified) {
+        send_flow_control(fd);
+    }
+
+    // Notify modules/app when the *first* userscript appears.
+    if (identified && was_zero) {
+        event_dispatcher_post_simple(INTERNAL_EVENT_WS_CONNECTED, EVENT_SOURCE_SYSTEM);
+        if (connection_callback) {
+            connection_callback(true);
+        }
+    }
 }
 
 // Ensure clients are unregistered even when the TCP/TLS socket closes without a
@@ -174,6 +342,290 @@ static void ws_session_close_cb(httpd_handle_t hd, int sockfd) {
     (void)close(sockfd);
 }
 
+// Detect events lost between the userscript and us. Returns true on a gap.
+static bool track_event_seq(int idx, uint32_t seq) {
+    if (idx < 0 || seq == 0) {
+        return false;  // Sender does not number its events
+    }
+
+    const uint32_t last = client_last_seq[idx];
+    client_last_seq[idx] = seq;
+    if (last == 0 || seq == last + 1) {
+        return false;
+    }
+
+    seq_gap_count++;
+    ESP_LOGW(TAG, "Event sequence gap (fd=%d): expected %lu, got %lu (gaps=%lu)",
+             client_fds[idx], (unsigned long)(last + 1), (unsigned long)seq,
+             (unsigned long)seq_gap_count);
+    return true;
+}
+
+// Convert a protocol event into a dispatcher event. Tracks the sequence
+// number and handles INFO; returns false for events that must not be enqueued.
+static bool accept_event(int fd, const ws_event_payload_t *in, internal_event_t *out) {
+    if (track_event_seq(find_client_index(fd), in->seq)) {
+        ws_handlers_request_snapshot("seq-gap");
+    }
+
+    // NOTE: Userscript can send frequent INFO heartbeats; don't enqueue them
+    // or they can fill the event queue and cause important events (GAME_START)
+    // to be dropped.
+    if (in->event_type == GAME_EVENT_INFO) {
+        // Logging every heartbeat at INFO can starve CPU and destabilize WS.
+        ESP_LOGD(TAG, "Received INFO event: %s", in->message);
+        // Treat the userscript's initial INFO as a secondary handshake.
+        // Userscript sends: {type:'event', payload:{type:'INFO', message:'userscript-connected'}}
+        if (strcmp(in->message, "userscript-connected") == 0) {
+            identify_userscript(fd, "INFO");
+        }
+
+        ESP_LOGD(TAG, "Dropping INFO event (no enqueue)");
+        return false;
+    }
+    if (in->event_type == GAME_EVENT_INVALID) {
+        ESP_LOGD(TAG, "Dropping invalid event (no enqueue)");
+        return false;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->type = in->event_type;
+    out->source = EVENT_SOURCE_WEBSOCKET;
+    out->timestamp = in->timestamp;
+    strncpy(out->message, in->message, sizeof(out->message) - 1);
+    strncpy(out->data, in->data, sizeof(out->data) - 1);
+    event_dispatcher_stamp(out);  // Dispatch latency counts from the frame being decoded
+    return true;
+}
+
+typedef struct {
+    int fd;
+    size_t count;
+    bool has_troop_update;
+} batch_ctx_t;
+
+static void collect_batch_event(const ws_event_payload_t *event, void *arg) {
+    batch_ctx_t *ctx = (batch_ctx_t *)arg;
+    if (ctx->count >= WS_BATCH_MAX_EVENTS) {
+        return;
+    }
+    internal_event_t *evt = &rx_batch[ctx->count];
+    if (!accept_event(ctx->fd, event, evt)) {
+        return;
+    }
+    ESP_LOGD(TAG, "Batched event type=%d msg=%s", (int)evt->type, evt->message);
+    if (evt->type == GAME_EVENT_TROOP_UPDATE) {
+        ctx->has_troop_update = true;
+    }
+    ctx->count++;
+}
+
+// One frame, one parse, one dispatcher post for all contained events
+static void handle_batch(const batch_ctx_t *ctx, esp_err_t ret, size_t parsed) {
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_SIZE) {
+        ESP_LOGW(TAG, "Failed to parse batch: %s", esp_err_to_name(ret));
+        return;
+    }
+
+    s_rx_stats.batches++;
+    s_rx_stats.events += parsed;
+
+    size_t posted = 0;
+    const uint32_t dropped_before = event_dispatcher_get_dropped_count();
+    if (ctx->count > 0) {
+        event_dispatcher_post_batch(rx_batch, ctx->count, &posted);
+    }
+    const bool dropped = posted != ctx->count ||
+                         event_dispatcher_get_dropped_count() != dropped_before;
+
+    ESP_LOGD(TAG, "Received batch: %u events, %u enqueued%s", (unsigned)parsed, (unsigned)posted,
+             ret == ESP_ERR_INVALID_SIZE ? " (truncated)" : "");
+
+    // Events past WS_BATCH_MAX_EVENTS were never seen: same as a queue overflow
+    if (dropped || ret == ESP_ERR_INVALID_SIZE) {
+        ws_handlers_request_snapshot("queue-full");
+    }
+    if (ctx->has_troop_update) {
+        adapt_troop_interval(dropped);
+    }
+}
+
+static void handle_snapshot(int fd, esp_err_t status) {
+    if (status != ESP_OK) {
+        ESP_LOGW(TAG, "Dropping malformed snapshot (fd=%d)", fd);
+        return;
+    }
+
+    // The snapshot covers every event up to its seq: restart gap detection there
+    const int idx = find_client_index(fd);
+    if (idx >= 0) {
+        client_last_seq[idx] = rx_snapshot.seq;
+    }
+
+    const uint32_t dropped_before = event_dispatcher_get_dropped_count();
+    if (game_snapshot_submit(&rx_snapshot) != ESP_OK ||
+        event_dispatcher_get_dropped_count() != dropped_before) {
+        ws_handlers_request_snapshot("queue-full");
+    }
+}
+
+static void add_component(json_writer_t *w, const char *name, bool present) {
+    json_writer_key(w, name);
+    json_writer_begin_object(w);
+    json_writer_field_bool(w, "present", present);
+    json_writer_field_bool(w, "working", present);
+    json_writer_end_object(w);
+}
+
+// Reply to the "hardware-diagnostic" command
+static void send_hardware_diagnostic(void) {
+    extern bool lcd_is_initialized(void);
+    extern bool io_expander_is_board_present(uint8_t board);
+    extern bool adc_handler_is_initialized(void);
+
+    char buffer[WS_DIAGNOSTIC_BUFFER_SIZE];
+    json_writer_t w;
+    json_writer_init(&w, buffer, sizeof(buffer));
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "event");
+
+    json_writer_key(&w, "payload");
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "HARDWARE_DIAGNOSTIC");
+    json_writer_field_int(&w, "timestamp", esp_timer_get_time() / 1000);
+    json_writer_field_string(&w, "message", "OTS Firmware Diagnostic");
+
+    json_writer_key(&w, "data");
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "version", OTS_FIRMWARE_VERSION);
+    json_writer_field_string(&w, "deviceType", "firmware");
+    json_writer_field_string(&w, "serialNumber", OTS_DEVICE_SERIAL_NUMBER);
+    json_writer_field_string(&w, "owner", OTS_DEVICE_OWNER);
+
+    // Hardware component detection (sound module: not reported yet)
+    json_writer_key(&w, "hardware");
+    json_writer_begin_object(&w);
+    add_component(&w, "lcd", lcd_is_initialized());
+    add_component(&w, "inputBoard", io_expander_is_board_present(0));
+    add_component(&w, "outputBoard", io_expander_is_board_present(1));
+    add_component(&w, "adc", adc_handler_is_initialized());
+    add_component(&w, "soundModule", false);
+    json_writer_end_object(&w);
+
+    json_writer_key(&w, "wsRx");
+    json_writer_begin_object(&w);
+    json_writer_field_uint(&w, "frames", s_rx_stats.frames);
+    json_writer_field_uint(&w, "events", s_rx_stats.events);
+    json_writer_field_uint(&w, "batches", s_rx_stats.batches);
+    json_writer_field_uint(&w, "busyUs", s_rx_stats.busy_us);
+    json_writer_end_object(&w);
+
+    // Load-test counters (tools/tests/ws_replay_load.py diffs them)
+    QueueHandle_t queue = (QueueHandle_t)event_dispatcher_get_queue();
+    json_writer_key(&w, "dispatcher");
+    json_writer_begin_object(&w);
+    json_writer_field_uint(&w, "dropped", event_dispatcher_get_dropped_count());
+    json_writer_field_uint(&w, "queued", queue ? uxQueueMessagesWaiting(queue) : 0);
+    ws_io_stats_t io_stats;
+    if (ws_io_get_stats(&io_stats) == ESP_OK) {
+        json_writer_field_uint(&w, "sendDropped", io_stats.send_dropped);
+    }
+    json_writer_field_uint(&w, "seqGaps", seq_gap_count);
+    json_writer_end_object(&w);
+
+    cpu_load_counters_t load;
+    if (cpu_load_get_counters(&load) == ESP_OK) {
+        json_writer_key(&w, "cpu");
+        json_writer_begin_object(&w);
+        json_writer_field_int(&w, "uptimeUs", load.uptime_us);
+        json_writer_key(&w, "idleUs");
+        json_writer_begin_array(&w);
+        for (uint8_t core = 0; core < load.cores; core++) {
+            json_writer_uint(&w, load.idle_us[core]);
+        }
+        json_writer_end_array(&w);
+        json_writer_end_object(&w);
+    }
+    json_writer_end_object(&w);  // data
+    json_writer_end_object(&w);  // payload
+    json_writer_end_object(&w);
+
+    size_t len;
+    if (json_writer_finish(&w, &len) != ESP_OK) {
+        ESP_LOGE(TAG, "Hardware diagnostic does not fit in %d bytes", WS_DIAGNOSTIC_BUFFER_SIZE);
+        return;
+    }
+    ESP_LOGI(TAG, "Sending hardware diagnostic response");
+    ws_handlers_send_text(buffer, len);
+}
+
+static void handle_text_frame(int fd, char *json, size_t len) {
+    // Debug only: raw frames can be very frequent (e.g. TROOP_UPDATE every 100ms).
+    const int max_log = 160;
+    ESP_LOGD(TAG, "WS TEXT frame len=%d: %.*s", (int)len, len > (size_t)max_log ? max_log : (int)len, json);
+
+    // Parse message using protocol handler; batch events and snapshots are
+    // decoded from the same parse
+    batch_ctx_t batch = { .fd = fd };
+    const ws_protocol_sink_t sink = {
+        .on_batch_event = collect_batch_event,
+        .ctx = &batch,
+        .snapshot = &rx_snapshot,
+    };
+    ws_message_t msg;
+    esp_err_t ret = ws_protocol_parse(json, len, &msg, &sink);
+    if (ret == ESP_OK) {
+        if (msg.type == WS_MSG_HANDSHAKE) {
+            if (strcmp(msg.payload.handshake.client_type, "userscript") == 0) {
+                identify_userscript(fd, "handshake");
+            }
+        } else if (msg.type == WS_MSG_SNAPSHOT) {
+            handle_snapshot(fd, msg.payload.snapshot.status);
+        } else if (msg.type == WS_MSG_EVENT) {
+            internal_event_t evt;
+            s_rx_stats.events++;
+            if (accept_event(fd, &msg.payload.event, &evt)) {
+                ESP_LOGI(TAG, "Received event type=%d msg=%s", (int)evt.type, evt.message);
+
+                // A dropped or evicted event leaves module state stale
+                const uint32_t dropped_before = event_dispatcher_get_dropped_count();
+                const bool dropped = event_dispatcher_post(&evt) != ESP_OK ||
+                                     event_dispatcher_get_dropped_count() != dropped_before;
+                if (dropped) {
+                    ws_handlers_request_snapshot("queue-full");
+                }
+                if (evt.type == GAME_EVENT_TROOP_UPDATE) {
+                    adapt_troop_interval(dropped);
+                }
+            }
+        } else if (msg.type == WS_MSG_BATCH) {
+            handle_batch(&batch, msg.payload.batch.status, msg.payload.batch.count);
+        } else if (msg.type == WS_MSG_COMMAND) {
+            ESP_LOGI(TAG, "Received command: %s", msg.payload.command.action);
+            
+            // Handle hardware-diagnostic command
+            if (strcmp(msg.payload.command.action, "hardware-diagnostic") == 0) {
+                send_hardware_diagnostic();
+            }
+        }
+
+        ESP_LOGD(TAG, "Message parsed successfully");
+    } else {
+        ESP_LOGW(TAG, "Failed to parse message");
+    }
+}
+
+// Handle one complete text frame. Runs on the WS I/O task for attached
+// sessions, or on the httpd task for sessions httpd still owns.
+static void process_text_frame(int fd, char *json, size_t len) {
+    xSemaphoreTake(s_rx_lock, portMAX_DELAY);
+    const int64_t start_us = esp_timer_get_time();
+    handle_text_frame(fd, json, len);
+    s_rx_stats.frames++;
+    s_rx_stats.busy_us += (uint64_t)(esp_timer_get_time() - start_us);
+    xSemaphoreGive(s_rx_lock);
+}
+
 static esp_err_t ws_handler(httpd_req_t *req) {
     // ESP-IDF calls this handler once for the initial HTTP upgrade (handshake)
     // and then again for subsequent WebSocket frames.
@@ -187,7 +639,18 @@ static esp_err_t ws_handler(httpd_req_t *req) {
     // like: "WS frame is not properly masked".
     const size_t upgrade_len = httpd_req_get_hdr_value_len(req, "Upgrade");
     if (upgrade_len > 0) {
-        // Let the server complete the handshake; frames will arrive in later calls.
+        // The 101 response has already been sent. Hand the session to the WS
+        // I/O task so OTA uploads or asset downloads cannot stall it; if that
+        // is not possible, frames keep arriving in later calls of this handler.
+        if (s_server != NULL && ws_io_is_running() &&
+            httpd_ws_get_fd_info(s_server, fd) == HTTPD_WS_CLIENT_WEBSOCKET) {
+            register_client(fd);
+            esp_err_t ret = ws_io_attach(req);
+            if (ret != ESP_OK) {
+                ESP_LOGW(TAG, "WS I/O attach failed (fd=%d): %s; staying on httpd",
+                         fd, esp_err_to_name(ret));
+            }
+        }
         return ESP_OK;
     }
 
@@ -264,153 +727,7 @@ static esp_err_t ws_handler(httpd_req_t *req) {
     } else if (ws_pkt.type == HTTPD_WS_TYPE_PONG) {
         // No action needed.
     } else if (ws_pkt.type == HTTPD_WS_TYPE_TEXT) {
-        // Debug only: raw frames can be very frequent (e.g. TROOP_UPDATE every 100ms).
-        const int max_log = 160;
-        ESP_LOGD(TAG, "WS TEXT frame len=%d: %.*s", ws_pkt.len, ws_pkt.len > max_log ? max_log : (int)ws_pkt.len, (char *)ws_pkt.payload);
-        
-        // Parse message using protocol handler
-        ws_message_t msg;
-        ret = ws_protocol_parse((char *)ws_pkt.payload, ws_pkt.len, &msg);
-        if (ret == ESP_OK) {
-            if (msg.type == WS_MSG_HANDSHAKE) {
-                const int idx = find_client_index(fd);
-                const bool is_userscript = (strcmp(msg.payload.handshake.client_type, "userscript") == 0);
-                if (idx >= 0 && is_userscript && !client_is_userscript[idx]) {
-                    client_is_userscript[idx] = true;
-                    const bool was_zero = (userscript_clients == 0);
-                    userscript_clients++;
-                    ESP_LOGI(TAG, "Identified userscript client (fd=%d), userscript_clients=%d", fd, userscript_clients);
-
-                    // Notify modules/app when the *first* userscript appears.
-                    if (was_zero) {
-                        event_dispatcher_post_simple(INTERNAL_EVENT_WS_CONNECTED, EVENT_SOURCE_SYSTEM);
-                        if (connection_callback) {
-                            connection_callback(true);
-                        }
-                    }
-                }
-            } else if (msg.type == WS_MSG_EVENT) {
-                // Forward protocol events into the firmware event system.
-                // NOTE: Userscript can send frequent INFO heartbeats; don't enqueue them
-                // or they can fill the event queue and cause important events (GAME_START)
-                // to be dropped.
-                if (msg.payload.event.event_type == GAME_EVENT_INFO) {
-                    // Logging every heartbeat at INFO can starve CPU and destabilize WS.
-                    ESP_LOGD(TAG, "Received INFO event: %s", msg.payload.event.message);
-                    // Treat the userscript's initial INFO as a secondary handshake.
-                    // Userscript sends: {type:'event', payload:{type:'INFO', message:'userscript-connected'}}
-                    const int idx = find_client_index(fd);
-                    if (idx >= 0 &&
-                        strcmp(msg.payload.event.message, "userscript-connected") == 0 &&
-                        !client_is_userscript[idx]) {
-                        client_is_userscript[idx] = true;
-                        const bool was_zero = (userscript_clients == 0);
-                        userscript_clients++;
-                        ESP_LOGI(TAG, "Identified userscript client via INFO (fd=%d), userscript_clients=%d", fd, userscript_clients);
-
-                        if (was_zero) {
-                            event_dispatcher_post_simple(INTERNAL_EVENT_WS_CONNECTED, EVENT_SOURCE_SYSTEM);
-                            if (connection_callback) {
-                                connection_callback(true);
-                            }
-                        }
-                    }
-
-                    ESP_LOGD(TAG, "Dropping INFO event (no enqueue)");
-                } else if (msg.payload.event.event_type == GAME_EVENT_INVALID) {
-                    ESP_LOGD(TAG, "Dropping invalid event (no enqueue)");
-                } else {
-                    ESP_LOGI(TAG, "Received event type=%d msg=%s", (int)msg.payload.event.event_type, msg.payload.event.message);
-                    internal_event_t evt = {
-                        .type = msg.payload.event.event_type,
-                        .source = EVENT_SOURCE_WEBSOCKET,
-                        .timestamp = msg.payload.event.timestamp,
-                    };
-                    strncpy(evt.message, msg.payload.event.message, sizeof(evt.message) - 1);
-                    strncpy(evt.data, msg.payload.event.data, sizeof(evt.data) - 1);
-                    event_dispatcher_post(&evt);
-                }
-            } else if (msg.type == WS_MSG_COMMAND) {
-                ESP_LOGI(TAG, "Received command: %s", msg.payload.command.action);
-                
-                // Handle hardware-diagnostic command
-                if (strcmp(msg.payload.command.action, "hardware-diagnostic") == 0) {
-                    // Build diagnostic response
-                    cJSON *root = cJSON_CreateObject();
-                    if (root) {
-                        cJSON_AddStringToObject(root, "type", "event");
-                        
-                        cJSON *payload = cJSON_CreateObject();
-                        cJSON_AddStringToObject(payload, "type", "HARDWARE_DIAGNOSTIC");
-                        cJSON_AddNumberToObject(payload, "timestamp", esp_timer_get_time() / 1000);
-                        cJSON_AddStringToObject(payload, "message", "OTS Firmware Diagnostic");
-                        
-                        cJSON *data = cJSON_CreateObject();
-                        cJSON_AddStringToObject(data, "version", OTS_FIRMWARE_VERSION);
-                        cJSON_AddStringToObject(data, "deviceType", "firmware");
-                        cJSON_AddStringToObject(data, "serialNumber", OTS_DEVICE_SERIAL_NUMBER);
-                        cJSON_AddStringToObject(data, "owner", OTS_DEVICE_OWNER);
-                        
-                        // Hardware component detection
-                        cJSON *hardware = cJSON_CreateObject();
-                        
-                        // LCD: Check if initialized
-                        cJSON *lcd = cJSON_CreateObject();
-                        extern bool lcd_is_initialized(void);
-                        bool lcd_present = lcd_is_initialized();
-                        cJSON_AddBoolToObject(lcd, "present", lcd_present);
-                        cJSON_AddBoolToObject(lcd, "working", lcd_present);
-                        cJSON_AddItemToObject(hardware, "lcd", lcd);
-                        
-                        // Input Board (MCP23017 board 0)
-                        cJSON *inputBoard = cJSON_CreateObject();
-                        extern bool io_expander_is_board_present(uint8_t board);
-                        bool input_present = io_expander_is_board_present(0);
-                        cJSON_AddBoolToObject(inputBoard, "present", input_present);
-                        cJSON_AddBoolToObject(inputBoard, "working", input_present);
-                        cJSON_AddItemToObject(hardware, "inputBoard", inputBoard);
-                        
-                        // Output Board (MCP23017 board 1)
-                        cJSON *outputBoard = cJSON_CreateObject();
-                        bool output_present = io_expander_is_board_present(1);
-                        cJSON_AddBoolToObject(outputBoard, "present", output_present);
-                        cJSON_AddBoolToObject(outputBoard, "working", output_present);
-                        cJSON_AddItemToObject(hardware, "outputBoard", outputBoard);
-                        
-                        // ADC: Check if initialized
-                        cJSON *adc = cJSON_CreateObject();
-                        extern bool adc_handler_is_initialized(void);
-                        bool adc_present = adc_handler_is_initialized();
-                        cJSON_AddBoolToObject(adc, "present", adc_present);
-                        cJSON_AddBoolToObject(adc, "working", adc_present);
-                        cJSON_AddItemToObject(hardware, "adc", adc);
-                        
-                        // Sound Module: Not implemented yet
-                        cJSON *soundModule = cJSON_CreateObject();
-                        cJSON_AddBoolToObject(soundModule, "present", false);
-                        cJSON_AddBoolToObject(soundModule, "working", false);
-                        cJSON_AddItemToObject(hardware, "soundModule", soundModule);
-                        
-                        cJSON_AddItemToObject(data, "hardware", hardware);
-                        cJSON_AddItemToObject(payload, "data", data);
-                        cJSON_AddItemToObject(root, "payload", payload);
-                        
-                        char *response = cJSON_PrintUnformatted(root);
-                        if (response) {
-                            ESP_LOGI(TAG, "Sending hardware diagnostic response");
-                            ws_handlers_send_text(response, strlen(response));
-                            free(response);
-                        }
-                        cJSON_Delete(root);
-                    }
-                }
-            }
-
-            ESP_LOGD(TAG, "Message parsed successfully");
-        } else {
-            ESP_LOGW(TAG, "Failed to parse message");
-        }
-        
+        process_text_frame(fd, (char *)ws_pkt.payload, ws_pkt.len);
     }
 
     if (buf != small_buf) {
@@ -426,9 +743,9 @@ static void ws_async_send(void *arg) {
     ws_pkt.len = strlen((char *)arg);
     ws_pkt.type = HTTPD_WS_TYPE_TEXT;
     
-    // Send to all connected clients
+    // Send to all clients httpd still owns; the WS I/O task serves the rest
     for (int i = 0; i < MAX_CLIENTS; i++) {
-        if (client_fds[i] != 0) {
+        if (client_fds[i] != 0 && !ws_io_owns(client_fds[i])) {
             esp_err_t ret = httpd_ws_send_frame_async(s_server, client_fds[i], &ws_pkt);
             if (ret != ESP_OK) {
                 ESP_LOGW(TAG, "Failed to send to client fd=%d: %s", 
@@ -456,6 +773,29 @@ esp_err_t ws_handlers_register(httpd_handle_t server) {
     userscript_clients = 0;
     memset(client_fds, 0, sizeof(client_fds));
     memset(client_is_userscript, 0, sizeof(client_is_userscript));
+    memset(client_last_seq, 0, sizeof(client_last_seq));
+
+    if (s_clients_lock == NULL) {
+        s_clients_lock = xSemaphoreCreateMutex();
+        if (s_clients_lock == NULL) {
+            ESP_LOGE(TAG, "Failed to create client table mutex");
+            s_server = NULL;
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (s_rx_lock == NULL) {
+        s_rx_lock = xSemaphoreCreateMutex();
+        if (s_rx_lock == NULL) {
+            ESP_LOGE(TAG, "Failed to create receive mutex");
+            s_server = NULL;
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    // Upgraded sessions move to the WS I/O task; without it they stay on httpd
+    if (ws_io_start(server, process_text_frame) != ESP_OK) {
+        ESP_LOGW(TAG, "WS I/O task unavailable; WebSocket traffic stays on the httpd task");
+    }
     
     // Register WebSocket handler
     static const httpd_uri_t ws = {
@@ -494,6 +834,16 @@ esp_err_t ws_handlers_send_text(const char *data, size_t len) {
         ESP_LOGD(TAG, "No clients connected, message not sent");
         return ESP_OK;  // Not an error, just no recipients
     }
+
+    // Sessions owned by the WS I/O task never wait behind httpd handlers
+    esp_err_t io_ret = ESP_OK;
+    const int io_sessions = ws_io_get_session_count();
+    if (io_sessions > 0) {
+        io_ret = ws_io_send_text(-1, data, len);
+    }
+    if (active_clients <= io_sessions) {
+        return io_ret;
+    }
     
     // Copy data for async send
     char *data_copy = malloc(len + 1);
@@ -512,7 +862,7 @@ esp_err_t ws_handlers_send_text(const char *data, size_t len) {
         return ESP_FAIL;
     }
     
-    return ESP_OK;
+    return io_ret;
 }
 
 esp_err_t ws_handlers_send_event(const game_event_t *event) {
@@ -542,6 +892,42 @@ int ws_handlers_get_userscript_count(void) {
     return userscript_clients;
 }
 
+esp_err_t ws_handlers_request_snapshot(const char *reason) {
+    if (userscript_clients == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const int64_t now_us = esp_timer_get_time();
+    if (last_resync_request_us != 0 &&
+        (now_us - last_resync_request_us) < (int64_t)RESYNC_REQUEST_MIN_INTERVAL_MS * 1000) {
+        ESP_LOGD(TAG, "Snapshot request (%s) suppressed: one already pending", reason ? reason : "?");
+        return ESP_OK;
+    }
+    last_resync_request_us = now_us;
+
+    char buffer[128];
+    json_writer_t w;
+    json_writer_init(&w, buffer, sizeof(buffer));
+    ws_protocol_begin_command(&w, "request-snapshot");
+    json_writer_field_string(&w, "reason", reason ? reason : "resync");
+    ws_protocol_end_command(&w);
+
+    size_t len;
+    esp_err_t ret = json_writer_finish(&w, &len);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Requesting state snapshot (%s)", reason ? reason : "resync");
+    return ws_handlers_send_text(buffer, len);
+}
+
+void ws_handlers_get_rx_stats(ws_handlers_rx_stats_t *out) {
+    if (out) {
+        *out = s_rx_stats;
+    }
+}
+
 void ws_handlers_set_connection_callback(ws_connection_callback_t callback) {
     connection_callback = callback;
 }
@@ -0,0 +1,759 @@
+/**
+ * @file ws_io.c
+ * @brief Dedicated WebSocket I/O task
+ *
+ * Owns upgraded WebSocket sessions so that game traffic no longer waits
+ * behind long-running httpd handlers. See ws_io.h for the hand-over model.
+ *
+ * Threading:
+ * - ws_io_attach() runs on the httpd task and publishes a session slot
+ * - ws_io_send_text() may be called from any task; it only enqueues
+ * - Everything else (reads, frame parsing, writes, close) runs on ws_io
+ */
+
+#include "ws_io.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_tls.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "lwip/sockets.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "OTS_WS_IO";
+
+#define WS_IO_TASK_STACK_SIZE 6144
+#define WS_IO_TASK_PRIORITY 6           // Above httpd (5) so game traffic preempts uploads
+#define WS_IO_SEND_QUEUE_LEN 16
+#define WS_IO_RX_BUFFER_SIZE 1024       // Initial per-session buffer; grows for large frames
+#define WS_IO_MAX_FRAME_SIZE 16384      // Snapshots are the largest messages
+#define WS_IO_SEND_TIMEOUT_MS 2000      // Drop a session that cannot take a frame for this long
+#define WS_IO_IDLE_TIMEOUT_MS 1000
+#define WS_IO_TX_SCRATCH_SIZE 1024      // Header + payload in one TLS record when it fits
+#define WS_IO_SMALL_MSG_SIZE 256        // Commands and most events; larger frames use the heap
+#define WS_IO_SMALL_MSG_SLOTS 8
+
+// WebSocket opcodes (RFC 6455)
+#define WS_OP_CONTINUATION 0x0
+#define WS_OP_TEXT 0x1
+#define WS_OP_BINARY 0x2
+#define WS_OP_CLOSE 0x8
+#define WS_OP_PING 0x9
+#define WS_OP_PONG 0xA
+
+#define WS_CLOSE_PROTOCOL_ERROR 1002
+#define WS_CLOSE_TOO_BIG 1009
+
+typedef struct {
+    int fd;                 // 0 = free slot
+    httpd_req_t *req;       // Async request copy; keeps httpd off the socket
+    esp_tls_t *tls;         // NULL when the server runs without TLS
+    uint8_t *rx_buf;
+    size_t rx_cap;
+    size_t rx_len;
+    bool closing;
+} ws_session_t;
+
+typedef struct {
+    int fd;                 // -1 = every attached session
+    uint8_t opcode;
+    char *data;
+    size_t len;
+    int64_t queued_us;
+} ws_io_msg_t;
+
+static httpd_handle_t s_server = NULL;
+static ws_io_text_handler_t s_on_text = NULL;
+static TaskHandle_t s_task = NULL;
+static QueueHandle_t s_send_queue = NULL;
+static volatile bool s_running = false;
+
+static ws_session_t s_sessions[WS_IO_MAX_SESSIONS];
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Loopback UDP socket used to wake select() (same trick as httpd's ctrl socket)
+static int s_wake_sock = -1;
+static int s_poke_sock = -1;
+static struct sockaddr_in s_wake_addr;
+static bool s_wake_pending = false;
+
+static ws_io_stats_t s_stats;
+static uint64_t s_rx_handle_total_us = 0;
+static uint64_t s_tx_queue_total_us = 0;
+static uint32_t s_tx_msgs = 0;
+
+// Fixed slots for queued small frames, so the copy made by ws_io_send_text()
+// does not hit the heap for every command
+static char s_small_msgs[WS_IO_SMALL_MSG_SLOTS][WS_IO_SMALL_MSG_SIZE];
+static uint32_t s_small_used = 0;   // Bit i: slot i is queued (guarded by s_lock)
+
+static void ws_io_task(void *arg);
+
+static char *msg_buf_alloc(size_t len) {
+    if (len <= WS_IO_SMALL_MSG_SIZE) {
+        taskENTER_CRITICAL(&s_lock);
+        for (int i = 0; i < WS_IO_SMALL_MSG_SLOTS; i++) {
+            if (!(s_small_used & (1u << i))) {
+                s_small_used |= (1u << i);
+                taskEXIT_CRITICAL(&s_lock);
+                return s_small_msgs[i];
+            }
+        }
+        taskEXIT_CRITICAL(&s_lock);
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    s_stats.send_heap_allocs++;
+    taskEXIT_CRITICAL(&s_lock);
+    return malloc(len);
+}
+
+static void msg_buf_free(char *data) {
+    if (data >= s_small_msgs[0] && data < s_small_msgs[WS_IO_SMALL_MSG_SLOTS]) {
+        const int slot = (int)((data - s_small_msgs[0]) / WS_IO_SMALL_MSG_SIZE);
+        taskENTER_CRITICAL(&s_lock);
+        s_small_used &= ~(1u << slot);
+        taskEXIT_CRITICAL(&s_lock);
+        return;
+    }
+    free(data);
+}
+
+static void wake_task(void) {
+    bool already;
+    taskENTER_CRITICAL(&s_lock);
+    already = s_wake_pending;
+    s_wake_pending = true;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (!already) {
+        const char b = 'w';
+        (void)sendto(s_poke_sock, &b, 1, 0, (const struct sockaddr *)&s_wake_addr, sizeof(s_wake_addr));
+    }
+}
+
+static esp_err_t create_wake_socket(void) {
+    s_wake_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    s_poke_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s_wake_sock < 0 || s_poke_sock < 0) {
+        ESP_LOGE(TAG, "Failed to create wake sockets: errno %d", errno);
+        return ESP_FAIL;
+    }
+
+    memset(&s_wake_addr, 0, sizeof(s_wake_addr));
+    s_wake_addr.sin_family = AF_INET;
+    s_wake_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    s_wake_addr.sin_port = 0;  // Ephemeral
+
+    if (bind(s_wake_sock, (struct sockaddr *)&s_wake_addr, sizeof(s_wake_addr)) < 0) {
+        ESP_LOGE(TAG, "Failed to bind wake socket: errno %d", errno);
+        return ESP_FAIL;
+    }
+
+    socklen_t addr_len = sizeof(s_wake_addr);
+    if (getsockname(s_wake_sock, (struct sockaddr *)&s_wake_addr, &addr_len) < 0) {
+        ESP_LOGE(TAG, "Failed to query wake socket port: errno %d", errno);
+        return ESP_FAIL;
+    }
+
+    fcntl(s_wake_sock, F_SETFL, fcntl(s_wake_sock, F_GETFL, 0) | O_NONBLOCK);
+    return ESP_OK;
+}
+
+static void close_wake_sockets(void) {
+    if (s_wake_sock >= 0) {
+        close(s_wake_sock);
+        s_wake_sock = -1;
+    }
+    if (s_poke_sock >= 0) {
+        close(s_poke_sock);
+        s_poke_sock = -1;
+    }
+}
+
+esp_err_t ws_io_start(httpd_handle_t server, ws_io_text_handler_t on_text) {
+    if (!server || !on_text) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task) {
+        ESP_LOGW(TAG, "WS I/O task already running");
+        return ESP_OK;
+    }
+
+    s_server = server;
+    s_on_text = on_text;
+    memset(s_sessions, 0, sizeof(s_sessions));
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    s_send_queue = xQueueCreate(WS_IO_SEND_QUEUE_LEN, sizeof(ws_io_msg_t));
+    if (!s_send_queue) {
+        ESP_LOGE(TAG, "Failed to create send queue");
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (create_wake_socket() != ESP_OK) {
+        close_wake_sockets();
+        vQueueDelete(s_send_queue);
+        s_send_queue = NULL;
+        return ESP_FAIL;
+    }
+
+    // Mark running before the task can observe it
+    s_running = true;
+    BaseType_t ok = xTaskCreate(ws_io_task, "ws_io", WS_IO_TASK_STACK_SIZE, NULL,
+                                WS_IO_TASK_PRIORITY, &s_task);
+    if (ok != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create WS I/O task");
+        s_running = false;
+        close_wake_sockets();
+        vQueueDelete(s_send_queue);
+        s_send_queue = NULL;
+        s_task = NULL;
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, "WS I/O task started (max %d sessions)", WS_IO_MAX_SESSIONS);
+    return ESP_OK;
+}
+
+bool ws_io_is_running(void) {
+    return s_running;
+}
+
+esp_err_t ws_io_attach(httpd_req_t *req) {
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!req) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const int fd = httpd_req_to_sockfd(req);
+    if (fd <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t *rx_buf = malloc(WS_IO_RX_BUFFER_SIZE);
+    if (!rx_buf) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Reserve a slot before detaching, so a full table leaves httpd in charge
+    int slot = -1;
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < WS_IO_MAX_SESSIONS; i++) {
+        if (s_sessions[i].fd == 0 && s_sessions[i].req == NULL) {
+            slot = i;
+            s_sessions[i].fd = -1;  // Reserved, not yet visible to the task
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (slot < 0) {
+        free(rx_buf);
+        return ESP_ERR_NO_MEM;
+    }
+
+    httpd_req_t *async_req = NULL;
+    esp_err_t ret = httpd_req_async_handler_begin(req, &async_req);
+    if (ret != ESP_OK) {
+        taskENTER_CRITICAL(&s_lock);
+        s_sessions[slot].fd = 0;
+        taskEXIT_CRITICAL(&s_lock);
+        free(rx_buf);
+        ESP_LOGW(TAG, "Failed to detach fd=%d from httpd: %s", fd, esp_err_to_name(ret));
+        return ret;
+    }
+
+    // Reads and writes must never block the I/O loop
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    ws_session_t *s = &s_sessions[slot];
+    s->req = async_req;
+    s->tls = (esp_tls_t *)httpd_sess_get_transport_ctx(s_server, fd);
+    s->rx_buf = rx_buf;
+    s->rx_cap = WS_IO_RX_BUFFER_SIZE;
+    s->rx_len = 0;
+    s->closing = false;
+
+    taskENTER_CRITICAL(&s_lock);
+    s->fd = fd;
+    s_stats.sessions_attached++;
+    s_stats.sessions_active++;
+    taskEXIT_CRITICAL(&s_lock);
+
+    wake_task();
+    ESP_LOGI(TAG, "Session fd=%d attached to WS I/O task (%s)", fd, s->tls ? "tls" : "plain");
+    return ESP_OK;
+}
+
+bool ws_io_owns(int fd) {
+    if (fd <= 0) {
+        return false;
+    }
+    bool owned = false;
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < WS_IO_MAX_SESSIONS; i++) {
+        if (s_sessions[i].fd == fd) {
+            owned = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    return owned;
+}
+
+int ws_io_get_session_count(void) {
+    return (int)s_stats.sessions_active;
+}
+
+static esp_err_t enqueue(int fd, uint8_t opcode, const char *data, size_t len) {
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ws_io_msg_t msg = {
+        .fd = fd,
+        .opcode = opcode,
+        .data = NULL,
+        .len = len,
+        .queued_us = esp_timer_get_time(),
+    };
+    if (len > 0) {
+        msg.data = msg_buf_alloc(len);
+        if (!msg.data) {
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(msg.data, data, len);
+    }
+
+    if (xQueueSend(s_send_queue, &msg, 0) != pdTRUE) {
+        msg_buf_free(msg.data);
+        taskENTER_CRITICAL(&s_lock);
+        s_stats.send_dropped++;
+        taskEXIT_CRITICAL(&s_lock);
+        ESP_LOGW(TAG, "Send queue full, dropping %u bytes", (unsigned)len);
+        return ESP_ERR_NO_MEM;
+    }
+
+    wake_task();
+    return ESP_OK;
+}
+
+esp_err_t ws_io_send_text(int fd, const char *data, size_t len) {
+    if (!data && len > 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return enqueue(fd, WS_OP_TEXT, data, len);
+}
+
+// ---------------------------------------------------------------------------
+// Everything below runs on the WS I/O task only
+// ---------------------------------------------------------------------------
+
+static ssize_t transport_read(ws_session_t *s, void *buf, size_t len) {
+    if (s->tls) {
+        ssize_t n = esp_tls_conn_read(s->tls, buf, len);
+        if (n == ESP_TLS_ERR_SSL_WANT_READ || n == ESP_TLS_ERR_SSL_WANT_WRITE) {
+            return -EAGAIN;
+        }
+        return n;
+    }
+
+    ssize_t n = recv(s->fd, buf, len, MSG_DONTWAIT);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return -EAGAIN;
+    }
+    return n;
+}
+
+static bool wait_writable(int fd, int timeout_ms) {
+    fd_set wfds;
+    FD_ZERO(&wfds);
+    FD_SET(fd, &wfds);
+    struct timeval tv = {
+        .tv_sec = timeout_ms / 1000,
+        .tv_usec = (timeout_ms % 1000) * 1000,
+    };
+    return select(fd + 1, NULL, &wfds, NULL, &tv) > 0;
+}
+
+static bool transport_write_all(ws_session_t *s, const uint8_t *data, size_t len) {
+    const int64_t deadline_us = esp_timer_get_time() + (int64_t)WS_IO_SEND_TIMEOUT_MS * 1000;
+
+    while (len > 0) {
+        ssize_t n;
+        bool again;
+        if (s->tls) {
+            n = esp_tls_conn_write(s->tls, data, len);
+            again = (n == ESP_TLS_ERR_SSL_WANT_WRITE || n == ESP_TLS_ERR_SSL_WANT_READ);
+        } else {
+            n = send(s->fd, data, len, MSG_DONTWAIT);
+            again = (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+        }
+
+        if (n > 0) {
+            data += n;
+            len -= (size_t)n;
+            continue;
+        }
+        if (!again) {
+            ESP_LOGW(TAG, "Write failed on fd=%d (%d)", s->fd, (int)n);
+            return false;
+        }
+
+        const int64_t left_us = deadline_us - esp_timer_get_time();
+        if (left_us <= 0 || !wait_writable(s->fd, (int)(left_us / 1000) + 1)) {
+            ESP_LOGW(TAG, "Write timeout on fd=%d", s->fd);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool send_frame(ws_session_t *s, uint8_t opcode, const uint8_t *payload, size_t len) {
+    uint8_t header[10];
+    size_t hlen = 0;
+
+    header[hlen++] = 0x80 | opcode;  // FIN, server frames are never masked
+    if (len < 126) {
+        header[hlen++] = (uint8_t)len;
+    } else if (len <= 0xFFFF) {
+        header[hlen++] = 126;
+        header[hlen++] = (uint8_t)(len >> 8);
+        header[hlen++] = (uint8_t)len;
+    } else {
+        header[hlen++] = 127;
+        for (int i = 7; i >= 0; i--) {
+            header[hlen++] = (uint8_t)((uint64_t)len >> (8 * i));
+        }
+    }
+
+    bool ok;
+    if (hlen + len <= WS_IO_TX_SCRATCH_SIZE) {
+        // One write = one TLS record for the common small message
+        static uint8_t scratch[WS_IO_TX_SCRATCH_SIZE];
+        memcpy(scratch, header, hlen);
+        if (len > 0) {
+            memcpy(scratch + hlen, payload, len);
+        }
+        ok = transport_write_all(s, scratch, hlen + len);
+    } else {
+        ok = transport_write_all(s, header, hlen) &&
+             transport_write_all(s, payload, len);
+    }
+
+    if (ok) {
+        s_stats.frames_tx++;
+    } else {
+        s->closing = true;
+    }
+    return ok;
+}
+
+static void send_close(ws_session_t *s, uint16_t code) {
+    const uint8_t payload[2] = { (uint8_t)(code >> 8), (uint8_t)code };
+    (void)send_frame(s, WS_OP_CLOSE, payload, sizeof(payload));
+    s->closing = true;
+}
+
+static void session_close(ws_session_t *s) {
+    const int fd = s->fd;
+    httpd_req_t *req = s->req;
+
+    taskENTER_CRITICAL(&s_lock);
+    s->fd = 0;
+    s->req = NULL;
+    if (s_stats.sessions_active > 0) {
+        s_stats.sessions_active--;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    free(s->rx_buf);
+    s->rx_buf = NULL;
+    s->rx_cap = 0;
+    s->rx_len = 0;
+    s->tls = NULL;
+    s->closing = false;
+
+    // Hand the socket back so httpd runs its normal close path (close_fn)
+    if (req) {
+        httpd_req_async_handler_complete(req);
+    }
+    httpd_sess_trigger_close(s_server, fd);
+    ESP_LOGI(TAG, "Session fd=%d released", fd);
+}
+
+static bool ensure_rx_capacity(ws_session_t *s, size_t needed) {
+    if (needed <= s->rx_cap) {
+        return true;
+    }
+    uint8_t *grown = realloc(s->rx_buf, needed);
+    if (!grown) {
+        ESP_LOGE(TAG, "Failed to grow rx buffer to %u bytes (fd=%d)", (unsigned)needed, s->fd);
+        return false;
+    }
+    s->rx_buf = grown;
+    s->rx_cap = needed;
+    return true;
+}
+
+static void record_rx_latency(int64_t ready_us) {
+    const uint32_t dt = (uint32_t)(esp_timer_get_time() - ready_us);
+    s_stats.frames_rx++;
+    s_rx_handle_total_us += dt;
+    s_stats.rx_handle_avg_us = (uint32_t)(s_rx_handle_total_us / s_stats.frames_rx);
+    if (dt > s_stats.rx_handle_max_us) {
+        s_stats.rx_handle_max_us = dt;
+    }
+}
+
+// Parse and handle every complete frame in the rx buffer
+static void process_frames(ws_session_t *s, int64_t ready_us) {
+    size_t off = 0;
+
+    while (!s->closing && s->rx_len - off >= 2) {
+        uint8_t *p = s->rx_buf + off;
+        const size_t avail = s->rx_len - off;
+        const bool fin = (p[0] & 0x80) != 0;
+        const uint8_t opcode = p[0] & 0x0F;
+        const bool masked = (p[1] & 0x80) != 0;
+        uint64_t plen = p[1] & 0x7F;
+        size_t hlen = 2;
+
+        if (plen == 126) {
+            if (avail < 4) break;
+            plen = ((uint64_t)p[2] << 8) | p[3];
+            hlen = 4;
+        } else if (plen == 127) {
+            if (avail < 10) break;
+            plen = 0;
+            for (int i = 0; i < 8; i++) {
+                plen = (plen << 8) | p[2 + i];
+            }
+            hlen = 10;
+        }
+
+        if (!masked) {
+            ESP_LOGW(TAG, "Unmasked client frame (fd=%d)", s->fd);
+            send_close(s, WS_CLOSE_PROTOCOL_ERROR);
+            break;
+        }
+        if (plen > WS_IO_MAX_FRAME_SIZE) {
+            ESP_LOGW(TAG, "Frame too large (%llu bytes, fd=%d)", (unsigned long long)plen, s->fd);
+            send_close(s, WS_CLOSE_TOO_BIG);
+            break;
+        }
+
+        const size_t frame_len = hlen + 4 + (size_t)plen;
+        if (avail < frame_len) {
+            // Make room for the rest of this frame (+1 for the NUL terminator)
+            if (off > 0) {
+                memmove(s->rx_buf, s->rx_buf + off, avail);
+                s->rx_len = avail;
+                off = 0;
+            }
+            if (!ensure_rx_capacity(s, frame_len + 1)) {
+                send_close(s, WS_CLOSE_TOO_BIG);
+            }
+            break;
+        }
+
+        const uint8_t *mask = p + hlen;
+        uint8_t *payload = p + hlen + 4;
+        for (size_t i = 0; i < (size_t)plen; i++) {
+            payload[i] ^= mask[i & 3];
+        }
+
+        switch (opcode) {
+            case WS_OP_TEXT:
+                if (!fin) {
+                    // Browsers send game messages unfragmented; same as the httpd path
+                    ESP_LOGW(TAG, "Dropping fragmented text frame (fd=%d)", s->fd);
+                    break;
+                }
+                if (!ensure_rx_capacity(s, off + frame_len + 1)) {
+                    break;
+                }
+                p = s->rx_buf + off;
+                payload = p + hlen + 4;
+                {
+                    const uint8_t saved = payload[plen];
+                    payload[plen] = '\0';
+                    s_on_text(s->fd, (char *)payload, (size_t)plen);
+                    payload[plen] = saved;
+                }
+                record_rx_latency(ready_us);
+                break;
+            case WS_OP_PING:
+                (void)send_frame(s, WS_OP_PONG, payload, (size_t)plen);
+                break;
+            case WS_OP_CLOSE:
+                ESP_LOGI(TAG, "Client requested close (fd=%d)", s->fd);
+                (void)send_frame(s, WS_OP_CLOSE, payload, plen >= 2 ? 2 : 0);
+                s->closing = true;
+                break;
+            case WS_OP_PONG:
+            case WS_OP_BINARY:
+            case WS_OP_CONTINUATION:
+            default:
+                break;
+        }
+
+        off += frame_len;
+    }
+
+    if (off > 0) {
+        s->rx_len -= off;
+        if (s->rx_len > 0) {
+            memmove(s->rx_buf, s->rx_buf + off, s->rx_len);
+        }
+    }
+}
+
+static void session_read(ws_session_t *s, int64_t ready_us) {
+    // Drain the socket (and any TLS-buffered plaintext) into the rx buffer.
+    // If it fills up, parse first; leftover bytes keep the socket readable.
+    while (s->rx_len < s->rx_cap) {
+        ssize_t n = transport_read(s, s->rx_buf + s->rx_len, s->rx_cap - s->rx_len);
+        if (n == -EAGAIN) {
+            break;
+        }
+        if (n <= 0) {
+            ESP_LOGD(TAG, "Peer closed fd=%d (%d)", s->fd, (int)n);
+            s->closing = true;
+            return;
+        }
+        s->rx_len += (size_t)n;
+    }
+
+    process_frames(s, ready_us);
+}
+
+static void record_tx_latency(int64_t queued_us) {
+    const uint32_t dt = (uint32_t)(esp_timer_get_time() - queued_us);
+    s_tx_msgs++;
+    s_tx_queue_total_us += dt;
+    s_stats.tx_queue_avg_us = (uint32_t)(s_tx_queue_total_us / s_tx_msgs);
+    if (dt > s_stats.tx_queue_max_us) {
+        s_stats.tx_queue_max_us = dt;
+    }
+}
+
+static void drain_send_queue(void) {
+    ws_io_msg_t msg;
+    while (xQueueReceive(s_send_queue, &msg, 0) == pdTRUE) {
+        for (int i = 0; i < WS_IO_MAX_SESSIONS; i++) {
+            ws_session_t *s = &s_sessions[i];
+            if (s->fd <= 0 || s->closing) continue;
+            if (msg.fd >= 0 && s->fd != msg.fd) continue;
+            (void)send_frame(s, msg.opcode, (const uint8_t *)msg.data, msg.len);
+        }
+        record_tx_latency(msg.queued_us);
+        msg_buf_free(msg.data);
+    }
+}
+
+static bool tls_has_pending(const ws_session_t *s) {
+    return s->tls && esp_tls_get_bytes_avail(s->tls) > 0;
+}
+
+static void ws_io_task(void *arg) {
+    (void)arg;
+    ESP_LOGI(TAG, "WS I/O task running (wake port %u)", ntohs(s_wake_addr.sin_port));
+
+    while (s_running) {
+        fd_set rfds;
+        FD_ZERO(&rfds);
+        FD_SET(s_wake_sock, &rfds);
+        int max_fd = s_wake_sock;
+        bool pending = false;
+
+        for (int i = 0; i < WS_IO_MAX_SESSIONS; i++) {
+            const ws_session_t *s = &s_sessions[i];
+            if (s->fd <= 0) continue;
+            FD_SET(s->fd, &rfds);
+            if (s->fd > max_fd) max_fd = s->fd;
+            // mbedTLS may already hold decrypted bytes select() cannot see
+            pending |= tls_has_pending(s);
+        }
+
+        struct timeval tv = {
+            .tv_sec = pending ? 0 : WS_IO_IDLE_TIMEOUT_MS / 1000,
+            .tv_usec = pending ? 0 : (WS_IO_IDLE_TIMEOUT_MS % 1000) * 1000,
+        };
+        int n = select(max_fd + 1, &rfds, NULL, NULL, &tv);
+        const int64_t ready_us = esp_timer_get_time();
+        if (n < 0) {
+            if (errno != EINTR) {
+                ESP_LOGW(TAG, "select failed: errno %d", errno);
+                vTaskDelay(pdMS_TO_TICKS(10));
+            }
+            continue;
+        }
+
+        if (FD_ISSET(s_wake_sock, &rfds)) {
+            char drain[16];
+            while (recv(s_wake_sock, drain, sizeof(drain), MSG_DONTWAIT) > 0) {
+            }
+        }
+
+        for (int i = 0; i < WS_IO_MAX_SESSIONS; i++) {
+            ws_session_t *s = &s_sessions[i];
+            if (s->fd <= 0) continue;
+            if (FD_ISSET(s->fd, &rfds) || tls_has_pending(s)) {
+                session_read(s, ready_us);
+            }
+        }
+
+        // Clear before draining so a message queued mid-drain wakes us again
+        taskENTER_CRITICAL(&s_lock);
+        s_wake_pending = false;
+        taskEXIT_CRITICAL(&s_lock);
+        drain_send_queue();
+
+        for (int i = 0; i < WS_IO_MAX_SESSIONS; i++) {
+            ws_session_t *s = &s_sessions[i];
+            if (s->fd > 0 && s->closing) {
+                session_close(s);
+            }
+        }
+    }
+
+    close_wake_sockets();
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+esp_err_t ws_io_get_stats(ws_io_stats_t *out_stats) {
+    if (!out_stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    taskENTER_CRITICAL(&s_lock);
+    memcpy(out_stats, &s_stats, sizeof(*out_stats));
+    taskEXIT_CRITICAL(&s_lock);
+    return ESP_OK;
+}
+
+void ws_io_log_stats(void) {
+    ws_io_stats_t st;
+    ws_io_get_stats(&st);
+
+    ESP_LOGI(TAG, "WS I/O: sessions=%lu (attached total %lu) rx=%lu tx=%lu dropped=%lu heap copies=%lu",
+             (unsigned long)st.sessions_active, (unsigned long)st.sessions_attached,
+             (unsigned long)st.frames_rx, (unsigned long)st.frames_tx,
+             (unsigned long)st.send_dropped, (unsigned long)st.send_heap_allocs);
+    ESP_LOGI(TAG, "WS I/O latency: rx handle avg=%luus max=%luus, tx queue avg=%luus max=%luus",
+             (unsigned long)st.rx_handle_avg_us, (unsigned long)st.rx_handle_max_us,
+             (unsigned long)st.tx_queue_avg_us, (unsigned long)st.tx_queue_max_us);
+
+    // Maxima are per reporting window
+    taskENTER_CRITICAL(&s_lock);
+    s_stats.rx_handle_max_us = 0;
+    s_stats.tx_queue_max_us = 0;
+    taskEXIT_CRITICAL(&s_lock);
+}
@@ -11,7 +11,171 @@ esp_err_t ws_protocol_init(void) {
     return ESP_OK;
 }
 
-esp_err_t ws_protocol_parse(const char *json_str, size_t len, ws_message_t *msg) {
+// Decode one event object ({type, timestamp, seq, message, data})
+static void parse_event_payload(const cJSON *payload, ws_event_payload_t *out) {
+    cJSON *event_type = cJSON_GetObjectItem(payload, "type");
+    if (event_type && cJSON_IsString(event_type)) {
+        out->event_type = string_to_event_type(event_type->valuestring);
+    }
+    
+    cJSON *timestamp = cJSON_GetObjectItem(payload, "timestamp");
+    if (timestamp && cJSON_IsNumber(timestamp)) {
+        out->timestamp = timestamp->valueint;
+    }
+
+    cJSON *seq = cJSON_GetObjectItem(payload, "seq");
+    if (seq && cJSON_IsNumber(seq) && seq->valuedouble > 0) {
+        out->seq = (uint32_t)seq->valuedouble;
+    }
+    
+    cJSON *message = cJSON_GetObjectItem(payload, "message");
+    if (message && cJSON_IsString(message)) {
+        strncpy(out->message, message->valuestring, sizeof(out->message) - 1);
+    }
+    
+    cJSON *data = cJSON_GetObjectItem(payload, "data");
+    if (data) {
+        if (cJSON_IsString(data) && data->valuestring) {
+            strncpy(out->data, data->valuestring, sizeof(out->data) - 1);
+        } else {
+            // Userscript/ots-server commonly send `data` as an object.
+            // Internally, firmware modules expect `event.data` as a JSON string.
+            // Print into the fixed buffer: no heap allocation per event.
+            if (!cJSON_PrintPreallocated((cJSON *)data, out->data, (int)sizeof(out->data), false)) {
+                out->data[0] = '\0';
+                ESP_LOGW(TAG, "Event data longer than %d bytes, dropped", (int)sizeof(out->data) - 1);
+            }
+        }
+    }
+}
+
+// Deliver the events of a `batch` payload
+static esp_err_t decode_batch(const cJSON *payload, ws_protocol_event_cb_t on_event, void *ctx,
+                              size_t *out_count) {
+    *out_count = 0;
+    cJSON *events = payload ? cJSON_GetObjectItem(payload, "events") : NULL;
+    if (!events || !cJSON_IsArray(events)) {
+        ESP_LOGW(TAG, "Batch missing events array");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    size_t count = 0;
+    ws_event_payload_t event;
+    cJSON *item = NULL;
+    cJSON_ArrayForEach(item, events) {
+        if (count >= WS_BATCH_MAX_EVENTS) {
+            ESP_LOGW(TAG, "Batch has more than %d events; rest skipped", WS_BATCH_MAX_EVENTS);
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        if (!cJSON_IsObject(item)) {
+            continue;
+        }
+        memset(&event, 0, sizeof(event));
+        parse_event_payload(item, &event);
+        on_event(&event, ctx);
+        count++;
+    }
+
+    *out_count = count;
+    return ret;
+}
+
+static bool parse_nuke_type(const char *str, nuke_type_t *out) {
+    if (strcmp(str, "atom") == 0) *out = NUKE_TYPE_ATOM;
+    else if (strcmp(str, "hydro") == 0) *out = NUKE_TYPE_HYDRO;
+    else if (strcmp(str, "mirv") == 0) *out = NUKE_TYPE_MIRV;
+    else return false;
+    return true;
+}
+
+static uint16_t get_count(const cJSON *obj, const char *key) {
+    const cJSON *item = cJSON_GetObjectItem(obj, key);
+    if (!item || !cJSON_IsNumber(item) || item->valuedouble <= 0) {
+        return 0;
+    }
+    return item->valuedouble > UINT16_MAX ? UINT16_MAX : (uint16_t)item->valuedouble;
+}
+
+// Decode a `snapshot` payload
+static esp_err_t decode_snapshot(const cJSON *payload, game_snapshot_t *out) {
+    memset(out, 0, sizeof(game_snapshot_t));
+
+    cJSON *version = payload ? cJSON_GetObjectItem(payload, "version") : NULL;
+    cJSON *phase = payload ? cJSON_GetObjectItem(payload, "phase") : NULL;
+    if (!version || !cJSON_IsNumber(version) || !phase || !cJSON_IsString(phase) ||
+        !game_snapshot_parse_phase(phase->valuestring, &out->phase)) {
+        ESP_LOGW(TAG, "Snapshot missing version or phase");
+        return ESP_ERR_INVALID_ARG;
+    }
+    out->version = (uint32_t)version->valuedouble;
+
+    cJSON *seq = cJSON_GetObjectItem(payload, "seq");
+    if (seq && cJSON_IsNumber(seq) && seq->valuedouble > 0) {
+        out->seq = (uint32_t)seq->valuedouble;
+    }
+
+    cJSON *timestamp = cJSON_GetObjectItem(payload, "timestamp");
+    if (timestamp && cJSON_IsNumber(timestamp)) {
+        out->timestamp = (uint64_t)timestamp->valuedouble;
+    }
+
+    cJSON *troops = cJSON_GetObjectItem(payload, "troops");
+    if (troops && cJSON_IsObject(troops)) {
+        cJSON *current = cJSON_GetObjectItem(troops, "current");
+        cJSON *max = cJSON_GetObjectItem(troops, "max");
+        if (current && cJSON_IsNumber(current) && max && cJSON_IsNumber(max)) {
+            out->troops_current = (uint32_t)current->valuedouble;
+            out->troops_max = (uint32_t)max->valuedouble;
+            out->has_troops = true;
+        }
+    }
+
+    cJSON *attack_ratio = cJSON_GetObjectItem(payload, "attackRatio");
+    if (attack_ratio && cJSON_IsNumber(attack_ratio)) {
+        double ratio = attack_ratio->valuedouble;
+        if (ratio < 0.0) ratio = 0.0;
+        if (ratio > 1.0) ratio = 1.0;
+        out->attack_percent = (uint8_t)(ratio * 100.0 + 0.5);
+        out->has_attack_ratio = true;
+    }
+
+    // Compact tuples: [unitID, "atom"|"hydro"|"mirv", "in"|"out"]
+    cJSON *nukes = cJSON_GetObjectItem(payload, "nukes");
+    cJSON *nuke = NULL;
+    cJSON_ArrayForEach(nuke, nukes) {
+        cJSON *unit_id = cJSON_GetArrayItem(nuke, 0);
+        cJSON *type = cJSON_GetArrayItem(nuke, 1);
+        cJSON *dir = cJSON_GetArrayItem(nuke, 2);
+        nuke_type_t nuke_type;
+        if (!unit_id || !cJSON_IsNumber(unit_id) || unit_id->valuedouble <= 0 ||
+            !type || !cJSON_IsString(type) || !parse_nuke_type(type->valuestring, &nuke_type) ||
+            !dir || !cJSON_IsString(dir)) {
+            ESP_LOGW(TAG, "Skipping malformed snapshot nuke entry");
+            continue;
+        }
+        if (out->nuke_count >= GAME_SNAPSHOT_MAX_NUKES) {
+            out->nukes_truncated = true;
+            break;
+        }
+        nuke_tracker_entry_t *entry = &out->nukes[out->nuke_count++];
+        entry->unit_id = (uint32_t)unit_id->valuedouble;
+        entry->type = nuke_type;
+        entry->direction = (strcmp(dir->valuestring, "out") == 0) ? NUKE_DIR_OUTGOING : NUKE_DIR_INCOMING;
+    }
+
+    cJSON *alerts = cJSON_GetObjectItem(payload, "alerts");
+    if (alerts && cJSON_IsObject(alerts)) {
+        out->land_alerts = get_count(alerts, "land");
+        out->naval_alerts = get_count(alerts, "naval");
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t ws_protocol_parse(const char *json_str, size_t len, ws_message_t *msg,
+                            const ws_protocol_sink_t *sink) {
     if (!json_str || !msg || len == 0) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -46,40 +210,22 @@ esp_err_t ws_protocol_parse(const char *json_str, size_t len, ws_message_t *msg)
         msg->type = WS_MSG_EVENT;
         cJSON *payload = cJSON_GetObjectItem(root, "payload");
         if (payload) {
-            cJSON *event_type = cJSON_GetObjectItem(payload, "type");
-            if (event_type && cJSON_IsString(event_type)) {
-                msg->payload.event.event_type = string_to_event_type(event_type->valuestring);
-            }
-            
-            cJSON *timestamp = cJSON_GetObjectItem(payload, "timestamp");
-            if (timestamp && cJSON_IsNumber(timestamp)) {
-                msg->payload.event.timestamp = timestamp->valueint;
-            }
-            
-            cJSON *message = cJSON_GetObjectItem(payload, "message");
-            if (message && cJSON_IsString(message)) {
-                strncpy(msg->payload.event.message, message->valuestring,
-                       sizeof(msg->payload.event.message) - 1);
-            }
-            
-            cJSON *data = cJSON_GetObjectItem(payload, "data");
-            if (data) {
-                if (cJSON_IsString(data) && data->valuestring) {
-                    strncpy(msg->payload.event.data, data->valuestring,
-                           sizeof(msg->payload.event.data) - 1);
-                } else {
-                    // Userscript/ots-server commonly send `data` as an object.
-                    // Internally, firmware modules expect `event.data` as a JSON string.
-                    char *data_str = cJSON_PrintUnformatted(data);
-                    if (data_str) {
-                        strncpy(msg->payload.event.data, data_str,
-                               sizeof(msg->payload.event.data) - 1);
-                        free(data_str);
-                    }
-                }
-            }
+            parse_event_payload(payload, &msg->payload.event);
         }
     }
+    else if (strcmp(type_str, "batch") == 0) {
+        msg->type = WS_MSG_BATCH;
+        msg->payload.batch.status = (sink && sink->on_batch_event)
+            ? decode_batch(cJSON_GetObjectItem(root, "payload"), sink->on_batch_event, sink->ctx,
+                           &msg->payload.batch.count)
+            : ESP_ERR_INVALID_ARG;
+    }
+    else if (strcmp(type_str, "snapshot") == 0) {
+        msg->type = WS_MSG_SNAPSHOT;
+        msg->payload.snapshot.status = (sink && sink->snapshot)
+            ? decode_snapshot(cJSON_GetObjectItem(root, "payload"), sink->snapshot)
+            : ESP_ERR_INVALID_ARG;
+    }
     else if (strcmp(type_str, "cmd") == 0) {
         msg->type = WS_MSG_COMMAND;
         cJSON *payload = cJSON_GetObjectItem(root, "payload");
@@ -111,31 +257,14 @@ esp_err_t ws_protocol_build_handshake(const char *client_type, char *out_buffer,
         return ESP_ERR_INVALID_ARG;
     }
     
-    cJSON *root = cJSON_CreateObject();
-    if (!root) {
-        return ESP_ERR_NO_MEM;
-    }
-    
-    cJSON_AddStringToObject(root, "type", "handshake");
-    cJSON_AddStringToObject(root, "clientType", client_type);
+    json_writer_t w;
+    json_writer_init(&w, out_buffer, buffer_size);
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "handshake");
+    json_writer_field_string(&w, "clientType", client_type);
+    json_writer_end_object(&w);
     
-    char *json_str = cJSON_PrintUnformatted(root);
-    esp_err_t ret = ESP_OK;
-    
-    if (json_str) {
-        if (strlen(json_str) < buffer_size) {
-            strncpy(out_buffer, json_str, buffer_size - 1);
-            out_buffer[buffer_size - 1] = '\0';
-        } else {
-            ret = ESP_ERR_INVALID_SIZE;
-        }
-        free(json_str);
-    } else {
-        ret = ESP_FAIL;
-    }
-    
-    cJSON_Delete(root);
-    return ret;
+    return json_writer_finish(&w, NULL);
 }
 
 esp_err_t ws_protocol_build_event(const game_event_t *event, char *out_buffer, size_t buffer_size) {
@@ -143,44 +272,45 @@ esp_err_t ws_protocol_build_event(const game_event_t *event, char *out_buffer, s
         return ESP_ERR_INVALID_ARG;
     }
     
-    cJSON *root = cJSON_CreateObject();
-    if (!root) {
-        return ESP_ERR_NO_MEM;
-    }
-    
-    cJSON_AddStringToObject(root, "type", "event");
+    json_writer_t w;
+    json_writer_init(&w, out_buffer, buffer_size);
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "event");
     
-    cJSON *payload = cJSON_CreateObject();
-    cJSON_AddStringToObject(payload, "type", event_type_to_string(event->type));
-    cJSON_AddNumberToObject(payload, "timestamp", event->timestamp);
-    cJSON_AddStringToObject(payload, "message", event->message);
-    
-    if (event->data && strlen(event->data) > 0) {
-        cJSON_AddStringToObject(payload, "data", event->data);
+    json_writer_key(&w, "payload");
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", event_type_to_string(event->type));
+    json_writer_field_uint(&w, "timestamp", event->timestamp);
+    json_writer_field_string(&w, "message", event->message);
+    if (event->data[0] != '\0') {
+        json_writer_field_string(&w, "data", event->data);
     }
+    json_writer_end_object(&w);
+    json_writer_end_object(&w);
     
-    cJSON_AddItemToObject(root, "payload", payload);
-    
-    char *json_str = cJSON_PrintUnformatted(root);
-    esp_err_t ret = ESP_OK;
-    
-    if (json_str) {
-        if (strlen(json_str) < buffer_size) {
-            strncpy(out_buffer, json_str, buffer_size - 1);
-            out_buffer[buffer_size - 1] = '\0';
-        } else {
-            ESP_LOGW(TAG, "Buffer too small for event message");
-            ret = ESP_ERR_INVALID_SIZE;
-        }
-        free(json_str);
-    } else {
-        ret = ESP_FAIL;
+    esp_err_t ret = json_writer_finish(&w, NULL);
+    if (ret == ESP_ERR_INVALID_SIZE) {
+        ESP_LOGW(TAG, "Buffer too small for event message");
     }
-    
-    cJSON_Delete(root);
     return ret;
 }
 
+void ws_protocol_begin_command(json_writer_t *w, const char *action) {
+    json_writer_begin_object(w);
+    json_writer_field_string(w, "type", "cmd");
+    json_writer_key(w, "payload");
+    json_writer_begin_object(w);
+    json_writer_field_string(w, "action", action);
+    json_writer_key(w, "params");
+    json_writer_begin_object(w);
+}
+
+void ws_protocol_end_command(json_writer_t *w) {
+    json_writer_end_object(w);  // params
+    json_writer_end_object(w);  // payload
+    json_writer_end_object(w);
+}
+
 bool ws_protocol_validate(const char *json_str, size_t len) {
     if (!json_str || len == 0) {
         return false;
@@ -123,12 +123,15 @@ class WsClient:
         path: str = "/ws",
         insecure: bool = True,
         sni: Optional[str] = None,
+        use_tls: bool = True,
     ):
         self.host = host
         self.port = port
         self.path = path
         self.insecure = insecure
         self.sni = sni
+        # Plain ws:// for the simulator (nuxt dev server); the device is always wss://
+        self.use_tls = use_tls
         self._raw: Optional[socket.socket] = None
         self._tls: Optional[ssl.SSLSocket] = None
 
@@ -140,12 +143,15 @@ class WsClient:
 
     def connect(self, timeout_s: float = 5.0) -> None:
         raw = socket.create_connection((self.host, self.port), timeout=timeout_s)
-        ctx = ssl.create_default_context()
-        if self.insecure:
-            ctx.check_hostname = False
-            ctx.verify_mode = ssl.CERT_NONE
-        server_hostname = self.sni or self.host
-        tls = ctx.wrap_socket(raw, server_hostname=server_hostname)
+        if self.use_tls:
+            ctx = ssl.create_default_context()
+            if self.insecure:
+                ctx.check_hostname = False
+                ctx.verify_mode = ssl.CERT_NONE
+            server_hostname = self.sni or self.host
+            tls = ctx.wrap_socket(raw, server_hostname=server_hostname)
+        else:
+            tls = raw
 
         key = ssl.RAND_bytes(16)
         key_b64 = base64.b64encode(key).decode("ascii")
@@ -0,0 +1,441 @@
+#!/usr/bin/env python3
+"""Host benchmark of the captive portal DNS responder.
+
+Compiles src/dns_responder.c with a small C harness and serves DNS on a
+loopback UDP socket (the stand-in for the lwIP socket on the device) with
+two server loops:
+
+- old: blocking recvfrom() per packet, reply built field by field, every
+  query answered with an A record
+- new: select() then non-blocking reads of up to 16 packets per wake-up,
+  replies from dns_responder templates, per-client rate limiting (same
+  loop as dns_task() in src/dns_captive_portal.c)
+
+Clients bind distinct 127.0.0.x addresses so the rate limiter sees them as
+different stations. Two scenarios are run against each loop:
+
+- throughput: N clients keep a window of queries in flight (rate limiting
+  off), reporting queries answered per second and round-trip time
+- flood: one client floods with a large window while three "phones" send
+  a connectivity-check lookup every 100 ms; reports how many of the phones'
+  lookups were answered and how fast
+
+Queries carry an EDNS OPT record by default: the old loop required bytes
+after the question and silently dropped plain queries (see --no-edns).
+
+Absolute numbers are host numbers: socket calls are far cheaper here than
+through lwIP on the ESP32, so use the old/new ratio and the flood results,
+not the raw rate, to judge the device.
+
+Examples:
+
+  python3 tools/tests/dns_captive_bench.py
+
+  python3 tools/tests/dns_captive_bench.py --duration-ms 3000 --clients 8 --json
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from typing import Any
+
+FW_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+HARNESS = r"""
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include "dns_responder.h"
+
+#define MAX_CLIENTS 15
+#define SEQ_MASK 0x0FFF
+#define BATCH_MAX 16
+#define LOSS_TIMEOUT_US 50000
+#define PROBE_INTERVAL_US 100000
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+/* ---- servers ---------------------------------------------------------- */
+
+typedef struct {
+    int sock;
+    int limit;                  /* rate limiting on (new loop only) */
+    uint32_t burst, per_sec;
+    volatile int running;
+    uint64_t processed, answered, limited;
+} server_t;
+
+/* The loop dns_task() ran before: one blocking recvfrom() per packet */
+static void *old_server(void *arg) {
+    server_t *s = arg;
+    uint8_t rx[256], tx[256];
+    while (s->running) {
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        int n = recvfrom(s->sock, rx, sizeof(rx), 0, (struct sockaddr *)&from, &from_len);
+        if (n <= 0) continue;
+        s->processed++;
+        if (n < 12) continue;
+        uint16_t qdcount = (uint16_t)((rx[4] << 8) | rx[5]);
+        if (qdcount != 1) continue;
+        int offset = 12;
+        while (offset < n && rx[offset] != 0) offset += (int)rx[offset] + 1;
+        if (offset + 5 >= n) continue;
+        offset += 1;
+        const int question_end = offset + 4;
+        if (question_end > n) continue;
+        memset(tx, 0, sizeof(tx));
+        tx[0] = rx[0]; tx[1] = rx[1];
+        tx[2] = 0x81; tx[3] = 0x80;
+        tx[4] = 0x00; tx[5] = 0x01;
+        tx[6] = 0x00; tx[7] = 0x01;
+        tx[8] = 0x00; tx[9] = 0x00; tx[10] = 0x00; tx[11] = 0x00;
+        int tx_len = 12;
+        const int q_len = question_end - 12;
+        if (tx_len + q_len + 16 > (int)sizeof(tx)) continue;
+        memcpy(&tx[tx_len], &rx[12], (size_t)q_len);
+        tx_len += q_len;
+        tx[tx_len++] = 0xC0; tx[tx_len++] = 0x0C;
+        tx[tx_len++] = 0x00; tx[tx_len++] = 0x01;
+        tx[tx_len++] = 0x00; tx[tx_len++] = 0x01;
+        tx[tx_len++] = 0x00; tx[tx_len++] = 0x00; tx[tx_len++] = 0x00; tx[tx_len++] = 0x00;
+        tx[tx_len++] = 0x00; tx[tx_len++] = 0x04;
+        tx[tx_len++] = 192; tx[tx_len++] = 168; tx[tx_len++] = 4; tx[tx_len++] = 1;
+        if (sendto(s->sock, tx, (size_t)tx_len, 0, (struct sockaddr *)&from, from_len) > 0) s->answered++;
+    }
+    return NULL;
+}
+
+/* Mirrors dns_task()/drain_socket() in src/dns_captive_portal.c */
+static void *new_server(void *arg) {
+    server_t *s = arg;
+    static uint8_t rx[DNS_RESPONDER_MAX_PACKET], tx[DNS_RESPONDER_MAX_PACKET];
+    dns_responder_t responder;
+    dns_rate_limiter_t limiter;
+    const uint8_t ip[4] = {192, 168, 4, 1};
+    dns_responder_init(&responder, ip, 0);
+    dns_rate_limiter_init(&limiter, s->burst, s->per_sec);
+
+    while (s->running) {
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(s->sock, &readable);
+        struct timeval timeout = { .tv_sec = 0, .tv_usec = 100000 };
+        if (select(s->sock + 1, &readable, NULL, NULL, &timeout) <= 0) continue;
+
+        const uint32_t now_ms = (uint32_t)(now_us() / 1000);
+        for (int batch = 0; batch < BATCH_MAX; batch++) {
+            struct sockaddr_in from;
+            socklen_t from_len = sizeof(from);
+            const int n = recvfrom(s->sock, rx, sizeof(rx), MSG_DONTWAIT, (struct sockaddr *)&from, &from_len);
+            if (n <= 0) break;
+            s->processed++;
+            if (s->limit && !dns_rate_limiter_allow(&limiter, from.sin_addr.s_addr, now_ms)) {
+                s->limited++;
+                continue;
+            }
+            size_t tx_len = 0;
+            if (dns_responder_reply(&responder, rx, (size_t)n, tx, sizeof(tx), &tx_len) == DNS_REPLY_NONE) continue;
+            if (sendto(s->sock, tx, tx_len, 0, (struct sockaddr *)&from, from_len) > 0) s->answered++;
+        }
+    }
+    return NULL;
+}
+
+/* ---- clients ---------------------------------------------------------- */
+
+typedef struct {
+    int sock;
+    int window;             /* closed loop: queries kept in flight; 0 = paced probe */
+    int outstanding;
+    uint32_t seq;
+    uint64_t next_probe_us, last_progress_us, written_off_us;
+    uint64_t sent, answered, lost, late;
+    uint64_t rtt_sum_us;
+    uint32_t rtt_n;
+    uint32_t *rtts;         /* probes only, for percentiles */
+} client_t;
+
+static uint64_t sent_at[MAX_CLIENTS][SEQ_MASK + 1];
+
+static int edns = 1;
+
+static int build_query(uint8_t *q, uint16_t id, int aaaa) {
+    static const char *labels[] = {"connectivitycheck", "gstatic", "com"};
+    int n = 0;
+    q[n++] = (uint8_t)(id >> 8); q[n++] = (uint8_t)id;
+    q[n++] = 0x01; q[n++] = 0x00;           /* standard query, RD */
+    q[n++] = 0x00; q[n++] = 0x01;           /* QDCOUNT */
+    memset(&q[n], 0, 6); n += 6;
+    for (int i = 0; i < 3; i++) {
+        const size_t len = strlen(labels[i]);
+        q[n++] = (uint8_t)len;
+        memcpy(&q[n], labels[i], len); n += (int)len;
+    }
+    q[n++] = 0;
+    q[n++] = 0x00; q[n++] = aaaa ? 28 : 1;  /* QTYPE */
+    q[n++] = 0x00; q[n++] = 0x01;           /* QCLASS IN */
+    if (edns) {
+        static const uint8_t opt[] = {0, 0x00, 41, 0x05, 0xC0, 0, 0, 0, 0, 0x00, 0x00};  /* OPT, 1472 B */
+        q[11] = 1;                          /* ARCOUNT */
+        memcpy(&q[n], opt, sizeof(opt)); n += (int)sizeof(opt);
+    }
+    return n;
+}
+
+static void send_query(client_t *c, int idx, const struct sockaddr_in *server) {
+    uint8_t q[64];
+    const uint16_t seq = (uint16_t)(c->seq++ & SEQ_MASK);
+    const int len = build_query(q, (uint16_t)((idx << 12) | seq), (seq & 3) == 3);
+    sent_at[idx][seq] = now_us();
+    if (sendto(c->sock, q, (size_t)len, 0, (const struct sockaddr *)server, sizeof(*server)) > 0) {
+        c->sent++;
+        c->outstanding++;
+    }
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    const uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * argv: mode(old|new) limit burst per_sec duration_ms clients window probers edns
+ * clients use `window` (closed loop); probers (after them) send every 100 ms
+ */
+int main(int argc, char **argv) {
+    if (argc < 10) return 2;
+    edns = atoi(argv[9]);
+    const int use_new = strcmp(argv[1], "new") == 0;
+    server_t srv = { .limit = atoi(argv[2]), .burst = (uint32_t)atoi(argv[3]),
+                     .per_sec = (uint32_t)atoi(argv[4]), .running = 1 };
+    const uint64_t duration_us = (uint64_t)atoi(argv[5]) * 1000u;
+    const int loaders = atoi(argv[6]), window = atoi(argv[7]), probers = atoi(argv[8]);
+    const int total = loaders + probers;
+    if (total < 1 || total > MAX_CLIENTS) return 2;
+
+    srv.sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct sockaddr_in addr = { .sin_family = AF_INET, .sin_port = 0 };
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(srv.sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) { perror("bind"); return 1; }
+    socklen_t alen = sizeof(addr);
+    getsockname(srv.sock, (struct sockaddr *)&addr, &alen);
+    if (!use_new) {
+        struct timeval tv = { .tv_sec = 0, .tv_usec = 100000 };
+        setsockopt(srv.sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+
+    client_t clients[MAX_CLIENTS];
+    struct pollfd pfd[MAX_CLIENTS];
+    memset(clients, 0, sizeof(clients));
+    for (int i = 0; i < total; i++) {
+        client_t *c = &clients[i];
+        c->sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        struct sockaddr_in local = { .sin_family = AF_INET, .sin_port = 0 };
+        local.sin_addr.s_addr = htonl(0x7F000000u | (uint32_t)(10 + i));   /* 127.0.0.10+i */
+        if (bind(c->sock, (struct sockaddr *)&local, sizeof(local)) != 0) { perror("client bind"); return 1; }
+        c->window = (i < loaders) ? window : 0;
+        if (c->window == 0) c->rtts = calloc(duration_us / PROBE_INTERVAL_US + 16, sizeof(uint32_t));
+        pfd[i].fd = c->sock;
+        pfd[i].events = POLLIN;
+    }
+
+    pthread_t th;
+    pthread_create(&th, NULL, use_new ? new_server : old_server, &srv);
+
+    const uint64_t start = now_us(), end = start + duration_us;
+    for (int i = 0; i < total; i++) {
+        clients[i].last_progress_us = start;
+        clients[i].next_probe_us = start + (uint64_t)i * 3000u;
+        for (int w = 0; w < clients[i].window; w++) send_query(&clients[i], i, &addr);
+    }
+
+    uint8_t rx[DNS_RESPONDER_MAX_PACKET];
+    for (uint64_t t = now_us(); t < end; t = now_us()) {
+        poll(pfd, (nfds_t)total, 1);
+        t = now_us();
+        for (int i = 0; i < total; i++) {
+            client_t *c = &clients[i];
+            if (pfd[i].revents & POLLIN) {
+                int n;
+                while ((n = recv(c->sock, rx, sizeof(rx), MSG_DONTWAIT)) > 0) {
+                    if (n < 12) continue;
+                    const uint16_t seq = (uint16_t)(((rx[0] << 8) | rx[1]) & SEQ_MASK);
+                    const uint64_t sent = sent_at[i][seq];
+                    if (sent < c->written_off_us) { c->late++; continue; }
+                    const uint64_t rtt = now_us() - sent;
+                    c->answered++;
+                    c->outstanding--;
+                    c->rtt_sum_us += rtt;
+                    if (c->rtts) c->rtts[c->rtt_n] = (uint32_t)rtt;
+                    c->rtt_n++;
+                    c->last_progress_us = now_us();
+                    if (c->window) send_query(c, i, &addr);
+                }
+            }
+            if (c->window) {
+                /* Lost (dropped or rate limited): write off what is in flight and refill */
+                if (c->outstanding > 0 && t - c->last_progress_us > LOSS_TIMEOUT_US) {
+                    c->lost += (uint64_t)c->outstanding;
+                    c->outstanding = 0;
+                    c->written_off_us = t;
+                    c->last_progress_us = t;
+                    for (int w = 0; w < c->window; w++) send_query(c, i, &addr);
+                }
+            } else if (t >= c->next_probe_us) {
+                c->next_probe_us += PROBE_INTERVAL_US;
+                send_query(c, i, &addr);
+            }
+        }
+    }
+    const double secs = (double)(now_us() - start) / 1e6;
+
+    srv.running = 0;
+    pthread_join(th, NULL);
+
+    /* Loaders first, then probers: kind sent answered rtt_avg_us rtt_p99_us */
+    uint64_t l_sent = 0, l_ans = 0, l_rtt = 0, p_sent = 0, p_ans = 0, p_rtt = 0;
+    uint32_t l_n = 0, p_n = 0, *all = calloc(1 + (size_t)probers * (duration_us / PROBE_INTERVAL_US + 16), sizeof(uint32_t));
+    for (int i = 0; i < total; i++) {
+        client_t *c = &clients[i];
+        if (c->window) {
+            l_sent += c->sent; l_ans += c->answered; l_rtt += c->rtt_sum_us; l_n += c->rtt_n;
+        } else {
+            p_sent += c->sent; p_ans += c->answered; p_rtt += c->rtt_sum_us;
+            memcpy(&all[p_n], c->rtts, c->rtt_n * sizeof(uint32_t));
+            p_n += c->rtt_n;
+        }
+    }
+    qsort(all, p_n, sizeof(uint32_t), cmp_u32);
+    printf("%s\t%.3f\t%llu\t%llu\t%llu\t%llu\t%llu\t%llu\t%llu\t%llu\t%llu\t%u\n", argv[1], secs,
+           (unsigned long long)srv.processed, (unsigned long long)srv.answered, (unsigned long long)srv.limited,
+           (unsigned long long)l_sent, (unsigned long long)l_ans,
+           (unsigned long long)(l_n ? l_rtt / l_n : 0),
+           (unsigned long long)p_sent, (unsigned long long)p_ans,
+           (unsigned long long)(p_n ? p_rtt / p_n : 0),
+           p_n ? all[(p_n * 99) / 100 < p_n ? (p_n * 99) / 100 : p_n - 1] : 0u);
+    return 0;
+}
+"""
+
+
+def build(workdir: str, cc: str) -> str:
+    src = os.path.join(workdir, "dns_bench.c")
+    with open(src, "w") as f:
+        f.write(HARNESS)
+    exe = os.path.join(workdir, "dns_captive_bench")
+    subprocess.run([
+        cc, "-O2", "-std=c11", "-I", os.path.join(FW_ROOT, "include"),
+        src, os.path.join(FW_ROOT, "src", "dns_responder.c"), "-lpthread", "-o", exe,
+    ], check=True)
+    return exe
+
+
+def run(exe: str, mode: str, limit: bool, burst: int, per_sec: int, duration_ms: int,
+        loaders: int, window: int, probers: int, edns: bool) -> dict[str, Any]:
+    out = subprocess.run(
+        [exe, mode, "1" if limit else "0", str(burst), str(per_sec), str(duration_ms),
+         str(loaders), str(window), str(probers), "1" if edns else "0"],
+        check=True, capture_output=True, text=True,
+    ).stdout.strip()
+    f = out.split("\t")
+    secs = float(f[1])
+    return {
+        "loop": f[0],
+        "seconds": secs,
+        "processed": int(f[2]),
+        "answered": int(f[3]),
+        "rateLimited": int(f[4]),
+        "answeredPerSec": round(int(f[3]) / secs),
+        "loadSent": int(f[5]),
+        "loadAnswered": int(f[6]),
+        "loadRttAvgUs": int(f[7]),
+        "probeSent": int(f[8]),
+        "probeAnswered": int(f[9]),
+        "probeRttAvgUs": int(f[10]),
+        "probeRttP99Us": int(f[11]),
+    }
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Benchmark old vs new captive portal DNS loop on loopback UDP")
+    ap.add_argument("--duration-ms", type=int, default=2000, help="Duration of each run (default: 2000)")
+    ap.add_argument("--clients", type=int, default=4, help="Clients in the throughput scenario (default: 4)")
+    ap.add_argument("--window", type=int, default=8, help="Queries in flight per client (default: 8)")
+    ap.add_argument("--flood-window", type=int, default=64, help="Queries in flight for the flooding client (default: 64)")
+    ap.add_argument("--burst", type=int, default=24, help="DNS_CLIENT_BURST (default: 24)")
+    ap.add_argument("--per-sec", type=int, default=12, help="DNS_CLIENT_PER_SEC (default: 12)")
+    ap.add_argument("--no-edns", action="store_true",
+                    help="Send plain queries (no OPT record); the old loop drops these")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="Host C compiler (default: $CC or cc)")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    if not shutil.which(args.cc):
+        print(f"ERROR: C compiler '{args.cc}' not found", file=sys.stderr)
+        return 1
+    if not 1 <= args.clients <= 12:
+        print("ERROR: --clients must be 1..12", file=sys.stderr)
+        return 1
+
+    results: dict[str, list[dict[str, Any]]] = {"throughput": [], "flood": []}
+    with tempfile.TemporaryDirectory() as workdir:
+        exe = build(workdir, args.cc)
+        for mode in ("old", "new"):
+            results["throughput"].append(
+                run(exe, mode, False, args.burst, args.per_sec, args.duration_ms, args.clients, args.window, 0,
+                    not args.no_edns))
+        for mode in ("old", "new"):
+            results["flood"].append(
+                run(exe, mode, mode == "new", args.burst, args.per_sec, args.duration_ms, 1, args.flood_window, 3,
+                    not args.no_edns))
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+        return 0
+
+    print(f"Throughput: {args.clients} clients x {args.window} queries in flight, no rate limit, "
+          f"{args.duration_ms} ms")
+    print(f"{'loop':<5} {'answered/s':>11} {'rtt avg us':>11}")
+    for r in results["throughput"]:
+        print(f"{r['loop']:<5} {r['answeredPerSec']:>11} {r['loadRttAvgUs']:>11}")
+    old, new = results["throughput"]
+    if old["answeredPerSec"]:
+        print(f"new/old: {new['answeredPerSec'] / old['answeredPerSec']:.2f}x")
+
+    print(f"\nFlood: 1 client x {args.flood_window} in flight + 3 phones probing every 100 ms "
+          f"(new: {args.burst} burst, {args.per_sec}/s per client)")
+    print(f"{'loop':<5} {'processed/s':>12} {'flood ans/s':>12} {'limited':>8} "
+          f"{'probes ok':>10} {'probe avg us':>13} {'probe p99 us':>13}")
+    for r in results["flood"]:
+        ok = f"{r['probeAnswered']}/{r['probeSent']}"
+        print(f"{r['loop']:<5} {round(r['processed'] / r['seconds']):>12} "
+              f"{round(r['loadAnswered'] / r['seconds']):>12} {r['rateLimited']:>8} "
+              f"{ok:>10} {r['probeRttAvgUs']:>13} {r['probeRttP99Us']:>13}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,393 @@
+#!/usr/bin/env python3
+"""Host benchmark for the outbound JSON writer (src/json_writer.c).
+
+Builds a small C harness with the host compiler and serializes the
+firmware-originated WebSocket messages with json_writer, the way the
+firmware does (set-troops-percent, flow-control, request-snapshot,
+handshake, a nuke event and the hardware-diagnostic reply). For each
+message it reports:
+
+- bytes per message
+- heap allocations and heap bytes per message (malloc/calloc/realloc are
+  wrapped and counted; json_writer should show 0)
+- serialization time per message on the host
+
+With --cjson-dir pointing at a directory containing cJSON.c/cJSON.h
+(e.g. $IDF_PATH/components/json/cJSON) the same messages are also built
+the old way (cJSON tree + cJSON_PrintUnformatted) for comparison.
+
+Every message is checked with Python's json module, so the script also
+catches escaping mistakes.
+
+Examples:
+
+  python3 tools/tests/json_writer_bench.py
+
+  python3 tools/tests/json_writer_bench.py --cjson-dir $IDF_PATH/components/json/cJSON --json
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from typing import Any, Optional
+
+FW_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+ESP_ERR_STUB = r"""
+#pragma once
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_INVALID_STATE 0x103
+"""
+
+HARNESS = r"""
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "json_writer.h"
+#ifdef WITH_CJSON
+#include "cJSON.h"
+#endif
+
+static size_t g_allocs, g_alloc_bytes;
+void *__real_malloc(size_t n);
+void *__real_calloc(size_t c, size_t n);
+void *__real_realloc(void *p, size_t n);
+void *__wrap_malloc(size_t n) { g_allocs++; g_alloc_bytes += n; return __real_malloc(n); }
+void *__wrap_calloc(size_t c, size_t n) { g_allocs++; g_alloc_bytes += c * n; return __real_calloc(c, n); }
+void *__wrap_realloc(void *p, size_t n) { g_allocs++; g_alloc_bytes += n; return __real_realloc(p, n); }
+
+static char g_out[2048];
+static size_t g_len;
+
+/* Same shape as ws_protocol_begin_command()/ws_protocol_end_command() */
+static void begin_command(json_writer_t *w, const char *action) {
+    json_writer_begin_object(w);
+    json_writer_field_string(w, "type", "cmd");
+    json_writer_key(w, "payload");
+    json_writer_begin_object(w);
+    json_writer_field_string(w, "action", action);
+    json_writer_key(w, "params");
+    json_writer_begin_object(w);
+}
+static void end_command(json_writer_t *w) {
+    json_writer_end_object(w);
+    json_writer_end_object(w);
+    json_writer_end_object(w);
+}
+static int finish(json_writer_t *w) { return json_writer_finish(w, &g_len) == ESP_OK; }
+
+static int w_percent(void) {
+    char buf[96]; json_writer_t w; json_writer_init(&w, buf, sizeof(buf));
+    begin_command(&w, "set-troops-percent");
+    json_writer_field_uint(&w, "percent", 42);
+    end_command(&w);
+    if (!finish(&w)) return 0; memcpy(g_out, buf, g_len + 1); return 1;
+}
+static int w_flow(void) {
+    char buf[112]; json_writer_t w; json_writer_init(&w, buf, sizeof(buf));
+    begin_command(&w, "flow-control");
+    json_writer_field_uint(&w, "troopIntervalMs", 400);
+    end_command(&w);
+    if (!finish(&w)) return 0; memcpy(g_out, buf, g_len + 1); return 1;
+}
+static int w_snapshot(void) {
+    char buf[128]; json_writer_t w; json_writer_init(&w, buf, sizeof(buf));
+    begin_command(&w, "request-snapshot");
+    json_writer_field_string(&w, "reason", "seq-gap");
+    end_command(&w);
+    if (!finish(&w)) return 0; memcpy(g_out, buf, g_len + 1); return 1;
+}
+static int w_handshake(void) {
+    char buf[128]; json_writer_t w; json_writer_init(&w, buf, sizeof(buf));
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "handshake");
+    json_writer_field_string(&w, "clientType", "firmware");
+    json_writer_end_object(&w);
+    if (!finish(&w)) return 0; memcpy(g_out, buf, g_len + 1); return 1;
+}
+static int w_event(void) {
+    char buf[512]; json_writer_t w; json_writer_init(&w, buf, sizeof(buf));
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "event");
+    json_writer_key(&w, "payload");
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "NUKE_LAUNCHED");
+    json_writer_field_uint(&w, "timestamp", 1712345678901ULL);
+    json_writer_field_string(&w, "message", "Atom bomb launched");
+    json_writer_field_string(&w, "data", "{\"nukeType\":\"atom\",\"unitId\":1234}");
+    json_writer_end_object(&w);
+    json_writer_end_object(&w);
+    if (!finish(&w)) return 0; memcpy(g_out, buf, g_len + 1); return 1;
+}
+static void component(json_writer_t *w, const char *name, int present) {
+    json_writer_key(w, name);
+    json_writer_begin_object(w);
+    json_writer_field_bool(w, "present", present);
+    json_writer_field_bool(w, "working", present);
+    json_writer_end_object(w);
+}
+static int w_diagnostic(void) {
+    char buf[1024]; json_writer_t w; json_writer_init(&w, buf, sizeof(buf));
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "event");
+    json_writer_key(&w, "payload");
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "type", "HARDWARE_DIAGNOSTIC");
+    json_writer_field_int(&w, "timestamp", 123456789);
+    json_writer_field_string(&w, "message", "OTS Firmware Diagnostic");
+    json_writer_key(&w, "data");
+    json_writer_begin_object(&w);
+    json_writer_field_string(&w, "version", "2026.10.0-dev");
+    json_writer_field_string(&w, "deviceType", "firmware");
+    json_writer_field_string(&w, "serialNumber", "OTS-FW-000000000001");
+    json_writer_field_string(&w, "owner", "Some Owner Name");
+    json_writer_key(&w, "hardware");
+    json_writer_begin_object(&w);
+    component(&w, "lcd", 1); component(&w, "inputBoard", 1); component(&w, "outputBoard", 1);
+    component(&w, "adc", 1); component(&w, "soundModule", 0);
+    json_writer_end_object(&w);
+    json_writer_key(&w, "wsRx");
+    json_writer_begin_object(&w);
+    json_writer_field_uint(&w, "frames", 4294967295u);
+    json_writer_field_uint(&w, "events", 4294967295u);
+    json_writer_field_uint(&w, "batches", 4294967295u);
+    json_writer_field_uint(&w, "busyUs", 18446744073709ULL);
+    json_writer_end_object(&w);
+    json_writer_key(&w, "dispatcher");
+    json_writer_begin_object(&w);
+    json_writer_field_uint(&w, "dropped", 4294967295u);
+    json_writer_field_uint(&w, "queued", 32);
+    json_writer_field_uint(&w, "sendDropped", 4294967295u);
+    json_writer_field_uint(&w, "seqGaps", 4294967295u);
+    json_writer_end_object(&w);
+    json_writer_key(&w, "cpu");
+    json_writer_begin_object(&w);
+    json_writer_field_int(&w, "uptimeUs", 9223372036854ULL);
+    json_writer_key(&w, "idleUs");
+    json_writer_begin_array(&w);
+    json_writer_uint(&w, 4294967295u); json_writer_uint(&w, 4294967295u);
+    json_writer_end_array(&w);
+    json_writer_end_object(&w);
+    json_writer_end_object(&w);
+    json_writer_end_object(&w);
+    json_writer_end_object(&w);
+    if (!finish(&w)) return 0; memcpy(g_out, buf, g_len + 1); return 1;
+}
+
+#ifdef WITH_CJSON
+static int c_print(cJSON *root) {
+    char *s = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (!s) return 0;
+    g_len = strlen(s); memcpy(g_out, s, g_len + 1); free(s);
+    return 1;
+}
+static cJSON *c_command(const char *action, cJSON **params) {
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddStringToObject(root, "type", "cmd");
+    cJSON *payload = cJSON_CreateObject();
+    cJSON_AddStringToObject(payload, "action", action);
+    *params = cJSON_CreateObject();
+    cJSON_AddItemToObject(payload, "params", *params);
+    cJSON_AddItemToObject(root, "payload", payload);
+    return root;
+}
+static int c_percent(void) { cJSON *p; cJSON *r = c_command("set-troops-percent", &p); cJSON_AddNumberToObject(p, "percent", 42); return c_print(r); }
+static int c_flow(void) { cJSON *p; cJSON *r = c_command("flow-control", &p); cJSON_AddNumberToObject(p, "troopIntervalMs", 400); return c_print(r); }
+static int c_snapshot(void) { cJSON *p; cJSON *r = c_command("request-snapshot", &p); cJSON_AddStringToObject(p, "reason", "seq-gap"); return c_print(r); }
+static int c_handshake(void) {
+    cJSON *r = cJSON_CreateObject();
+    cJSON_AddStringToObject(r, "type", "handshake");
+    cJSON_AddStringToObject(r, "clientType", "firmware");
+    return c_print(r);
+}
+static int c_event(void) {
+    cJSON *r = cJSON_CreateObject();
+    cJSON_AddStringToObject(r, "type", "event");
+    cJSON *p = cJSON_CreateObject();
+    cJSON_AddStringToObject(p, "type", "NUKE_LAUNCHED");
+    cJSON_AddNumberToObject(p, "timestamp", 1712345678901.0);
+    cJSON_AddStringToObject(p, "message", "Atom bomb launched");
+    cJSON_AddStringToObject(p, "data", "{\"nukeType\":\"atom\",\"unitId\":1234}");
+    cJSON_AddItemToObject(r, "payload", p);
+    return c_print(r);
+}
+static void c_component(cJSON *hw, const char *name, int present) {
+    cJSON *o = cJSON_CreateObject();
+    cJSON_AddBoolToObject(o, "present", present);
+    cJSON_AddBoolToObject(o, "working", present);
+    cJSON_AddItemToObject(hw, name, o);
+}
+static int c_diagnostic(void) {
+    cJSON *r = cJSON_CreateObject();
+    cJSON_AddStringToObject(r, "type", "event");
+    cJSON *p = cJSON_CreateObject();
+    cJSON_AddStringToObject(p, "type", "HARDWARE_DIAGNOSTIC");
+    cJSON_AddNumberToObject(p, "timestamp", 123456789);
+    cJSON_AddStringToObject(p, "message", "OTS Firmware Diagnostic");
+    cJSON *d = cJSON_CreateObject();
+    cJSON_AddStringToObject(d, "version", "2026.10.0-dev");
+    cJSON_AddStringToObject(d, "deviceType", "firmware");
+    cJSON_AddStringToObject(d, "serialNumber", "OTS-FW-000000000001");
+    cJSON_AddStringToObject(d, "owner", "Some Owner Name");
+    cJSON *hw = cJSON_CreateObject();
+    c_component(hw, "lcd", 1); c_component(hw, "inputBoard", 1); c_component(hw, "outputBoard", 1);
+    c_component(hw, "adc", 1); c_component(hw, "soundModule", 0);
+    cJSON_AddItemToObject(d, "hardware", hw);
+    cJSON *rx = cJSON_CreateObject();
+    cJSON_AddNumberToObject(rx, "frames", 4294967295.0);
+    cJSON_AddNumberToObject(rx, "events", 4294967295.0);
+    cJSON_AddNumberToObject(rx, "batches", 4294967295.0);
+    cJSON_AddNumberToObject(rx, "busyUs", 18446744073709.0);
+    cJSON_AddItemToObject(d, "wsRx", rx);
+    cJSON *ds = cJSON_CreateObject();
+    cJSON_AddNumberToObject(ds, "dropped", 4294967295.0);
+    cJSON_AddNumberToObject(ds, "queued", 32);
+    cJSON_AddNumberToObject(ds, "sendDropped", 4294967295.0);
+    cJSON_AddNumberToObject(ds, "seqGaps", 4294967295.0);
+    cJSON_AddItemToObject(d, "dispatcher", ds);
+    cJSON *cpu = cJSON_CreateObject();
+    cJSON_AddNumberToObject(cpu, "uptimeUs", 9223372036854.0);
+    cJSON *idle = cJSON_CreateArray();
+    cJSON_AddItemToArray(idle, cJSON_CreateNumber(4294967295.0));
+    cJSON_AddItemToArray(idle, cJSON_CreateNumber(4294967295.0));
+    cJSON_AddItemToObject(cpu, "idleUs", idle);
+    cJSON_AddItemToObject(d, "cpu", cpu);
+    cJSON_AddItemToObject(p, "data", d);
+    cJSON_AddItemToObject(r, "payload", p);
+    return c_print(r);
+}
+#endif
+
+typedef struct { const char *impl; const char *name; int (*fn)(void); } bench_t;
+
+static const bench_t BENCHES[] = {
+    {"json_writer", "set-troops-percent", w_percent},
+    {"json_writer", "flow-control", w_flow},
+    {"json_writer", "request-snapshot", w_snapshot},
+    {"json_writer", "handshake", w_handshake},
+    {"json_writer", "event", w_event},
+    {"json_writer", "hardware-diagnostic", w_diagnostic},
+#ifdef WITH_CJSON
+    {"cjson", "set-troops-percent", c_percent},
+    {"cjson", "flow-control", c_flow},
+    {"cjson", "request-snapshot", c_snapshot},
+    {"cjson", "handshake", c_handshake},
+    {"cjson", "event", c_event},
+    {"cjson", "hardware-diagnostic", c_diagnostic},
+#endif
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    const long iters = argc > 1 ? atol(argv[1]) : 100000;
+    for (size_t b = 0; b < sizeof(BENCHES) / sizeof(BENCHES[0]); b++) {
+        const bench_t *bench = &BENCHES[b];
+        g_allocs = g_alloc_bytes = 0;
+        if (!bench->fn()) { fprintf(stderr, "%s/%s failed\n", bench->impl, bench->name); return 1; }
+        const size_t allocs = g_allocs, alloc_bytes = g_alloc_bytes;
+        const double t0 = now_ns();
+        for (long i = 0; i < iters; i++) bench->fn();
+        const double ns = (now_ns() - t0) / iters;
+        /* One line per message: impl, name, bytes, allocs, alloc bytes, ns, text */
+        printf("%s\t%s\t%zu\t%zu\t%zu\t%.1f\t%s\n", bench->impl, bench->name, g_len,
+               allocs, alloc_bytes, ns, g_out);
+    }
+    return 0;
+}
+"""
+
+
+def build(workdir: str, cjson_dir: Optional[str], cc: str) -> str:
+    with open(os.path.join(workdir, "esp_err.h"), "w") as f:
+        f.write(ESP_ERR_STUB)
+    src = os.path.join(workdir, "bench.c")
+    with open(src, "w") as f:
+        f.write(HARNESS)
+
+    exe = os.path.join(workdir, "json_writer_bench")
+    cmd = [
+        cc, "-O2", "-std=c11", "-D_POSIX_C_SOURCE=200809L",
+        "-I", workdir, "-I", os.path.join(FW_ROOT, "include"),
+        src, os.path.join(FW_ROOT, "src", "json_writer.c"),
+        "-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc",
+        "-o", exe,
+    ]
+    if cjson_dir:
+        cmd[1:1] = ["-DWITH_CJSON", "-I", cjson_dir]
+        cmd.insert(-2, os.path.join(cjson_dir, "cJSON.c"))
+    subprocess.run(cmd, check=True)
+    return exe
+
+
+def run(exe: str, iterations: int) -> list[dict[str, Any]]:
+    out = subprocess.run([exe, str(iterations)], check=True, capture_output=True, text=True).stdout
+    rows = []
+    for line in out.splitlines():
+        impl, name, size, allocs, alloc_bytes, ns, text = line.split("\t", 6)
+        try:
+            json.loads(text)
+        except json.JSONDecodeError as e:
+            raise SystemExit(f"ERROR: {impl}/{name} produced invalid JSON ({e}): {text}")
+        rows.append({
+            "impl": impl,
+            "message": name,
+            "bytes": int(size),
+            "allocs": int(allocs),
+            "allocBytes": int(alloc_bytes),
+            "nsPerMsg": float(ns),
+        })
+    return rows
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Host benchmark of firmware JSON message serialization")
+    ap.add_argument("--cjson-dir", help="Directory with cJSON.c/cJSON.h to compare against")
+    ap.add_argument("--iterations", type=int, default=100000, help="Serializations per message (default: 100000)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="Host C compiler (default: $CC or cc)")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    if not shutil.which(args.cc):
+        print(f"ERROR: C compiler '{args.cc}' not found", file=sys.stderr)
+        return 1
+    if args.cjson_dir and not os.path.isfile(os.path.join(args.cjson_dir, "cJSON.c")):
+        print(f"ERROR: {args.cjson_dir}/cJSON.c not found", file=sys.stderr)
+        return 1
+
+    with tempfile.TemporaryDirectory() as workdir:
+        exe = build(workdir, args.cjson_dir, args.cc)
+        rows = run(exe, args.iterations)
+
+    if args.json:
+        print(json.dumps(rows, indent=2))
+        return 0
+
+    print(f"{'impl':<12} {'message':<20} {'bytes':>6} {'allocs':>7} {'alloc B':>8} {'ns/msg':>8}")
+    for r in rows:
+        print(f"{r['impl']:<12} {r['message']:<20} {r['bytes']:>6} {r['allocs']:>7} "
+              f"{r['allocBytes']:>8} {r['nsPerMsg']:>8.1f}")
+    print("\nallocs/alloc B are per message; the firmware's send path adds one queued copy")
+    print("(a fixed ws_io slot for frames up to 256 bytes, the heap above that).")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
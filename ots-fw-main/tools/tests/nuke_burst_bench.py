@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+"""Event dispatch latency under a burst of nuke events.
+
+Nuke events are the most expensive ones for the dispatcher: the alert and
+nuke modules update LEDs over I2C for each of them. This script:
+
+1. Connects as a userscript (handshake)
+2. Reads the "events" statistics from GET /api/status
+3. Sends --bursts bursts of --burst nuke events back to back (incoming
+   alerts, outgoing launches, then explosions resolving them), --gap
+   seconds apart
+4. Reads the statistics again and reports the difference: dispatch latency
+   (post -> dispatcher task done), per-handler time and, for handlers on a
+   worker, post -> handler done ("lag")
+
+Dispatch latency is what every other event (GAME_END, button presses, ...)
+waits behind. To compare against handlers running inline on the dispatcher
+task, build the firmware with -DEVENT_DISPATCHER_DEFER_BLOCKING=0, run the
+script with --save baseline.json, flash the normal build and run it again
+with --compare baseline.json.
+
+Examples:
+
+  python3 tools/tests/nuke_burst_bench.py --host 192.168.1.50
+
+  python3 tools/tests/nuke_burst_bench.py --host 192.168.1.50 --burst 24 --save inline.json
+  python3 tools/tests/nuke_burst_bench.py --host 192.168.1.50 --burst 24 --compare inline.json
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import http.client
+import json
+import os
+import socket
+import ssl
+import sys
+import time
+from typing import Any, Optional
+
+
+def _ensure_repo_root_on_syspath() -> None:
+    repo_root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+    if repo_root not in sys.path:
+        sys.path.insert(0, repo_root)
+
+
+_ensure_repo_root_on_syspath()
+
+
+from tools.ots_device_tool import WsClient  # noqa: E402
+
+NUKE_ALERTS = ("ALERT_ATOM", "ALERT_HYDRO", "ALERT_MIRV")
+NUKE_TYPES = ("atom", "hydro", "mirv")
+
+
+def fetch_event_stats(host: str, port: int, timeout_s: float) -> Optional[dict[str, Any]]:
+    ctx = ssl.create_default_context()
+    ctx.check_hostname = False
+    ctx.verify_mode = ssl.CERT_NONE
+    conn = http.client.HTTPSConnection(host, port, timeout=timeout_s, context=ctx)
+    try:
+        conn.request("GET", "/api/status", headers={"Cache-Control": "no-cache"})
+        resp = conn.getresponse()
+        body = resp.read()
+        if resp.status != 200:
+            return None
+        return json.loads(body.decode("utf-8")).get("events")
+    except (OSError, ssl.SSLError, json.JSONDecodeError):
+        return None
+    finally:
+        conn.close()
+
+
+class Burst:
+    def __init__(self, client: WsClient):
+        self.client = client
+        self.seq = 0
+        self.unit_id = 50000
+        self.resyncs = 0
+
+    def drain(self, duration_s: float) -> None:
+        end_by = time.perf_counter() + duration_s
+        while True:
+            left = end_by - time.perf_counter()
+            if left <= 0:
+                return
+            try:
+                frame = self.client.recv_frame(timeout_s=left)
+            except (socket.timeout, TimeoutError):
+                return
+            if frame.opcode != 0x1:
+                continue
+            try:
+                msg = json.loads(frame.payload.decode("utf-8"))
+            except (UnicodeDecodeError, json.JSONDecodeError):
+                continue
+            if msg.get("type") == "cmd" and msg.get("payload", {}).get("action") == "request-snapshot":
+                self.resyncs += 1
+
+    def _send(self, event_type: str, data: dict[str, Any]) -> None:
+        self.seq += 1
+        payload = {
+            "type": event_type,
+            "timestamp": int(time.time() * 1000),
+            "data": data,
+            "seq": self.seq,
+        }
+        self.client.send_text(json.dumps({"type": "event", "payload": payload}))
+
+    def send(self, count: int) -> int:
+        """One burst: a third incoming alerts, a third launches, the rest explosions."""
+        sent = 0
+        launched: list[int] = []
+        for i in range(count):
+            kind = i % 3
+            if kind == 0:
+                self.unit_id += 1
+                self._send(NUKE_ALERTS[(i // 3) % 3], {"nukeUnitID": self.unit_id})
+                launched.append(self.unit_id)
+            elif kind == 1:
+                self.unit_id += 1
+                self._send("NUKE_LAUNCHED", {"nukeUnitID": self.unit_id, "nukeType": NUKE_TYPES[(i // 3) % 3]})
+                launched.append(self.unit_id)
+            else:
+                self._send("NUKE_EXPLODED", {"nukeUnitID": launched.pop(0) if launched else self.unit_id})
+            sent += 1
+        return sent
+
+
+def _delta(before: dict[str, Any], after: dict[str, Any]) -> dict[str, Any]:
+    lb, la = before.get("latency", {}), after.get("latency", {})
+    n = la.get("count", 0) - lb.get("count", 0)
+    total = la.get("avgUs", 0) * la.get("count", 0) - lb.get("avgUs", 0) * lb.get("count", 0)
+    hist = [a - b for a, b in zip(la.get("hist", []), lb.get("hist", []))]
+
+    handlers: list[dict[str, Any]] = []
+    prev = {h.get("name"): h for h in before.get("handlers", [])}
+    for h in after.get("handlers", []):
+        p = prev.get(h.get("name"), {})
+        calls = h.get("calls", 0) - p.get("calls", 0)
+        busy = h.get("avgUs", 0) * h.get("calls", 0) - p.get("avgUs", 0) * p.get("calls", 0)
+        lag = h.get("lagAvgUs", 0) * h.get("calls", 0) - p.get("lagAvgUs", 0) * p.get("calls", 0)
+        handlers.append({
+            "name": h.get("name") or "(unnamed)",
+            "blocking": h.get("blocking", False),
+            "calls": calls,
+            "avgUs": round(busy / calls) if calls else 0,
+            "lagAvgUs": round(lag / calls) if calls and h.get("blocking") else None,
+            "maxUs": h.get("maxUs", 0),
+            "lagMaxUs": h.get("lagMaxUs", 0) if h.get("blocking") else None,
+            "overBudget": h.get("overBudget", 0) - p.get("overBudget", 0),
+            "queueDropped": h.get("queueDropped", 0) - p.get("queueDropped", 0),
+        })
+
+    return {
+        "latency": {
+            "count": n,
+            "avgUs": round(total / n) if n else 0,
+            # Cumulative maximum: reset with `event-stats reset` for a clean run
+            "maxUs": la.get("maxUs", 0),
+            "hist": hist,
+            "histBoundsUs": la.get("histBoundsUs", []),
+        },
+        "queueHighWater": after.get("queue", {}).get("highWater", 0),
+        "dropped": after.get("queue", {}).get("droppedTotal", 0) - before.get("queue", {}).get("droppedTotal", 0),
+        "handlers": handlers,
+    }
+
+
+def _hist_labels(bounds: list[int]) -> list[str]:
+    def fmt(us: int) -> str:
+        return f"{us // 1000}ms" if us >= 1000 else f"{us}us"
+    return [f"<{fmt(b)}" for b in bounds] + [f">={fmt(bounds[-1])}" if bounds else ">="]
+
+
+def _print(result: dict[str, Any], baseline: Optional[dict[str, Any]]) -> None:
+    lat = result["latency"]
+    print(f"  events sent: {result['sent']}  resyncs: {result['resyncs']}  "
+          f"dropped: {result['dropped']}  queue high-water: {result['queueHighWater']}")
+    line = f"  dispatch latency: n={lat['count']} avg={lat['avgUs']}us max={lat['maxUs']}us"
+    if baseline:
+        b = baseline["latency"]
+        line += f"  (baseline avg={b['avgUs']}us max={b['maxUs']}us"
+        if lat["avgUs"]:
+            line += f", {b['avgUs'] / lat['avgUs']:.1f}x"
+        line += ")"
+    print(line)
+    labels = _hist_labels(lat.get("histBoundsUs", []))
+    print("    " + "  ".join(f"{label}={count}" for label, count in zip(labels, lat["hist"])))
+    print(f"  {'handler':<16} {'mode':<9} {'calls':>6} {'avg us':>8} {'max us':>8} {'lag avg':>8} {'lag max':>8} {'over':>5} {'qdrop':>6}")
+    for h in result["handlers"]:
+        print(f"  {h['name']:<16} {'blocking' if h['blocking'] else 'fast':<9} {h['calls']:>6} {h['avgUs']:>8} "
+              f"{h['maxUs']:>8} {h['lagAvgUs'] if h['lagAvgUs'] is not None else '-':>8} "
+              f"{h['lagMaxUs'] if h['lagMaxUs'] is not None else '-':>8} {h['overBudget']:>5} {h['queueDropped']:>6}")
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Event dispatch latency under a burst of nuke events")
+    ap.add_argument("--host", required=True, help="Device IP or hostname")
+    ap.add_argument("--port", type=int, default=3000, help="HTTPS/WSS port (default: 3000)")
+    ap.add_argument("--burst", type=int, default=18, help="Nuke events per burst (default: 18)")
+    ap.add_argument("--bursts", type=int, default=10, help="Number of bursts (default: 10)")
+    ap.add_argument("--gap", type=float, default=0.5, help="Seconds between bursts (default: 0.5)")
+    ap.add_argument("--settle", type=float, default=1.5, help="Seconds to wait before reading statistics")
+    ap.add_argument("--timeout", type=float, default=4.0, help="HTTP timeout in seconds")
+    ap.add_argument("--save", default=None, help="Write the result to this JSON file")
+    ap.add_argument("--compare", default=None, help="Baseline JSON (from --save) to compare against")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    baseline = None
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+
+    client = WsClient(host=args.host, port=args.port, path="/ws", insecure=True)
+    try:
+        client.connect()
+    except OSError as e:
+        print(f"ERROR: WebSocket connect failed: {e}", file=sys.stderr)
+        return 1
+
+    burst = Burst(client)
+    try:
+        client.send_text(json.dumps({"type": "handshake", "clientType": "userscript"}))
+        burst.drain(0.5)
+        before = fetch_event_stats(args.host, args.port, args.timeout)
+        if before is None or "latency" not in before:
+            print("ERROR: /api/status has no event latency statistics (older firmware?)", file=sys.stderr)
+            return 1
+
+        sent = 0
+        for _ in range(args.bursts):
+            sent += burst.send(args.burst)
+            burst.drain(args.gap)
+        burst.drain(args.settle)
+        after = fetch_event_stats(args.host, args.port, args.timeout)
+        if after is None:
+            print("ERROR: failed to read /api/status after the bursts", file=sys.stderr)
+            return 1
+    finally:
+        client.close()
+
+    result = _delta(before, after)
+    result.update({"host": args.host, "sent": sent, "burst": args.burst, "bursts": args.bursts,
+                   "resyncs": burst.resyncs})
+
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(result, f, indent=2)
+
+    if args.json:
+        print(json.dumps({"result": result, "baseline": baseline}, indent=2))
+        return 0
+
+    print(f"Nuke burst: {args.bursts} x {args.burst} events, {args.host}:{args.port}")
+    _print(result, baseline)
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
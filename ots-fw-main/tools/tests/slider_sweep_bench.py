@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+"""Host simulation of the troops slider pipeline for full-range sweeps.
+
+Compiles src/slider_filter.c with a small C harness and replays slider
+sweeps (0 -> 100 % -> 0 %) of different speeds through two pipelines, in
+1 ms steps:
+
+- old: ADC read every 150 ms (io_task counter), troops_update() polling
+  every 50 ms, a command on every >= 1 % change
+- new: ADC read every 50 ms with the raw deadband, changes pushed to the
+  troops module (woken ~1 ms later), slider_filter deciding what is sent,
+  and module wake-ups at slider_filter_next_ms()
+
+Per sweep it reports the number of commands, how long after the slider
+stopped the game got the final value, and the mean error (in percent)
+between the slider and the value the game last received while moving.
+
+ADC noise is simulated (+-N raw counts, fixed seed) so chatter at rest is
+visible too. The on-device counterpart is the `slider-stats` serial
+command (reset, sweep by hand, read).
+
+Examples:
+
+  python3 tools/tests/slider_sweep_bench.py
+
+  python3 tools/tests/slider_sweep_bench.py --sweep-ms 300 1000 --noise 6 --json
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from typing import Any
+
+FW_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+HARNESS = r"""
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "slider_filter.h"
+
+#define ADC_CHANGE_DEADBAND_RAW 8
+#define REST_MS 1500
+#define CHATTER_AFTER_MS 500
+
+static uint32_t rng = 12345;
+static int noise(int amp) {
+    if (amp <= 0) return 0;
+    rng = rng * 1103515245u + 12345u;
+    return (int)((rng >> 16) % (uint32_t)(2 * amp + 1)) - amp;
+}
+
+/* Rest at 0, sweep up, rest at 100, sweep down, rest at 0 */
+static double position(uint32_t t, uint32_t sweep) {
+    if (t < REST_MS) return 0.0;
+    t -= REST_MS;
+    if (t < sweep) return 100.0 * t / sweep;
+    t -= sweep;
+    if (t < REST_MS) return 100.0;
+    t -= REST_MS;
+    if (t < sweep) return 100.0 - 100.0 * t / sweep;
+    return 0.0;
+}
+
+static int read_raw(double pos, int amp) {
+    int raw = (int)lround(pos / 100.0 * 4095.0) + noise(amp);
+    return raw < 0 ? 0 : (raw > 4095 ? 4095 : raw);
+}
+
+typedef struct { uint32_t msgs, msgs_rest; double err_sum; uint32_t err_n; int final_up_ms, final_down_ms; } result_t;
+
+/* Time the game first holds the end value of a segment (within the 1 % truncation of raw -> percent) */
+static void track_final(result_t *r, uint32_t t, uint32_t sweep, int game) {
+    const uint32_t up_end = REST_MS + sweep, down_end = 2 * REST_MS + 2 * sweep;
+    if (r->final_up_ms < 0 && t >= up_end && t < up_end + REST_MS && game >= 99) r->final_up_ms = (int)(t - up_end);
+    if (r->final_down_ms < 0 && t >= down_end && game <= 1) r->final_down_ms = (int)(t - down_end);
+}
+
+static int moving(uint32_t t, uint32_t sweep) {
+    return (t >= REST_MS && t < REST_MS + sweep) || (t >= 2 * REST_MS + sweep && t < 2 * REST_MS + 2 * sweep);
+}
+
+/* At rest and past any settle/catch-up window: a send here is noise chatter */
+static int resting(uint32_t t, uint32_t sweep) {
+    const uint32_t up_end = REST_MS + sweep, down_end = 2 * REST_MS + 2 * sweep;
+    if (t < REST_MS) return 1;
+    if (t >= up_end + CHATTER_AFTER_MS && t < up_end + REST_MS) return 1;
+    return t >= down_end + CHATTER_AFTER_MS;
+}
+
+static void account(result_t *r, uint32_t t, uint32_t sweep, double pos, int game) {
+    if (moving(t, sweep)) { r->err_sum += fabs(pos - game); r->err_n++; }
+    track_final(r, t, sweep, game);
+}
+
+static result_t run_old(uint32_t sweep, int amp) {
+    result_t r = {0, 0, 0, 0, -1, -1};
+    const uint32_t end = 3 * REST_MS + 2 * sweep;
+    int adc = 0, last_sent = 0, game = 0;
+    rng = 12345;
+    for (uint32_t t = 0; t < end; t++) {
+        const double pos = position(t, sweep);
+        if (t % 150 == 0) {
+            int p = read_raw(pos, amp) * 100 / 4095;
+            adc = p > 100 ? 100 : p;
+        }
+        if (t % 50 == 25 && abs(adc - last_sent) >= 1) {
+            last_sent = game = adc;
+            r.msgs++;
+            if (resting(t, sweep)) r.msgs_rest++;
+        }
+        account(&r, t, sweep, pos, game);
+    }
+    return r;
+}
+
+static result_t run_new(uint32_t sweep, int amp, uint32_t interval, uint32_t settle) {
+    result_t r = {0, 0, 0, 0, -1, -1};
+    const uint32_t end = 3 * REST_MS + 2 * sweep;
+    slider_filter_config_t cfg = { .min_interval_ms = interval, .settle_ms = settle, .threshold = 1 };
+    slider_filter_t f;
+    slider_filter_init(&f, &cfg);
+    int raw_ref = 0, have = 0, percent = 0, game = 0;
+    uint32_t change_ms = 0, wake_at = 1;  /* first update sends the start position (counted as chatter) */
+    rng = 12345;
+    for (uint32_t t = 0; t < end; t++) {
+        const double pos = position(t, sweep);
+        if (t % 50 == 0) {
+            const int raw = read_raw(pos, amp);
+            if (!have || abs(raw - raw_ref) >= ADC_CHANGE_DEADBAND_RAW) {
+                int p = raw * 100 / 4095;
+                p = p > 100 ? 100 : p;
+                raw_ref = raw;
+                if (!have || p != percent) {
+                    percent = p;
+                    change_ms = t;
+                    wake_at = t + 1;  /* module_manager_notify() -> scheduler */
+                }
+                have = 1;
+            }
+        }
+        if (wake_at != UINT32_MAX && t >= wake_at) {
+            uint8_t out;
+            if (slider_filter_update(&f, (uint8_t)percent, change_ms, t, &out) != SLIDER_SEND_NONE) {
+                game = out;
+                if (t > 0) { r.msgs++; if (resting(t, sweep)) r.msgs_rest++; }
+            }
+            const uint32_t next = slider_filter_next_ms(&f, t);
+            wake_at = (next == UINT32_MAX) ? UINT32_MAX : t + (next ? next : 1);
+        }
+        account(&r, t, sweep, pos, game);
+    }
+    return r;
+}
+
+static void print(const char *name, uint32_t sweep, const result_t *r) {
+    printf("%s\t%u\t%u\t%u\t%d\t%d\t%.2f\n", name, sweep, r->msgs, r->msgs_rest,
+           r->final_up_ms, r->final_down_ms, r->err_n ? r->err_sum / r->err_n : 0.0);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 5) return 2;
+    const int amp = atoi(argv[1]);
+    const uint32_t interval = (uint32_t)atoi(argv[2]), settle = (uint32_t)atoi(argv[3]);
+    for (int i = 4; i < argc; i++) {
+        const uint32_t sweep = (uint32_t)atoi(argv[i]);
+        result_t o = run_old(sweep, amp), n = run_new(sweep, amp, interval, settle);
+        print("old", sweep, &o);
+        print("new", sweep, &n);
+    }
+    return 0;
+}
+"""
+
+
+def build(workdir: str, cc: str) -> str:
+    src = os.path.join(workdir, "sweep.c")
+    with open(src, "w") as f:
+        f.write(HARNESS)
+    exe = os.path.join(workdir, "slider_sweep_bench")
+    subprocess.run([
+        cc, "-O2", "-std=c11", "-I", os.path.join(FW_ROOT, "include"),
+        src, os.path.join(FW_ROOT, "src", "slider_filter.c"), "-lm", "-o", exe,
+    ], check=True)
+    return exe
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Simulate old vs new troops slider pipeline on full-range sweeps")
+    ap.add_argument("--sweep-ms", type=int, nargs="+", default=[250, 500, 1000, 2000],
+                    help="Duration of one 0->100%% sweep (default: 250 500 1000 2000)")
+    ap.add_argument("--noise", type=int, default=3, help="ADC noise amplitude in raw counts (default: 3)")
+    ap.add_argument("--min-interval", type=int, default=150, help="TROOPS_SLIDER_MIN_INTERVAL_MS (default: 150)")
+    ap.add_argument("--settle", type=int, default=120, help="TROOPS_SLIDER_SETTLE_MS (default: 120)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="Host C compiler (default: $CC or cc)")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    if not shutil.which(args.cc):
+        print(f"ERROR: C compiler '{args.cc}' not found", file=sys.stderr)
+        return 1
+
+    with tempfile.TemporaryDirectory() as workdir:
+        exe = build(workdir, args.cc)
+        out = subprocess.run(
+            [exe, str(args.noise), str(args.min_interval), str(args.settle)] + [str(s) for s in args.sweep_ms],
+            check=True, capture_output=True, text=True,
+        ).stdout
+
+    rows: list[dict[str, Any]] = []
+    for line in out.splitlines():
+        name, sweep, msgs, rest, up, down, err = line.split("\t")
+        rows.append({
+            "pipeline": name,
+            "sweepMs": int(sweep),
+            "commands": int(msgs),
+            "chatter": int(rest),
+            "finalUpMs": int(up),
+            "finalDownMs": int(down),
+            "meanErrorPct": float(err),
+        })
+
+    if args.json:
+        print(json.dumps(rows, indent=2))
+        return 0
+
+    print(f"Full-range sweep up and down, ADC noise +-{args.noise} counts "
+          f"(new: min interval {args.min_interval} ms, settle {args.settle} ms)")
+    print(f"{'pipeline':<9} {'sweep ms':>8} {'cmds':>5} {'chatter':>8} {'final up':>9} {'final down':>11} {'mean err %':>11}")
+    for r in rows:
+        print(f"{r['pipeline']:<9} {r['sweepMs']:>8} {r['commands']:>5} {r['chatter']:>8} "
+              f"{r['finalUpMs']:>7}ms {r['finalDownMs']:>9}ms {r['meanErrorPct']:>11.2f}")
+    print("\nchatter: commands sent while the slider rests (more than 500 ms after a sweep)")
+    print("final up/down: time from the slider stopping to the game holding the end value (-1: never)")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+"""Benchmark TLS handshake cost and reconnect latency of the HTTPS/WSS server.
+
+Measures three scenarios against the device (default port 3000):
+- full:      new TLS session per connection (no resumption)
+- resumed:   reconnect offering the previous session ticket
+- keepalive: N HTTP requests over one connection vs one connection per request
+
+For each scenario it reports how many full handshakes the device had to do
+(session_reused=False on the client side) and the connect/request latency.
+
+This is intentionally stdlib-only.
+
+Examples:
+
+  python3 tools/tests/tls_handshake_bench.py --host 192.168.1.50
+
+  # More samples, machine-readable output
+  python3 tools/tests/tls_handshake_bench.py --host ots-fw-main.local -n 30 --json
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import socket
+import ssl
+import statistics
+import sys
+import time
+from typing import Any, Optional
+
+
+def _make_context() -> ssl.SSLContext:
+    # The firmware uses a self-signed certificate
+    ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+    ctx.check_hostname = False
+    ctx.verify_mode = ssl.CERT_NONE
+    # The device only speaks TLS 1.2; pin it so tickets behave the same on every host
+    ctx.maximum_version = ssl.TLSVersion.TLSv1_2
+    return ctx
+
+
+def _connect(
+    ctx: ssl.SSLContext, host: str, port: int, timeout_s: float, session: Optional[ssl.SSLSession] = None
+) -> tuple[ssl.SSLSocket, float]:
+    t0 = time.perf_counter()
+    raw = socket.create_connection((host, port), timeout=timeout_s)
+    # Keep Nagle/delayed-ACK stalls out of the request latency numbers
+    raw.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    try:
+        sock = ctx.wrap_socket(raw, server_hostname=host, session=session)
+    except Exception:
+        raw.close()
+        raise
+    return sock, (time.perf_counter() - t0) * 1000.0
+
+
+def _http_get(sock: ssl.SSLSocket, host: str, path: str, keep_alive: bool) -> int:
+    req = (
+        f"GET {path} HTTP/1.1\r\n"
+        f"Host: {host}\r\n"
+        f"Connection: {'keep-alive' if keep_alive else 'close'}\r\n"
+        "User-Agent: ots-tls-bench/1.0\r\n"
+        "\r\n"
+    )
+    sock.sendall(req.encode("ascii"))
+
+    buf = b""
+    while b"\r\n\r\n" not in buf:
+        chunk = sock.recv(4096)
+        if not chunk:
+            raise ConnectionError("connection closed while reading headers")
+        buf += chunk
+
+    head, _, body = buf.partition(b"\r\n\r\n")
+    lines = head.decode("latin-1").split("\r\n")
+    parts = lines[0].split()
+    if len(parts) < 2 or not parts[1].isdigit():
+        raise ConnectionError(f"malformed status line: {lines[0]!r}")
+    status = int(parts[1])
+    length = 0
+    for line in lines[1:]:
+        name, _, value = line.partition(":")
+        if name.strip().lower() == "content-length":
+            length = int(value.strip())
+
+    while len(body) < length:
+        chunk = sock.recv(4096)
+        if not chunk:
+            break
+        body += chunk
+    return status
+
+
+def _summary(samples: list[float]) -> dict[str, float]:
+    if not samples:
+        return {"n": 0}
+    ordered = sorted(samples)
+    p95 = ordered[min(len(ordered) - 1, int(round(0.95 * (len(ordered) - 1))))]
+    return {
+        "n": len(samples),
+        "min_ms": round(ordered[0], 1),
+        "median_ms": round(statistics.median(ordered), 1),
+        "p95_ms": round(p95, 1),
+        "max_ms": round(ordered[-1], 1),
+    }
+
+
+def bench_full(host: str, port: int, count: int, timeout_s: float) -> dict[str, Any]:
+    ctx = _make_context()
+    latencies: list[float] = []
+    full = 0
+    for _ in range(count):
+        sock, ms = _connect(ctx, host, port, timeout_s)
+        latencies.append(ms)
+        if not sock.session_reused:
+            full += 1
+        sock.close()
+    return {"full_handshakes": full, "connect": _summary(latencies)}
+
+
+def bench_resumed(host: str, port: int, count: int, timeout_s: float) -> dict[str, Any]:
+    ctx = _make_context()
+    sock, _ = _connect(ctx, host, port, timeout_s)
+    session = sock.session
+    sock.close()
+
+    latencies: list[float] = []
+    full = 0
+    for _ in range(count):
+        sock, ms = _connect(ctx, host, port, timeout_s, session=session)
+        latencies.append(ms)
+        if not sock.session_reused:
+            full += 1
+        session = sock.session
+        sock.close()
+    return {
+        "full_handshakes": full,
+        "resumed": count - full,
+        "ticket_lifetime_s": session.ticket_lifetime_hint if session else None,
+        "connect": _summary(latencies),
+    }
+
+
+def bench_keepalive(host: str, port: int, count: int, path: str, timeout_s: float) -> dict[str, Any]:
+    ctx = _make_context()
+
+    per_request: list[float] = []
+    for _ in range(count):
+        t0 = time.perf_counter()
+        sock, _ = _connect(ctx, host, port, timeout_s)
+        _http_get(sock, host, path, keep_alive=False)
+        sock.close()
+        per_request.append((time.perf_counter() - t0) * 1000.0)
+
+    reused: list[float] = []
+    sock, _ = _connect(ctx, host, port, timeout_s)
+    reconnects = 0
+    try:
+        for _ in range(count):
+            t0 = time.perf_counter()
+            try:
+                _http_get(sock, host, path, keep_alive=True)
+            except (ConnectionError, ssl.SSLError, OSError):
+                # Server closed the connection; count it and carry on
+                reconnects += 1
+                session = sock.session
+                sock.close()
+                sock, _ = _connect(ctx, host, port, timeout_s, session=session)
+                _http_get(sock, host, path, keep_alive=True)
+            reused.append((time.perf_counter() - t0) * 1000.0)
+    finally:
+        sock.close()
+
+    return {
+        "path": path,
+        "new_connection_per_request": _summary(per_request),
+        "single_connection": _summary(reused),
+        "server_closed_connection": reconnects,
+    }
+
+
+def _print_report(results: dict[str, Any]) -> None:
+    def line(label: str, s: dict[str, float]) -> None:
+        if s.get("n", 0) == 0:
+            print(f"  {label:<28} (no samples)")
+            return
+        print(
+            f"  {label:<28} n={s['n']:<3} min={s['min_ms']:>7.1f}  median={s['median_ms']:>7.1f}  "
+            f"p95={s['p95_ms']:>7.1f}  max={s['max_ms']:>7.1f} ms"
+        )
+
+    full = results["full"]
+    resumed = results["resumed"]
+    ka = results["keepalive"]
+
+    print(f"Target: {results['host']}:{results['port']}")
+    print("\nHandshakes")
+    line("full (no session)", full["connect"])
+    line("resumed (session ticket)", resumed["connect"])
+    print(f"  resumed {resumed['resumed']}/{resumed['resumed'] + resumed['full_handshakes']} reconnects"
+          f" (ticket lifetime hint: {resumed['ticket_lifetime_s']}s)")
+    if resumed["full_handshakes"]:
+        print("  WARNING: device did not resume every session - are session tickets enabled?")
+
+    print(f"\nRequests to {ka['path']}")
+    line("new connection per request", ka["new_connection_per_request"])
+    line("single keep-alive connection", ka["single_connection"])
+    if ka["server_closed_connection"]:
+        print(f"  server closed the keep-alive connection {ka['server_closed_connection']} time(s)")
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Benchmark TLS handshakes and reconnect latency")
+    ap.add_argument("--host", required=True, help="Device IP or hostname")
+    ap.add_argument("--port", type=int, default=3000, help="HTTPS/WSS port (default: 3000)")
+    ap.add_argument("-n", "--count", type=int, default=10, help="Samples per scenario (default: 10)")
+    ap.add_argument("--path", default="/device", help="Path for keep-alive requests (default: /device)")
+    ap.add_argument("--timeout", type=float, default=10.0, help="Socket timeout in seconds")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    try:
+        results = {
+            "host": args.host,
+            "port": args.port,
+            "full": bench_full(args.host, args.port, args.count, args.timeout),
+            "resumed": bench_resumed(args.host, args.port, args.count, args.timeout),
+            "keepalive": bench_keepalive(args.host, args.port, args.count, args.path, args.timeout),
+        }
+    except (OSError, ssl.SSLError) as e:
+        print(f"ERROR: {e}", file=sys.stderr)
+        return 1
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+    else:
+        _print_report(results)
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
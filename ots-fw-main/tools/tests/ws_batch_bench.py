@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""Compare batched and unbatched event delivery over the WebSocket.
+
+The userscript sends the events of one game tick as a single "batch"
+message. This script measures what that saves on both ends:
+
+1. Connect as a userscript (handshake)
+2. Send --events TROOP_UPDATE events one per frame ("event" messages)
+3. Send the same number of events in "batch" messages of --batch-size
+4. For each phase report client-side frames/s and events/s, and the
+   device's receive cost per event from the wsRx counters returned by
+   the "hardware-diagnostic" command (frames, events, busyUs)
+
+Events are sent in --burst sized groups with --gap seconds between them so
+the device's 32-entry event queue can drain; a too aggressive setting shows
+up as snapshot requests (reported as "resyncs").
+
+Examples:
+
+  python3 tools/tests/ws_batch_bench.py --host 192.168.1.50
+
+  # Larger run, machine-readable
+  python3 tools/tests/ws_batch_bench.py --host 192.168.1.50 --events 2000 --json
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import socket
+import sys
+import time
+from typing import Any, Optional
+
+
+def _ensure_repo_root_on_syspath() -> None:
+    repo_root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+    if repo_root not in sys.path:
+        sys.path.insert(0, repo_root)
+
+
+_ensure_repo_root_on_syspath()
+
+
+from tools.ots_device_tool import WsClient  # noqa: E402
+
+
+class Bench:
+    def __init__(self, client: WsClient):
+        self.client = client
+        self.seq = 0
+        self.resyncs = 0
+
+    def _handle(self, frame) -> Optional[dict[str, Any]]:
+        if frame.opcode != 0x1:
+            return None
+        try:
+            msg = json.loads(frame.payload.decode("utf-8"))
+        except (UnicodeDecodeError, json.JSONDecodeError):
+            return None
+        payload = msg.get("payload", {})
+        if msg.get("type") == "cmd" and payload.get("action") == "request-snapshot":
+            self.resyncs += 1
+        return msg
+
+    def drain(self, duration_s: float) -> None:
+        end_by = time.perf_counter() + duration_s
+        while True:
+            left = end_by - time.perf_counter()
+            if left <= 0:
+                return
+            try:
+                self._handle(self.client.recv_frame(timeout_s=left))
+            except (socket.timeout, TimeoutError):
+                return
+
+    def rx_stats(self, timeout_s: float) -> Optional[dict[str, Any]]:
+        self.client.send_text(json.dumps({"type": "cmd", "payload": {"action": "hardware-diagnostic"}}))
+        end_by = time.perf_counter() + timeout_s
+        while True:
+            left = end_by - time.perf_counter()
+            if left <= 0:
+                return None
+            try:
+                msg = self._handle(self.client.recv_frame(timeout_s=left))
+            except (socket.timeout, TimeoutError):
+                return None
+            if msg and msg.get("payload", {}).get("type") == "HARDWARE_DIAGNOSTIC":
+                data = msg["payload"].get("data", {})
+                if isinstance(data, str):
+                    data = json.loads(data)
+                return data.get("wsRx")
+
+    def _event(self, i: int) -> dict[str, Any]:
+        self.seq += 1
+        return {
+            "type": "TROOP_UPDATE",
+            "timestamp": int(time.time() * 1000),
+            "data": {"currentTroops": 100000 + i * 100, "maxTroops": 1000000},
+            "seq": self.seq,
+        }
+
+    def run(self, events: int, batch_size: int, burst: int, gap_s: float) -> dict[str, Any]:
+        frames = 0
+        sent = 0
+        t0 = time.perf_counter()
+        while sent < events:
+            group = min(burst, events - sent)
+            done = 0
+            while done < group:
+                if batch_size <= 1:
+                    self.client.send_text(json.dumps({"type": "event", "payload": self._event(sent + done)}))
+                    done += 1
+                else:
+                    n = min(batch_size, group - done)
+                    batch = [self._event(sent + done + k) for k in range(n)]
+                    self.client.send_text(json.dumps({"type": "batch", "payload": {"events": batch}}))
+                    done += n
+                frames += 1
+            sent += group
+            if gap_s > 0:
+                self.drain(gap_s)
+        elapsed = time.perf_counter() - t0
+        send_s = max(elapsed - gap_s * ((events + burst - 1) // burst), 1e-6)
+        return {
+            "frames": frames,
+            "events": sent,
+            "send_s": round(send_s, 3),
+            "frames_per_s": round(frames / send_s, 1),
+            "events_per_s": round(sent / send_s, 1),
+        }
+
+
+def _delta(before: Optional[dict[str, Any]], after: Optional[dict[str, Any]]) -> Optional[dict[str, Any]]:
+    if not before or not after:
+        return None
+    out = {k: after.get(k, 0) - before.get(k, 0) for k in ("frames", "events", "batches", "busyUs")}
+    out["us_per_event"] = round(out["busyUs"] / out["events"], 1) if out["events"] else None
+    out["us_per_frame"] = round(out["busyUs"] / out["frames"], 1) if out["frames"] else None
+    return out
+
+
+def phase(bench: Bench, label: str, args, batch_size: int) -> dict[str, Any]:
+    bench.resyncs = 0
+    before = bench.rx_stats(args.timeout)
+    result = bench.run(args.events, batch_size, args.burst, args.gap)
+    bench.drain(args.settle)
+    after = bench.rx_stats(args.timeout)
+    result["label"] = label
+    result["batch_size"] = batch_size
+    result["device"] = _delta(before, after)
+    result["resyncs"] = bench.resyncs
+    return result
+
+
+def _print_phase(r: dict[str, Any]) -> None:
+    print(
+        f"  {r['label']:<10} {r['events']} events in {r['frames']} frames: "
+        f"{r['frames_per_s']:>8.1f} frames/s {r['events_per_s']:>8.1f} events/s  resyncs={r['resyncs']}"
+    )
+    dev = r["device"]
+    if dev is None:
+        print("             device: no wsRx counters (firmware without batch support?)")
+        return
+    print(
+        f"             device: {dev['frames']} frames, {dev['events']} events, "
+        f"{dev['us_per_frame']} us/frame, {dev['us_per_event']} us/event"
+    )
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Batched vs unbatched WebSocket event delivery")
+    ap.add_argument("--host", required=True, help="Device IP or hostname")
+    ap.add_argument("--port", type=int, default=3000, help="HTTPS/WSS port (default: 3000)")
+    ap.add_argument("--events", type=int, default=500, help="Events per phase (default: 500)")
+    ap.add_argument("--batch-size", type=int, default=16, help="Events per batch message (default: 16, max 16)")
+    ap.add_argument("--burst", type=int, default=16, help="Events sent back to back before a gap (default: 16)")
+    ap.add_argument("--gap", type=float, default=0.05, help="Seconds between bursts (default: 0.05)")
+    ap.add_argument("--settle", type=float, default=1.0, help="Seconds to wait before reading counters")
+    ap.add_argument("--timeout", type=float, default=2.0, help="Seconds to wait for the diagnostic reply")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    if not 2 <= args.batch_size <= 16:
+        print("ERROR: --batch-size must be 2..16", file=sys.stderr)
+        return 1
+
+    client = WsClient(host=args.host, port=args.port, path="/ws", insecure=True)
+    try:
+        client.connect()
+    except OSError as e:
+        print(f"ERROR: WebSocket connect failed: {e}", file=sys.stderr)
+        return 1
+
+    bench = Bench(client)
+    results: dict[str, Any] = {"host": args.host}
+    try:
+        client.send_text(json.dumps({"type": "handshake", "clientType": "userscript"}))
+        bench.drain(0.5)
+        results["unbatched"] = phase(bench, "unbatched", args, 1)
+        results["batched"] = phase(bench, "batched", args, args.batch_size)
+    finally:
+        client.close()
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+        return 0
+
+    print(f"WebSocket event delivery, {args.host}:{args.port}")
+    _print_phase(results["unbatched"])
+    _print_phase(results["batched"])
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""Measure WebSocket round-trip latency while an OTA upload is in progress.
+
+WebSocket sessions are served by a dedicated I/O task on the device, so a
+long HTTP request on the same server (OTA upload, /api/scan, asset download)
+should no longer stall game traffic. This script checks that:
+
+1. Baseline: probe the WebSocket for --baseline seconds with no HTTP load
+2. Load: POST the firmware image to /ota/upload while probing continuously
+3. Report round-trip latency (median/p95/max) and timeouts for both phases
+
+Probes:
+- ping: WebSocket PING -> PONG (transport path only)
+- diag: "hardware-diagnostic" command -> HARDWARE_DIAGNOSTIC event
+        (full path: frame parse, command handling, send queue)
+
+By default the upload is aborted at 90% so the device does NOT reboot into
+the new image; pass --complete to let it finish (the device reboots).
+
+Examples:
+
+  python3 tools/tests/ws_latency_during_ota.py --host 192.168.1.50 \\
+    --bin .pio/build/esp32-s3-dev/firmware.bin
+
+  # Transport-only probes, 20ms apart
+  python3 tools/tests/ws_latency_during_ota.py --host 192.168.1.50 \\
+    --bin .pio/build/esp32-s3-dev/firmware.bin --probe ping --interval 0.02
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import socket
+import ssl
+import statistics
+import sys
+import threading
+import time
+from typing import Any, Optional
+
+
+def _ensure_repo_root_on_syspath() -> None:
+    repo_root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+    if repo_root not in sys.path:
+        sys.path.insert(0, repo_root)
+
+
+_ensure_repo_root_on_syspath()
+
+
+from tools.ots_device_tool import WsClient  # noqa: E402
+
+
+def _summary(samples: list[float], timeouts: int) -> dict[str, Any]:
+    out: dict[str, Any] = {"n": len(samples), "timeouts": timeouts}
+    if not samples:
+        return out
+    ordered = sorted(samples)
+    p95 = ordered[min(len(ordered) - 1, int(round(0.95 * (len(ordered) - 1))))]
+    out.update(
+        {
+            "median_ms": round(statistics.median(ordered), 1),
+            "p95_ms": round(p95, 1),
+            "max_ms": round(ordered[-1], 1),
+        }
+    )
+    return out
+
+
+class Prober:
+    def __init__(self, client: WsClient, probe: str, timeout_s: float):
+        self.client = client
+        self.probe = probe
+        self.timeout_s = timeout_s
+        self._counter = 0
+
+    def _wait_for(self, match) -> bool:
+        deadline = time.perf_counter() + self.timeout_s
+        while True:
+            left = deadline - time.perf_counter()
+            if left <= 0:
+                return False
+            try:
+                frame = self.client.recv_frame(timeout_s=left)
+            except (socket.timeout, TimeoutError):
+                return False
+            if match(frame):
+                return True
+
+    def once(self) -> Optional[float]:
+        self._counter += 1
+        t0 = time.perf_counter()
+
+        if self.probe == "ping":
+            token = self._counter.to_bytes(4, "big")
+            self.client.send_frame(0x9, token)
+            ok = self._wait_for(lambda f: f.opcode == 0xA and f.payload == token)
+        else:
+            self.client.send_text(json.dumps({"type": "cmd", "payload": {"action": "hardware-diagnostic"}}))
+
+            def is_diag(f) -> bool:
+                if f.opcode != 0x1:
+                    return False
+                try:
+                    msg = json.loads(f.payload.decode("utf-8"))
+                except (UnicodeDecodeError, json.JSONDecodeError):
+                    return False
+                return msg.get("payload", {}).get("type") == "HARDWARE_DIAGNOSTIC"
+
+            ok = self._wait_for(is_diag)
+
+        if not ok:
+            return None
+        return (time.perf_counter() - t0) * 1000.0
+
+
+def run_phase(prober: Prober, stop_evt: threading.Event, duration_s: Optional[float], interval_s: float) -> dict[str, Any]:
+    samples: list[float] = []
+    timeouts = 0
+    end_by = time.perf_counter() + duration_s if duration_s else None
+
+    while not stop_evt.is_set() and (end_by is None or time.perf_counter() < end_by):
+        rtt = prober.once()
+        if rtt is None:
+            timeouts += 1
+        else:
+            samples.append(rtt)
+        time.sleep(interval_s)
+
+    return _summary(samples, timeouts)
+
+
+def ota_upload(
+    host: str, port: int, bin_path: str, abort_fraction: Optional[float], timeout_s: float, result: dict[str, Any]
+) -> None:
+    size = os.path.getsize(bin_path)
+    limit = size if abort_fraction is None else int(size * abort_fraction)
+
+    ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+    ctx.check_hostname = False
+    ctx.verify_mode = ssl.CERT_NONE
+
+    t0 = time.perf_counter()
+    sent = 0
+    raw = socket.create_connection((host, port), timeout=timeout_s)
+    try:
+        sock = ctx.wrap_socket(raw, server_hostname=host)
+        head = (
+            "POST /ota/upload HTTP/1.1\r\n"
+            f"Host: {host}:{port}\r\n"
+            "Content-Type: application/octet-stream\r\n"
+            f"Content-Length: {size}\r\n"
+            "Connection: close\r\n"
+            "\r\n"
+        )
+        sock.sendall(head.encode("ascii"))
+        with open(bin_path, "rb") as f:
+            while sent < limit:
+                chunk = f.read(min(4096, limit - sent))
+                if not chunk:
+                    break
+                sock.sendall(chunk)
+                sent += len(chunk)
+
+        if abort_fraction is None:
+            status = sock.recv(256).split(b"\r\n", 1)[0].decode("latin-1", "replace")
+            result["status"] = status
+        else:
+            result["status"] = f"aborted after {sent} of {size} bytes"
+        sock.close()
+    except OSError as e:
+        result["status"] = f"error: {e}"
+    finally:
+        raw.close()
+        result["bytes_sent"] = sent
+        result["seconds"] = round(time.perf_counter() - t0, 1)
+
+
+def _print_phase(label: str, s: dict[str, Any]) -> None:
+    if s["n"] == 0:
+        print(f"  {label:<10} no replies ({s['timeouts']} timeouts)")
+        return
+    print(
+        f"  {label:<10} n={s['n']:<4} median={s['median_ms']:>7.1f}  p95={s['p95_ms']:>7.1f}  "
+        f"max={s['max_ms']:>7.1f} ms  timeouts={s['timeouts']}"
+    )
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="WebSocket latency during a concurrent OTA upload")
+    ap.add_argument("--host", required=True, help="Device IP or hostname")
+    ap.add_argument("--port", type=int, default=3000, help="HTTPS/WSS port (default: 3000)")
+    ap.add_argument("--bin", required=True, help="Firmware image to upload")
+    ap.add_argument("--probe", choices=["ping", "diag"], default="diag", help="Probe type (default: diag)")
+    ap.add_argument("--interval", type=float, default=0.1, help="Seconds between probes (default: 0.1)")
+    ap.add_argument("--baseline", type=float, default=5.0, help="Baseline duration in seconds (default: 5)")
+    ap.add_argument("--probe-timeout", type=float, default=2.0, help="Seconds before a probe counts as lost")
+    ap.add_argument("--abort-at", type=float, default=0.9, help="Abort upload at this fraction (default: 0.9)")
+    ap.add_argument("--complete", action="store_true", help="Finish the upload (device reboots into it)")
+    ap.add_argument("--json", action="store_true", help="Print results as JSON")
+    args = ap.parse_args()
+
+    if not os.path.isfile(args.bin):
+        print(f"ERROR: firmware image not found: {args.bin}", file=sys.stderr)
+        return 1
+
+    client = WsClient(host=args.host, port=args.port, path="/ws", insecure=True)
+    try:
+        client.connect()
+    except OSError as e:
+        print(f"ERROR: WebSocket connect failed: {e}", file=sys.stderr)
+        return 1
+
+    prober = Prober(client, args.probe, args.probe_timeout)
+    stop_evt = threading.Event()
+    results: dict[str, Any] = {"host": args.host, "probe": args.probe}
+
+    try:
+        results["baseline"] = run_phase(prober, stop_evt, args.baseline, args.interval)
+
+        upload: dict[str, Any] = {}
+        uploader = threading.Thread(
+            target=ota_upload,
+            args=(args.host, args.port, args.bin, None if args.complete else args.abort_at, 30.0, upload),
+            daemon=True,
+        )
+        uploader.start()
+
+        def _stop_when_done() -> None:
+            uploader.join()
+            stop_evt.set()
+
+        threading.Thread(target=_stop_when_done, daemon=True).start()
+        results["during_ota"] = run_phase(prober, stop_evt, None, args.interval)
+        results["upload"] = upload
+    finally:
+        client.close()
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+        return 0
+
+    print(f"WebSocket {args.probe} round-trip, {args.host}:{args.port}")
+    _print_phase("baseline", results["baseline"])
+    _print_phase("during OTA", results["during_ota"])
+    up = results["upload"]
+    print(f"  upload: {up.get('status')} ({up.get('bytes_sent', 0)} bytes in {up.get('seconds')}s)")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,587 @@
+#!/usr/bin/env python3
+"""Replay recorded userscript sessions against the firmware as a load test.
+
+Recordings are made by the simulator: start it with OTS_RECORD_DIR set and
+point the userscript at it; every userscript connection is written to one
+`.otsrec` file (see ots-simulator/server/utils/session-recorder.ts):
+
+  #otsrec 1 <start epoch ms>
+  <ms since previous frame> <frame JSON>
+
+This script replays a recording at one or more speed multipliers against a
+device (wss://) or the simulator (--plain, ws://) and, for each speed,
+reports:
+
+- throughput: frames and events sent, achieved events/s, send lag (how far
+  behind schedule frames went out; grows when the device stops reading)
+- echo latency: WebSocket PING -> PONG (transport path)
+- ACK latency: "hardware-diagnostic" -> HARDWARE_DIAGNOSTIC reply (full path:
+  frame parse, command handling, send queue), probed during the replay
+- firmware counters from the diagnostic reply, diffed over the run: dropped
+  events (event queue), dropped sends (WS send queue), sequence gaps,
+  receive cost per event (wsRx) and CPU load per core (cpu)
+- resync requests (request-snapshot commands) the device sent
+
+Event `seq` numbers are rewritten so each run is one gap-free stream; gaps
+reported by the device are therefore real losses.
+
+Reports are JSON (--report) and can be compared across firmware versions
+(--compare baseline.json): metrics that got worse by more than --threshold
+are flagged and the exit code is 2.
+
+Examples:
+
+  # Record: OTS_RECORD_DIR=recordings npm run dev   (in ots-simulator)
+
+  python3 tools/tests/ws_replay_load.py --host 192.168.1.50 \\
+    --recording recordings/session-2026-01-10T12-00-00-000Z.otsrec \\
+    --speeds 1,4,16 --report baseline.json
+
+  # Same load against a new firmware build, compared with the baseline
+  python3 tools/tests/ws_replay_load.py --host 192.168.1.50 \\
+    --recording recordings/session-2026-01-10T12-00-00-000Z.otsrec \\
+    --speeds 1,4,16 --report new.json --compare baseline.json
+
+  # Against the simulator on this machine
+  python3 tools/tests/ws_replay_load.py --host localhost --plain \\
+    --recording session.otsrec --speeds 1
+
+"""
+
+from __future__ import annotations
+
+import argparse
+import datetime
+import gzip
+import hashlib
+import json
+import os
+import select
+import socket
+import statistics
+import sys
+import time
+from collections import deque
+from dataclasses import dataclass
+from typing import Any, Optional
+
+
+def _ensure_repo_root_on_syspath() -> None:
+    repo_root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+    if repo_root not in sys.path:
+        sys.path.insert(0, repo_root)
+
+
+_ensure_repo_root_on_syspath()
+
+
+from tools.ots_device_tool import WsClient  # noqa: E402
+
+
+REPORT_FORMAT = 1
+RECORDING_MAGIC = "#otsrec"
+RECORDING_VERSION = 1
+
+
+# ---------------------------------------------------------------------------
+# Recording
+# ---------------------------------------------------------------------------
+
+
+@dataclass
+class Recording:
+    name: str
+    sha1: str
+    frames: list[tuple[int, dict[str, Any]]]  # (ms since previous frame, message)
+
+    @property
+    def events(self) -> int:
+        return sum(_event_count(msg) for _, msg in self.frames)
+
+    @property
+    def duration_s(self) -> float:
+        return sum(delta for delta, _ in self.frames) / 1000.0
+
+
+def _event_count(msg: dict[str, Any]) -> int:
+    if msg.get("type") == "event":
+        return 1
+    if msg.get("type") == "batch":
+        return len(msg.get("payload", {}).get("events", []))
+    return 0
+
+
+def load_recording(path: str) -> Recording:
+    opener = gzip.open if path.endswith(".gz") else open
+    with opener(path, "rb") as f:
+        raw = f.read()
+
+    lines = raw.decode("utf-8").splitlines()
+    if not lines or not lines[0].startswith(RECORDING_MAGIC):
+        raise ValueError(f"{path}: not an .otsrec recording")
+    header = lines[0].split()
+    if len(header) < 2 or header[1] != str(RECORDING_VERSION):
+        raise ValueError(f"{path}: unsupported recording version {header[1:2]}")
+
+    frames: list[tuple[int, dict[str, Any]]] = []
+    for lineno, line in enumerate(lines[1:], start=2):
+        if not line.strip():
+            continue
+        delta, _, text = line.partition(" ")
+        try:
+            frames.append((int(delta), json.loads(text)))
+        except (ValueError, json.JSONDecodeError) as e:
+            raise ValueError(f"{path}:{lineno}: bad frame: {e}") from e
+
+    return Recording(name=os.path.basename(path), sha1=hashlib.sha1(raw).hexdigest(), frames=frames)
+
+
+@dataclass
+class ScheduledFrame:
+    due_s: float
+    text: str
+    events: int
+
+
+def schedule(rec: Recording, speed: float, max_gap_ms: int, loops: int) -> list[ScheduledFrame]:
+    """Time-compress the recording and renumber seq across all loops."""
+    out: list[ScheduledFrame] = []
+    t_ms = 0.0
+    seq = 0
+    for _ in range(loops):
+        for delta, msg in rec.frames:
+            t_ms += min(delta, max_gap_ms) / speed
+            msg = json.loads(json.dumps(msg))  # private copy per loop
+            payload = msg.get("payload", {})
+            if msg.get("type") == "event":
+                seq += 1
+                payload["seq"] = seq
+            elif msg.get("type") == "batch":
+                for event in payload.get("events", []):
+                    seq += 1
+                    event["seq"] = seq
+            elif msg.get("type") == "snapshot":
+                payload["seq"] = seq
+            out.append(ScheduledFrame(t_ms / 1000.0, json.dumps(msg, separators=(",", ":")), _event_count(msg)))
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Statistics helpers
+# ---------------------------------------------------------------------------
+
+
+def _summary(samples: list[float], timeouts: Optional[int] = None) -> dict[str, Any]:
+    out: dict[str, Any] = {"n": len(samples)}
+    if timeouts is not None:
+        out["timeouts"] = timeouts
+    if not samples:
+        return out
+    ordered = sorted(samples)
+    p95 = ordered[min(len(ordered) - 1, int(round(0.95 * (len(ordered) - 1))))]
+    out.update(
+        {
+            "median_ms": round(statistics.median(ordered), 2),
+            "p95_ms": round(p95, 2),
+            "max_ms": round(ordered[-1], 2),
+        }
+    )
+    return out
+
+
+def _diff(after: dict[str, Any], before: dict[str, Any], key: str) -> Optional[int]:
+    if key not in after or key not in before:
+        return None
+    return int(after[key]) - int(before[key])
+
+
+def _cpu_busy(before: dict[str, Any], after: dict[str, Any]) -> Optional[list[float]]:
+    """Per-core busy % between two diagnostic samples (idle counters wrap at 2^32)."""
+    b, a = before.get("cpu"), after.get("cpu")
+    if not b or not a:
+        return None
+    window = float(a["uptimeUs"]) - float(b["uptimeUs"])
+    if window <= 0:
+        return None
+    busy = []
+    for idle_a, idle_b in zip(a.get("idleUs", []), b.get("idleUs", [])):
+        idle = (int(idle_a) - int(idle_b)) % (1 << 32)
+        busy.append(round(max(0.0, 100.0 - 100.0 * idle / window), 1))
+    return busy
+
+
+# ---------------------------------------------------------------------------
+# Replay
+# ---------------------------------------------------------------------------
+
+
+class Replayer:
+    def __init__(self, client: WsClient, probe_interval_s: float, probe_timeout_s: float):
+        self.client = client
+        self.probe_interval_s = probe_interval_s
+        self.probe_timeout_s = probe_timeout_s
+        self._token = 0
+        self._pings: dict[bytes, float] = {}
+        self._diags: deque[float] = deque()
+        self.echo_ms: list[float] = []
+        self.ack_ms: list[float] = []
+        self.diag_samples: list[dict[str, Any]] = []
+        self.resyncs = 0
+
+    def reset(self) -> None:
+        self._pings.clear()
+        self._diags.clear()
+        self.echo_ms = []
+        self.ack_ms = []
+        self.diag_samples = []
+        self.resyncs = 0
+
+    # -- receive ------------------------------------------------------------
+
+    def _readable(self, wait_s: float) -> bool:
+        sock = self.client.tls
+        pending = getattr(sock, "pending", None)
+        if pending is not None and pending() > 0:
+            return True
+        r, _, _ = select.select([sock], [], [], max(0.0, wait_s))
+        return bool(r)
+
+    def _handle(self, frame) -> None:
+        now = time.perf_counter()
+        if frame.opcode == 0x9:
+            self.client.send_frame(0xA, frame.payload)
+            return
+        if frame.opcode == 0xA:
+            t0 = self._pings.pop(frame.payload, None)
+            if t0 is not None:
+                self.echo_ms.append((now - t0) * 1000.0)
+            return
+        if frame.opcode != 0x1:
+            return
+        try:
+            msg = json.loads(frame.payload.decode("utf-8"))
+        except (UnicodeDecodeError, json.JSONDecodeError):
+            return
+        payload = msg.get("payload", {})
+        if msg.get("type") == "cmd" and payload.get("action") == "request-snapshot":
+            self.resyncs += 1
+        elif payload.get("type") == "HARDWARE_DIAGNOSTIC":
+            data = payload.get("data", {})
+            if isinstance(data, str):
+                data = json.loads(data)
+            if self._diags:
+                self.ack_ms.append((now - self._diags.popleft()) * 1000.0)
+            self.diag_samples.append(data)
+
+    def pump(self, wait_s: float) -> None:
+        """Handle incoming frames for up to wait_s."""
+        end_by = time.perf_counter() + wait_s
+        while True:
+            left = end_by - time.perf_counter()
+            if not self._readable(max(0.0, left)):
+                return
+            try:
+                self._handle(self.client.recv_frame(timeout_s=max(self.probe_timeout_s, 1.0)))
+            except (socket.timeout, TimeoutError):
+                return
+            if left <= 0:
+                # Drain what is already buffered, then go back to sending
+                if not self._readable(0.0):
+                    return
+
+    # -- probes -------------------------------------------------------------
+
+    def probe(self) -> None:
+        self._token += 1
+        token = self._token.to_bytes(4, "big")
+        self._pings[token] = time.perf_counter()
+        self.client.send_frame(0x9, token)
+        self._diags.append(time.perf_counter())
+        self.client.send_text(json.dumps({"type": "cmd", "payload": {"action": "hardware-diagnostic"}}))
+
+    def diag(self) -> Optional[dict[str, Any]]:
+        """Blocking diagnostic read (before/after a run)."""
+        count = len(self.diag_samples)
+        self._diags.append(time.perf_counter())
+        self.client.send_text(json.dumps({"type": "cmd", "payload": {"action": "hardware-diagnostic"}}))
+        end_by = time.perf_counter() + self.probe_timeout_s
+        while len(self.diag_samples) == count and time.perf_counter() < end_by:
+            self.pump(end_by - time.perf_counter())
+        return self.diag_samples[-1] if len(self.diag_samples) > count else None
+
+    def timeouts(self) -> tuple[int, int]:
+        return len(self._pings), len(self._diags)
+
+    # -- run ----------------------------------------------------------------
+
+    def run(self, frames: list[ScheduledFrame], settle_s: float) -> dict[str, Any]:
+        self.reset()
+        before = self.diag()
+        # Only latency samples taken during the replay count
+        self.ack_ms = []
+        samples_before = len(self.diag_samples)
+
+        lag_ms: list[float] = []
+        events = 0
+        start = time.perf_counter()
+        next_probe = start
+        for frame in frames:
+            due = start + frame.due_s
+            while True:
+                now = time.perf_counter()
+                if now >= next_probe:
+                    self.probe()
+                    next_probe += self.probe_interval_s
+                    continue
+                if now >= due:
+                    break
+                self.pump(min(due, next_probe) - now)
+            self.client.send_text(frame.text)
+            lag_ms.append((time.perf_counter() - due) * 1000.0)
+            events += frame.events
+            self.pump(0.0)
+        sent_s = max(time.perf_counter() - start, 1e-6)
+
+        # Let outstanding probes and queued events finish
+        self.pump(settle_s)
+        during = self.diag_samples[samples_before:]
+        after = self.diag()
+        lost_pings, lost_diags = self.timeouts()
+
+        result: dict[str, Any] = {
+            "frames": len(frames),
+            "events": events,
+            "seconds": round(sent_s, 2),
+            "events_per_s": round(events / sent_s, 1),
+            "send_lag": _summary(lag_ms),
+            "echo": _summary(self.echo_ms, lost_pings),
+            "ack": _summary(self.ack_ms, lost_diags),
+            "resyncs": self.resyncs,
+            "device": None,
+        }
+        if before and after:
+            result["device"] = self._device_delta(before, after, during)
+        return result
+
+    @staticmethod
+    def _device_delta(before: dict[str, Any], after: dict[str, Any], during: list[dict[str, Any]]) -> dict[str, Any]:
+        disp_b, disp_a = before.get("dispatcher", {}), after.get("dispatcher", {})
+        rx_b, rx_a = before.get("wsRx", {}), after.get("wsRx", {})
+        out: dict[str, Any] = {
+            "dropped": _diff(disp_a, disp_b, "dropped"),
+            "send_dropped": _diff(disp_a, disp_b, "sendDropped"),
+            "seq_gaps": _diff(disp_a, disp_b, "seqGaps"),
+            "rx_events": _diff(rx_a, rx_b, "events"),
+            "us_per_event": None,
+            "cpu_busy": _cpu_busy(before, after),
+            "cpu_busy_peak": None,
+        }
+        busy_us = _diff(rx_a, rx_b, "busyUs")
+        if busy_us is not None and out["rx_events"]:
+            out["us_per_event"] = round(busy_us / out["rx_events"], 1)
+
+        # Highest per-core load between consecutive probes
+        peak: Optional[list[float]] = None
+        points = [before] + during + [after]
+        for prev, cur in zip(points, points[1:]):
+            busy = _cpu_busy(prev, cur)
+            if busy is None:
+                continue
+            peak = busy if peak is None else [max(p, b) for p, b in zip(peak, busy)]
+        out["cpu_busy_peak"] = peak
+        return out
+
+
+# ---------------------------------------------------------------------------
+# Report comparison
+# ---------------------------------------------------------------------------
+
+# (label, path into a run, lower_is_better, absolute tolerance)
+METRICS: list[tuple[str, tuple[str, ...], bool, float]] = [
+    ("events/s", ("events_per_s",), False, 0.0),
+    ("send lag p95 ms", ("send_lag", "p95_ms"), True, 5.0),
+    ("echo p95 ms", ("echo", "p95_ms"), True, 2.0),
+    ("echo timeouts", ("echo", "timeouts"), True, 0.0),
+    ("ack p95 ms", ("ack", "p95_ms"), True, 2.0),
+    ("ack timeouts", ("ack", "timeouts"), True, 0.0),
+    ("resyncs", ("resyncs",), True, 0.0),
+    ("dropped events", ("device", "dropped"), True, 0.0),
+    ("dropped sends", ("device", "send_dropped"), True, 0.0),
+    ("seq gaps", ("device", "seq_gaps"), True, 0.0),
+    ("us/event", ("device", "us_per_event"), True, 5.0),
+    ("cpu busy % (max core)", ("device", "cpu_busy", "max"), True, 2.0),
+    ("cpu peak % (max core)", ("device", "cpu_busy_peak", "max"), True, 5.0),
+]
+
+
+def _metric(run: dict[str, Any], path: tuple[str, ...]) -> Optional[float]:
+    value: Any = run
+    for key in path:
+        if key == "max" and isinstance(value, list):
+            value = max(value) if value else None
+        elif isinstance(value, dict):
+            value = value.get(key)
+        else:
+            return None
+        if value is None:
+            return None
+    return float(value)
+
+
+def compare(report: dict[str, Any], baseline: dict[str, Any], threshold: float) -> list[str]:
+    """Print a comparison table; return the regressions."""
+    if baseline.get("recording", {}).get("sha1") != report["recording"]["sha1"]:
+        print("WARNING: baseline was made with a different recording; numbers may not be comparable")
+
+    base_fw = baseline.get("firmware", {}).get("version", "?")
+    cur_fw = report.get("firmware", {}).get("version", "?")
+    print(f"\nComparison with baseline (firmware {base_fw} -> {cur_fw}, threshold {threshold:.0%})")
+
+    regressions: list[str] = []
+    base_runs = {run["speed"]: run for run in baseline.get("runs", [])}
+    for run in report["runs"]:
+        base = base_runs.get(run["speed"])
+        if base is None:
+            print(f"  x{run['speed']}: no baseline run at this speed")
+            continue
+        print(f"  x{run['speed']}")
+        for label, path, lower_better, tolerance in METRICS:
+            old, new = _metric(base, path), _metric(run, path)
+            if old is None or new is None:
+                continue
+            worse_by = (new - old) if lower_better else (old - new)
+            regressed = worse_by > max(abs(old) * threshold, tolerance)
+            flag = "  REGRESSION" if regressed else ""
+            print(f"    {label:<22} {old:>10.1f} -> {new:>10.1f}{flag}")
+            if regressed:
+                regressions.append(f"x{run['speed']} {label}: {old:g} -> {new:g}")
+    return regressions
+
+
+# ---------------------------------------------------------------------------
+# Output
+# ---------------------------------------------------------------------------
+
+
+def _fmt_latency(s: dict[str, Any]) -> str:
+    if not s.get("n"):
+        return f"no replies ({s.get('timeouts', 0)} timeouts)"
+    return (
+        f"median={s['median_ms']:.1f} p95={s['p95_ms']:.1f} max={s['max_ms']:.1f} ms"
+        + (f" timeouts={s['timeouts']}" if "timeouts" in s else "")
+    )
+
+
+def _print_run(run: dict[str, Any]) -> None:
+    print(
+        f"  x{run['speed']:<5} {run['events']} events / {run['frames']} frames in {run['seconds']}s "
+        f"({run['events_per_s']} events/s), resyncs={run['resyncs']}"
+    )
+    print(f"         send lag: {_fmt_latency(run['send_lag'])}")
+    print(f"         echo:     {_fmt_latency(run['echo'])}")
+    print(f"         ack:      {_fmt_latency(run['ack'])}")
+    dev = run["device"]
+    if dev is None:
+        print("         device:   no diagnostic counters")
+        return
+    print(
+        f"         device:   dropped={dev['dropped']} sendDropped={dev['send_dropped']} "
+        f"seqGaps={dev['seq_gaps']} us/event={dev['us_per_event']} "
+        f"cpu={dev['cpu_busy']} peak={dev['cpu_busy_peak']}"
+    )
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Replay recorded userscript sessions as a firmware load test")
+    ap.add_argument("--host", required=True, help="Device IP or hostname (or simulator host with --plain)")
+    ap.add_argument("--port", type=int, default=3000, help="HTTPS/WSS port (default: 3000)")
+    ap.add_argument("--plain", action="store_true", help="Use ws:// instead of wss:// (simulator)")
+    ap.add_argument("--recording", required=True, help=".otsrec or .otsrec.gz file")
+    ap.add_argument("--speeds", default="1", help="Comma-separated speed multipliers (default: 1)")
+    ap.add_argument("--loops", type=int, default=1, help="Replay the recording this many times per run")
+    ap.add_argument("--max-gap", type=float, default=5.0, help="Clamp idle gaps to this many seconds before scaling")
+    ap.add_argument("--probe-interval", type=float, default=0.5, help="Seconds between latency probes")
+    ap.add_argument("--probe-timeout", type=float, default=3.0, help="Seconds before a probe counts as lost")
+    ap.add_argument("--settle", type=float, default=2.0, help="Seconds to wait after each run")
+    ap.add_argument("--report", help="Write the JSON report to this file")
+    ap.add_argument("--compare", help="Baseline report to compare against")
+    ap.add_argument("--threshold", type=float, default=0.10, help="Relative change counted as regression")
+    ap.add_argument("--json", action="store_true", help="Print the report as JSON")
+    args = ap.parse_args()
+
+    try:
+        rec = load_recording(args.recording)
+        speeds = [float(s) for s in args.speeds.split(",") if s.strip()]
+    except (OSError, ValueError) as e:
+        print(f"ERROR: {e}", file=sys.stderr)
+        return 1
+    if not speeds or any(s <= 0 for s in speeds):
+        print("ERROR: --speeds must be positive numbers", file=sys.stderr)
+        return 1
+
+    client = WsClient(host=args.host, port=args.port, path="/ws", insecure=True, use_tls=not args.plain)
+    try:
+        client.connect()
+    except OSError as e:
+        print(f"ERROR: WebSocket connect failed: {e}", file=sys.stderr)
+        return 1
+
+    # Probes are tiny frames; don't let Nagle add delayed-ACK waits to them
+    client.tls.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    replayer = Replayer(client, args.probe_interval, args.probe_timeout)
+    report: dict[str, Any] = {
+        "format": REPORT_FORMAT,
+        "created": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "host": args.host,
+        "target": "simulator" if args.plain else "device",
+        "firmware": {},
+        "recording": {
+            "name": rec.name,
+            "sha1": rec.sha1,
+            "frames": len(rec.frames),
+            "events": rec.events,
+            "seconds": round(rec.duration_s, 1),
+        },
+        "settings": {"loops": args.loops, "max_gap_s": args.max_gap, "probe_interval_s": args.probe_interval},
+        "runs": [],
+    }
+
+    try:
+        client.send_text(json.dumps({"type": "handshake", "clientType": "userscript"}))
+        replayer.pump(0.5)
+        info = replayer.diag() or {}
+        report["firmware"] = {k: info.get(k) for k in ("version", "deviceType") if k in info}
+
+        for speed in speeds:
+            frames = schedule(rec, speed, int(args.max_gap * 1000), args.loops)
+            run = replayer.run(frames, args.settle)
+            run["speed"] = speed
+            report["runs"].append(run)
+            if not args.json:
+                _print_run(run)
+    finally:
+        client.close()
+
+    if args.report:
+        with open(args.report, "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2)
+
+    if args.json:
+        print(json.dumps(report, indent=2))
+
+    if args.compare:
+        try:
+            with open(args.compare, "r", encoding="utf-8") as f:
+                baseline = json.load(f)
+        except (OSError, json.JSONDecodeError) as e:
+            print(f"ERROR: cannot read baseline: {e}", file=sys.stderr)
+            return 1
+        regressions = compare(report, baseline, args.threshold)
+        if regressions:
+            print(f"\n{len(regressions)} regression(s)")
+            return 2
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -117,7 +117,7 @@ void can_audio_build_stop_all(can_frame_t *frame) {
 
 void can_audio_build_sound_status(uint8_t state_bits, uint16_t current_sound, 
                                   uint8_t error_code, uint8_t volume, uint16_t uptime,
-                                  can_frame_t *frame) {
+                                  uint8_t active_sources, can_frame_t *frame) {
     memset(frame, 0, sizeof(can_frame_t));
     
     frame->id = CAN_ID_SOUND_STATUS;
@@ -142,8 +142,42 @@ void can_audio_build_sound_status(uint8_t state_bits, uint16_t current_sound,
     frame->data[5] = uptime & 0xFF;
     frame->data[6] = (uptime >> 8) & 0xFF;
     
-    // Byte 7: Active source count (could be added here)
-    frame->data[7] = 0;
+    // Byte 7: Active source count
+    frame->data[7] = active_sources;
+}
+
+void can_audio_build_sound_perf(const can_audio_perf_t *perf, can_frame_t *frame) {
+    memset(frame, 0, sizeof(can_frame_t));
+    
+    frame->id = CAN_ID_SOUND_PERF;
+    frame->extended = false;
+    frame->rtr = false;
+    frame->dlc = 8;
+    
+    frame->data[0] = perf->min_voice_fill;
+    frame->data[1] = perf->loop_p99;
+    frame->data[2] = perf->underruns;
+    frame->data[3] = perf->voice_starved;
+    frame->data[4] = perf->decoder_cpu;
+    frame->data[5] = perf->heap_free_4k;
+    frame->data[6] = perf->psram_free;
+    frame->data[7] = perf->last_ttfs_ms;
+}
+
+bool can_audio_parse_sound_perf(const can_frame_t *frame, can_audio_perf_t *perf) {
+    if (!frame || frame->id != CAN_ID_SOUND_PERF || frame->dlc < 8 || !perf) {
+        return false;
+    }
+    
+    perf->min_voice_fill = frame->data[0];
+    perf->loop_p99 = frame->data[1];
+    perf->underruns = frame->data[2];
+    perf->voice_starved = frame->data[3];
+    perf->decoder_cpu = frame->data[4];
+    perf->heap_free_4k = frame->data[5];
+    perf->psram_free = frame->data[6];
+    perf->last_ttfs_ms = frame->data[7];
+    return true;
 }
 
 void can_audio_build_sound_ack(uint8_t ok, uint16_t sound_index, uint8_t queue_id,
@@ -27,7 +27,8 @@
 #define CAN_ID_STOP_ACK         0x424  // audio → main (STOP acknowledgment)
 #define CAN_ID_SOUND_FINISHED   0x425  // audio → main (sound playback finished)
 #define CAN_ID_SOUND_STATUS     0x426  // audio → main (periodic status - future enhancement)
-// 0x427-0x42F: Reserved for future audio features
+#define CAN_ID_SOUND_PERF       0x427  // audio → main (real-time metrics, sent with STATUS)
+// 0x428-0x42F: Reserved for future audio features
 
 // ============================================================================
 // PLAY_SOUND MESSAGE (0x420)
@@ -56,6 +57,27 @@
 #define CAN_AUDIO_STATUS_MUTED        (1 << 3)  // Muted by hardware switch
 #define CAN_AUDIO_STATUS_ERROR        (1 << 4)  // Error state
 
+// ============================================================================
+// SOUND_PERF MESSAGE (0x427)
+// ============================================================================
+
+#define CAN_AUDIO_PERF_NONE           0xFF      // Field not available (no voice / no PSRAM)
+#define CAN_AUDIO_PERF_HEAP_UNIT      4096      // heap_free_4k unit: up to 1016 KiB before saturating
+
+/**
+ * @brief Audio module real-time metrics (one byte each, saturating at 254)
+ */
+typedef struct {
+    uint8_t min_voice_fill;     // Lowest stream buffer fill of playing voices, % (0xFF = none)
+    uint8_t loop_p99;           // Mixer pass time p99, % of the block's real-time budget
+    uint8_t underruns;          // I2S underruns while voices were mixed
+    uint8_t voice_starved;      // Mixer passes where a voice's decoder fell behind
+    uint8_t decoder_cpu;        // Decoder CPU time since the last STATUS, % of one core
+    uint8_t heap_free_4k;       // Free internal heap, 4 KiB units (CAN_AUDIO_PERF_HEAP_UNIT)
+    uint8_t psram_free;         // Free PSRAM, % (0xFF = no PSRAM)
+    uint8_t last_ttfs_ms;       // Time to first sample of the last play, ms
+} can_audio_perf_t;
+
 // ============================================================================
 // SPECIAL VALUES
 // ============================================================================
@@ -203,11 +225,27 @@ void can_audio_build_stop_all(can_frame_t *frame);
  * @param error_code Last error code (CAN_AUDIO_ERR_*)
  * @param volume Current master volume (0-100)
  * @param uptime Uptime in seconds (wraps at 65535)
+ * @param active_sources Number of active mixer sources
  * @param frame Output frame
  */
 void can_audio_build_sound_status(uint8_t state_bits, uint16_t current_sound, 
                                   uint8_t error_code, uint8_t volume, uint16_t uptime,
-                                  can_frame_t *frame);
+                                  uint8_t active_sources, can_frame_t *frame);
+
+/**
+ * @brief Build a SOUND_PERF frame
+ * @param perf Metrics
+ * @param frame Output frame
+ */
+void can_audio_build_sound_perf(const can_audio_perf_t *perf, can_frame_t *frame);
+
+/**
+ * @brief Parse a SOUND_PERF frame
+ * @param frame CAN frame
+ * @param perf Output metrics
+ * @return true if valid SOUND_PERF frame
+ */
+bool can_audio_parse_sound_perf(const can_frame_t *frame, can_audio_perf_t *perf);
 
 /**
  * @brief Build a SOUND_ACK frame
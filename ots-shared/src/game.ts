@@ -6,6 +6,8 @@ export type GamePhase = 'lobby' | 'spawning' | 'in-game' | 'game-won' | 'game-lo
 
 export type NukeType = 'atom' | 'hydro' | 'mirv'
 
+export type NukeDirection = 'in' | 'out'
+
 // ============================================================================
 // Command Types (UI/HW -> Userscript/Firmware)
 // ============================================================================
@@ -14,6 +16,8 @@ export type KnownCommandParamsByAction = {
   ping: undefined
   'send-nuke': { nukeType: NukeType }
   'set-attack-ratio': { ratio: number }
+  'request-snapshot': { reason?: string } | undefined
+  'flow-control': { troopIntervalMs: number }
 }
 
 export type KnownCommandAction = keyof KnownCommandParamsByAction
@@ -53,6 +57,20 @@ export type TroopsData = {
   max: number
 }
 
+/**
+ * TROOP_UPDATE data. Only fields that changed since the previous update are
+ * present; receivers keep their last value for the others. A full update
+ * (every field) is sent when monitoring starts.
+ */
+export type TroopUpdateEventData = {
+  currentTroops?: number
+  maxTroops?: number
+  attackRatio?: number
+  attackRatioPercent?: number
+  troopsToSend?: number
+  timestamp: number
+}
+
 export type GameState = {
   timestamp: number
   mapName: string
@@ -70,6 +88,33 @@ export type GameEvent = {
   timestamp: number
   message?: string
   data?: unknown
+  /** Per-connection sequence number, set by the userscript client (starts at 1) */
+  seq?: number
+}
+
+// ============================================================================
+// Snapshot Types
+// ============================================================================
+
+/** Compact in-flight nuke entry: [unitID, nukeType, direction] */
+export type SnapshotNuke = [unitID: number, nukeType: NukeType, direction: NukeDirection]
+
+/**
+ * Full game state, sent on connect and when the receiver requests a resync.
+ * Replaces everything derived from earlier events.
+ */
+export type GameSnapshot = {
+  version: typeof PROTOCOL_CONSTANTS.SNAPSHOT_VERSION
+  /** Sequence number of the last event sent before this snapshot */
+  seq: number
+  timestamp: number
+  phase: GamePhase
+  troops?: TroopsData
+  /** Attack ratio slider (0-1) */
+  attackRatio?: number
+  nukes: SnapshotNuke[]
+  /** Active invasions targeting the player */
+  alerts: { land: number; naval: number }
 }
 
 export type SoundPriority = 'low' | 'normal' | 'high'
@@ -103,6 +148,11 @@ export type HardwareDiagnosticData = {
     adc: HardwareComponentStatus
     soundModule: HardwareComponentStatus
   }
+  /** Cumulative load-test counters (firmware only); diff two reports */
+  wsRx?: { frames: number; events: number; batches: number; busyUs: number }
+  dispatcher?: { dropped: number; queued: number; sendDropped?: number; seqGaps: number }
+  /** Per-core idle time, wraps at 2^32 */
+  cpu?: { uptimeUs: number; idleUs: number[] }
 }
 
 // ============================================================================
@@ -134,6 +184,11 @@ export type CmdMessage<Action extends string = string, Params = unknown> = {
 
 export type AckMessage = { type: 'ack'; payload?: unknown }
 
+export type SnapshotMessage = { type: 'snapshot'; payload: GameSnapshot }
+
+/** Several events in one frame (same order and seq numbering as separate `event` messages) */
+export type BatchMessage = { type: 'batch'; payload: { events: GameEvent[] } }
+
 export type WsMessage =
   | HandshakeMessage
   | HandshakeAckMessage
@@ -141,10 +196,14 @@ export type WsMessage =
   | EventMessage
   | CmdMessage
   | AckMessage
+  | SnapshotMessage
+  | BatchMessage
 
 export type IncomingMessage =
   | { type: 'state'; payload: GameState }
   | { type: 'event'; payload: GameEvent }
+  | { type: 'snapshot'; payload: GameSnapshot }
+  | BatchMessage
 
 export type OutgoingMessage =
   | { type: 'cmd'; payload: { action: string; params?: unknown } }
@@ -169,6 +228,17 @@ export const PROTOCOL_CONSTANTS = {
   INFO_MESSAGE_USERSCRIPT_DISCONNECTED: 'userscript-disconnected',
   INFO_MESSAGE_NUKE_SENT: 'Nuke sent',
 
+  // Most events per `batch` message (firmware decodes at most this many)
+  BATCH_MAX_EVENTS: 16,
+
+  // State snapshot format version (bump on incompatible changes)
+  SNAPSHOT_VERSION: 1,
+
+  // TROOP_UPDATE pacing until the receiver sends `flow-control`
+  TROOP_UPDATE_DEFAULT_INTERVAL_MS: 200,
+  TROOP_UPDATE_MIN_INTERVAL_MS: 100,
+  TROOP_UPDATE_MAX_INTERVAL_MS: 5000,
+
   // Heartbeat configuration
   HEARTBEAT_INTERVAL_MS: 5000,
   RECONNECT_DELAY_MS: 2000,
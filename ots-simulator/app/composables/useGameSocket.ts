@@ -1,6 +1,6 @@
 import { computed, ref, watch, watchEffect } from 'vue'
 import { useWebSocket } from '@vueuse/core'
-import type { GameEvent, IncomingMessage, OutgoingMessage, NukeType, NukeSentEventData, TroopsData, GamePhase } from '../../../ots-shared/src/game'
+import type { GameEvent, GameSnapshot, IncomingMessage, OutgoingMessage, NukeType, NukeSentEventData, TroopsData, TroopUpdateEventData, GamePhase } from '../../../ots-shared/src/game'
 import { PROTOCOL_CONSTANTS } from '../../../ots-shared/src/game'
 
 const WS_URL =
@@ -259,6 +259,13 @@ export function useGameSocket() {
         if (msg.payload.troops) {
           troops.value = msg.payload.troops
         }
+      } else if (msg.type === 'snapshot') {
+        applySnapshot(msg.payload)
+      } else if (msg.type === 'batch') {
+        // Same handling as the events arriving one by one, in order
+        for (const event of msg.payload.events) {
+          processMessage({ type: 'event', payload: event })
+        }
       } else if (msg.type === 'event') {
         events.value = [msg.payload, ...events.value]
 
@@ -329,11 +336,13 @@ export function useGameSocket() {
 
         // Handle troop update events
         if (msg.payload.type === 'TROOP_UPDATE') {
-          const data = msg.payload.data as any
-          if (data && typeof data.currentTroops === 'number' && typeof data.maxTroops === 'number') {
-            troops.value = {
-              current: data.currentTroops,
-              max: data.maxTroops
+          // Delta update: only changed fields are present, keep the rest
+          const data = msg.payload.data as Partial<TroopUpdateEventData> | undefined
+          if (data) {
+            const current = typeof data.currentTroops === 'number' ? data.currentTroops : troops.value?.current
+            const max = typeof data.maxTroops === 'number' ? data.maxTroops : troops.value?.max
+            if (current !== undefined && max !== undefined) {
+              troops.value = { current, max }
             }
             // Update attack ratio if provided (convert from 0-1 to 0-100)
             if (typeof data.attackRatioPercent === 'number') {
@@ -433,6 +442,42 @@ export function useGameSocket() {
     }
   }
 
+  // Replace all event-derived state with a userscript snapshot (like the firmware does)
+  const applySnapshot = (snapshot: GameSnapshot) => {
+    if (snapshot.version !== PROTOCOL_CONSTANTS.SNAPSHOT_VERSION) {
+      console.warn(`[Snapshot] Ignoring unsupported version ${snapshot.version}`)
+      return
+    }
+
+    gamePhase.value = snapshot.phase
+    lastUserscriptHeartbeat.value = Date.now()
+    lastUserscriptHeartbeatId.value++
+
+    if (snapshot.troops) {
+      troops.value = snapshot.troops
+    }
+    if (typeof snapshot.attackRatio === 'number') {
+      attackRatio.value = Math.round(snapshot.attackRatio * 100)
+    }
+
+    trackedNukes.value.clear()
+    Object.keys(activeAlerts.value).forEach(key => {
+      activeAlerts.value[key as keyof typeof activeAlerts.value] = false
+    })
+    alertTimers.forEach(timer => clearTimeout(timer))
+    alertTimers.clear()
+
+    for (const [unitID, nukeType, direction] of snapshot.nukes) {
+      if (direction === 'out') {
+        trackNukeLaunch(String(unitID), nukeType)
+      } else {
+        startAlert(nukeType)
+      }
+    }
+    if (snapshot.alerts.land > 0) startAlert('land')
+    if (snapshot.alerts.naval > 0) startAlert('naval')
+  }
+
   const startAlert = (alertType: 'atom' | 'hydro' | 'mirv' | 'land' | 'naval') => {
     // Clear existing timer if any
     const existingTimer = alertTimers.get(alertType)
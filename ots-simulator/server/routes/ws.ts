@@ -1,10 +1,14 @@
 import { defineWebSocketHandler } from 'h3'
 import type { IncomingMessage, OutgoingMessage } from '../../../ots-shared/src/game'
 import { PROTOCOL_CONSTANTS } from '../../../ots-shared/src/game'
+import { recordFrame, startRecording, stopRecording } from '../utils/session-recorder'
 
 // Track peer types using a Map
 const peerTypes = new Map<string, 'ui' | 'userscript' | 'unknown'>()
 
+// Latest userscript snapshot, replayed to UI clients when they connect
+let lastSnapshot: string | null = null
+
 export default defineWebSocketHandler({
   async open(peer) {
     // Default to userscript unless identified as UI via handshake
@@ -22,6 +26,7 @@ export default defineWebSocketHandler({
 
     // If a userscript disconnects, notify all UI clients
     if (clientType === 'userscript') {
+      lastSnapshot = null
       const disconnectEvent = JSON.stringify({
         type: 'event',
         payload: {
@@ -35,6 +40,7 @@ export default defineWebSocketHandler({
     }
 
     // Clean up peer type tracking
+    stopRecording(peer.id)
     peerTypes.delete(peer.id)
   },
 
@@ -47,6 +53,7 @@ export default defineWebSocketHandler({
 
     try {
       const parsed = JSON.parse(text)
+      recordFrame(peer.id, parsed.type, text)
 
       // Check for handshake message to identify client type
       if (parsed.type === 'handshake' && parsed.clientType) {
@@ -60,6 +67,11 @@ export default defineWebSocketHandler({
           // UI clients need to subscribe to UI channel and unsubscribe from userscript
           peer.subscribe('ui')
           peer.unsubscribe('userscript')
+
+          // Bring the new UI up to date without waiting for the next snapshot
+          if (lastSnapshot) {
+            peer.send(lastSnapshot)
+          }
         } else {
           console.log(`[ws] handshake ${peer.id} confirmed as ${clientType}`)
         }
@@ -69,6 +81,7 @@ export default defineWebSocketHandler({
 
         // If a userscript connects, notify all UI clients
         if (clientType === 'userscript') {
+          startRecording(peer.id)
           const connectEvent = JSON.stringify({
             type: 'event',
             payload: {
@@ -84,6 +97,19 @@ export default defineWebSocketHandler({
         return
       }
 
+      // Full state snapshot from userscript: cache and relay like events
+      if (parsed.type === 'snapshot') {
+        lastSnapshot = text
+        peer.publish('broadcast', text)
+        return
+      }
+
+      // Several userscript events in one frame: relay as-is, UI unpacks it
+      if (parsed.type === 'batch') {
+        peer.publish('broadcast', text)
+        return
+      }
+
       // Check if it's an incoming message (event from userscript)
       if (parsed.type === 'event') {
         const msg = parsed as IncomingMessage
@@ -0,0 +1,101 @@
+import { createWriteStream, mkdirSync, type WriteStream } from 'node:fs'
+import { join } from 'node:path'
+
+/**
+ * Userscript session recorder for load testing
+ *
+ * Enabled by setting OTS_RECORD_DIR. Every userscript connection writes one
+ * `.otsrec` file with the frames it sent, which
+ * `ots-fw-main/tools/tests/ws_replay_load.py` replays against a device.
+ *
+ * Format (text, one frame per line, appendable and diffable):
+ *
+ *   #otsrec 1 <start epoch ms>
+ *   <ms since previous frame> <frame JSON>
+ *
+ * Frames are stored as received; the replayer renumbers `seq`.
+ * Gzip the file for storage, the replayer reads `.otsrec.gz` as well.
+ */
+
+export const RECORDING_FORMAT_VERSION = 1
+
+// Frame types worth replaying (handshakes are re-sent by the replayer)
+const RECORDED_TYPES = new Set(['event', 'batch', 'snapshot'])
+
+class SessionRecording {
+  private stream: WriteStream
+  private lastMs: number
+  failed = false
+  frames = 0
+
+  constructor(readonly path: string, onError: (err: Error) => void) {
+    this.lastMs = Date.now()
+    this.stream = createWriteStream(path, { flags: 'w' })
+    // Unwritable directory, full disk, ...: an unhandled 'error' would take the server down
+    this.stream.on('error', (err) => {
+      this.failed = true
+      onError(err)
+    })
+    this.stream.write(`#otsrec ${RECORDING_FORMAT_VERSION} ${this.lastMs}\n`)
+  }
+
+  write(text: string) {
+    if (this.failed) return
+    const now = Date.now()
+    // JSON.stringify never emits raw newlines, but frames from other senders might
+    this.stream.write(`${now - this.lastMs} ${text.replace(/\n/g, ' ')}\n`)
+    this.lastMs = now
+    this.frames++
+  }
+
+  close() {
+    this.stream.end()
+  }
+}
+
+const recordings = new Map<string, SessionRecording>()
+
+function recordDir(): string | null {
+  return process.env.OTS_RECORD_DIR || null
+}
+
+/**
+ * Start recording a peer (no-op unless OTS_RECORD_DIR is set)
+ */
+export function startRecording(peerId: string) {
+  const dir = recordDir()
+  if (!dir || recordings.has(peerId)) return
+
+  try {
+    mkdirSync(dir, { recursive: true })
+    const stamp = new Date().toISOString().replace(/[:.]/g, '-')
+    const path = join(dir, `session-${stamp}.otsrec`)
+    const recording = new SessionRecording(path, (err) => {
+      console.error(`[recorder] ${peerId}: recording to ${path} failed, disabled`, err)
+      if (recordings.get(peerId) === recording) recordings.delete(peerId)
+    })
+    recordings.set(peerId, recording)
+    console.log(`[recorder] recording ${peerId} to ${path}`)
+  } catch (err) {
+    console.error('[recorder] failed to start recording', err)
+  }
+}
+
+/**
+ * Record one frame from a peer (ignored if the peer is not being recorded)
+ */
+export function recordFrame(peerId: string, type: string, text: string) {
+  if (!RECORDED_TYPES.has(type)) return
+  recordings.get(peerId)?.write(text)
+}
+
+/**
+ * Stop recording a peer and close its file
+ */
+export function stopRecording(peerId: string) {
+  const recording = recordings.get(peerId)
+  if (!recording) return
+  recording.close()
+  recordings.delete(peerId)
+  console.log(`[recorder] ${peerId}: ${recording.frames} frames in ${recording.path}`)
+}
@@ -18,6 +18,7 @@ export const ATTACK_RATIO_INPUT_SELECTOR = '#attack-ratio'
 export const GAME_POLL_INTERVAL_MS = 100
 export const GAME_INSTANCE_CHECK_INTERVAL_MS = 100
 export const INPUT_LISTENER_RETRY_DELAY_MS = 500
+export const TROOP_POLL_INTERVAL_MS = 100 // Local change detection; sends are paced separately
 
 // ============================================================================
 // Game API Cache
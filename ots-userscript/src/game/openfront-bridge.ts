@@ -1,9 +1,9 @@
-import type { WsClient } from '../websocket/client'
+import type { SnapshotState, WsClient } from '../websocket/client'
 import type { Hud } from '../hud/sidebar-hud'
-import type { GameEvent, KnownCommandPayload, NukeType } from '../../../ots-shared/src/game'
+import type { GamePhase, KnownCommandPayload, NukeType } from '../../../ots-shared/src/game'
 import { waitForElement, createLogger } from '../utils'
 import { createGameAPI, getGameView } from './game-api'
-import { NukeTracker, BoatTracker, LandAttackTracker } from './trackers'
+import { NukeTracker, BoatTracker, LandAttackTracker, TrackerLoop } from './trackers'
 import { TroopMonitor } from './troop-monitor'
 import { processWinUpdate } from './victory-handler'
 import {
@@ -23,6 +23,10 @@ function isSetAttackRatioParams(params: unknown): params is KnownCommandPayload<
   return isRecord(params) && typeof params.ratio === 'number'
 }
 
+function isFlowControlParams(params: unknown): params is KnownCommandPayload<'flow-control'>['params'] {
+  return isRecord(params) && typeof params.troopIntervalMs === 'number' && params.troopIntervalMs > 0
+}
+
 function isSendNukeParams(params: unknown): params is KnownCommandPayload<'send-nuke'>['params'] {
   return isRecord(params) && (params.nukeType === 'atom' || params.nukeType === 'hydro' || params.nukeType === 'mirv')
 }
@@ -32,12 +36,14 @@ export class GameBridge {
   private nukeTracker: NukeTracker
   private boatTracker: BoatTracker
   private landTracker: LandAttackTracker
+  private trackerLoop: TrackerLoop
   private troopMonitor: TroopMonitor
   private gameConnected = false
   private inGame = false
   private inSpawning = false
   private gameAPI = createGameAPI()
   private hasProcessedWin = false
+  private endPhase: 'game-won' | 'game-lost' | null = null
 
   constructor(
     private ws: WsClient,
@@ -46,12 +52,47 @@ export class GameBridge {
     this.nukeTracker = new NukeTracker()
     this.boatTracker = new BoatTracker()
     this.landTracker = new LandAttackTracker()
+    this.trackerLoop = new TrackerLoop([this.nukeTracker, this.boatTracker, this.landTracker])
     this.troopMonitor = new TroopMonitor(this.gameAPI, this.ws)
 
-    // Register event callbacks
-    this.nukeTracker.onEvent((event) => this.handleTrackerEvent(event))
-    this.boatTracker.onEvent((event) => this.handleTrackerEvent(event))
-    this.landTracker.onEvent((event) => this.handleTrackerEvent(event))
+    // All events of one game tick go out together
+    this.trackerLoop.onEvents((events) => this.ws.sendEvents(events))
+
+    // Full state for resync after reconnects or dropped events
+    this.ws.setSnapshotProvider(() => this.getSnapshotState())
+  }
+
+  /**
+   * Current game state for a snapshot message
+   */
+  getSnapshotState(): SnapshotState {
+    let phase: GamePhase = 'lobby'
+    if (this.inGame) {
+      phase = 'in-game'
+    } else if (this.inSpawning) {
+      phase = 'spawning'
+    } else if (this.endPhase) {
+      phase = this.endPhase
+    }
+
+    if (phase !== 'in-game') {
+      return { phase, nukes: [], alerts: { land: 0, naval: 0 } }
+    }
+
+    return {
+      phase,
+      ...this.troopMonitor.getSnapshotState(),
+      nukes: this.nukeTracker.getInFlight(),
+      alerts: {
+        land: this.landTracker.getActiveCount(),
+        naval: this.boatTracker.getActiveCount()
+      }
+    }
+  }
+
+  private sendGameEnd(message: string, data: { victory: boolean; phase: 'game-won' | 'game-lost' } & Record<string, unknown>) {
+    this.endPhase = data.phase
+    this.ws.sendEvent('GAME_END', message, data)
   }
 
   init() {
@@ -177,13 +218,13 @@ export class GameBridge {
               // Handle both cases: team match and team mismatch
               if (myTeam !== null) {
                 if (winnerId === myTeam) {
-                  this.ws.sendEvent('GAME_END', 'Your team won!', { victory: true, phase: 'game-won', method: 'team-victory', myTeam, winnerId })
+                  this.sendGameEnd('Your team won!', { victory: true, phase: 'game-won', method: 'team-victory', myTeam, winnerId })
                   if (this.hud.isSoundEnabled('game_victory')) {
                     this.ws.sendEvent('SOUND_PLAY', 'Victory sound', { soundId: 'game_victory', priority: 'high' })
                   }
                   console.log('[GameBridge] ✓ Your team won!')
                 } else {
-                  this.ws.sendEvent('GAME_END', `Team ${winnerId} won`, { victory: false, phase: 'game-lost', method: 'team-defeat', myTeam, winnerId })
+                  this.sendGameEnd(`Team ${winnerId} won`, { victory: false, phase: 'game-lost', method: 'team-defeat', myTeam, winnerId })
                   if (this.hud.isSoundEnabled('game_defeat')) {
                     this.ws.sendEvent('SOUND_PLAY', 'Defeat sound', { soundId: 'game_defeat', priority: 'high' })
                   }
@@ -192,7 +233,7 @@ export class GameBridge {
               } else {
                 // Fallback: team is null, assume defeat
                 console.warn('[GameBridge] myPlayer.team() returned null, assuming defeat')
-                this.ws.sendEvent('GAME_END', `Team ${winnerId} won`, { victory: false, phase: 'game-lost', method: 'team-defeat-fallback', myTeam: null, winnerId })
+                this.sendGameEnd(`Team ${winnerId} won`, { victory: false, phase: 'game-lost', method: 'team-defeat-fallback', myTeam: null, winnerId })
                 if (this.hud.isSoundEnabled('game_defeat')) {
                   this.ws.sendEvent('SOUND_PLAY', 'Defeat sound', { soundId: 'game_defeat', priority: 'high' })
                 }
@@ -205,13 +246,13 @@ export class GameBridge {
               console.log(`[GameBridge] My clientID: ${myClientID}, My smallID: ${mySmallID}, Winner ID: ${winnerId}`)
 
               if (myClientID !== null && winnerId === myClientID) {
-                this.ws.sendEvent('GAME_END', 'You won!', { victory: true, phase: 'game-won', method: 'solo-victory', myClientID, winnerId })
+                this.sendGameEnd('You won!', { victory: true, phase: 'game-won', method: 'solo-victory', myClientID, winnerId })
                 if (this.hud.isSoundEnabled('game_victory')) {
                   this.ws.sendEvent('SOUND_PLAY', 'Victory sound', { soundId: 'game_victory', priority: 'high' })
                 }
                 console.log('[GameBridge] ✓ You won!')
               } else {
-                this.ws.sendEvent('GAME_END', 'Another player won', { victory: false, phase: 'game-lost', method: 'solo-defeat', myClientID, winnerId })
+                this.sendGameEnd('Another player won', { victory: false, phase: 'game-lost', method: 'solo-defeat', myClientID, winnerId })
                 if (this.hud.isSoundEnabled('game_defeat')) {
                   this.ws.sendEvent('SOUND_PLAY', 'Defeat sound', { soundId: 'game_defeat', priority: 'high' })
                 }
@@ -243,7 +284,7 @@ export class GameBridge {
 
       if (!isAlive && !inSpawnPhase && hasSpawned) {
         // Player died during the game - immediate detection
-        this.ws.sendEvent('GAME_END', 'You died', { victory: false, phase: 'game-lost', reason: 'death' })
+        this.sendGameEnd('You died', { victory: false, phase: 'game-lost', reason: 'death' })
         if (this.hud.isSoundEnabled('game_player_death')) {
           this.ws.sendEvent('SOUND_PLAY', 'Player death sound', { soundId: 'game_player_death', priority: 'high' })
         }
@@ -262,13 +303,13 @@ export class GameBridge {
 
       // Game is over, send appropriate event
       if (winResult === true) {
-        this.ws.sendEvent('GAME_END', 'Victory!', { victory: true, phase: 'game-won', method: 'gameOver-fallback' })
+        this.sendGameEnd('Victory!', { victory: true, phase: 'game-won', method: 'gameOver-fallback' })
         if (this.hud.isSoundEnabled('game_victory')) {
           this.ws.sendEvent('SOUND_PLAY', 'Victory sound', { soundId: 'game_victory', priority: 'high' })
         }
         console.log('[GameBridge] ✓ Game ended - VICTORY! (fallback method)')
       } else {
-        this.ws.sendEvent('GAME_END', 'Defeat', { victory: false, phase: 'game-lost', method: 'gameOver-fallback' })
+        this.sendGameEnd('Defeat', { victory: false, phase: 'game-lost', method: 'gameOver-fallback' })
         if (this.hud.isSoundEnabled('game_defeat')) {
           this.ws.sendEvent('SOUND_PLAY', 'Defeat sound', { soundId: 'game_defeat', priority: 'high' })
         }
@@ -317,6 +358,7 @@ export class GameBridge {
           this.inGame = false
           this.inSpawning = false
           this.hasProcessedWin = false
+          this.endPhase = null
           console.log('[GameBridge] Player no longer in game')
         }
         this.clearTrackers()
@@ -329,6 +371,7 @@ export class GameBridge {
       // Detect spawning phase (player exists but game hasn't started)
       if (!this.inSpawning && !this.inGame && gameStarted === false) {
         this.inSpawning = true
+        this.endPhase = null
         this.ws.sendEvent('GAME_SPAWNING', 'Spawn countdown active', { spawning: true })
         console.log('[GameBridge] Spawning phase - countdown active')
         this.clearTrackers() // Clear any stale state
@@ -355,30 +398,19 @@ export class GameBridge {
       }
 
       try {
-        // Run all trackers
-        this.nukeTracker.detectLaunches(gameAPI, myPlayerID)
-        this.nukeTracker.detectExplosions(gameAPI)
-
-        this.boatTracker.detectLaunches(gameAPI, myPlayerID)
-        this.boatTracker.detectArrivals(gameAPI)
-
-        this.landTracker.detectLaunches(gameAPI)
-        this.landTracker.detectCompletions(gameAPI)
+        // Run all trackers (once per game tick)
+        const myPlayer = gameAPI.getMyPlayer()
+        if (myPlayer) {
+          this.trackerLoop.poll(gameAPI, myPlayer, myPlayerID)
+        }
       } catch (e) {
         console.error('[GameBridge] Error in polling loop:', e)
       }
     }, GAME_POLL_INTERVAL_MS)
   }
 
-  private handleTrackerEvent(event: GameEvent) {
-    // Forward event to WebSocket
-    this.ws.sendEvent(event.type, event.message || '', event.data)
-  }
-
   private clearTrackers() {
-    this.nukeTracker.clear()
-    this.boatTracker.clear()
-    this.landTracker.clear()
+    this.trackerLoop.clear()
     this.troopMonitor.stop()
   }
 
@@ -401,6 +433,13 @@ export class GameBridge {
       }
       // Type guard ensures params is defined and correctly typed
       this.handleSetAttackRatio(params!)
+    } else if (action === 'flow-control') {
+      // Device-side pacing for high-rate events
+      if (!isFlowControlParams(params)) {
+        logger.warn('flow-control command missing troopIntervalMs', params)
+        return
+      }
+      this.troopMonitor.setSendInterval(params!.troopIntervalMs)
     } else if (action === 'ping') {
       // Ping is already handled by WsClient, but we can log it
       logger.log('Ping received')
@@ -1,5 +1,6 @@
-import type { GameAPI } from './game-api'
-import type { GameEvent } from '../../../ots-shared/src/game'
+import type { GameAPI, UnitLike } from '../game-api'
+import type { Tracker, TrackerTick } from './tracker-loop'
+import { UnitIdIndex } from './unit-id-index'
 
 interface TrackedBoat {
   unitID: number
@@ -13,23 +14,10 @@ interface TrackedBoat {
   reported: boolean
 }
 
-export class BoatTracker {
+export class BoatTracker implements Tracker {
   private trackedBoats = new Map<number, TrackedBoat>()
-  private eventCallbacks: Array<(event: GameEvent) => void> = []
-
-  onEvent(callback: (event: GameEvent) => void) {
-    this.eventCallbacks.push(callback)
-  }
-
-  private emitEvent(event: GameEvent) {
-    this.eventCallbacks.forEach((cb) => {
-      try {
-        cb(event)
-      } catch (e) {
-        console.error('[BoatTracker] Error in event callback:', e)
-      }
-    })
-  }
+  // Every transport ship id on the map, tracked or not: each is classified once
+  private present = new UnitIdIndex()
 
   /**
    * Get target player ID from a tile
@@ -48,91 +36,88 @@ export class BoatTracker {
   }
 
   /**
-   * Detect new boat launches targeting the current player
+   * Diff this tick's transport ships against the last tick
+   *
+   * New ids are checked once for targeting the player; only tracked boats
+   * are checked for arrival; ids that vanished are resolved as destroyed.
    */
-  detectLaunches(gameAPI: GameAPI, myPlayerID: string) {
-    const transportShips = gameAPI.getUnits('Transport')
+  poll(t: TrackerTick) {
+    this.present.begin()
 
-    for (const boat of transportShips) {
+    for (const boat of t.gameAPI.getUnits('Transport')) {
       try {
         const boatId = typeof boat.id === 'function' ? boat.id() : null
-        if (!boatId || this.trackedBoats.has(boatId)) continue
-
-        const targetTile = typeof boat.targetTile === 'function' ? boat.targetTile() : null
-        const targetPlayerID = this.getTargetPlayerID(gameAPI, targetTile)
-
-        // Only track boats targeting the current player
-        if (targetPlayerID === myPlayerID) {
-          const owner = typeof boat.owner === 'function' ? boat.owner() : null
-          const troops = typeof boat.troops === 'function' ? boat.troops() : 0
-
-          const tracked: TrackedBoat = {
-            unitID: boatId,
-            ownerID: owner && typeof owner.id === 'function' ? owner.id() : 'unknown',
-            ownerName: owner && typeof owner.name === 'function' ? owner.name() : 'Unknown',
-            troops: troops,
-            targetTile: targetTile,
-            targetPlayerID: targetPlayerID,
-            launchedTick: gameAPI.getTicks() || 0,
-            hasReachedTarget: false,
-            reported: false
-          }
-
-          this.trackedBoats.set(boatId, tracked)
-          this.reportLaunch(tracked, gameAPI)
+        if (!boatId) continue
+
+        if (this.present.add(boatId)) {
+          this.classify(boat, boatId, t)
+          continue
         }
+
+        const tracked = this.trackedBoats.get(boatId)
+        if (tracked) this.checkReachedTarget(boat, tracked)
       } catch (e) {
         console.error('[BoatTracker] Error processing boat:', e)
       }
     }
+
+    for (const unitID of this.present.finish()) {
+      const tracked = this.trackedBoats.get(unitID)
+      if (!tracked) continue
+      if (!tracked.reported) {
+        // Unit was deleted before reaching target = destroyed
+        this.reportArrival(tracked, true)
+        tracked.reported = true
+      }
+      this.trackedBoats.delete(unitID)
+    }
   }
 
-  /**
-   * Detect boat arrivals or destructions
-   */
-  detectArrivals(gameAPI: GameAPI) {
-    for (const [unitID, tracked] of this.trackedBoats.entries()) {
-      try {
-        const unit = gameAPI.getUnit(unitID)
-
-        if (!unit) {
-          // Unit was deleted
-          if (!tracked.reported) {
-            // Unit was deleted before reaching target = destroyed
-            this.reportArrival(tracked, true, gameAPI)
-            tracked.reported = true
-          }
-          this.trackedBoats.delete(unitID)
-          continue
-        }
+  private classify(boat: UnitLike, boatId: number, t: TrackerTick) {
+    const targetTile = typeof boat.targetTile === 'function' ? boat.targetTile() : 0
+    const targetPlayerID = this.getTargetPlayerID(t.gameAPI, targetTile)
+
+    // Only track boats targeting the current player
+    if (targetPlayerID !== t.myPlayerID) return
+
+    const owner = typeof boat.owner === 'function' ? boat.owner() : null
+    const troops = typeof boat.troops === 'function' ? boat.troops() : 0
+
+    const tracked: TrackedBoat = {
+      unitID: boatId,
+      ownerID: owner && typeof owner.id === 'function' ? owner.id() : 'unknown',
+      ownerName: owner && typeof owner.name === 'function' ? owner.name() : 'Unknown',
+      troops: troops,
+      targetTile: targetTile,
+      targetPlayerID: targetPlayerID,
+      launchedTick: t.tick,
+      hasReachedTarget: false,
+      reported: false
+    }
 
-        // Check if boat reached target
-        const reachedTarget = typeof unit.reachedTarget === 'function' ? unit.reachedTarget() : false
-        if (reachedTarget && !tracked.hasReachedTarget) {
-          // Boat reached target = arrival!
-          tracked.hasReachedTarget = true
-          this.reportArrival(tracked, false, gameAPI)
-          tracked.reported = true
-          // Unit will be deleted next tick, but we've already reported
-        }
+    this.trackedBoats.set(boatId, tracked)
+    this.reportLaunch(tracked, t)
+  }
 
-        // Update state
-        tracked.hasReachedTarget = reachedTarget
-      } catch (e) {
-        console.error('[BoatTracker] Error checking boat arrival:', e)
-      }
+  private checkReachedTarget(unit: UnitLike, tracked: TrackedBoat) {
+    const reachedTarget = typeof unit.reachedTarget === 'function' ? unit.reachedTarget() : false
+    if (reachedTarget && !tracked.hasReachedTarget) {
+      // Boat reached target = arrival!
+      this.reportArrival(tracked, false)
+      tracked.reported = true
+      // Unit will be deleted next tick, but we've already reported
     }
+    tracked.hasReachedTarget = reachedTarget
   }
 
-  private reportLaunch(tracked: TrackedBoat, gameAPI: GameAPI) {
+  private reportLaunch(tracked: TrackedBoat, t: TrackerTick) {
     const coordinates = {
-      x: gameAPI.getX(tracked.targetTile),
-      y: gameAPI.getY(tracked.targetTile)
+      x: t.gameAPI.getX(tracked.targetTile),
+      y: t.gameAPI.getY(tracked.targetTile)
     }
 
-    const event: GameEvent = {
+    t.emit({
       type: 'ALERT_NAVAL',
-      timestamp: Date.now(),
       message: 'Naval invasion detected!',
       data: {
         type: 'boat',
@@ -145,12 +130,10 @@ export class BoatTracker {
         tick: tracked.launchedTick,
         coordinates
       }
-    }
-
-    this.emitEvent(event)
+    })
   }
 
-  private reportArrival(tracked: TrackedBoat, destroyed: boolean, gameAPI: GameAPI) {
+  private reportArrival(tracked: TrackedBoat, destroyed: boolean) {
     // We don't emit additional events for arrivals/destructions
     // The alert LED will stay active for its duration (15s) from the initial ALERT event
     // Just log for debugging
@@ -161,8 +144,19 @@ export class BoatTracker {
     }
   }
 
+  /**
+   * Number of transport ships still heading for the player (for state snapshots)
+   */
+  getActiveCount(): number {
+    let count = 0
+    for (const tracked of this.trackedBoats.values()) {
+      if (!tracked.reported) count++
+    }
+    return count
+  }
+
   clear() {
     this.trackedBoats.clear()
+    this.present.clear()
   }
 }
-
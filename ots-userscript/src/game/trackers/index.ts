@@ -7,3 +7,6 @@
 export { NukeTracker } from './nuke-tracker'
 export { BoatTracker } from './boat-tracker'
 export { LandAttackTracker } from './land-tracker'
+export { TrackerLoop } from './tracker-loop'
+export type { Tracker, TrackerTick, TrackerLoopStats } from './tracker-loop'
+export { UnitIdIndex } from './unit-id-index'
@@ -1,5 +1,6 @@
-import type { GameAPI } from './game-api'
-import type { GameEvent } from '../../../ots-shared/src/game'
+import type { GameAPI, IncomingAttackLike, PlayerLike } from '../game-api'
+import type { Tracker, TrackerTick } from './tracker-loop'
+import { UnitIdIndex } from './unit-id-index'
 
 interface TrackedAttack {
   attackID: number
@@ -13,28 +14,14 @@ interface TrackedAttack {
   reported: boolean
 }
 
-export class LandAttackTracker {
+export class LandAttackTracker implements Tracker {
   private trackedAttacks = new Map<number, TrackedAttack>()
-  private eventCallbacks: Array<(event: GameEvent) => void> = []
-
-  onEvent(callback: (event: GameEvent) => void) {
-    this.eventCallbacks.push(callback)
-  }
-
-  private emitEvent(event: GameEvent) {
-    this.eventCallbacks.forEach((cb) => {
-      try {
-        cb(event)
-      } catch (e) {
-        console.error('[LandAttackTracker] Error in event callback:', e)
-      }
-    })
-  }
+  private present = new UnitIdIndex()
 
   /**
    * Get player by smallID
    */
-  private getPlayerBySmallID(gameAPI: GameAPI, smallID: number): any | null {
+  private getPlayerBySmallID(gameAPI: GameAPI, smallID: number): PlayerLike | null {
     if (!smallID || smallID === 0) return null
     try {
       return gameAPI.getPlayerBySmallID(smallID)
@@ -44,88 +31,81 @@ export class LandAttackTracker {
   }
 
   /**
-   * Detect new land attack launches targeting the current player
+   * Diff this tick's incoming attacks against the last tick
+   *
+   * New attack ids are reported once, known ones only refresh their
+   * retreating flag, and ids that vanished completed or were cancelled.
    */
-  detectLaunches(gameAPI: GameAPI) {
-    const myPlayer = gameAPI.getMyPlayer()
-    if (!myPlayer) return
+  poll(t: TrackerTick) {
+    if (!t.mySmallID) return
 
+    let incomingAttacks: IncomingAttackLike[] = []
     try {
-      const incomingAttacks = typeof myPlayer.incomingAttacks === 'function' ? myPlayer.incomingAttacks() : []
-      const mySmallID = typeof myPlayer.smallID === 'function' ? myPlayer.smallID() : null
-
-      if (!mySmallID) return
-
-      for (const attack of incomingAttacks) {
-        try {
-          // Only track attacks targeting the current player (targetID matches my smallID)
-          if (attack.targetID === mySmallID && !this.trackedAttacks.has(attack.id)) {
-            const attacker = this.getPlayerBySmallID(gameAPI, attack.attackerID)
-
-            if (attacker) {
-              const tracked: TrackedAttack = {
-                attackID: attack.id,
-                attackerID: attack.attackerID,
-                attackerPlayerID: typeof attacker.id === 'function' ? attacker.id() : 'unknown',
-                attackerPlayerName: typeof attacker.name === 'function' ? attacker.name() : 'Unknown',
-                troops: attack.troops || 0,
-                targetPlayerID: typeof myPlayer.id === 'function' ? myPlayer.id() : 'unknown',
-                launchedTick: gameAPI.getTicks() || 0,
-                retreating: attack.retreating || false,
-                reported: false
-              }
-
-              this.trackedAttacks.set(attack.id, tracked)
-              this.reportLaunch(tracked, gameAPI)
-            }
-          }
-        } catch (e) {
-          console.error('[LandAttackTracker] Error processing attack:', e)
-        }
-      }
+      incomingAttacks = typeof t.myPlayer.incomingAttacks === 'function' ? t.myPlayer.incomingAttacks() : []
     } catch (e) {
       console.error('[LandAttackTracker] Error getting incoming attacks:', e)
+      return
     }
-  }
 
-  /**
-   * Detect land attack completions (when attacks disappear from incomingAttacks)
-   */
-  detectCompletions(gameAPI: GameAPI) {
-    const myPlayer = gameAPI.getMyPlayer()
-    if (!myPlayer) return
+    this.present.begin()
 
-    try {
-      const incomingAttacks = typeof myPlayer.incomingAttacks === 'function' ? myPlayer.incomingAttacks() : []
-      const activeAttackIDs = new Set(incomingAttacks.map((a: any) => a.id))
-
-      for (const [attackID, tracked] of this.trackedAttacks.entries()) {
-        if (!activeAttackIDs.has(attackID)) {
-          // Attack is no longer in incomingAttacks - it completed, was cancelled, or retreated
-          if (!tracked.reported) {
-            // Check if it was retreating when we last saw it
-            const wasCancelled = tracked.retreating
-            this.reportComplete(tracked, wasCancelled, gameAPI)
-            tracked.reported = true
-          }
-          this.trackedAttacks.delete(attackID)
-        } else {
-          // Update retreating status
-          const currentAttack = incomingAttacks.find((a: any) => a.id === attackID)
-          if (currentAttack) {
-            tracked.retreating = currentAttack.retreating || false
-          }
+    for (const attack of incomingAttacks) {
+      try {
+        // Only track attacks targeting the current player (targetID matches my smallID)
+        if (attack.targetID !== t.mySmallID) continue
+
+        if (this.present.add(attack.id)) {
+          this.classify(attack, t)
+          continue
         }
+
+        const tracked = this.trackedAttacks.get(attack.id)
+        if (tracked) tracked.retreating = attack.retreating || false
+      } catch (e) {
+        console.error('[LandAttackTracker] Error processing attack:', e)
       }
-    } catch (e) {
-      console.error('[LandAttackTracker] Error checking attack completions:', e)
     }
+
+    for (const attackID of this.present.finish()) {
+      const tracked = this.trackedAttacks.get(attackID)
+      if (!tracked) continue
+      // Attack is no longer in incomingAttacks - it completed, was cancelled, or retreated
+      if (!tracked.reported) {
+        // Check if it was retreating when we last saw it
+        this.reportComplete(tracked, tracked.retreating)
+        tracked.reported = true
+      }
+      this.trackedAttacks.delete(attackID)
+    }
+  }
+
+  private classify(attack: IncomingAttackLike, t: TrackerTick) {
+    const attacker = this.getPlayerBySmallID(t.gameAPI, attack.attackerID)
+    if (!attacker) {
+      // Attacker not resolvable yet; look at this attack again next tick
+      this.present.retry(attack.id)
+      return
+    }
+
+    const tracked: TrackedAttack = {
+      attackID: attack.id,
+      attackerID: attack.attackerID,
+      attackerPlayerID: typeof attacker.id === 'function' ? attacker.id() : 'unknown',
+      attackerPlayerName: typeof attacker.name === 'function' ? attacker.name() : 'Unknown',
+      troops: attack.troops || 0,
+      targetPlayerID: t.myPlayerID,
+      launchedTick: t.tick,
+      retreating: attack.retreating || false,
+      reported: false
+    }
+
+    this.trackedAttacks.set(attack.id, tracked)
+    this.reportLaunch(tracked, t)
   }
 
-  private reportLaunch(tracked: TrackedAttack, gameAPI: GameAPI) {
-    const event: GameEvent = {
+  private reportLaunch(tracked: TrackedAttack, t: TrackerTick) {
+    t.emit({
       type: 'ALERT_LAND',
-      timestamp: Date.now(),
       message: 'Land invasion detected!',
       data: {
         type: 'land',
@@ -136,12 +116,10 @@ export class LandAttackTracker {
         targetPlayerID: tracked.targetPlayerID,
         tick: tracked.launchedTick
       }
-    }
-
-    this.emitEvent(event)
+    })
   }
 
-  private reportComplete(tracked: TrackedAttack, wasCancelled: boolean, gameAPI: GameAPI) {
+  private reportComplete(tracked: TrackedAttack, wasCancelled: boolean) {
     // We don't emit additional events for completions/cancellations
     // The alert LED will stay active for its duration (15s) from the initial ALERT event
     // Just log for debugging
@@ -152,8 +130,15 @@ export class LandAttackTracker {
     }
   }
 
+  /**
+   * Number of land attacks currently targeting the player (for state snapshots)
+   */
+  getActiveCount(): number {
+    return this.trackedAttacks.size
+  }
+
   clear() {
     this.trackedAttacks.clear()
+    this.present.clear()
   }
 }
-
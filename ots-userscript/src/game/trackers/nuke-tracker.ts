@@ -1,5 +1,9 @@
-import type { GameAPI } from './game-api'
-import type { GameEvent } from '../../../ots-shared/src/game'
+import type { GameAPI, UnitLike } from '../game-api'
+import type { NukeType, SnapshotNuke } from '../../../../ots-shared/src/game'
+import type { Tracker, TrackerTick } from './tracker-loop'
+import { UnitIdIndex } from './unit-id-index'
+
+const NUKE_UNIT_TYPES = ['Atom Bomb', 'Hydrogen Bomb', 'MIRV', 'MIRV Warhead']
 
 interface TrackedNuke {
   unitID: number
@@ -14,23 +18,16 @@ interface TrackedNuke {
   isOutgoing: boolean // true if player launched it, false if incoming
 }
 
-export class NukeTracker {
-  private trackedNukes = new Map<number, TrackedNuke>()
-  private eventCallbacks: Array<(event: GameEvent) => void> = []
-
-  onEvent(callback: (event: GameEvent) => void) {
-    this.eventCallbacks.push(callback)
-  }
+function shortNukeType(type: string): NukeType {
+  if (type.includes('Hydrogen')) return 'hydro'
+  if (type.includes('MIRV')) return 'mirv'
+  return 'atom'
+}
 
-  private emitEvent(event: GameEvent) {
-    this.eventCallbacks.forEach((cb) => {
-      try {
-        cb(event)
-      } catch (e) {
-        console.error('[NukeTracker] Error in event callback:', e)
-      }
-    })
-  }
+export class NukeTracker implements Tracker {
+  private trackedNukes = new Map<number, TrackedNuke>()
+  // Every nuke id on the map, tracked or not: each is classified once
+  private present = new UnitIdIndex()
 
   /**
    * Get target player ID from a tile
@@ -49,123 +46,109 @@ export class NukeTracker {
   }
 
   /**
-   * Detect new nuke launches (both incoming and outgoing)
+   * Diff this tick's nukes against the last tick
+   *
+   * New ids are classified (incoming / outgoing / unrelated) once; only
+   * tracked nukes are checked for reaching their target; ids that vanished
+   * are resolved as exploded or intercepted.
    */
-  detectLaunches(gameAPI: GameAPI, myPlayerID: string) {
-    const nukeTypes = ['Atom Bomb', 'Hydrogen Bomb', 'MIRV', 'MIRV Warhead']
-    const allNukes = gameAPI.getUnits(...nukeTypes)
+  poll(t: TrackerTick) {
+    this.present.begin()
 
-    for (const nuke of allNukes) {
+    for (const nuke of t.gameAPI.getUnits(...NUKE_UNIT_TYPES)) {
       try {
         const nukeId = typeof nuke.id === 'function' ? nuke.id() : null
-        if (!nukeId || this.trackedNukes.has(nukeId)) continue
-
-        const owner = typeof nuke.owner === 'function' ? nuke.owner() : null
-        const ownerID = owner && typeof owner.id === 'function' ? owner.id() : 'unknown'
-        const targetTile = typeof nuke.targetTile === 'function' ? nuke.targetTile() : null
-        const targetPlayerID = this.getTargetPlayerID(gameAPI, targetTile)
-        const nukeType = typeof nuke.type === 'function' ? nuke.type() : 'Unknown'
-
-        // Track if it's incoming (targeting player) or outgoing (launched by player)
-        const isIncoming = targetPlayerID === myPlayerID
-        const isOutgoing = ownerID === myPlayerID
-
-        // Track both incoming and outgoing nukes
-        if (isIncoming || isOutgoing) {
-          const tracked: TrackedNuke = {
-            unitID: nukeId,
-            type: nukeType,
-            ownerID: ownerID,
-            ownerName: owner && typeof owner.name === 'function' ? owner.name() : 'Unknown',
-            targetTile: targetTile,
-            targetPlayerID: targetPlayerID || 'unknown',
-            launchedTick: gameAPI.getTicks() || 0,
-            hasReachedTarget: false,
-            reported: false,
-            isOutgoing: isOutgoing
-          }
-
-          this.trackedNukes.set(nukeId, tracked)
-          this.reportLaunch(tracked, gameAPI)
+        if (!nukeId) continue
+
+        if (this.present.add(nukeId)) {
+          this.classify(nuke, nukeId, t)
+          continue
         }
+
+        const tracked = this.trackedNukes.get(nukeId)
+        if (tracked) this.checkReachedTarget(nuke, tracked, t)
       } catch (e) {
         console.error('[NukeTracker] Error processing nuke:', e)
       }
     }
+
+    for (const unitID of this.present.finish()) {
+      const tracked = this.trackedNukes.get(unitID)
+      if (!tracked) continue
+      // Unit was deleted - either intercepted or exploded
+      if (!tracked.reported) {
+        // Check if it reached target before deletion
+        this.reportExplosion(tracked, !tracked.hasReachedTarget, t)
+        tracked.reported = true
+      }
+      this.trackedNukes.delete(unitID)
+    }
   }
 
-  /**
-   * Detect nuke explosions or interceptions
-   */
-  detectExplosions(gameAPI: GameAPI) {
-    for (const [unitID, tracked] of this.trackedNukes.entries()) {
-      try {
-        const unit = gameAPI.getUnit(unitID)
-
-        if (!unit) {
-          // Unit was deleted - either intercepted or exploded
-          if (!tracked.reported) {
-            // Check if it reached target before deletion
-            const intercepted = !tracked.hasReachedTarget
-            this.reportExplosion(tracked, intercepted, gameAPI)
-            tracked.reported = true
-          }
-          this.trackedNukes.delete(unitID)
-          continue
-        }
+  private classify(nuke: UnitLike, nukeId: number, t: TrackerTick) {
+    const owner = typeof nuke.owner === 'function' ? nuke.owner() : null
+    const ownerID = owner && typeof owner.id === 'function' ? owner.id() : 'unknown'
+    const targetTile = typeof nuke.targetTile === 'function' ? nuke.targetTile() : 0
+    const targetPlayerID = this.getTargetPlayerID(t.gameAPI, targetTile)
+    const nukeType = typeof nuke.type === 'function' ? nuke.type() : 'Unknown'
+
+    // Track if it's incoming (targeting player) or outgoing (launched by player)
+    const isIncoming = targetPlayerID === t.myPlayerID
+    const isOutgoing = ownerID === t.myPlayerID
+    if (!isIncoming && !isOutgoing) return
+
+    const tracked: TrackedNuke = {
+      unitID: nukeId,
+      type: nukeType,
+      ownerID: ownerID,
+      ownerName: owner && typeof owner.name === 'function' ? owner.name() : 'Unknown',
+      targetTile: targetTile,
+      targetPlayerID: targetPlayerID || 'unknown',
+      launchedTick: t.tick,
+      hasReachedTarget: false,
+      reported: false,
+      isOutgoing: isOutgoing
+    }
 
-        // Check if nuke reached target
-        const reachedTarget = typeof unit.reachedTarget === 'function' ? unit.reachedTarget() : false
-        if (reachedTarget && !tracked.hasReachedTarget) {
-          // Nuke reached target = explosion!
-          tracked.hasReachedTarget = true
-          this.reportExplosion(tracked, false, gameAPI)
-          tracked.reported = true
-          // Unit will be deleted next tick, but we've already reported
-        }
+    this.trackedNukes.set(nukeId, tracked)
+    this.reportLaunch(tracked, t)
+  }
 
-        // Update state
-        tracked.hasReachedTarget = reachedTarget
-      } catch (e) {
-        console.error('[NukeTracker] Error checking nuke explosion:', e)
-      }
+  private checkReachedTarget(unit: UnitLike, tracked: TrackedNuke, t: TrackerTick) {
+    const reachedTarget = typeof unit.reachedTarget === 'function' ? unit.reachedTarget() : false
+    if (reachedTarget && !tracked.hasReachedTarget) {
+      // Nuke reached target = explosion!
+      this.reportExplosion(tracked, false, t)
+      tracked.reported = true
+      // Unit will be deleted next tick, but we've already reported
     }
+    tracked.hasReachedTarget = reachedTarget
   }
 
-  private reportLaunch(tracked: TrackedNuke, gameAPI: GameAPI) {
+  private reportLaunch(tracked: TrackedNuke, t: TrackerTick) {
     const coordinates = {
-      x: gameAPI.getX(tracked.targetTile),
-      y: gameAPI.getY(tracked.targetTile)
+      x: t.gameAPI.getX(tracked.targetTile),
+      y: t.gameAPI.getY(tracked.targetTile)
     }
 
     if (tracked.isOutgoing) {
       // Player launched this nuke - report as outgoing launch
-      // Determine nuke type for data
-      let nukeTypeShort: 'atom' | 'hydro' | 'mirv' = 'atom'
-      if (tracked.type.includes('Hydrogen')) {
-        nukeTypeShort = 'hydro'
-      } else if (tracked.type.includes('MIRV')) {
-        nukeTypeShort = 'mirv'
-      }
-
-      const event: GameEvent = {
+      t.emit({
         type: 'NUKE_LAUNCHED',
-        timestamp: Date.now(),
         message: `${tracked.type} launched`,
         data: {
-          nukeType: nukeTypeShort,
+          nukeType: shortNukeType(tracked.type),
           nukeUnitID: tracked.unitID,
           targetTile: tracked.targetTile,
           targetPlayerID: tracked.targetPlayerID,
           tick: tracked.launchedTick,
           coordinates
         }
-      }
-      this.emitEvent(event)
+      })
       console.log('[NukeTracker] Player launched:', tracked.type, 'at', coordinates)
     } else {
       // Incoming nuke - report as alert
-      let eventType: 'ALERT_NUKE' | 'ALERT_HYDRO' | 'ALERT_MIRV' = 'ALERT_NUKE'
+      let eventType: 'ALERT_ATOM' | 'ALERT_HYDRO' | 'ALERT_MIRV' = 'ALERT_ATOM'
       let message = 'Incoming nuclear strike detected!'
 
       if (tracked.type.includes('Hydrogen')) {
@@ -176,9 +159,8 @@ export class NukeTracker {
         message = 'Incoming MIRV strike detected!'
       }
 
-      const event: GameEvent = {
+      t.emit({
         type: eventType,
-        timestamp: Date.now(),
         message: message,
         data: {
           nukeType: tracked.type,
@@ -190,64 +172,62 @@ export class NukeTracker {
           tick: tracked.launchedTick,
           coordinates
         }
-      }
-      this.emitEvent(event)
+      })
     }
   }
 
-  private reportExplosion(tracked: TrackedNuke, intercepted: boolean, gameAPI: GameAPI) {
+  private reportExplosion(tracked: TrackedNuke, intercepted: boolean, t: TrackerTick) {
+    const eventType: 'NUKE_EXPLODED' | 'NUKE_INTERCEPTED' = intercepted
+      ? 'NUKE_INTERCEPTED'
+      : 'NUKE_EXPLODED'
+
     if (tracked.isOutgoing) {
       // Player's nuke - use same event types as incoming for consistency
-      const eventType: 'NUKE_EXPLODED' | 'NUKE_INTERCEPTED' = intercepted
-        ? 'NUKE_INTERCEPTED'
-        : 'NUKE_EXPLODED'
-
-      const event: GameEvent = {
+      t.emit({
         type: eventType,
-        timestamp: Date.now(),
         message: intercepted ? `${tracked.type} intercepted` : `${tracked.type} exploded`,
         data: {
           nukeType: tracked.type,
           unitID: tracked.unitID,
           targetTile: tracked.targetTile,
           targetPlayerID: tracked.targetPlayerID,
-          tick: gameAPI.getTicks() || 0,
+          tick: t.tick,
           isOutgoing: true
         }
-      }
-      this.emitEvent(event)
+      })
       console.log('[NukeTracker] Player nuke', intercepted ? 'intercepted' : 'landed', ':', tracked.type)
     } else {
       // Incoming nuke
-      const eventType: 'NUKE_EXPLODED' | 'NUKE_INTERCEPTED' = intercepted
-        ? 'NUKE_INTERCEPTED'
-        : 'NUKE_EXPLODED'
-
-      const message = intercepted
-        ? 'Nuclear weapon intercepted'
-        : 'Nuclear weapon exploded'
-
-      const event: GameEvent = {
+      t.emit({
         type: eventType,
-        timestamp: Date.now(),
-        message: message,
+        message: intercepted ? 'Nuclear weapon intercepted' : 'Nuclear weapon exploded',
         data: {
           nukeType: tracked.type,
           unitID: tracked.unitID,
           ownerID: tracked.ownerID,
           ownerName: tracked.ownerName,
           targetTile: tracked.targetTile,
-          tick: gameAPI.getTicks() || 0
+          tick: t.tick
         }
-      }
-
-      this.emitEvent(event)
+      })
       console.log('[NukeTracker] Incoming nuke', intercepted ? 'intercepted' : 'exploded', ':', tracked.type)
     }
   }
 
+  /**
+   * Nukes still in flight (for state snapshots)
+   */
+  getInFlight(): SnapshotNuke[] {
+    const nukes: SnapshotNuke[] = []
+    for (const tracked of this.trackedNukes.values()) {
+      if (tracked.reported) continue
+      nukes.push([tracked.unitID, shortNukeType(tracked.type), tracked.isOutgoing ? 'out' : 'in'])
+    }
+    return nukes
+  }
+
   clear() {
     this.trackedNukes.clear()
+    this.present.clear()
   }
 }
-
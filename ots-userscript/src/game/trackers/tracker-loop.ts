@@ -0,0 +1,122 @@
+import type { GameAPI, PlayerLike } from '../game-api'
+import type { GameEvent } from '../../../../ots-shared/src/game'
+
+/**
+ * Per-tick state shared by all trackers
+ *
+ * Built once per game tick so trackers don't repeat the same player/tick
+ * lookups, and so every event of a tick carries the same timestamp.
+ */
+export type TrackerTick = {
+  gameAPI: GameAPI
+  tick: number
+  timestamp: number
+  myPlayer: PlayerLike
+  myPlayerID: string
+  mySmallID: number | null
+  emit(event: Omit<GameEvent, 'timestamp'>): void
+}
+
+export interface Tracker {
+  poll(tick: TrackerTick): void
+  clear(): void
+}
+
+export type TrackerLoopStats = {
+  /** Game ticks processed */
+  ticks: number
+  /** Polls skipped because the game had not advanced */
+  skipped: number
+  events: number
+  /** Ticks that produced at least one event (one send each) */
+  batches: number
+  lastPollMs: number
+  maxPollMs: number
+}
+
+function newStats(): TrackerLoopStats {
+  return { ticks: 0, skipped: 0, events: 0, batches: 0, lastPollMs: 0, maxPollMs: 0 }
+}
+
+/**
+ * Runs every tracker once per game tick and hands their events over together
+ */
+export class TrackerLoop {
+  private lastTick: number | null = null
+  private stats = newStats()
+  private batchCallbacks: Array<(events: GameEvent[]) => void> = []
+
+  constructor(private trackers: Tracker[]) { }
+
+  /**
+   * Register a callback for the events of one tick (never called with an empty list)
+   */
+  onEvents(callback: (events: GameEvent[]) => void) {
+    this.batchCallbacks.push(callback)
+  }
+
+  poll(gameAPI: GameAPI, myPlayer: PlayerLike, myPlayerID: string) {
+    const tick = gameAPI.getTicks()
+    // Units only change when the game advances; polls run faster than ticks
+    if (tick !== null && tick === this.lastTick) {
+      this.stats.skipped++
+      return
+    }
+    this.lastTick = tick
+
+    const started = performance.now()
+    const timestamp = Date.now()
+    const events: GameEvent[] = []
+    const context: TrackerTick = {
+      gameAPI,
+      tick: tick ?? 0,
+      timestamp,
+      myPlayer,
+      myPlayerID,
+      mySmallID: typeof myPlayer.smallID === 'function' ? myPlayer.smallID() : null,
+      emit: (event) => events.push({ ...event, timestamp })
+    }
+
+    for (const tracker of this.trackers) {
+      try {
+        tracker.poll(context)
+      } catch (e) {
+        console.error('[TrackerLoop] Error in tracker poll:', e)
+      }
+    }
+
+    const elapsed = performance.now() - started
+    this.stats.ticks++
+    this.stats.lastPollMs = elapsed
+    this.stats.maxPollMs = Math.max(this.stats.maxPollMs, elapsed)
+
+    if (events.length === 0) return
+
+    this.stats.events += events.length
+    this.stats.batches++
+    this.batchCallbacks.forEach((cb) => {
+      try {
+        cb(events)
+      } catch (e) {
+        console.error('[TrackerLoop] Error in event callback:', e)
+      }
+    })
+  }
+
+  getStats(): TrackerLoopStats {
+    return { ...this.stats }
+  }
+
+  clear() {
+    if (this.stats.ticks > 0) {
+      const s = this.stats
+      console.log(
+        `[TrackerLoop] ${s.ticks} ticks (${s.skipped} polls skipped), ${s.events} events in ${s.batches} batches,` +
+          ` max poll ${s.maxPollMs.toFixed(2)}ms`
+      )
+    }
+    this.lastTick = null
+    this.stats = newStats()
+    this.trackers.forEach((tracker) => tracker.clear())
+  }
+}
@@ -0,0 +1,67 @@
+/**
+ * Set of ids present in the current game tick, diffed against the previous one
+ *
+ * Trackers feed every id they see during a tick through add(); only ids that
+ * were not present last tick come back as new, and finish() returns the ids
+ * that disappeared. Expensive game lookups (owner, target tile, attacker) are
+ * then done once per unit instead of once per unit per poll.
+ */
+export class UnitIdIndex {
+  private previous = new Set<number>()
+  private current = new Set<number>()
+  private added = 0
+
+  /**
+   * Start a tick (the last tick's ids become the comparison baseline)
+   */
+  begin() {
+    const recycled = this.previous
+    this.previous = this.current
+    this.current = recycled
+    this.current.clear()
+    this.added = 0
+  }
+
+  /**
+   * Record an id seen this tick
+   *
+   * @returns true if the id was not present last tick
+   */
+  add(id: number): boolean {
+    if (this.current.has(id)) return false
+    this.current.add(id)
+    if (this.previous.has(id)) return false
+    this.added++
+    return true
+  }
+
+  /**
+   * Forget an id for this tick so the next tick reports it as new again
+   * (for entities that could not be classified yet)
+   */
+  retry(id: number) {
+    if (!this.previous.has(id) && this.current.delete(id)) this.added--
+  }
+
+  /**
+   * End the tick
+   *
+   * @returns ids present last tick but not in this one
+   */
+  finish(): number[] {
+    const removed: number[] = []
+    // Nothing new and the same size means nothing left either: the common
+    // case costs O(1) instead of a scan of last tick's ids
+    if (this.added === 0 && this.current.size === this.previous.size) return removed
+    for (const id of this.previous) {
+      if (!this.current.has(id)) removed.push(id)
+    }
+    return removed
+  }
+
+  clear() {
+    this.previous.clear()
+    this.current.clear()
+    this.added = 0
+  }
+}
@@ -1,9 +1,72 @@
 import type { GameAPI } from './game-api'
 import type { WsClient } from '../websocket/client'
+import type { TroopsData, TroopUpdateEventData } from '../../../ots-shared/src/game'
+import { PROTOCOL_CONSTANTS } from '../../../ots-shared/src/game'
+import { INPUT_LISTENER_RETRY_DELAY_MS, TROOP_POLL_INTERVAL_MS } from './constants'
 
 /**
- * Monitors troop data and sends updates only when values change
- * More efficient than polling every 500ms
+ * Smallest troop change the firmware LCD can show at this magnitude.
+ * Mirrors troops_format_count() in ots-fw-main/src/troops_module.c:
+ * exact below 1K, then one decimal place of K / M / B.
+ */
+export function troopDisplayStep(troops: number): number {
+  if (troops >= 1_000_000_000) return 100_000_000
+  if (troops >= 1_000_000) return 100_000
+  if (troops >= 1_000) return 100
+  return 1
+}
+
+/**
+ * Round a troop count down to what the LCD would display
+ */
+export function quantizeTroops(troops: number): number {
+  const step = troopDisplayStep(troops)
+  return Math.floor(troops / step) * step
+}
+
+/**
+ * Per-game TROOP_UPDATE counters
+ */
+export type TroopMonitorStats = {
+  /** Polls where any raw value changed (one message each before delta/quantize) */
+  rawChanges: number
+  /** TROOP_UPDATE messages actually sent */
+  sent: number
+  /** Raw changes that were not visible on the device display */
+  belowResolution: number
+  /** Polls where a visible change waited for the device's send interval */
+  paced: number
+  /** Send interval in effect at the end of the game */
+  intervalMs: number
+}
+
+// Device-side values (already divided by 10) as of the last TROOP_UPDATE
+type SentTroopState = {
+  currentTroops: number
+  maxTroops: number
+  attackRatio: number
+  attackRatioPercent: number
+  troopsToSend: number
+}
+
+function toDeviceUnits(troops: number): number {
+  // Game returns 10x the real amount
+  return Math.floor(troops / 10)
+}
+
+function newStats(intervalMs: number): TroopMonitorStats {
+  return { rawChanges: 0, sent: 0, belowResolution: 0, paced: 0, intervalMs }
+}
+
+/**
+ * Monitors troop data and sends updates only when the device display would change
+ *
+ * - Polls at game tick rate (100ms); reading the game is cheap, sending is not
+ * - Compares values at LCD resolution (see quantizeTroops), so growth that
+ *   does not change a displayed digit is not sent
+ * - Sends only the fields that changed since the last update
+ * - Paces troop-count updates to the interval the device asks for with the
+ *   `flow-control` command; attack ratio changes (user input) go out immediately
  */
 export class TroopMonitor {
   private pollInterval: number | null = null
@@ -12,6 +75,11 @@ export class TroopMonitor {
   private lastAttackRatio: number | null = null
   private lastTroopsToSend: number | null = null
 
+  private sent: SentTroopState | null = null
+  private lastSentAt = 0
+  private intervalMs: number = PROTOCOL_CONSTANTS.TROOP_UPDATE_DEFAULT_INTERVAL_MS
+  private stats: TroopMonitorStats = newStats(this.intervalMs)
+
   // Track localStorage for attack ratio changes
   private storageListener: ((e: StorageEvent) => void) | null = null
 
@@ -22,17 +90,20 @@ export class TroopMonitor {
 
   /**
    * Start monitoring for changes
-   * Polls at game tick rate (100ms) but only sends when values actually change
+   * Polls at game tick rate (100ms) but only sends when the display would change
    */
   start() {
     if (this.pollInterval) return
 
     console.log('[TroopMonitor] Starting change detection')
 
-    // Poll at game tick rate (100ms) for efficient change detection
+    this.sent = null
+    this.lastSentAt = 0
+    this.stats = newStats(this.intervalMs)
+
     this.pollInterval = window.setInterval(() => {
       this.checkForChanges()
-    }, 100)
+    }, TROOP_POLL_INTERVAL_MS)
 
     // Listen for localStorage changes (attack ratio slider)
     this.storageListener = (event: StorageEvent) => {
@@ -47,12 +118,12 @@ export class TroopMonitor {
     // Watch DOM input for attack ratio changes
     this.interceptAttackRatioChanges()
 
-    // Force initial data read and send
+    // Force initial data read and send (full update: nothing sent yet)
     this.checkForChanges(true)
   }
 
   /**
-   * Stop monitoring
+   * Stop monitoring and report how many messages the game needed
    */
   stop() {
     if (this.pollInterval) {
@@ -65,11 +136,42 @@ export class TroopMonitor {
       this.storageListener = null
     }
 
+    if (this.stats.rawChanges > 0) {
+      const { rawChanges, sent } = this.stats
+      const saved = Math.round((1 - sent / rawChanges) * 100)
+      console.log(
+        `[TroopMonitor] TROOP_UPDATE: ${sent} sent for ${rawChanges} raw changes (${saved}% fewer),` +
+          ` ${this.stats.belowResolution} below display resolution, ${this.stats.paced} paced` +
+          ` at ${this.stats.intervalMs}ms`
+      )
+      this.ws.sendInfo('troop-update-stats', { ...this.stats })
+      this.stats = newStats(this.intervalMs)
+    }
+
     console.log('[TroopMonitor] Stopped')
   }
 
   /**
-   * Check if any values have changed and send update if they have
+   * Apply the minimum TROOP_UPDATE interval requested by the device
+   */
+  setSendInterval(intervalMs: number) {
+    const clamped = Math.min(
+      PROTOCOL_CONSTANTS.TROOP_UPDATE_MAX_INTERVAL_MS,
+      Math.max(PROTOCOL_CONSTANTS.TROOP_UPDATE_MIN_INTERVAL_MS, Math.round(intervalMs))
+    )
+    if (clamped !== this.intervalMs) {
+      console.log(`[TroopMonitor] Send interval ${this.intervalMs}ms → ${clamped}ms (device flow-control)`)
+      this.intervalMs = clamped
+    }
+    this.stats.intervalMs = clamped
+  }
+
+  getStats(): TroopMonitorStats {
+    return { ...this.stats }
+  }
+
+  /**
+   * Read the game and send an update if the device display would change
    */
   private checkForChanges(forceRatioUpdate = false) {
     if (!this.gameAPI.isValid()) {
@@ -79,6 +181,7 @@ export class TroopMonitor {
         this.lastMaxTroops = null
         this.lastAttackRatio = null
         this.lastTroopsToSend = null
+        this.sent = null
       }
       return
     }
@@ -88,49 +191,84 @@ export class TroopMonitor {
     const attackRatio = this.gameAPI.getAttackRatio()
     const troopsToSend = this.gameAPI.getTroopsToSend()
 
-    // Check if any value changed
-    const troopsChanged = currentTroops !== this.lastCurrentTroops
-    const maxChanged = maxTroops !== this.lastMaxTroops
-    const ratioChanged = attackRatio !== this.lastAttackRatio || forceRatioUpdate
-    const toSendChanged = troopsToSend !== this.lastTroopsToSend
-
-    if (troopsChanged || maxChanged || ratioChanged || toSendChanged) {
-      // Log what changed
-      const changes: string[] = []
-      if (troopsChanged) changes.push(`troops: ${this.lastCurrentTroops} → ${currentTroops}`)
-      if (maxChanged) changes.push(`max: ${this.lastMaxTroops} → ${maxTroops}`)
-      if (ratioChanged) changes.push(`ratio: ${this.lastAttackRatio} → ${attackRatio}`)
-      if (toSendChanged) changes.push(`toSend: ${this.lastTroopsToSend} → ${troopsToSend}`)
-
-      console.log('[TroopMonitor] Changes detected:', changes.join(', '))
-
-      // Update stored values
-      this.lastCurrentTroops = currentTroops
-      this.lastMaxTroops = maxTroops
-      this.lastAttackRatio = attackRatio
-      this.lastTroopsToSend = troopsToSend
-
-      // Send update
-      this.sendUpdate()
+    const rawChanged =
+      currentTroops !== this.lastCurrentTroops ||
+      maxTroops !== this.lastMaxTroops ||
+      attackRatio !== this.lastAttackRatio ||
+      troopsToSend !== this.lastTroopsToSend
+
+    this.lastCurrentTroops = currentTroops
+    this.lastMaxTroops = maxTroops
+    this.lastAttackRatio = attackRatio
+    this.lastTroopsToSend = troopsToSend
+
+    if (currentTroops === null || maxTroops === null) {
+      return
+    }
+
+    if (rawChanged) this.stats.rawChanges++
+
+    const next: SentTroopState = {
+      currentTroops: toDeviceUnits(currentTroops),
+      maxTroops: toDeviceUnits(maxTroops),
+      attackRatio,
+      attackRatioPercent: Math.round(attackRatio * 100),
+      troopsToSend: troopsToSend !== null ? toDeviceUnits(troopsToSend) : 0
     }
+
+    const ratioChanged = this.sent === null || next.attackRatioPercent !== this.sent.attackRatioPercent
+    if (!forceRatioUpdate && !ratioChanged) {
+      if (!this.displayChanged(next)) {
+        if (rawChanged) this.stats.belowResolution++
+        return
+      }
+      if (Date.now() - this.lastSentAt < this.intervalMs) {
+        // Still visible on the next poll after the interval; no timer needed
+        this.stats.paced++
+        return
+      }
+    }
+
+    this.sendUpdate(next, forceRatioUpdate)
   }
 
   /**
-   * Send current troop data to WebSocket
+   * Would the firmware LCD show anything different from the last update?
+   * Line 1 is "current / max", line 2 is "pct% (current * pct / 100)".
    */
-  private sendUpdate() {
-    // Divide troops by 10 since game returns 10x the real amount
-    const data = {
-      currentTroops: this.lastCurrentTroops !== null ? Math.floor(this.lastCurrentTroops / 10) : null,
-      maxTroops: this.lastMaxTroops !== null ? Math.floor(this.lastMaxTroops / 10) : null,
-      attackRatio: this.lastAttackRatio,
-      attackRatioPercent: this.lastAttackRatio !== null ? Math.round(this.lastAttackRatio * 100) : null,
-      troopsToSend: this.lastTroopsToSend !== null ? Math.floor(this.lastTroopsToSend / 10) : null,
-      timestamp: Date.now()
+  private displayChanged(next: SentTroopState): boolean {
+    const sent = this.sent
+    if (sent === null) return true
+
+    const calc = (s: SentTroopState) => Math.floor((s.currentTroops * s.attackRatioPercent) / 100)
+    return (
+      quantizeTroops(next.currentTroops) !== quantizeTroops(sent.currentTroops) ||
+      quantizeTroops(next.maxTroops) !== quantizeTroops(sent.maxTroops) ||
+      quantizeTroops(calc(next)) !== quantizeTroops(calc(sent))
+    )
+  }
+
+  /**
+   * Send the fields that differ from the last update (all of them the first time)
+   */
+  private sendUpdate(next: SentTroopState, includeRatio: boolean) {
+    const prev = this.sent
+    const data: TroopUpdateEventData = { timestamp: Date.now() }
+
+    // Exact values: the device formats them, we only decide when to send
+    if (prev === null || next.currentTroops !== prev.currentTroops) data.currentTroops = next.currentTroops
+    if (prev === null || next.maxTroops !== prev.maxTroops) data.maxTroops = next.maxTroops
+    if (prev === null || includeRatio || next.attackRatio !== prev.attackRatio) {
+      data.attackRatio = next.attackRatio
+      data.attackRatioPercent = next.attackRatioPercent
     }
+    if (prev === null || next.troopsToSend !== prev.troopsToSend) data.troopsToSend = next.troopsToSend
+
+    this.sent = next
+    this.lastSentAt = data.timestamp
+    this.stats.sent++
 
     this.ws.sendEvent('TROOP_UPDATE', 'Troop data changed', data)
-    console.log('[TroopMonitor] Sent update:', data)
   }
 
   /**
@@ -169,6 +307,23 @@ export class TroopMonitor {
     attachInputListener()
   }
 
+  /**
+   * Troop fields for a state snapshot, in the same units as TROOP_UPDATE
+   */
+  getSnapshotState(): { troops?: TroopsData; attackRatio?: number } {
+    const state: { troops?: TroopsData; attackRatio?: number } = {}
+    if (this.lastCurrentTroops !== null && this.lastMaxTroops !== null) {
+      state.troops = {
+        current: toDeviceUnits(this.lastCurrentTroops),
+        max: toDeviceUnits(this.lastMaxTroops)
+      }
+    }
+    if (this.lastAttackRatio !== null) {
+      state.attackRatio = this.lastAttackRatio
+    }
+    return state
+  }
+
   /**
    * Get current troop data snapshot
    */
@@ -156,6 +156,10 @@ export class LogsTab {
       } else if (jsonObj.type === 'state') {
         // State message
         summary = 'State update'
+      } else if (jsonObj.type === 'batch' && Array.isArray(jsonObj.payload?.events)) {
+        // Batch message: list the contained event types
+        const types = jsonObj.payload.events.map((e: any) => e?.type || '?')
+        summary = `Batch: ${types.length} events (${types.join(', ')})`
       } else if (jsonObj.type === 'handshake') {
         summary = `Handshake: ${jsonObj.clientType || 'unknown'}`
       } else {
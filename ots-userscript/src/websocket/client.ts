@@ -1,9 +1,13 @@
 import type {
+  BatchMessage,
   CmdMessage,
   EventMessage,
+  GameEvent,
   GameEventType,
+  GameSnapshot,
   GameState,
   HandshakeMessage,
+  SnapshotMessage,
   StateMessage,
   WsMessage,
   WsStatus
@@ -27,6 +31,9 @@ function parseWsMessage(raw: string): WsMessage | null {
   }
 }
 
+/** Snapshot fields owned by the game side; the client fills in version/seq/timestamp */
+export type SnapshotState = Omit<GameSnapshot, 'version' | 'seq' | 'timestamp'>
+
 function debugLog(...args: unknown[]) {
   // eslint-disable-next-line no-console
   console.log('[OTS Userscript]', ...args)
@@ -38,6 +45,9 @@ export class WsClient {
   private reconnectDelay = DEFAULT_RECONNECT_DELAY_MS
   private heartbeatInterval: number | null = null
   private shouldReconnect = true
+  // Event sequence number: lets receivers detect dropped events
+  private seq = 0
+  private snapshotProvider: (() => SnapshotState) | null = null
 
   constructor(
     private hud: Hud,
@@ -91,6 +101,9 @@ export class WsClient {
 
       this.sendInfo(PROTOCOL_CONSTANTS.INFO_MESSAGE_USERSCRIPT_CONNECTED, { url: window.location.href })
 
+      // Give the receiver the full state; it may have missed events while disconnected
+      this.sendSnapshot('connect')
+
       // Start periodic heartbeat (every 15 seconds) for stale detection
       this.startHeartbeat()
     })
@@ -198,9 +211,60 @@ export class WsClient {
         type,
         timestamp: Date.now(),
         message,
-        data
+        data,
+        seq: ++this.seq
+      }
+    }
+    this.safeSend(msg)
+  }
+
+  /**
+   * Send the events of one game tick in as few frames as possible
+   *
+   * Events keep their own timestamps and get consecutive seq numbers, so a
+   * receiver handles a batch exactly like the same events sent one by one.
+   */
+  sendEvents(events: GameEvent[]) {
+    if (events.length === 1) {
+      const [event] = events
+      this.sendEvent(event.type, event.message || '', event.data)
+      return
+    }
+
+    for (let i = 0; i < events.length; i += PROTOCOL_CONSTANTS.BATCH_MAX_EVENTS) {
+      const chunk = events.slice(i, i + PROTOCOL_CONSTANTS.BATCH_MAX_EVENTS)
+      const msg: BatchMessage = {
+        type: 'batch',
+        payload: {
+          events: chunk.map((event) => ({
+            type: event.type,
+            timestamp: event.timestamp,
+            message: event.message || '',
+            data: event.data,
+            seq: ++this.seq
+          }))
+        }
+      }
+      this.safeSend(msg)
+    }
+  }
+
+  setSnapshotProvider(provider: () => SnapshotState) {
+    this.snapshotProvider = provider
+  }
+
+  sendSnapshot(reason: string) {
+    if (!this.snapshotProvider) return
+    const msg: SnapshotMessage = {
+      type: 'snapshot',
+      payload: {
+        version: PROTOCOL_CONSTANTS.SNAPSHOT_VERSION,
+        seq: this.seq,
+        timestamp: Date.now(),
+        ...this.snapshotProvider()
       }
     }
+    debugLog('Sending state snapshot:', reason)
     this.safeSend(msg)
   }
 
@@ -247,6 +311,9 @@ export class WsClient {
 
       if (action === 'ping') {
         this.sendInfo('pong-from-userscript')
+      } else if (action === 'request-snapshot') {
+        const reason = isRecord(params) && typeof params.reason === 'string' ? params.reason : 'request'
+        this.sendSnapshot(reason)
       } else if (this.onCommand) {
         // Forward command to the game bridge
         this.onCommand(action, params)